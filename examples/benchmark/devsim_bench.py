@@ -0,0 +1,572 @@
+# Copyright 2026 DEVSIM LLC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+####
+#### devsim_bench.py
+#### canonical diode and MOSFET workloads for performance tracking
+####
+#### Each case runs in its own process, so that peak memory is measured per case.
+#### The per-phase Newton timings are taken from the solve(info=True, timing=True) result.
+####
+import argparse
+import json
+import math
+import os
+import platform
+import subprocess
+import sys
+import time
+
+RESULT_MARKER = "DEVSIM_BENCH_RESULT "
+
+WORKLOADS = ("diode_1d", "diode_2d", "diode_3d", "mos_2d")
+ANALYSES = ("dc", "transient", "ac", "noise")
+
+DIODE_LENGTH = 1e-5
+DIODE_DOPING = 1e18
+
+
+def peak_rss_bytes():
+    try:
+        import resource
+    except ImportError:
+        return None
+    rss = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    # kilobytes on Linux, bytes on macOS
+    if sys.platform == "darwin":
+        return rss
+    return 1024 * rss
+
+
+class Case:
+    def __init__(self, workload, unknowns, threads, analyses):
+        self.workload = workload
+        self.unknowns = unknowns
+        self.threads = threads
+        self.analyses = analyses
+        self.device = "bench"
+        self.timings = []
+        self.wall = {}
+
+    def timed(self, name, function, *args, **kwargs):
+        tic = time.perf_counter()
+        ret = function(*args, **kwargs)
+        self.wall[name] = self.wall.get(name, 0.0) + time.perf_counter() - tic
+        return ret
+
+    def solve(self, analysis, **kwargs):
+        import devsim
+
+        # small signal solves do not return newton information
+        small_signal = kwargs.get("type") in ("ac", "noise")
+        tic = time.perf_counter()
+        if small_signal:
+            res = devsim.solve(**kwargs)
+        else:
+            res = devsim.solve(info=True, timing=True, **kwargs)
+        wall = time.perf_counter() - tic
+        self.wall[analysis] = self.wall.get(analysis, 0.0) + wall
+        if res and "timing" in res:
+            entry = {
+                "analysis": analysis,
+                "converged": res["converged"],
+                "iterations": len(res["iterations"]),
+                "timing": res["timing"],
+            }
+            if "number_of_blocks" in res:
+                entry["number_of_blocks"] = res["number_of_blocks"]
+            self.timings.append(entry)
+        return res
+
+
+####
+#### meshes
+####
+def create_1d_diode(case, nodes):
+    import devsim
+
+    spacing = DIODE_LENGTH / max(nodes - 1, 1)
+    devsim.create_1d_mesh(mesh="dio")
+    devsim.add_1d_mesh_line(mesh="dio", pos=0, ps=spacing, tag="top")
+    devsim.add_1d_mesh_line(mesh="dio", pos=DIODE_LENGTH, ps=spacing, tag="bot")
+    devsim.add_1d_contact(mesh="dio", name="top", tag="top", material="metal")
+    devsim.add_1d_contact(mesh="dio", name="bot", tag="bot", material="metal")
+    devsim.add_1d_region(
+        mesh="dio", material="Si", region="bulk", tag1="top", tag2="bot"
+    )
+    devsim.finalize_mesh(mesh="dio")
+    devsim.create_device(mesh="dio", device=case.device)
+    return ["bulk"]
+
+
+def create_2d_diode(case, nodes):
+    import devsim
+
+    n = max(int(math.sqrt(nodes)), 2)
+    spacing = DIODE_LENGTH / (n - 1)
+    devsim.create_2d_mesh(mesh="dio")
+    for d in ("x", "y"):
+        devsim.add_2d_mesh_line(mesh="dio", dir=d, pos=0, ps=spacing)
+        devsim.add_2d_mesh_line(mesh="dio", dir=d, pos=DIODE_LENGTH, ps=spacing)
+    devsim.add_2d_region(mesh="dio", material="Si", region="bulk")
+    for name, x in (("top", 0), ("bot", DIODE_LENGTH)):
+        devsim.add_2d_contact(
+            mesh="dio",
+            name=name,
+            material="metal",
+            region="bulk",
+            xl=x,
+            xh=x,
+            bloat=1e-10,
+        )
+    devsim.finalize_mesh(mesh="dio")
+    devsim.create_device(mesh="dio", device=case.device)
+    return ["bulk"]
+
+
+def create_3d_diode(case, nodes):
+    """
+    structured tetrahedral mesh
+    passed to create_gmsh_mesh directly, so that gmsh is not required
+    """
+    import devsim
+
+    n = max(int(round(nodes ** (1.0 / 3.0))), 2)
+    spacing = DIODE_LENGTH / (n - 1)
+
+    def index(i, j, k):
+        return i + n * (j + n * k)
+
+    coordinates = []
+    for k in range(n):
+        for j in range(n):
+            for i in range(n):
+                coordinates.extend((i * spacing, j * spacing, k * spacing))
+
+    physical_names = ["bulk", "top", "bot"]
+    elements = []
+    # each cube is split into 6 tetrahedra sharing the main diagonal
+    for k in range(n - 1):
+        for j in range(n - 1):
+            for i in range(n - 1):
+                c = [
+                    index(i + (v & 1), j + ((v >> 1) & 1), k + ((v >> 2) & 1))
+                    for v in range(8)
+                ]
+                for a, b in ((1, 3), (3, 2), (2, 6), (6, 4), (4, 5), (5, 1)):
+                    elements.extend((3, 0, c[0], c[a], c[b], c[7]))
+    # contacts on the x faces
+    for name, i in ((1, 0), (2, n - 1)):
+        for k in range(n - 1):
+            for j in range(n - 1):
+                f = (
+                    index(i, j, k),
+                    index(i, j + 1, k),
+                    index(i, j, k + 1),
+                    index(i, j + 1, k + 1),
+                )
+                elements.extend((2, name, f[0], f[1], f[3]))
+                elements.extend((2, name, f[0], f[3], f[2]))
+
+    devsim.create_gmsh_mesh(
+        mesh="dio",
+        coordinates=coordinates,
+        physical_names=physical_names,
+        elements=elements,
+    )
+    devsim.add_gmsh_region(mesh="dio", gmsh_name="bulk", region="bulk", material="Si")
+    for name in ("top", "bot"):
+        devsim.add_gmsh_contact(
+            mesh="dio", gmsh_name=name, region="bulk", material="metal", name=name
+        )
+    devsim.finalize_mesh(mesh="dio")
+    devsim.create_device(mesh="dio", device=case.device)
+    return ["bulk"]
+
+
+def create_2d_mos(case, nodes):
+    """
+    the bulk region is scaled to the number of nodes
+    the oxide has a fixed number of layers
+    """
+    import devsim
+
+    width = 1.0e-5
+    depth = 0.5e-5
+    tox = 1e-6
+    ny = max(int(math.sqrt(nodes / 2.0)), 4)
+    nx = max(nodes // ny, 4)
+    xs = width / (nx - 1)
+    ys = depth / (ny - 1)
+
+    devsim.create_2d_mesh(mesh="mos")
+    # the oxide only covers the channel, keeping source and drain off the interface
+    for x in (0, 0.25 * width, 0.75 * width, width):
+        devsim.add_2d_mesh_line(mesh="mos", dir="x", pos=x, ps=xs)
+    devsim.add_2d_mesh_line(mesh="mos", dir="y", pos=-tox, ps=tox / 4)
+    devsim.add_2d_mesh_line(mesh="mos", dir="y", pos=0, ps=ys)
+    devsim.add_2d_mesh_line(mesh="mos", dir="y", pos=depth, ps=ys)
+    devsim.add_2d_region(
+        mesh="mos",
+        material="Oxide",
+        region="oxide",
+        xl=0.25 * width,
+        xh=0.75 * width,
+        yl=-tox,
+        yh=0,
+    )
+    devsim.add_2d_region(mesh="mos", material="Si", region="bulk", yl=0, yh=depth)
+    devsim.add_2d_contact(
+        mesh="mos",
+        name="gate",
+        region="oxide",
+        yl=-tox,
+        yh=-tox,
+        material="metal",
+    )
+    devsim.add_2d_contact(
+        mesh="mos", name="body", region="bulk", yl=depth, yh=depth, material="metal"
+    )
+    devsim.add_2d_contact(
+        mesh="mos",
+        name="source",
+        region="bulk",
+        yl=0,
+        yh=0,
+        xl=0,
+        xh=0.2 * width,
+        material="metal",
+    )
+    devsim.add_2d_contact(
+        mesh="mos",
+        name="drain",
+        region="bulk",
+        yl=0,
+        yh=0,
+        xl=0.8 * width,
+        xh=width,
+        material="metal",
+    )
+    devsim.add_2d_interface(
+        mesh="mos", name="bulk_oxide", region0="bulk", region1="oxide"
+    )
+    devsim.finalize_mesh(mesh="mos")
+    devsim.create_device(mesh="mos", device=case.device)
+    return ["bulk", "oxide"]
+
+
+####
+#### physics
+####
+def setup_diode(case, circuit):
+    import devsim
+    from devsim.python_packages.model_create import CreateNodeModel, CreateSolution
+    from devsim.python_packages import simple_physics as sp
+
+    device = case.device
+    region = "bulk"
+    circuit_contacts = ["top"] if circuit else []
+    if circuit:
+        devsim.circuit_element(
+            name="V1",
+            n1=sp.GetContactBiasName("top"),
+            n2=0,
+            value=0.0,
+            acreal=1.0,
+            acimag=0.0,
+        )
+
+    sp.SetSiliconParameters(device, region, 300)
+    CreateNodeModel(
+        device,
+        region,
+        "NetDoping",
+        "%g*(step(x-%g)-step(%g-x))"
+        % (DIODE_DOPING, 0.5 * DIODE_LENGTH, 0.5 * DIODE_LENGTH),
+    )
+
+    CreateSolution(device, region, "Potential")
+    sp.CreateSiliconPotentialOnly(device, region)
+    for c in devsim.get_contact_list(device=device):
+        if c not in circuit_contacts:
+            devsim.set_parameter(
+                device=device, name=sp.GetContactBiasName(c), value=0.0
+            )
+        sp.CreateSiliconPotentialOnlyContact(device, region, c, c in circuit_contacts)
+
+    case.solve(
+        "dc", type="dc", absolute_error=1.0, relative_error=1e-10, maximum_iterations=30
+    )
+
+    CreateSolution(device, region, "Electrons")
+    CreateSolution(device, region, "Holes")
+    devsim.set_node_values(
+        device=device, region=region, name="Electrons", init_from="IntrinsicElectrons"
+    )
+    devsim.set_node_values(
+        device=device, region=region, name="Holes", init_from="IntrinsicHoles"
+    )
+    sp.CreateSiliconDriftDiffusion(device, region)
+    for c in devsim.get_contact_list(device=device):
+        sp.CreateSiliconDriftDiffusionAtContact(
+            device, region, c, c in circuit_contacts
+        )
+
+
+def setup_mos(case):
+    import devsim
+    from devsim.python_packages.model_create import CreateNodeModel, CreateSolution
+    from devsim.python_packages import simple_physics as sp
+
+    device = case.device
+    sp.SetSiliconParameters(device, "bulk", 300)
+    sp.SetOxideParameters(device, "oxide", 300)
+    CreateNodeModel(
+        device,
+        "bulk",
+        "NetDoping",
+        "1e20*(step(2e-6-x)+step(x-8e-6))*exp(-y/1e-7)-1e16",
+    )
+
+    for region in ("bulk", "oxide"):
+        CreateSolution(device, region, "Potential")
+    sp.CreateSiliconPotentialOnly(device, "bulk")
+    sp.CreateOxidePotentialOnly(device, "oxide", "log_damp")
+    for c in devsim.get_contact_list(device=device):
+        devsim.set_parameter(device=device, name=sp.GetContactBiasName(c), value=0.0)
+        if c == "gate":
+            sp.CreateOxideContact(device, "oxide", c)
+        else:
+            sp.CreateSiliconPotentialOnlyContact(device, "bulk", c)
+    sp.CreateSiliconOxideInterface(device, "bulk_oxide")
+
+    case.solve(
+        "dc", type="dc", absolute_error=1.0, relative_error=1e-10, maximum_iterations=40
+    )
+
+    CreateSolution(device, "bulk", "Electrons")
+    CreateSolution(device, "bulk", "Holes")
+    devsim.set_node_values(
+        device=device, region="bulk", name="Electrons", init_from="IntrinsicElectrons"
+    )
+    devsim.set_node_values(
+        device=device, region="bulk", name="Holes", init_from="IntrinsicHoles"
+    )
+    sp.CreateSiliconDriftDiffusion(device, "bulk")
+    for c in devsim.get_contact_list(device=device):
+        if c != "gate":
+            sp.CreateSiliconDriftDiffusionAtContact(device, "bulk", c)
+
+
+def count_unknowns(device, regions):
+    import devsim
+
+    ret = 0
+    for region in regions:
+        nodes = len(
+            devsim.get_node_model_values(device=device, region=region, name="x")
+        )
+        ret += nodes * len(devsim.get_equation_list(device=device, region=region))
+    return ret
+
+
+def run_case(case):
+    import devsim
+    from devsim.python_packages import simple_physics as sp
+
+    devsim.set_parameter(name="threads_available", value=case.threads)
+    devsim.set_parameter(name="threads_task_size", value=2048)
+
+    is_diode = case.workload.startswith("diode")
+    # the diode has 3 equations per node, the mos bulk dominates the count
+    nodes = max(case.unknowns // 3, 2)
+    create = {
+        "diode_1d": create_1d_diode,
+        "diode_2d": create_2d_diode,
+        "diode_3d": create_3d_diode,
+        "mos_2d": create_2d_mos,
+    }[case.workload]
+    regions = case.timed("mesh", create, case, nodes)
+
+    # the circuit source is needed to drive the small signal analyses
+    circuit = is_diode and any(a in case.analyses for a in ("transient", "ac", "noise"))
+    if is_diode:
+        case.timed("setup", setup_diode, case, circuit)
+    else:
+        case.timed("setup", setup_mos, case)
+
+    dc_type = "transient_dc" if circuit else "dc"
+    case.solve(
+        "dc",
+        type=dc_type,
+        absolute_error=1e10,
+        relative_error=1e-10,
+        maximum_iterations=40,
+    )
+
+    if "dc" in case.analyses:
+        if is_diode:
+            for v in (0.1, 0.2, 0.3):
+                if circuit:
+                    devsim.circuit_alter(name="V1", value=v)
+                else:
+                    devsim.set_parameter(
+                        device=case.device, name=sp.GetContactBiasName("top"), value=v
+                    )
+                case.solve(
+                    "dc",
+                    type=dc_type,
+                    absolute_error=1e10,
+                    relative_error=1e-10,
+                    maximum_iterations=40,
+                )
+        else:
+            for v in (0.1, 0.2, 0.3):
+                for c in ("gate", "drain"):
+                    devsim.set_parameter(
+                        device=case.device, name=sp.GetContactBiasName(c), value=v
+                    )
+                case.solve(
+                    "dc",
+                    type="dc",
+                    absolute_error=1e10,
+                    relative_error=1e-10,
+                    maximum_iterations=40,
+                )
+
+    if circuit and "transient" in case.analyses:
+        devsim.circuit_alter(name="V1", value=0.4)
+        for _ in range(5):
+            case.solve(
+                "transient",
+                type="transient_bdf1",
+                absolute_error=1e10,
+                relative_error=1e-10,
+                maximum_iterations=40,
+                tdelta=1e-9,
+                charge_error=1,
+            )
+
+    if circuit and "ac" in case.analyses:
+        for f in (1e3, 1e6):
+            case.solve("ac", type="ac", frequency=f)
+
+    if circuit and "noise" in case.analyses:
+        for f in (1e3, 1e6):
+            case.solve("noise", type="noise", frequency=f, output_node="V1.I")
+
+    return {
+        "workload": case.workload,
+        "requested_unknowns": case.unknowns,
+        "unknowns": count_unknowns(case.device, regions),
+        "threads": case.threads,
+        "analyses": case.analyses,
+        "wall_time": case.wall,
+        "solves": case.timings,
+        "peak_rss_bytes": peak_rss_bytes(),
+    }
+
+
+def summarize(solves):
+    """
+    sum the newton phase timings over every solve of a case
+    """
+    ret = {}
+    for s in solves:
+        for k, v in s["timing"].items():
+            ret[k] = ret.get(k, 0.0) + v
+    return ret
+
+
+def run_child(args):
+    """
+    runs a single case in a separate process and returns the parsed result
+    """
+    command = [
+        sys.executable,
+        os.path.abspath(__file__),
+        "--run-one",
+        "--workloads",
+        args[0],
+        "--unknowns",
+        str(args[1]),
+        "--threads",
+        str(args[2]),
+        "--analyses",
+    ] + list(args[3])
+    proc = subprocess.run(command, stdout=subprocess.PIPE, universal_newlines=True)
+    for line in proc.stdout.splitlines():
+        if line.startswith(RESULT_MARKER):
+            return json.loads(line[len(RESULT_MARKER) :])
+    return {
+        "workload": args[0],
+        "requested_unknowns": args[1],
+        "threads": args[2],
+        "error": "case failed with exit code %d" % proc.returncode,
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description="DEVSIM benchmark suite")
+    parser.add_argument(
+        "--workloads", nargs="+", choices=WORKLOADS, default=list(WORKLOADS)
+    )
+    parser.add_argument("--unknowns", nargs="+", type=int, default=[10000])
+    parser.add_argument("--threads", nargs="+", type=int, default=[1, 2, 4])
+    parser.add_argument(
+        "--analyses", nargs="+", choices=ANALYSES, default=list(ANALYSES)
+    )
+    parser.add_argument("--output", default="devsim_bench.json")
+    parser.add_argument("--run-one", action="store_true", help=argparse.SUPPRESS)
+    args = parser.parse_args()
+
+    if args.run_one:
+        case = Case(args.workloads[0], args.unknowns[0], args.threads[0], args.analyses)
+        result = run_case(case)
+        sys.stdout.flush()
+        print(RESULT_MARKER + json.dumps(result))
+        return
+
+    cases = []
+    for workload in args.workloads:
+        for unknowns in args.unknowns:
+            for threads in args.threads:
+                print("%s unknowns=%d threads=%d" % (workload, unknowns, threads))
+                result = run_child((workload, unknowns, threads, args.analyses))
+                if "solves" in result:
+                    result["newton_timing"] = summarize(result["solves"])
+                    print("  %s" % json.dumps(result["newton_timing"]))
+                else:
+                    print("  %s" % result["error"])
+                cases.append(result)
+
+    # thread scaling is relative to the smallest thread count of each workload and size
+    baseline = {}
+    for c in cases:
+        if "newton_timing" not in c:
+            continue
+        key = (c["workload"], c["requested_unknowns"])
+        if key not in baseline or c["threads"] < baseline[key]["threads"]:
+            baseline[key] = c
+    for c in cases:
+        if "newton_timing" not in c:
+            continue
+        b = baseline[(c["workload"], c["requested_unknowns"])]
+        total = c["newton_timing"].get("total", 0.0)
+        if total > 0.0:
+            c["speedup"] = b["newton_timing"].get("total", 0.0) / total
+
+    report = {
+        "platform": platform.platform(),
+        "python": platform.python_version(),
+        "cpu_count": os.cpu_count(),
+        "cases": cases,
+    }
+    with open(args.output, "w") as ofh:
+        json.dump(report, ofh, indent=2)
+    print("wrote %s" % args.output)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,61 @@
+# Copyright 2013 DEVSIM LLC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+from devsim import set_parameter, solve, solve_continuation
+
+import devsim.python_packages.simple_physics as simple_physics
+import diode_common
+
+#####
+# Same as diode_1d, but the forward bias is ramped with solve_continuation
+#
+
+device = "MyDevice"
+region = "MyRegion"
+
+diode_common.CreateMesh(device=device, region=region)
+
+diode_common.SetParameters(device=device, region=region)
+set_parameter(device=device, region=region, name="taun", value=1e-8)
+set_parameter(device=device, region=region, name="taup", value=1e-8)
+
+diode_common.SetNetDoping(device=device, region=region)
+
+diode_common.InitialSolution(device, region)
+
+# Initial DC solution
+solve(type="dc", absolute_error=1.0, relative_error=1e-10, maximum_iterations=30)
+
+diode_common.DriftDiffusionInitialSolution(device, region)
+###
+### Drift diffusion simulation at equilibrium
+###
+solve(type="dc", absolute_error=1e10, relative_error=1e-10, maximum_iterations=30)
+
+
+def print_currents(device):
+    simple_physics.PrintCurrents(device, "top")
+    simple_physics.PrintCurrents(device, "bot")
+
+
+####
+#### Ramp the bias to 0.8 Volts
+####
+info = solve_continuation(
+    device=device,
+    parameter=simple_physics.GetContactBiasName("top"),
+    end_value=0.8,
+    step_size=0.05,
+    minimum_step=1e-3,
+    maximum_step=0.2,
+    target_iterations=3,
+    callback=print_currents,
+    absolute_error=1e10,
+    relative_error=1e-10,
+    maximum_iterations=30,
+    info=True,
+)
+
+for p in info["points"]:
+    print("%g %d %s" % (p["value"], p["iterations"], p["converged"]))
@@ -0,0 +1,580 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#include "CompiledModelExpr.hh"
+#include "Region.hh"
+#include "NodeModel.hh"
+#include "EdgeModel.hh"
+#include "GlobalData.hh"
+#include "NodeKeeper.hh"
+#include "ObjectHolder.hh"
+#include "MathEval.hh"
+#include "OutputStream.hh"
+#include "FPECheck.hh"
+#include "dsAssert.hh"
+
+#include "EngineAPI.hh"
+
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <filesystem>
+
+#if !defined(_WIN32)
+#include <dlfcn.h>
+#include <unistd.h>
+#endif
+
+namespace MEE {
+
+namespace {
+const char kernel_symbol[] = "devsim_compiled_model";
+
+/// Writes the loop body, with each distinct subexpression stored once in a temporary
+class SourceWriter {
+  public:
+    SourceWriter() : supported(true) {}
+
+    std::string Visit(Eqo::EqObjPtr);
+
+    bool supported;
+    std::ostringstream body;
+    std::vector<std::string> vector_names;
+    std::vector<std::string> scalar_names;
+    std::vector<std::pair<std::string, size_t>> function_names;
+
+  private:
+    size_t GetIndex(std::vector<std::string> &, const std::string &);
+    std::string WriteFunction(const std::string &, const std::vector<std::string> &);
+
+    std::map<std::string, std::string> temporaries;
+};
+
+size_t SourceWriter::GetIndex(std::vector<std::string> &names, const std::string &name)
+{
+  for (size_t i = 0; i < names.size(); ++i)
+  {
+    if (names[i] == name)
+    {
+      return i;
+    }
+  }
+  names.push_back(name);
+  return names.size() - 1;
+}
+
+std::string SourceWriter::WriteFunction(const std::string &name, const std::vector<std::string> &args)
+{
+  std::ostringstream os;
+  if ((name == "pow") && (args.size() == 2))
+  {
+    os << "std::pow(" << args[0] << ", " << args[1] << ")";
+    return os.str();
+  }
+
+  size_t index = function_names.size();
+  for (size_t i = 0; i < function_names.size(); ++i)
+  {
+    if ((function_names[i].first == name) && (function_names[i].second == args.size()))
+    {
+      index = i;
+      break;
+    }
+  }
+  if (index == function_names.size())
+  {
+    function_names.push_back(std::make_pair(name, args.size()));
+  }
+
+  os << "f" << index << "(";
+  for (size_t i = 0; i < args.size(); ++i)
+  {
+    if (i != 0)
+    {
+      os << ", ";
+    }
+    os << args[i];
+  }
+  os << ")";
+  return os.str();
+}
+
+std::string SourceWriter::Visit(Eqo::EqObjPtr arg)
+{
+  const std::string &key = EngineAPI::getStringValue(arg);
+
+  std::map<std::string, std::string>::const_iterator it = temporaries.find(key);
+  if (it != temporaries.end())
+  {
+    return it->second;
+  }
+
+  const EngineAPI::EqObjType etype = EngineAPI::getEnumeratedType(arg);
+
+  std::ostringstream os;
+  switch (etype)
+  {
+    case EngineAPI::CONST_OBJ:
+    {
+      const double v = EngineAPI::getDoubleValue(arg);
+      if (!std::isfinite(v))
+      {
+        supported = false;
+      }
+      os << "(" << std::setprecision(17) << std::showpoint << v << ")";
+      return os.str();
+    }
+    case EngineAPI::MODEL_OBJ:
+      os << "v[" << GetIndex(vector_names, key) << "][k]";
+      return os.str();
+    case EngineAPI::VARIABLE_OBJ:
+      os << "s[" << GetIndex(scalar_names, EngineAPI::getName(arg)) << "]";
+      return os.str();
+    case EngineAPI::ADD_OBJ:
+    case EngineAPI::PRODUCT_OBJ:
+    {
+      const char *op = (etype == EngineAPI::ADD_OBJ) ? " + " : " * ";
+      std::vector<Eqo::EqObjPtr> values = EngineAPI::getArgs(arg);
+      os << "(";
+      for (size_t i = 0; i < values.size(); ++i)
+      {
+        if (i != 0)
+        {
+          os << op;
+        }
+        os << Visit(values[i]);
+      }
+      os << ")";
+      break;
+    }
+    case EngineAPI::IF_OBJ:
+    {
+      std::vector<Eqo::EqObjPtr> values = EngineAPI::getArgs(arg);
+      dsAssert(values.size() == 2, "UNEXPECTED");
+      const std::string test = Visit(values[0]);
+      const std::string val  = Visit(values[1]);
+      os << "((" << test << " != 0.0) ? " << val << " : 0.0)";
+      break;
+    }
+    case EngineAPI::IFELSE_OBJ:
+    {
+      std::vector<Eqo::EqObjPtr> values = EngineAPI::getArgs(arg);
+      dsAssert(values.size() == 3, "UNEXPECTED");
+      const std::string test = Visit(values[0]);
+      const std::string val1 = Visit(values[1]);
+      const std::string val2 = Visit(values[2]);
+      os << "((" << test << " != 0.0) ? " << val1 << " : " << val2 << ")";
+      break;
+    }
+    case EngineAPI::USERFUNC_OBJ:
+    case EngineAPI::EXPONENT_OBJ:
+    case EngineAPI::POW_OBJ:
+    case EngineAPI::LOG_OBJ:
+    case EngineAPI::ULOGICAL_OBJ:
+    case EngineAPI::BLOGICAL_OBJ:
+    {
+      std::vector<Eqo::EqObjPtr> values = EngineAPI::getArgs(arg);
+      std::vector<std::string> args;
+      args.reserve(values.size());
+      for (size_t i = 0; i < values.size(); ++i)
+      {
+        args.push_back(Visit(values[i]));
+      }
+      os << WriteFunction(EngineAPI::getName(arg), args);
+      break;
+    }
+    default:
+      supported = false;
+      return "0.0";
+  }
+
+  std::ostringstream name;
+  name << "t" << temporaries.size();
+  body << "    const double " << name.str() << " = " << os.str() << ";\n";
+  temporaries[key] = name.str();
+  return name.str();
+}
+
+/// FNV-1a, which gives the same name to the library in every run
+std::string GetHash(const std::string &text)
+{
+  uint64_t h = 14695981039346656037ULL;
+  for (const char c : text)
+  {
+    h ^= static_cast<unsigned char>(c);
+    h *= 1099511628211ULL;
+  }
+  std::ostringstream os;
+  os << std::hex << std::setw(16) << std::setfill('0') << h;
+  return os.str();
+}
+
+std::string GetStringParameter(const std::string &name, const std::string &default_value)
+{
+  GlobalData &gdata = GlobalData::GetInstance();
+  GlobalData::DBEntry_t dbent = gdata.GetDBEntryOnGlobal(name);
+  if (dbent.first)
+  {
+    return dbent.second.GetString();
+  }
+  return default_value;
+}
+
+std::string GetCompileCommand()
+{
+#if defined(__APPLE__)
+  const char default_command[] = "c++ -std=c++11 -O2 -fPIC -ffp-contract=off -shared -undefined dynamic_lookup";
+#else
+  const char default_command[] = "c++ -std=c++11 -O2 -fPIC -ffp-contract=off -shared";
+#endif
+  return GetStringParameter("model_compile_command", default_command);
+}
+
+std::string GetCacheDirectory()
+{
+  std::string default_directory;
+  if (const char *p = std::getenv("DEVSIM_MODEL_CACHE"))
+  {
+    default_directory = p;
+  }
+  else if (const char *p = std::getenv("XDG_CACHE_HOME"))
+  {
+    default_directory = (std::filesystem::path(p) / "devsim" / "models").string();
+  }
+  else if (const char *p = std::getenv("HOME"))
+  {
+    default_directory = (std::filesystem::path(p) / ".cache" / "devsim" / "models").string();
+  }
+  else
+  {
+    std::error_code ec;
+    default_directory = (std::filesystem::temp_directory_path(ec) / "devsim_models").string();
+  }
+  return GetStringParameter("model_compile_directory", default_directory);
+}
+
+/// Loaded libraries are shared by every simulation context, and are never unloaded
+struct KernelCache {
+  std::mutex                                           mutex;
+  std::map<std::string, CompiledModelExpr::kernel_t> kernels;
+};
+
+KernelCache &GetKernelCache()
+{
+  static KernelCache cache;
+  return cache;
+}
+
+CompiledModelExpr::kernel_t LoadKernel(const std::string &library, std::string &errors)
+{
+  CompiledModelExpr::kernel_t kernel = nullptr;
+#if defined(_WIN32)
+  errors += "compiled models are not supported on this platform\n";
+#else
+  void *handle = dlopen(library.c_str(), RTLD_NOW | RTLD_LOCAL);
+  if (!handle)
+  {
+    errors += dlerror();
+    errors += "\n";
+    return nullptr;
+  }
+  kernel = reinterpret_cast<CompiledModelExpr::kernel_t>(dlsym(handle, kernel_symbol));
+  if (!kernel)
+  {
+    errors += "could not find \"";
+    errors += kernel_symbol;
+    errors += "\" in \"" + library + "\"\n";
+    dlclose(handle);
+  }
+#endif
+  return kernel;
+}
+
+CompiledModelExpr::kernel_t CompileKernel(const std::string &source, std::string &errors)
+{
+  const std::string command = GetCompileCommand();
+  const std::string hash    = GetHash(source + "\n" + command);
+
+  KernelCache &cache = GetKernelCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+
+  auto it = cache.kernels.find(hash);
+  if (it != cache.kernels.end())
+  {
+    return it->second;
+  }
+
+  //// failures are also cached, so that the compiler is only run once
+  CompiledModelExpr::kernel_t &kernel = cache.kernels[hash];
+
+#if defined(_WIN32)
+  errors += "compiled models are not supported on this platform\n";
+#else
+  const std::filesystem::path directory(GetCacheDirectory());
+  const std::filesystem::path library = directory / ("devsim_model_" + hash + ".so");
+
+  std::error_code ec;
+  if (!std::filesystem::exists(library, ec))
+  {
+    std::filesystem::create_directories(directory, ec);
+
+    //// another process may be building the same library, so both files have the process id
+    const std::string stem = "devsim_model_" + hash + "." + std::to_string(getpid());
+    const std::filesystem::path source_file = directory / (stem + ".cc");
+    const std::filesystem::path temporary = directory / (stem + ".tmp");
+    {
+      std::ofstream ofile(source_file);
+      ofile << source;
+      if (!ofile)
+      {
+        errors += "could not write \"" + source_file.string() + "\"\n";
+        ofile.close();
+        std::filesystem::remove(source_file, ec);
+        return nullptr;
+      }
+    }
+
+    std::ostringstream os;
+    os << command << " -o \"" << temporary.string() << "\" \"" << source_file.string() << "\"";
+    OutputStream::WriteOut(OutputStream::OutputType::VERBOSE1, os.str() + "\n");
+    const int status = std::system(os.str().c_str());
+    std::filesystem::remove(source_file, ec);
+    if (status != 0)
+    {
+      errors += "command failed: " + os.str() + "\n";
+      std::filesystem::remove(temporary, ec);
+      return nullptr;
+    }
+
+    std::filesystem::rename(temporary, library, ec);
+    if (ec)
+    {
+      errors += "could not create \"" + library.string() + "\": " + ec.message() + "\n";
+      std::filesystem::remove(temporary, ec);
+      return nullptr;
+    }
+  }
+
+  kernel = LoadKernel(library.string(), errors);
+#endif
+  return kernel;
+}
+}
+
+bool CompiledModelExpr::IsEnabled()
+{
+  bool ret = false;
+  GlobalData &gdata = GlobalData::GetInstance();
+  GlobalData::DBEntry_t dbent = gdata.GetDBEntryOnGlobal("model_compile");
+  if (dbent.first)
+  {
+    ObjectHolder::BooleanEntry_t bent = dbent.second.GetBoolean();
+    ret = bent.first && bent.second;
+  }
+  return ret;
+}
+
+CompiledModelExpr::CompiledModelExpr() : etype(ExpectedType::UNKNOWN), kernel(nullptr), load_attempted(false)
+{
+}
+
+CompiledModelExprPtr CompiledModelExpr::Create(Eqo::EqObjPtr equation, ExpectedType et)
+{
+  if ((et != ExpectedType::NODE) && (et != ExpectedType::EDGE))
+  {
+    return CompiledModelExprPtr();
+  }
+
+  SourceWriter writer;
+  const std::string result = writer.Visit(equation);
+
+  //// expressions without a model reference evaluate to a single value
+  if (!writer.supported || writer.vector_names.empty())
+  {
+    return CompiledModelExprPtr();
+  }
+
+  std::vector<const void *> functions;
+  const MathEval<double> &meval = MathEval<double>::GetInstance();
+  for (auto &f : writer.function_names)
+  {
+    const void *p = meval.GetBuiltInFunctionPointer(f.first, f.second);
+    if (!p)
+    {
+      return CompiledModelExprPtr();
+    }
+    functions.push_back(p);
+  }
+
+  CompiledModelExprPtr ret(new CompiledModelExpr());
+  ret->etype        = et;
+  ret->expression   = EngineAPI::getStringValue(equation);
+  ret->vector_names = writer.vector_names;
+  ret->scalar_names = writer.scalar_names;
+  ret->functions    = functions;
+
+  std::string comment = ret->expression;
+  for (char &c : comment)
+  {
+    if ((c == '\n') || (c == '\r') || (c == '\\'))
+    {
+      c = ' ';
+    }
+  }
+
+  std::ostringstream os;
+  os << "// generated by devsim for the model expression\n"
+        "// " << comment << "\n"
+        "#include <cmath>\n"
+        "#include <cstddef>\n"
+        "\n"
+        "#if defined(_WIN32)\n"
+        "#define DEVSIM_EXPORT __declspec(dllexport)\n"
+        "#else\n"
+        "#define DEVSIM_EXPORT __attribute__((visibility(\"default\")))\n"
+        "#endif\n"
+        "\n"
+        "typedef double (*devsim_f1)(double);\n"
+        "typedef double (*devsim_f2)(double, double);\n"
+        "typedef double (*devsim_f3)(double, double, double);\n"
+        "typedef double (*devsim_f4)(double, double, double, double);\n"
+        "\n"
+        "extern \"C\" DEVSIM_EXPORT void " << kernel_symbol << "(const double *const *v, const double *s, const void *const *f, double *r, size_t n)\n"
+        "{\n"
+        "  (void) s;\n"
+        "  (void) f;\n";
+  for (size_t i = 0; i < writer.function_names.size(); ++i)
+  {
+    const size_t nargs = writer.function_names[i].second;
+    os << "  // " << writer.function_names[i].first << "\n"
+          "  const devsim_f" << nargs << " f" << i << " = reinterpret_cast<devsim_f" << nargs << ">(f[" << i << "]);\n";
+  }
+  os << "  for (size_t k = 0; k < n; ++k)\n"
+        "  {\n"
+     << writer.body.str()
+     << "    r[k] = " << result << ";\n"
+        "  }\n"
+        "}\n";
+  ret->source = os.str();
+
+  return ret;
+}
+
+bool CompiledModelExpr::GetVectorValues(const Region &region, std::vector<const double *> &vectors, size_t length) const
+{
+  vectors.resize(vector_names.size());
+
+  //// all of the referenced models are updated before their values are kept
+  for (size_t pass = 0; pass < 2; ++pass)
+  {
+    for (size_t i = 0; i < vector_names.size(); ++i)
+    {
+      const std::vector<double> *values = nullptr;
+      if (etype == ExpectedType::NODE)
+      {
+        ConstNodeModelPtr nm = region.GetNodeModel(vector_names[i]);
+        if (!nm || nm->IsInProcess())
+        {
+          return false;
+        }
+        values = &(nm->GetScalarValues<double>());
+      }
+      else
+      {
+        ConstEdgeModelPtr em = region.GetEdgeModel(vector_names[i]);
+        if (!em || em->IsInProcess())
+        {
+          return false;
+        }
+        values = &(em->GetScalarValues<double>());
+      }
+
+      if (values->size() != length)
+      {
+        return false;
+      }
+      vectors[i] = values->data();
+    }
+  }
+  return true;
+}
+
+bool CompiledModelExpr::GetScalarValues(const Region &region, std::vector<double> &scalars) const
+{
+  GlobalData &gd = GlobalData::GetInstance();
+  NodeKeeper &nk = NodeKeeper::instance();
+
+  scalars.resize(scalar_names.size());
+  for (size_t i = 0; i < scalar_names.size(); ++i)
+  {
+    const GlobalData::DoubleDBEntry_t &gdbent = gd.GetDoubleDBEntryOnRegion(&region, scalar_names[i]);
+    if (gdbent.first)
+    {
+      scalars[i] = gdbent.second;
+    }
+    else if (nk.IsCircuitNode(scalar_names[i]))
+    {
+      scalars[i] = nk.GetNodeValue("dcop", scalar_names[i]);
+    }
+    else
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool CompiledModelExpr::Evaluate(const Region &region, std::vector<double> &result) const
+{
+  if (!load_attempted)
+  {
+    load_attempted = true;
+    std::string errors;
+    kernel = CompileKernel(source, errors);
+    if (!kernel)
+    {
+      std::ostringstream os;
+      os << "Using the interpreter for the expression " << expression << "\n" << errors;
+      OutputStream::WriteOut(OutputStream::OutputType::VERBOSE1, os.str());
+    }
+  }
+
+  if (!kernel)
+  {
+    return false;
+  }
+
+  const size_t length = (etype == ExpectedType::NODE) ? region.GetNumberNodes() : region.GetNumberEdges();
+
+  std::vector<const double *> vectors;
+  std::vector<double>         scalars;
+  if (!GetVectorValues(region, vectors, length) || !GetScalarValues(region, scalars))
+  {
+    return false;
+  }
+
+  result.resize(length);
+
+  FPECheck::ClearFPE();
+  kernel(vectors.data(), scalars.data(), functions.data(), result.data(), length);
+  //// the interpreter reports where the floating point exception happened
+  if (FPECheck::CheckFPE())
+  {
+    FPECheck::ClearFPE();
+    return false;
+  }
+
+  return true;
+}
+}
+
@@ -0,0 +1,67 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#ifndef COMPILEDMODELEXPR_HH
+#define COMPILEDMODELEXPR_HH
+#include "ModelExprEval.hh"
+#include <string>
+#include <vector>
+#include <memory>
+
+namespace Eqo {
+    class EquationObject;
+    typedef std::shared_ptr<EquationObject> EqObjPtr;
+}
+
+class Region;
+
+namespace MEE {
+class CompiledModelExpr;
+typedef std::shared_ptr<CompiledModelExpr> CompiledModelExprPtr;
+
+/// A node or edge model expression compiled to native code
+/// The generated source is built into a shared library in the cache directory.
+/// The library is named from a hash of the source and compiler command, so it is reused by later runs.
+/// Evaluate returns false whenever the interpreter should be used instead.
+class CompiledModelExpr {
+    public:
+        typedef void (*kernel_t)(const double *const * /*vectors*/, const double * /*scalars*/, const void *const * /*functions*/, double * /*result*/, size_t /*length*/);
+
+        /// The "model_compile" parameter is set
+        static bool IsEnabled();
+
+        /// Returns nullptr when the expression uses anything the generated code does not support
+        /// All of the referenced models must have the expected type
+        static CompiledModelExprPtr Create(Eqo::EqObjPtr, ExpectedType);
+
+        bool Evaluate(const Region &, std::vector<double> &) const;
+
+        const std::string &GetSource() const
+        {
+          return source;
+        }
+
+    private:
+        CompiledModelExpr();
+        CompiledModelExpr(const CompiledModelExpr &);
+        CompiledModelExpr &operator=(const CompiledModelExpr &);
+
+        bool GetVectorValues(const Region &, std::vector<const double *> &, size_t) const;
+        bool GetScalarValues(const Region &, std::vector<double> &) const;
+
+        ExpectedType             etype;
+        std::string              expression;
+        std::string              source;
+        std::vector<std::string> vector_names;
+        std::vector<std::string> scalar_names;
+        std::vector<const void *> functions;
+        mutable kernel_t         kernel;
+        mutable bool             load_attempted;
+};
+}
+#endif
+
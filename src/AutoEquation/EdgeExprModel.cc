@@ -17,11 +17,12 @@ SPDX-License-Identifier: Apache-2.0
 #include <set>
 #include <string>
 #include <sstream>
+#include <type_traits>
 
 
 // Must be valid equation object which is passed
 template <typename DoubleType>
-EdgeExprModel<DoubleType>::EdgeExprModel(const std::string &nm, const Eqo::EqObjPtr eq, RegionPtr rp, EdgeModel::DisplayType dt, ContactPtr cp) : EdgeModel(nm, rp, dt, cp), equation(eq)
+EdgeExprModel<DoubleType>::EdgeExprModel(const std::string &nm, const Eqo::EqObjPtr eq, RegionPtr rp, EdgeModel::DisplayType dt, ContactPtr cp) : EdgeModel(nm, rp, dt, cp), equation(eq), compile_attempted(false)
 {
 }
 
@@ -70,6 +71,25 @@ void EdgeExprModel<DoubleType>::RegisterModels()
 template <typename DoubleType>
 void EdgeExprModel<DoubleType>::calcEdgeScalarValues() const
 {
+    if constexpr (std::is_same<DoubleType, double>::value)
+    {
+      if (!AtContact() && MEE::CompiledModelExpr::IsEnabled())
+      {
+        if (!compile_attempted)
+        {
+          compile_attempted = true;
+          compiled = MEE::CompiledModelExpr::Create(equation, MEE::ExpectedType::EDGE);
+        }
+
+        EdgeScalarList<double> values;
+        if (compiled && compiled->Evaluate(GetRegion(), values))
+        {
+          SetValues(values);
+          return;
+        }
+      }
+    }
+
     typename MEE::ModelExprEval<DoubleType>::error_t errors;
     const Region *rp = &(this->GetRegion());
     MEE::ModelExprEval<DoubleType> mexp(rp, GetName(), errors);
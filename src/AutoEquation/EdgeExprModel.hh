@@ -8,6 +8,7 @@ SPDX-License-Identifier: Apache-2.0
 #ifndef EDGEEXPRMODEL_HH
 #define EDGEEXPRMODEL_HH
 #include "EdgeModel.hh"
+#include "CompiledModelExpr.hh"
 #include <string>
 #include <memory>
 namespace Eqo {
@@ -37,6 +38,9 @@ class EdgeExprModel : public EdgeModel
         void calcEdgeScalarValues() const;
 
         const Eqo::EqObjPtr      equation;
+        //// native code for the equation, when the "model_compile" parameter is set
+        mutable MEE::CompiledModelExprPtr compiled;
+        mutable bool             compile_attempted;
 };
 
 #endif
@@ -54,9 +54,8 @@ ExprContactEquation<DoubleType>::ExprContactEquation(
 template <typename DoubleType>
 void ExprContactEquation<DoubleType>::DerivedAssemble(dsMath::RealRowColValueVec<DoubleType> &m, dsMath::RHSEntryVec<DoubleType> &v, PermutationMap &p, dsMathEnum::WhatToLoad w, dsMathEnum::TimeMode t)
 {
-    ModelExprDataCachePtr<DoubleType> model_cache = ModelExprDataCachePtr<DoubleType>(new ModelExprDataCache<DoubleType>());
-    Region &r = const_cast<Region &>(ContactEquation<DoubleType>::GetRegion());
-    r.SetModelExprDataCache(model_cache);
+    //// shared with the bulk equations in the assembly pass
+    ModelExprDataCachePtr<DoubleType> model_cache = MEE::GetModelExprDataCache<DoubleType>(ContactEquation<DoubleType>::GetRegion());
 
     const std::string &NodeVolumeModel = ContactEquation<DoubleType>::GetRegion().GetNodeVolumeModel();
     const std::string &EdgeCoupleModel = ContactEquation<DoubleType>::GetRegion().GetEdgeCoupleModel();
@@ -66,7 +65,6 @@ void ExprContactEquation<DoubleType>::DerivedAssemble(dsMath::RealRowColValueVec
     {
         if (!nodemodel_int.empty())
         {
-            model_cache->clear();
             ContactEquation<DoubleType>::AssembleNodeEquation(nodemodel_int, m, v, p, w, NodeVolumeModel);
         }
     }
@@ -74,20 +72,16 @@ void ExprContactEquation<DoubleType>::DerivedAssemble(dsMath::RealRowColValueVec
     {
         if (!nodemodel_int.empty())
         {
-            model_cache->clear();
             ContactEquation<DoubleType>::AssembleNodeEquation(nodemodel_int, m, v, p, w, NodeVolumeModel);
         }
 
         if (!edgemodel_int.empty())
         {
-            model_cache->clear();
             ContactEquation<DoubleType>::AssembleEdgeEquation(edgemodel_int, m, v, w, EdgeCoupleModel, 1.0, -1.0);
         }
 
         if (!edgevolumemodel_int.empty())
         {
-            model_cache->clear();
-
             const std::string &node0model = ContactEquation<DoubleType>::GetRegion().GetEdgeNode0VolumeModel();
             const std::string &node1model = ContactEquation<DoubleType>::GetRegion().GetEdgeNode1VolumeModel();
 
@@ -104,14 +98,11 @@ void ExprContactEquation<DoubleType>::DerivedAssemble(dsMath::RealRowColValueVec
 
         if (!elementedgemodel_int.empty())
         {
-            model_cache->clear();
             ContactEquation<DoubleType>::AssembleElementEdgeEquation(elementedgemodel_int, m, v, w, ElementEdgeCoupleModel, 1.0, -1.0);
         }
 
         if (!(volume_node0_model_int_.empty() && volume_node1_model_int_.empty()))
         {
-            model_cache->clear();
-
             const std::string &node0model = ContactEquation<DoubleType>::GetRegion().GetElementNode0VolumeModel();
             const std::string &node1model = ContactEquation<DoubleType>::GetRegion().GetElementNode1VolumeModel();
 
@@ -131,17 +122,14 @@ void ExprContactEquation<DoubleType>::DerivedAssemble(dsMath::RealRowColValueVec
         {
             if (!nodemodel_current.empty())
             {
-                model_cache->clear();
                 ContactEquation<DoubleType>::AssembleNodeEquationOnCircuit(nodemodel_current, m, v, w, NodeVolumeModel);
             }
             if (!edgemodel_current.empty())
             {
-                model_cache->clear();
                 ContactEquation<DoubleType>::AssembleEdgeEquationOnCircuit(edgemodel_current, m, v, w, EdgeCoupleModel, 1.0, -1.0);
             }
             if (!elementedgemodel_current.empty())
             {
-                model_cache->clear();
                 ContactEquation<DoubleType>::AssembleElementEdgeEquationOnCircuit(elementedgemodel_current, m, v, w, ElementEdgeCoupleModel, 1.0, -1.0);
             }
         }
@@ -168,17 +156,14 @@ void ExprContactEquation<DoubleType>::DerivedAssemble(dsMath::RealRowColValueVec
         {
             if (!nodemodel_charge.empty())
             {
-                model_cache->clear();
                 ContactEquation<DoubleType>::AssembleNodeEquationOnCircuit(nodemodel_charge, m, v, w, NodeVolumeModel);
             }
             if (!edgemodel_charge.empty())
             {
-                model_cache->clear();
                 ContactEquation<DoubleType>::AssembleEdgeEquationOnCircuit(edgemodel_charge, m, v, w, EdgeCoupleModel, 1.0, -1.0);
             }
             if (!elementedgemodel_charge.empty())
             {
-                model_cache->clear();
                 ContactEquation<DoubleType>::AssembleElementEdgeEquationOnCircuit(elementedgemodel_charge, m, v, w, ElementEdgeCoupleModel, 1.0, -1.0);
             }
         }
@@ -41,15 +41,13 @@ ExprEquation<DoubleType>::ExprEquation(
 template <typename DoubleType>
 void ExprEquation<DoubleType>::DerivedAssemble(dsMath::RealRowColValueVec<DoubleType> &m, dsMath::RHSEntryVec<DoubleType> &v, dsMathEnum::WhatToLoad w, dsMathEnum::TimeMode t)
 {
-    ModelExprDataCachePtr<DoubleType> model_cache = ModelExprDataCachePtr<DoubleType>(new ModelExprDataCache<DoubleType>());
-    Region &r = const_cast<Region &>(Equation<DoubleType>::GetRegion());
-    r.SetModelExprDataCache(model_cache);
+    //// shared with the other equations in the assembly pass
+    ModelExprDataCachePtr<DoubleType> model_cache = MEE::GetModelExprDataCache<DoubleType>(Equation<DoubleType>::GetRegion());
 
     if (t == dsMathEnum::TimeMode::DC)
     {
         if (!edge_model_.empty())
         {
-            model_cache->clear();
             Equation<DoubleType>::EdgeCoupleAssemble(edge_model_, m, v, w);
             if (!edge_volume_model_.empty())
             {
@@ -59,19 +57,16 @@ void ExprEquation<DoubleType>::DerivedAssemble(dsMath::RealRowColValueVec<Double
 
         if (!node_model_.empty())
         {
-            model_cache->clear();
             Equation<DoubleType>::NodeVolumeAssemble(node_model_, m, v, w);
         }
 
         if (!element_model_.empty())
         {
-            model_cache->clear();
             Equation<DoubleType>::ElementEdgeCoupleAssemble(element_model_, m, v, w);
         }
 
         if (!volume_node0_model_.empty() || !volume_node1_model_.empty())
         {
-            model_cache->clear();
             Equation<DoubleType>::ElementNodeVolumeAssemble(volume_node0_model_, volume_node1_model_, m, v, w);
         }
 
@@ -80,7 +75,6 @@ void ExprEquation<DoubleType>::DerivedAssemble(dsMath::RealRowColValueVec<Double
     {
         if (!time_node_model_.empty())
         {
-            model_cache->clear();
             Equation<DoubleType>::NodeVolumeAssemble(time_node_model_, m, v, w);
         }
     }
@@ -51,17 +51,11 @@ InterfaceExprEquation<DoubleType>::InterfaceExprEquation(
 template <typename DoubleType>
 void InterfaceExprEquation<DoubleType>::DerivedAssemble(dsMath::RealRowColValueVec<DoubleType> &m, dsMath::RHSEntryVec<DoubleType> &v, PermutationMap &p, dsMathEnum::WhatToLoad w, dsMathEnum::TimeMode t)
 {
-    ModelExprDataCachePtr<DoubleType> model_cache0 = ModelExprDataCachePtr<DoubleType>(new ModelExprDataCache<DoubleType>());
-    Region &r0 = *const_cast<Region *>(InterfaceEquation<DoubleType>::GetInterface().GetRegion0());
-    r0.SetModelExprDataCache(model_cache0);
-
-    ModelExprDataCachePtr<DoubleType> model_cache1 = ModelExprDataCachePtr<DoubleType>(new ModelExprDataCache<DoubleType>());
-    Region &r1 = *const_cast<Region *>(InterfaceEquation<DoubleType>::GetInterface().GetRegion1());
-    r1.SetModelExprDataCache(model_cache1);
-
-    InterfaceModelExprDataCachePtr<DoubleType> interface_model_cache = InterfaceModelExprDataCachePtr<DoubleType>(new InterfaceModelExprDataCache<DoubleType>());
-    Interface &interface = const_cast<Interface &>(InterfaceEquation<DoubleType>::GetInterface());
-    interface.SetInterfaceModelExprDataCache(interface_model_cache);
+    //// shared with the bulk equations in the assembly pass
+    const Interface &interface = InterfaceEquation<DoubleType>::GetInterface();
+    ModelExprDataCachePtr<DoubleType> model_cache0 = MEE::GetModelExprDataCache<DoubleType>(*interface.GetRegion0());
+    ModelExprDataCachePtr<DoubleType> model_cache1 = MEE::GetModelExprDataCache<DoubleType>(*interface.GetRegion1());
+    InterfaceModelExprDataCachePtr<DoubleType> interface_model_cache = IMEE::GetInterfaceModelExprDataCache<DoubleType>(interface);
 
     const std::string &SurfaceAreaModel = InterfaceEquation<DoubleType>::GetInterface().GetSurfaceAreaModel();
     if (t == dsMathEnum::TimeMode::DC)
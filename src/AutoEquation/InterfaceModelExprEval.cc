@@ -19,6 +19,7 @@ SPDX-License-Identifier: Apache-2.0
 #include "Node.hh"
 
 #include "ObjectCache.hh"
+#include "AssemblyCacheScope.hh"
 
 #include "EngineAPI.hh"
 #include <numeric>
@@ -55,6 +56,23 @@ void InterfaceModelExprEval<DoubleType>::GetRegionAndName(const std::string &nm,
   }
 }
 
+template <typename DoubleType>
+InterfaceModelExprDataCachePtr<DoubleType> GetInterfaceModelExprDataCache(const Interface &i)
+{
+  Interface &interface = const_cast<Interface &>(i);
+
+  const size_t generation = AssemblyCacheScope::GetGeneration();
+
+  InterfaceModelExprDataCachePtr<DoubleType> cache = interface.GetInterfaceModelExprDataCache<DoubleType>();
+  if (!cache || (cache->GetGeneration() != generation))
+  {
+    cache = InterfaceModelExprDataCachePtr<DoubleType>(new InterfaceModelExprDataCache<DoubleType>(generation));
+    interface.SetInterfaceModelExprDataCache(cache);
+    AssemblyCacheScope::Keep(cache);
+  }
+  return cache;
+}
+
 template <typename DoubleType>
 InterfaceModelExprEval<DoubleType>::InterfaceModelExprEval(data_ref_t &vals, error_t &er) : data_ref(vals), errors(er)
 {
@@ -399,19 +417,17 @@ InterfaceModelExprData<DoubleType> InterfaceModelExprEval<DoubleType>::eval_func
   InterfaceModelExprData<DoubleType> out;
 
   bool cache_result = true;
-  InterfaceModelExprDataCachePtr<DoubleType> cache = const_cast<Interface *>(data_ref)->GetInterfaceModelExprDataCache<DoubleType>();
-  if (!cache)
-  {
-    cache = InterfaceModelExprDataCachePtr<DoubleType>(new InterfaceModelExprDataCache<DoubleType>());
-    const_cast<Interface *>(data_ref)->SetInterfaceModelExprDataCache(cache);
-  }
+  InterfaceModelExprDataCachePtr<DoubleType> cache = GetInterfaceModelExprDataCache<DoubleType>(*data_ref);
 
-  if (cache->GetEntry(EngineAPI::getStringValue(arg), out))
+  const std::string &key = EngineAPI::getStringValue(arg);
+  if (cache->GetEntry(key, out))
   {
     cache_result = false;
+    AssemblyCacheScope::RecordLookup(true);
   }
   else
   {
+    AssemblyCacheScope::RecordLookup(false);
     switch(etype)
     {
       case EngineAPI::MODEL_OBJ:
@@ -461,7 +477,7 @@ InterfaceModelExprData<DoubleType> InterfaceModelExprEval<DoubleType>::eval_func
 
   if (cache_result && (out.GetType() != datatype::INVALID))
   {
-    cache->SetEntry(EngineAPI::getStringValue(arg), out);
+    cache->SetEntry(key, out);
   }
 
   return out;
@@ -684,8 +700,10 @@ InterfaceModelExprData<DoubleType> InterfaceModelExprEval<DoubleType>::EvaluateE
 }
 
 template class InterfaceModelExprEval<double>;
+template InterfaceModelExprDataCachePtr<double> GetInterfaceModelExprDataCache(const Interface &);
 #ifdef DEVSIM_EXTENDED_PRECISION
 template class InterfaceModelExprEval<float128>;
+template InterfaceModelExprDataCachePtr<float128> GetInterfaceModelExprDataCache(const Interface &);
 #endif
 };
 
@@ -14,6 +14,7 @@ SPDX-License-Identifier: Apache-2.0
 #include "TriangleEdgeModel.hh"
 #include "TetrahedronEdgeModel.hh"
 
+#include "Contact.hh"
 #include "GlobalData.hh"
 #include "NodeKeeper.hh"
 #include "Region.hh"
@@ -23,6 +24,7 @@ SPDX-License-Identifier: Apache-2.0
 #include "FPECheck.hh"
 
 #include "ObjectCache.hh"
+#include "AssemblyCacheScope.hh"
 
 #include "MathEval.hh"
 
@@ -34,6 +36,23 @@ SPDX-License-Identifier: Apache-2.0
 
 namespace MEE {
 
+template <typename DoubleType>
+ModelExprDataCachePtr<DoubleType> GetModelExprDataCache(const Region &r)
+{
+  Region &region = const_cast<Region &>(r);
+
+  const size_t generation = AssemblyCacheScope::GetGeneration();
+
+  ModelExprDataCachePtr<DoubleType> cache = region.GetModelExprDataCache<DoubleType>();
+  if (!cache || (cache->GetGeneration() != generation))
+  {
+    cache = ModelExprDataCachePtr<DoubleType>(new ModelExprDataCache<DoubleType>(generation));
+    region.SetModelExprDataCache(cache);
+    AssemblyCacheScope::Keep(cache);
+  }
+  return cache;
+}
+
 template <typename DoubleType>
 ModelExprEval<DoubleType>::ModelExprEval(data_ref_t &vals, const std::string &m, error_t &er) : data_ref(vals), model(m), errors(er), etype(ExpectedType::UNKNOWN)
 {
@@ -52,6 +71,7 @@ ModelExprEval<DoubleType>::ModelExprEval(data_ref_t &vals, const std::string &m,
         os << indexes[i] << "\n";
       }
 #endif
+      cache_scope = nm->GetContact().GetName() + "@node";
     }
     etype = ExpectedType::NODE;
   }
@@ -67,6 +87,7 @@ ModelExprEval<DoubleType>::ModelExprEval(data_ref_t &vals, const std::string &m,
         os << indexes[i] << "\n";
       }
 #endif
+      cache_scope = nm->GetContact().GetName() + "@edge";
     }
     etype = ExpectedType::EDGE;
   }
@@ -407,19 +428,17 @@ ModelExprData<DoubleType> ModelExprEval<DoubleType>::eval_function(Eqo::EqObjPtr
   ModelExprData<DoubleType> out(data_ref);
 
   bool cache_result = true;
-  ModelExprDataCachePtr<DoubleType> cache = const_cast<Region *>(data_ref)->GetModelExprDataCache<DoubleType>();
-  if (!cache)
-  {
-    cache = ModelExprDataCachePtr<DoubleType>(new ModelExprDataCache<DoubleType>());
-    const_cast<Region *>(data_ref)->SetModelExprDataCache(cache);
-  }
+  ModelExprDataCachePtr<DoubleType> cache = GetModelExprDataCache<DoubleType>(*data_ref);
 
-  if (cache->GetEntry(EngineAPI::getStringValue(arg), out))
+  const std::string &key = EngineAPI::getStringValue(arg);
+  if (cache->GetEntry(key, out, cache_scope))
   {
     cache_result = false;
+    AssemblyCacheScope::RecordLookup(true);
   }
   else
   {
+    AssemblyCacheScope::RecordLookup(false);
     switch(etype)
     {
       case EngineAPI::MODEL_OBJ:
@@ -469,7 +488,7 @@ ModelExprData<DoubleType> ModelExprEval<DoubleType>::eval_function(Eqo::EqObjPtr
 
   if (cache_result && (out.GetType() != datatype::INVALID))
   {
-    cache->SetEntry(EngineAPI::getStringValue(arg), out);
+    cache->SetEntry(key, out, cache_scope);
   }
 
 #if 0
@@ -870,9 +889,11 @@ ModelExprData<DoubleType> ModelExprEval<DoubleType>::EvaluateExternalMath(const
 }
 
 template class ModelExprEval<double>;
+template ModelExprDataCachePtr<double> GetModelExprDataCache(const Region &);
 #ifdef DEVSIM_EXTENDED_PRECISION
 #include "Float128.hh"
 template class ModelExprEval<float128>;
+template ModelExprDataCachePtr<float128> GetModelExprDataCache(const Region &);
 #endif
 }
 
@@ -53,6 +53,8 @@ class ModelExprEval {
         const std::string       model;     // model being evaluated
         error_t                 &errors;
         std::vector<size_t>     indexes;
+        //// contact models are only evaluated on the contact indexes, so their cache entries are kept apart
+        std::string             cache_scope;
         //// This is the expected data type
         ExpectedType            etype;
 };
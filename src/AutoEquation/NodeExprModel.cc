@@ -15,6 +15,7 @@ SPDX-License-Identifier: Apache-2.0
 
 #include "EngineAPI.hh"
 #include <sstream>
+#include <type_traits>
 
 #include <set>
 #include <string>
@@ -25,7 +26,7 @@ SPDX-License-Identifier: Apache-2.0
 
 // Must be valid equation object which is passed
 template <typename DoubleType>
-NodeExprModel<DoubleType>::NodeExprModel(const std::string &nm, const Eqo::EqObjPtr eq, RegionPtr rp, NodeModel::DisplayType dt, ContactPtr cp) : NodeModel(nm, rp, dt, cp), equation(eq)
+NodeExprModel<DoubleType>::NodeExprModel(const std::string &nm, const Eqo::EqObjPtr eq, RegionPtr rp, NodeModel::DisplayType dt, ContactPtr cp) : NodeModel(nm, rp, dt, cp), equation(eq), compile_attempted(false)
 {
 }
 
@@ -74,6 +75,25 @@ void NodeExprModel<DoubleType>::RegisterModels()
 template <typename DoubleType>
 void NodeExprModel<DoubleType>::calcNodeScalarValues() const
 {
+    if constexpr (std::is_same<DoubleType, double>::value)
+    {
+      if (!AtContact() && MEE::CompiledModelExpr::IsEnabled())
+      {
+        if (!compile_attempted)
+        {
+          compile_attempted = true;
+          compiled = MEE::CompiledModelExpr::Create(equation, MEE::ExpectedType::NODE);
+        }
+
+        NodeScalarList<double> values;
+        if (compiled && compiled->Evaluate(GetRegion(), values))
+        {
+          SetValues(values);
+          return;
+        }
+      }
+    }
+
     typename MEE::ModelExprEval<DoubleType>::error_t errors;
     const Region *rp = &(this->GetRegion());
     MEE::ModelExprEval<DoubleType> mexp(rp, GetName(), errors);
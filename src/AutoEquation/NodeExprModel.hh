@@ -8,6 +8,7 @@ SPDX-License-Identifier: Apache-2.0
 #ifndef NODEEXPRMODEL_HH
 #define NODEEXPRMODEL_HH
 #include "NodeModel.hh"
+#include "CompiledModelExpr.hh"
 #include <string>
 #include <memory>
 namespace Eqo {
@@ -37,6 +38,9 @@ class NodeExprModel : public NodeModel
         void calcNodeScalarValues() const;
         void setInitialValues();
         const Eqo::EqObjPtr      equation;
+        //// native code for the equation, when the "model_compile" parameter is set
+        mutable MEE::CompiledModelExprPtr compiled;
+        mutable bool             compile_attempted;
 };
 
 #endif
@@ -6,16 +6,32 @@ SPDX-License-Identifier: Apache-2.0
 ***/
 
 #include "Region.hh"
+#include "Interface.hh"
 #ifndef OBJECT_CACHE_HH
 #define OBJECT_CACHE_HH
-#include <map>
+#include <unordered_map>
 #include <string>
+#include <utility>
+#include <functional>
+#include <cstddef>
+
+/// The entries are keyed by the expression and a scope, where the scope is empty unless the expression is evaluated on a subset of the region
 template <typename T> class ObjectCache {
   public:
-    bool GetEntry(const std::string &name, T &ent) const
+    explicit ObjectCache(size_t g = 0) : generation(g)
+    {
+    }
+
+    /// The assembly pass which created the cache, or 0 for a single evaluation
+    size_t GetGeneration() const
+    {
+      return generation;
+    }
+
+    bool GetEntry(const std::string &name, T &ent, const std::string &scope = std::string()) const
     {
       bool ret = false;
-      typename std::map<std::string, T>::const_iterator it = objectmap.find(name);
+      typename objectmap_t::const_iterator it = objectmap.find(key_t(name, scope));
       if (it != objectmap.end())
       {
         ent = (*it).second;
@@ -24,9 +40,9 @@ template <typename T> class ObjectCache {
       return ret;
     }
 
-    void SetEntry(const std::string &name, const T &ent)
+    void SetEntry(const std::string &name, const T &ent, const std::string &scope = std::string())
     {
-      objectmap[name] = ent;
+      objectmap[key_t(name, scope)] = ent;
     }
 
     void clear()
@@ -35,6 +51,31 @@ template <typename T> class ObjectCache {
     }
 
   private:
-    std::map<std::string, T> objectmap;
+    typedef std::pair<std::string, std::string> key_t;
+
+    struct key_hash {
+      size_t operator()(const key_t &k) const
+      {
+        const size_t h = std::hash<std::string>()(k.first);
+        return (k.second.empty()) ? h : (h ^ (std::hash<std::string>()(k.second) + 0x9e3779b9 + (h << 6) + (h >> 2)));
+      }
+    };
+
+    typedef std::unordered_map<key_t, T, key_hash> objectmap_t;
+
+    objectmap_t objectmap;
+    size_t      generation;
 };
+
+namespace MEE {
+/// The cache for an evaluation on the region
+/// During an assembly pass, this is the cache shared by all of the equations until the end of the pass
+template <typename DoubleType>
+ModelExprDataCachePtr<DoubleType> GetModelExprDataCache(const Region &);
+}
+
+namespace IMEE {
+template <typename DoubleType>
+InterfaceModelExprDataCachePtr<DoubleType> GetInterfaceModelExprDataCache(const Interface &);
+}
 #endif
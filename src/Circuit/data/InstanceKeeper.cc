@@ -10,12 +10,15 @@ SPDX-License-Identifier: Apache-2.0
 //#include "matrix.hh"
 #include "Signal.hh"
 #include "dsAssert.hh"
+#include "SimulationContext.hh"
 
 #include <iostream>
 #include <vector>
 #include <utility>
 #include <cmath>
 #include <complex>
+#include <algorithm>
+#include <cfloat>
 
 using std::complex;
 using std::vector;
@@ -23,21 +26,22 @@ using std::pair;
 
 // This class should not ever know the particulars of any one model type
 
-InstanceKeeper *InstanceKeeper::instance_ = 0;
 
 InstanceKeeper &InstanceKeeper::instance()
 {
-    if (!instance_)
+    InstanceKeeper *instance = static_cast<InstanceKeeper *>(SimulationContext::GetInstance(SimulationContext::InstanceSlot::INSTANCEKEEPER));
+    if (!instance)
     {
-        instance_ = new InstanceKeeper;
+        instance = new InstanceKeeper;
+        SimulationContext::SetInstance(SimulationContext::InstanceSlot::INSTANCEKEEPER, instance);
     }
-    return *instance_;
+    return *instance;
 }
 
 void InstanceKeeper::delete_instance()
 {
-    delete instance_;
-    instance_ = nullptr;
+    delete static_cast<InstanceKeeper *>(SimulationContext::GetInstance(SimulationContext::InstanceSlot::INSTANCEKEEPER));
+    SimulationContext::SetInstance(SimulationContext::InstanceSlot::INSTANCEKEEPER, nullptr);
 }
 
 InstanceKeeper::InstanceKeeper() {}
@@ -50,7 +54,10 @@ InstanceModelPtr InstanceKeeper::addInstanceModel(InstanceModelPtr p)
     dsAssert(instMod_.count(nm) == 0, "CIRCUIT_UNEXPECTED");
 
     if (instMod_.count(nm) == 0)
+    {
       instMod_[nm] = p;
+      stampMod_[nm] = p;
+    }
 
     return instMod_[nm];
 }
@@ -72,9 +79,11 @@ InstanceModelPtr InstanceKeeper::addInstanceModel(InstanceModel *p)
 // precomputation iterator can be handled later
 void InstanceKeeper::AssembleDCMatrix(dsMath::RealRowColValueVec<double> &mat, const std::vector<double> &sol, dsMath::RHSEntryVec<double> &rhs)
 {
-    InstanceModelList::iterator iter, end=instMod_.end();
+    linearBatch_.AssembleDC(mat, sol, rhs);
+
+    InstanceModelList::iterator iter, end=stampMod_.end();
 
-    for (iter = instMod_.begin(); iter != end; ++iter)
+    for (iter = stampMod_.begin(); iter != end; ++iter)
     {
         iter->second->assembleDC(sol, mat, rhs);
     }
@@ -84,8 +93,10 @@ void InstanceKeeper::AssembleDCMatrix(dsMath::RealRowColValueVec<double> &mat, c
 // The next two are the AC terms.  Make sure they look the same as above.
 void InstanceKeeper::AssembleTRMatrix(dsMath::RealRowColValueVec<double> *mat, const std::vector<double> &sol, dsMath::RHSEntryVec<double> &rhs, double scl)
 {
-    InstanceModelList::iterator iter, end=instMod_.end();
-    for (iter = instMod_.begin(); iter != end; ++iter)
+    linearBatch_.AssembleTran(mat, sol, rhs, scl);
+
+    InstanceModelList::iterator iter, end=stampMod_.end();
+    for (iter = stampMod_.begin(); iter != end; ++iter)
     {
         //os << "assembling " << iter->first << "\n";
         //// Get this working first, but do we need to load the rhs?? for small-signal AC
@@ -117,6 +128,23 @@ void InstanceKeeper::updateSignals(double t)
     }
 }
 
+void InstanceKeeper::replaceSignal(SignalPtr x, SignalPtr y)
+{
+    sigList_.remove(x);
+    sigList_.push_back(y);
+}
+
+double InstanceKeeper::NextBreakPoint(double t) const
+{
+    double ret = DBL_MAX;
+    SignalList::const_iterator iter, end=sigList_.end();
+    for (iter = sigList_.begin(); iter != end; ++iter)
+    {
+       ret = std::min(ret, (*iter)->NextBreakPoint(t));
+    }
+    return ret;
+}
+
 InstanceModelPtr InstanceKeeper::getInstanceModel(const std::string &name)
 {
     InstanceModelPtr ret;
@@ -129,4 +157,19 @@ InstanceModelPtr InstanceKeeper::getInstanceModel(const std::string &name)
     return ret;
 }
 
+void InstanceKeeper::addLinearElement(const std::string &name, LinearElementBatch::ElementType t, CircuitNodePtr n1, CircuitNodePtr n2, double value)
+{
+    dsAssert(instMod_.count(name) != 0, "CIRCUIT_UNEXPECTED");
+    stampMod_.erase(name);
+    linearBatch_.AddElement(name, t, n1, n2, value);
+}
 
+void InstanceKeeper::alterLinearElement(const std::string &name, const std::string &param, double value)
+{
+    if (linearBatch_.HasElement(name))
+    {
+        //// the instance accepted the parameter, so the batch must too, or it would be stale
+        const bool ok = linearBatch_.SetValue(name, param, value);
+        dsAssert(ok, "CIRCUIT_UNEXPECTED");
+    }
+}
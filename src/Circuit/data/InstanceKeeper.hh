@@ -18,6 +18,7 @@ SPDX-License-Identifier: Apache-2.0
 #include <memory>
 
 #include "InstanceModel.hh"
+#include "LinearElementBatch.hh"
 
 namespace dsMath {
 template <typename T> class RowColVal;
@@ -56,9 +57,18 @@ class InstanceKeeper {
 
         InstanceModelPtr getInstanceModel(const std::string &);
 
+        /// The instance, which must already be added, is stamped from the arrays of its type instead
+        void addLinearElement(const std::string &/*name*/, LinearElementBatch::ElementType, CircuitNodePtr /*n1*/, CircuitNodePtr /*n2*/, double /*value*/);
+        /// Keeps the arrays consistent after a parameter of the instance is changed
+        void alterLinearElement(const std::string &/*name*/, const std::string &/*param*/, double /*value*/);
+
         void addSignal(SignalPtr);
+        /// the old signal is removed, if it was added
+        void replaceSignal(SignalPtr /*old*/, SignalPtr /*new*/);
         // apply the current time step to the signal
         void updateSignals(double);
+        /// the earliest break point of all signals after the time, or DBL_MAX
+        double NextBreakPoint(double) const;
 
         void AssembleDCMatrix(dsMath::RealRowColValueVec<double> &, const std::vector<double> &sol, dsMath::RHSEntryVec<double> &rhs);
         //// This is also used for the ssac
@@ -74,9 +84,10 @@ class InstanceKeeper {
         InstanceKeeper(const InstanceKeeper &);
         InstanceKeeper operator=(const InstanceKeeper &);
 
-        static InstanceKeeper *instance_;
-
         InstanceModelList       instMod_;
+        //// The instances which are not in linearBatch_
+        InstanceModelList       stampMod_;
+        LinearElementBatch      linearBatch_;
         SignalList              sigList_;
 };
 #endif
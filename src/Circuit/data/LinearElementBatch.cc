@@ -0,0 +1,184 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#include "LinearElementBatch.hh"
+#include "NodeKeeper.hh"
+#include "MatrixEntries.hh"
+#include "dsAssert.hh"
+
+#include <cmath>
+
+LinearElementBatch::LinearElementBatch() : valid_(false), numberingVersion_(0)
+{
+}
+
+LinearElementBatch::ElementArrays &LinearElementBatch::GetArrays(ElementType t)
+{
+  return (t == ElementType::RESISTOR) ? resistors_ : capacitors_;
+}
+
+void LinearElementBatch::AddElement(const std::string &name, ElementType t, CircuitNodePtr n1, CircuitNodePtr n2, double value)
+{
+  dsAssert(elementIndex_.count(name) == 0, "CIRCUIT_UNEXPECTED");
+
+  ElementArrays &arrays = GetArrays(t);
+  elementIndex_[name] = std::make_pair(t, arrays.value.size());
+  arrays.n1.push_back(n1);
+  arrays.n2.push_back(n2);
+  arrays.value.push_back(value);
+  valid_ = false;
+}
+
+bool LinearElementBatch::SetValue(const std::string &name, const std::string &param, double value)
+{
+  auto it = elementIndex_.find(name);
+  if (it == elementIndex_.end())
+  {
+    return false;
+  }
+
+  const ElementType t = it->second.first;
+  if (param != ((t == ElementType::RESISTOR) ? "R" : "C"))
+  {
+    return false;
+  }
+
+  GetArrays(t).value[it->second.second] = value;
+  valid_ = false;
+  return true;
+}
+
+/// The entries are in the same order as the generated IdealResistor and IdealCapacitor models
+void LinearElementBatch::UpdateArrays(ElementArrays &arrays, ElementType t)
+{
+  const size_t len = arrays.value.size();
+  arrays.eq1.resize(len);
+  arrays.eq2.resize(len);
+  arrays.scale.resize(len);
+  arrays.current.resize(len);
+  arrays.entries.clear();
+  arrays.entries.reserve(4 * len);
+
+  for (size_t i = 0; i < len; ++i)
+  {
+    const int top = (arrays.n1[i]->isGROUND()) ? -1 : static_cast<int>(arrays.n1[i]->getNumber());
+    const int bot = (arrays.n2[i]->isGROUND()) ? -1 : static_cast<int>(arrays.n2[i]->getNumber());
+    const double g = (t == ElementType::RESISTOR) ? std::pow(arrays.value[i], (-1)) : arrays.value[i];
+
+    arrays.eq1[i]   = top;
+    arrays.eq2[i]   = bot;
+    arrays.scale[i] = g;
+
+    if (bot >= 0)
+    {
+      if (top >= 0)
+      {
+        arrays.entries.push_back(dsMath::RealRowColVal<double>(bot, top, -g));
+      }
+      arrays.entries.push_back(dsMath::RealRowColVal<double>(bot, bot, g));
+    }
+    if (top >= 0)
+    {
+      arrays.entries.push_back(dsMath::RealRowColVal<double>(top, top, g));
+      if (bot >= 0)
+      {
+        arrays.entries.push_back(dsMath::RealRowColVal<double>(top, bot, -g));
+      }
+    }
+  }
+}
+
+void LinearElementBatch::Update()
+{
+  const size_t version = NodeKeeper::instance().GetNumberingVersion();
+  if (valid_ && (version == numberingVersion_))
+  {
+    return;
+  }
+
+  UpdateArrays(resistors_, ElementType::RESISTOR);
+  UpdateArrays(capacitors_, ElementType::CAPACITOR);
+
+  numberingVersion_ = version;
+  valid_ = true;
+}
+
+void LinearElementBatch::CalculateCurrents(ElementArrays &arrays, const std::vector<double> &sol)
+{
+  const size_t len = arrays.scale.size();
+  const int    *eq1   = arrays.eq1.data();
+  const int    *eq2   = arrays.eq2.data();
+  const double *scale = arrays.scale.data();
+  const double *s     = sol.data();
+  double       *cur   = arrays.current.data();
+
+  for (size_t i = 0; i < len; ++i)
+  {
+    const double vtop = (eq1[i] < 0) ? 0.0 : s[eq1[i]];
+    const double vbot = (eq2[i] < 0) ? 0.0 : s[eq2[i]];
+    cur[i] = (vtop - vbot) * scale[i];
+  }
+}
+
+void LinearElementBatch::AssembleRHS(const ElementArrays &arrays, dsMath::RHSEntryVec<double> &rhs, double scl)
+{
+  const size_t len = arrays.scale.size();
+  for (size_t i = 0; i < len; ++i)
+  {
+    const double c = arrays.current[i];
+    if (arrays.eq2[i] >= 0)
+    {
+      rhs.push_back(std::make_pair(arrays.eq2[i], scl * (-c)));
+    }
+    if (arrays.eq1[i] >= 0)
+    {
+      rhs.push_back(std::make_pair(arrays.eq1[i], scl * c));
+    }
+  }
+}
+
+void LinearElementBatch::AssembleDC(dsMath::RealRowColValueVec<double> &mat, const std::vector<double> &sol, dsMath::RHSEntryVec<double> &rhs)
+{
+  if (elementIndex_.empty())
+  {
+    return;
+  }
+
+  Update();
+
+  //// capacitors are open at dc
+  CalculateCurrents(resistors_, sol);
+  AssembleRHS(resistors_, rhs, 1.0);
+
+  mat.insert(mat.end(), resistors_.entries.begin(), resistors_.entries.end());
+}
+
+void LinearElementBatch::AssembleTran(dsMath::RealRowColValueVec<double> *mat, const std::vector<double> &sol, dsMath::RHSEntryVec<double> &rhs, double scl)
+{
+  if (elementIndex_.empty())
+  {
+    return;
+  }
+
+  Update();
+
+  //// resistors have no charge
+  CalculateCurrents(capacitors_, sol);
+  AssembleRHS(capacitors_, rhs, scl);
+
+  if (mat == nullptr)
+  {
+    return;
+  }
+
+  mat->reserve(mat->size() + capacitors_.entries.size());
+  for (const auto &e : capacitors_.entries)
+  {
+    mat->push_back(dsMath::RealRowColVal<double>(e.row, e.col, scl * e.val));
+  }
+}
+
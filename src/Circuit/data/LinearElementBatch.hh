@@ -0,0 +1,75 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#ifndef LINEAR_ELEMENT_BATCH_HH
+#define LINEAR_ELEMENT_BATCH_HH
+
+#include "CircuitNode.hh"
+#include "MatrixEntries.hh"
+
+#include <vector>
+#include <string>
+#include <map>
+#include <utility>
+
+/**
+ * Two terminal linear elements, stored as arrays grouped by type.
+ * Each type is stamped by one loop over its arrays, instead of a virtual call per instance.
+ * The matrix entries only depend on the element values and node numbers,
+ * so they are calculated once, and copied into the matrix on each assembly.
+ */
+class LinearElementBatch {
+    public:
+        enum class ElementType {RESISTOR, CAPACITOR};
+
+        LinearElementBatch();
+
+        void AddElement(const std::string &/*name*/, ElementType, CircuitNodePtr /*n1*/, CircuitNodePtr /*n2*/, double /*value*/);
+
+        /// returns false if the element is not in the batch, or the parameter does not apply
+        bool SetValue(const std::string &/*name*/, const std::string &/*param*/, double /*value*/);
+
+        bool HasElement(const std::string &name) const
+        {
+          return elementIndex_.count(name) != 0;
+        }
+
+        void AssembleDC(dsMath::RealRowColValueVec<double> &, const std::vector<double> &sol, dsMath::RHSEntryVec<double> &rhs);
+        void AssembleTran(dsMath::RealRowColValueVec<double> *, const std::vector<double> &sol, dsMath::RHSEntryVec<double> &rhs, double scl);
+
+    private:
+        struct ElementArrays {
+          std::vector<CircuitNodePtr> n1;
+          std::vector<CircuitNodePtr> n2;
+          std::vector<double>         value;
+
+          //// calculated by Update
+          //// -1 for ground
+          std::vector<int>            eq1;
+          std::vector<int>            eq2;
+          //// conductance or capacitance
+          std::vector<double>         scale;
+          dsMath::RealRowColValueVec<double> entries;
+          //// branch current from the last assembly
+          std::vector<double>         current;
+        };
+
+        void Update();
+        static void UpdateArrays(ElementArrays &, ElementType);
+        static void CalculateCurrents(ElementArrays &, const std::vector<double> &);
+        static void AssembleRHS(const ElementArrays &, dsMath::RHSEntryVec<double> &, double);
+
+        ElementArrays &GetArrays(ElementType);
+
+        std::map<std::string, std::pair<ElementType, size_t>> elementIndex_;
+        ElementArrays resistors_;
+        ElementArrays capacitors_;
+        bool          valid_;
+        size_t        numberingVersion_;
+};
+#endif
+
@@ -10,27 +10,29 @@ SPDX-License-Identifier: Apache-2.0
 #include "GlobalData.hh"
 #include "dsAssert.hh"
 #include "OutputStream.hh"
+#include "SimulationContext.hh"
 
 #include <sstream>
 #include <climits>
 #include <cmath>
 
 
-NodeKeeper *NodeKeeper::instance_ = 0;
 
 NodeKeeper &NodeKeeper::instance()
 {
-    if (!instance_)
+    NodeKeeper *instance = static_cast<NodeKeeper *>(SimulationContext::GetInstance(SimulationContext::InstanceSlot::NODEKEEPER));
+    if (!instance)
     {
-        instance_ = new NodeKeeper;
+        instance = new NodeKeeper;
+        SimulationContext::SetInstance(SimulationContext::InstanceSlot::NODEKEEPER, instance);
     }
-    return *instance_;
+    return *instance;
 }
 
 void NodeKeeper::delete_instance()
 {
-    delete instance_;
-    instance_ = nullptr;
+    delete static_cast<NodeKeeper *>(SimulationContext::GetInstance(SimulationContext::InstanceSlot::NODEKEEPER));
+    SimulationContext::SetInstance(SimulationContext::InstanceSlot::NODEKEEPER, nullptr);
 }
 
 NodeKeeper::NodeKeeper()
@@ -153,6 +155,7 @@ void NodeKeeper::SetNodeNumbers(size_t start, bool verbose) {
     minEquationNumber = start;
 
     bool hasGround = false;
+    bool changed   = !NodesNumbered_;
 
     std::ostringstream os;
 
@@ -161,6 +164,11 @@ void NodeKeeper::SetNodeNumbers(size_t start, bool verbose) {
             iter != end;
             ++iter)
     {
+        const size_t number = (iter->second->isGROUND()) ? size_t(-1) : i;
+        if (iter->second->GetNumber() != number)
+        {
+            changed = true;
+        }
         if (iter->second->isGROUND())
         {
             iter->second->SetNumber(size_t(-1));
@@ -190,6 +198,10 @@ void NodeKeeper::SetNodeNumbers(size_t start, bool verbose) {
 
     NodesNumbered_ = true;
 
+    if (changed)
+    {
+        ++numberingVersion_;
+    }
 }
 
 size_t NodeKeeper::GetMaxEquationNumber()
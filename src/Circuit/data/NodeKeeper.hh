@@ -89,6 +89,8 @@ class NodeKeeper {
         size_t GetEquationNumber(const std::string &);
 
         void   SetNodeNumbers(size_t /*start*/, bool /*verbose*/);
+        /// Changes whenever SetNodeNumbers gives a node a different number
+        size_t GetNumberingVersion() const {return numberingVersion_;}
         size_t GetMaxEquationNumber();
         size_t GetMinEquationNumber();
 
@@ -111,8 +113,6 @@ class NodeKeeper {
         NodeKeeper(const NodeKeeper &);
         NodeKeeper operator=(const NodeKeeper &);
 
-        static NodeKeeper *instance_;
-
         NodeTable_t       NodeTable_;
         NodeAliasTable_t  NodeAliasTable_;
         SolutionMap_t     Sol_;
@@ -121,6 +121,7 @@ class NodeKeeper {
         bool            NodesNumbered_ = false;
         size_t          minEquationNumber = 0;
         size_t          maxEquationNumber = 0;
+        size_t          numberingVersion_ = 0;
         NormMap_t       absError;
         NormMap_t       relError;
 };
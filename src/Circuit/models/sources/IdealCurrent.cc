@@ -64,3 +64,8 @@ bool IdealCurrent::addParam(const std::string &nm, double v)
     return ret;
 }
 
+void IdealCurrent::setSignal(SignalPtr sig)
+{
+    InstanceKeeper::instance().replaceSignal(sig_, sig);
+    sig_ = sig;
+}
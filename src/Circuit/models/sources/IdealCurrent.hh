@@ -33,6 +33,8 @@ class IdealCurrent : public InstanceModel {
 //      void getDCStamp(Matrix::RowColEntryVec &);
 //      void getTranStamp(Matrix::RowColEntryVec &) {};
         bool addParam(const std::string &, double);
+        /// The new signal replaces the old one for transient simulation
+        void setSignal(SignalPtr);
 
     private:
         void assembleDC_impl(const NodeKeeper::Solution &, dsMath::RealRowColValueVec<double> &, dsMath::RHSEntryVec<double> &);
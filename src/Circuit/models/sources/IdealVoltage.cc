@@ -152,3 +152,8 @@ bool IdealVoltage::addParam(const std::string &nm, double v)
     return ret;
 }
 
+void IdealVoltage::setSignal(SignalPtr sig)
+{
+    InstanceKeeper::instance().replaceSignal(sig_, sig);
+    sig_ = sig;
+}
@@ -45,6 +45,8 @@ class IdealVoltage : public InstanceModel {
 //      void getDCStamp(Matrix::RowColEntryVec &);
 //      void getTranStamp(Matrix::RowColEntryVec &) {};
         bool addParam(const std::string &, double);
+        /// The new signal replaces the old one for transient simulation
+        void setSignal(SignalPtr);
     private:
         void assembleACRHS_impl(std::vector<std::pair<size_t, std::complex<double> > > &);
         void assembleDC_impl(const NodeKeeper::Solution &, dsMath::RealRowColValueVec<double> &, dsMath::RHSEntryVec<double> &);
@@ -45,69 +45,38 @@ Pulse::Pulse(double v1,
          _volt=v1;
 }
 
-// Need to make best numerical accuracy possible
 // return time of the next break point, not time until
+// The break points are the corners of the waveform, and are strictly after tnow.
+// A period of 0 is a single pulse.
 double Pulse::NextBreakPoint(double tnow)
 {
-   // number of periods already traversed
-   // not considering td
-   double numper = floor((tnow-_td) / _per);
-
-   double adj = (numper - 1.0) * _per;
-
-   // This eliminates all of the redundant cycles
-   double t = tnow - adj;
-
-   // don't need to correct for number of periods
-   if (t < _td)
+   if (tnow < _td)
       return _td;
 
-   double ans = 0.0;
-   // Add smallest numbers first
-   std::vector<double> tpts;
-   tpts.push_back(adj);
-   tpts.push_back(_td);
-   tpts.push_back(_tr);
-   std::sort(tpts.begin(),tpts.end());
-   for (size_t i = tpts.size(); i != 0; --i)
-      ans += tpts[i-1];
-
-   if (tnow < ans)
-      return ans;
-
-   ans=0.0;
-   tpts.push_back(_pw);
-   std::sort(tpts.begin(),tpts.end());
-   for (size_t i = tpts.size(); i != 0; --i)
-      ans += tpts[i-1];
-
-   if (tnow < ans)
-      return ans;
-
-   ans = 0.0;
-   tpts.push_back(_tf);
-   std::sort(tpts.begin(),tpts.end());
-   for (size_t i = tpts.size(); i != 0; --i)
-      ans += tpts[i-1];
-
-   if (tnow < ans)
-      return ans;
-
-   ans = 0.0;
-   tpts.clear();
-   tpts.push_back(_td);
-   tpts.push_back(adj);
-   tpts.push_back(_per);
-   std::sort(tpts.begin(),tpts.end());
-   for (size_t i = tpts.size(); i != 0; --i)
-      ans += tpts[i-1];
-
-   if (t < ans)
-      return ans;
-
-   ans = 0.0;
-   return ans;
+   // start of the current period
+   double base = _td;
+   if (_per > 0.0)
+      base += floor((tnow - _td) / _per) * _per;
+
+   const double corners[] = {_tr, _tr + _pw, _tr + _pw + _tf};
+
+   // the floor may be off by one period, so check the next period too
+   const size_t numstart = (_per > 0.0) ? 3 : 1;
+   for (size_t i = 0; i < numstart; ++i)
+   {
+      const double start = base + static_cast<double>(i) * _per;
+      if (start > tnow)
+         return start;
+
+      for (const double c : corners)
+      {
+         const double t = start + c;
+         if (t > tnow)
+            return t;
+      }
+   }
 
+   return DBL_MAX;
 }
 
 double Pulse::CalcVoltage(double tnow)
@@ -118,7 +87,7 @@ double Pulse::CalcVoltage(double tnow)
 
    // number of periods already traversed
    // not considering td
-   double numper = floor((tnow-_td) / _per);
+   double numper = (_per > 0.0) ? floor((tnow-_td) / _per) : 0.0;
 
    double adj = (numper) * _per;
 
@@ -13,12 +13,11 @@ SPDX-License-Identifier: Apache-2.0
 #include "OutputStream.hh"
 #include "dsAssert.hh"
 #include "ObjectHolder.hh"
+#include "SimulationContext.hh"
 
 #include <sstream>
 
 
-GlobalData *GlobalData::instance = 0;
-
 GlobalData::GlobalData()
 {
   InitializeParameters();
@@ -26,17 +25,19 @@ GlobalData::GlobalData()
 
 GlobalData &GlobalData::GetInstance()
 {
+    GlobalData *instance = static_cast<GlobalData *>(SimulationContext::GetInstance(SimulationContext::InstanceSlot::GLOBALDATA));
     if (!instance)
     {
         instance = new GlobalData;
+        SimulationContext::SetInstance(SimulationContext::InstanceSlot::GLOBALDATA, instance);
     }
     return *instance;
 }
 
 void GlobalData::DestroyInstance()
 {
-    delete instance;
-    instance = nullptr;
+    delete static_cast<GlobalData *>(SimulationContext::GetInstance(SimulationContext::InstanceSlot::GLOBALDATA));
+    SimulationContext::SetInstance(SimulationContext::InstanceSlot::GLOBALDATA, nullptr);
 }
 
 GlobalData::~GlobalData()
@@ -95,6 +96,7 @@ bool GlobalData::DeleteDevice(const std::string &nm)
 void GlobalData::AddDBEntryOnDevice(const std::string &device, const std::string &name, ObjectHolder value)
 {
     deviceData[device][name] = value;
+    ClearParameterValues(device, "", name);
 
     SignalCallbacksOnDevice(device, name);
 }
@@ -102,6 +104,7 @@ void GlobalData::AddDBEntryOnDevice(const std::string &device, const std::string
 void GlobalData::AddDBEntryOnRegion(const std::string &device, const std::string &region, const std::string &name, ObjectHolder value)
 {
     regionData[device][region][name] = value;
+    ClearParameterValues(device, region, name);
     SignalCallbacksOnRegion(device, region, name);
 }
 
@@ -116,6 +119,7 @@ void GlobalData::AddDBEntryOnRegion(const Region *rp, const std::string &name, O
 void GlobalData::AddDBEntryOnGlobal(const std::string &name, ObjectHolder value)
 {
     globalData[name] = value;
+    ClearParameterValues("", "", name);
     SignalCallbacksOnGlobal(name);
 }
 
@@ -196,6 +200,87 @@ GlobalData::DBEntry_t GlobalData::GetDBEntryOnGlobal(const std::string &name) co
 }
 
 GlobalData::DoubleDBEntry_t GlobalData::GetDoubleDBEntryOnRegion(const Region *rp, const std::string &name) const
+{
+  return GetDoubleDBEntryOnRegion(rp, GetParameterSymbol(name));
+}
+
+size_t GlobalData::GetParameterSymbol(const std::string &name) const
+{
+  std::lock_guard<std::mutex> lock(parameterMutex);
+
+  auto it = parameterSymbols.find(name);
+  if (it != parameterSymbols.end())
+  {
+    return it->second;
+  }
+
+  const size_t symbol = parameterNames.size();
+  parameterSymbols[name] = symbol;
+  parameterNames.push_back(name);
+  return symbol;
+}
+
+const std::string &GlobalData::GetParameterName(size_t symbol) const
+{
+  std::lock_guard<std::mutex> lock(parameterMutex);
+  dsAssert(symbol < parameterNames.size(), "UNEXPECTED");
+  return parameterNames[symbol];
+}
+
+GlobalData::DoubleDBEntry_t GlobalData::GetDoubleDBEntryOnRegion(const Region *rp, size_t symbol) const
+{
+  Region::ParameterValueList_t &values = rp->GetParameterValueList();
+  if (symbol >= values.size())
+  {
+    std::lock_guard<std::mutex> lock(parameterMutex);
+    dsAssert(symbol < parameterNames.size(), "UNEXPECTED");
+    values.resize(parameterNames.size());
+  }
+
+  Region::ParameterValue &pv = values[symbol];
+  if (!pv.resolved)
+  {
+    const DoubleDBEntry_t &dbent = FindDoubleDBEntryOnRegion(rp, GetParameterName(symbol));
+    pv.resolved = true;
+    pv.found    = dbent.first;
+    pv.value    = dbent.second;
+  }
+
+  return std::make_pair(pv.found, pv.value);
+}
+
+void GlobalData::ClearParameterValues(const std::string &device, const std::string &region, const std::string &name)
+{
+  size_t symbol = 0;
+  {
+    std::lock_guard<std::mutex> lock(parameterMutex);
+    auto sit = parameterSymbols.find(name);
+    if (sit == parameterSymbols.end())
+    {
+      return;
+    }
+    symbol = sit->second;
+  }
+
+  for (DeviceList_t::iterator dit = deviceList.begin(); dit != deviceList.end(); ++dit)
+  {
+    if (!device.empty() && (device != dit->first))
+    {
+      continue;
+    }
+
+    const Device::RegionList_t &rlist = (dit->second)->GetRegionList();
+    for (Device::RegionList_t::const_iterator rit = rlist.begin(); rit != rlist.end(); ++rit)
+    {
+      if (region.empty() || (region == rit->first))
+      {
+        (rit->second)->ClearParameterValue(symbol);
+      }
+    }
+  }
+}
+
+GlobalData::DoubleDBEntry_t GlobalData::FindDoubleDBEntryOnRegion(const Region *rp, const std::string &name) const
 {
   DoubleDBEntry_t ret = std::make_pair(false, 0.0);
   DBEntry_t       dbent = GetDBEntryOnRegion(rp, name);
@@ -10,6 +10,9 @@ SPDX-License-Identifier: Apache-2.0
 #include <string>
 #include <vector>
 #include <map>
+#include <unordered_map>
+#include <deque>
+#include <mutex>
 
 class Region;
 typedef Region *RegionPtr;
@@ -58,6 +61,11 @@ class GlobalData
         GlobalData::DBEntry_t GetDBEntryOnGlobal(const std::string &/*name*/) const;
         GlobalData::DoubleDBEntry_t GetDoubleDBEntryOnRegion(const Region * /*rp*/, const std::string &/*name*/) const;
 
+        //// Parameter names are interned as symbols, which index the resolved parameter values of each region
+        size_t GetParameterSymbol(const std::string &/*name*/) const;
+        const std::string &GetParameterName(size_t /*symbol*/) const;
+        GlobalData::DoubleDBEntry_t GetDoubleDBEntryOnRegion(const Region * /*rp*/, size_t /*symbol*/) const;
+
         //// Only retrieves the name of the parameters
         //// The list doesn't search recursively up the hierarchy
         std::vector<std::string> GetDBEntryListOnGlobal() const;
@@ -86,11 +94,14 @@ class GlobalData
     private:
         void InitializeParameters();
 
+        GlobalData::DoubleDBEntry_t FindDoubleDBEntryOnRegion(const Region * /*rp*/, const std::string &/*name*/) const;
+        //// An empty device or region is every device or region
+        void ClearParameterValues(const std::string &/*device*/, const std::string &/*region*/, const std::string &/*name*/);
+
         GlobalData();
         GlobalData(GlobalData &);
         GlobalData &operator=(GlobalData &);
         ~GlobalData();
-        static GlobalData *instance;
 
         DeviceList_t deviceList;
 
@@ -99,6 +110,12 @@ class GlobalData
         GlobalDataMap_t   globalData;
 
         TclEquationList_t tclEquationList;
+
+        //// the symbols are interned while the models of different regions are evaluated at the same time
+        //// the names are not moved when a new one is added
+        mutable std::mutex                              parameterMutex;
+        mutable std::unordered_map<std::string, size_t> parameterSymbols;
+        mutable std::deque<std::string>                 parameterNames;
 };
 #endif
 
@@ -27,6 +27,7 @@ SPDX-License-Identifier: Apache-2.0
 #include "dsAssert.hh"
 #include "EdgeData.hh"
 #include "EquationErrors.hh"
+#include "ParallelReduce.hh"
 
 #include <algorithm>
 #include <sstream>
@@ -216,12 +217,11 @@ DoubleType ContactEquation<DoubleType>::integrateNodeModelOverNodes(const std::s
 
     NodeScalarData<DoubleType> nsd(*nv);
     nsd.times_equal_model(*nm);
+    const std::vector<DoubleType> &nvals = nsd.GetScalarList();
 
-    for (ConstNodeList_t::const_iterator cit = cnodes.begin(); cit != cnodes.end(); ++cit)
-    {
-      const DoubleType nodeval = nsd[(*cit)->GetIndex()];
-      ch += nodeval;
-    }
+    ch = dsMath::ParallelSum<DoubleType>(cnodes.size(), [&](size_t i) {
+      return nvals[cnodes[i]->GetIndex()];
+    });
   }
   return ch;
 }
@@ -257,12 +257,14 @@ DoubleType ContactEquation<DoubleType>::integrateEdgeModelOverNodes(const std::s
 
     EdgeScalarData<DoubleType> esd(*ec);
     esd.times_equal_model(*em);
+    const std::vector<DoubleType> &evals = esd.GetScalarList();
 
     const Region::NodeToConstEdgeList_t &ntelist = region.GetNodeToEdgeList();
 
-    for (ConstNodeList_t::const_iterator cit = cnodes.begin(); cit != cnodes.end(); ++cit)
-    {
-      const ConstEdgeList &el = ntelist[(*cit)->GetIndex()];
+    ch = dsMath::ParallelSum<DoubleType>(cnodes.size(), [&](size_t i) {
+      const Node *cnode = cnodes[i];
+      DoubleType nch = 0.0;
+      const ConstEdgeList &el = ntelist[cnode->GetIndex()];
       ConstEdgeList::const_iterator it = el.begin();
       const ConstEdgeList::const_iterator itend = el.end();
       for ( ; it != itend; ++it)
@@ -272,11 +274,12 @@ DoubleType ContactEquation<DoubleType>::integrateEdgeModelOverNodes(const std::s
           continue;
         }
 
-        DoubleType val = GetHeadOrTail(**it, *cit, n0_sign, n1_sign, static_cast<DoubleType>(0.0));
-        val *= esd[(*it)->GetIndex()];
-        ch += val;
+        DoubleType val = GetHeadOrTail(**it, cnode, n0_sign, n1_sign, static_cast<DoubleType>(0.0));
+        val *= evals[(*it)->GetIndex()];
+        nch += val;
       }
-    }
+      return nch;
+    });
   }
   return ch;
 }
@@ -311,13 +314,15 @@ DoubleType ContactEquation<DoubleType>::integrateTriangleEdgeModelOverNodes(cons
 
     TriangleEdgeScalarData<DoubleType> esd(*ec);
     esd.times_equal_model(*em);
+    const std::vector<DoubleType> &evals = esd.GetScalarList();
 
     const Region::TriangleToConstEdgeList_t &ttelist = region.GetTriangleToEdgeList();
     const Region::NodeToConstTriangleList_t &nttlist = region.GetNodeToTriangleList();
 
-    for (ConstNodeList_t::const_iterator cit = cnodes.begin(); cit != cnodes.end(); ++cit)
-    {
-      const ConstTriangleList &ntl = nttlist[(*cit)->GetIndex()];
+    ch = dsMath::ParallelSum<DoubleType>(cnodes.size(), [&](size_t i) {
+      const Node *cnode = cnodes[i];
+      DoubleType nch = 0.0;
+      const ConstTriangleList &ntl = nttlist[cnode->GetIndex()];
       for (ConstTriangleList::const_iterator ti = ntl.begin(); ti != ntl.end(); ++ti)
       {
         const Triangle &triangle = **ti;
@@ -327,19 +332,20 @@ DoubleType ContactEquation<DoubleType>::integrateTriangleEdgeModelOverNodes(cons
         {
           const Edge &edge = *edgeList[eindex];
 
-          auto val = GetHeadOrTail(edge, *cit, n0_sign, n1_sign, DoubleType(0.0));
+          auto val = GetHeadOrTail(edge, cnode, n0_sign, n1_sign, DoubleType(0.0));
 
           if ( (val == DoubleType(0.0)) || bothNodesOnContact(cnode_set, edge, n0_sign, n1_sign))
           {
             continue;
           }
 
-          val *= esd[3 * tindex + eindex];
+          val *= evals[3 * tindex + eindex];
 
-          ch += val;
+          nch += val;
         }
       }
-    }
+      return nch;
+    });
   }
   return ch;
 }
@@ -373,13 +379,15 @@ DoubleType ContactEquation<DoubleType>::integrateTetrahedronEdgeModelOverNodes(c
 
     TetrahedronEdgeScalarData<DoubleType> esd(*ec);
     esd.times_equal_model(*em);
+    const std::vector<DoubleType> &evals = esd.GetScalarList();
 
     const Region::TetrahedronToConstEdgeDataList_t &ttelist = region.GetTetrahedronToEdgeDataList();
     const Region::NodeToConstTetrahedronList_t &nttlist = region.GetNodeToTetrahedronList();
 
-    for (ConstNodeList_t::const_iterator cit = cnodes.begin(); cit != cnodes.end(); ++cit)
-    {
-      const ConstTetrahedronList &ntl = nttlist[(*cit)->GetIndex()];
+    ch = dsMath::ParallelSum<DoubleType>(cnodes.size(), [&](size_t i) {
+      const Node *cnode = cnodes[i];
+      DoubleType nch = 0.0;
+      const ConstTetrahedronList &ntl = nttlist[cnode->GetIndex()];
       for (ConstTetrahedronList::const_iterator ti = ntl.begin(); ti != ntl.end(); ++ti)
       {
         const Tetrahedron &tetrahedron = **ti;
@@ -389,19 +397,20 @@ DoubleType ContactEquation<DoubleType>::integrateTetrahedronEdgeModelOverNodes(c
         {
           const Edge &edge = *(edgeDataList[eindex]->edge);
 
-          auto val = GetHeadOrTail(edge, *cit, n0_sign, n1_sign, DoubleType(0.0));
+          auto val = GetHeadOrTail(edge, cnode, n0_sign, n1_sign, DoubleType(0.0));
 
           if ( (val == DoubleType(0.0)) || bothNodesOnContact(cnode_set, edge, n0_sign, n1_sign))
           {
             continue;
           }
 
-          val *= esd[6 * tindex + eindex];
+          val *= evals[6 * tindex + eindex];
 
-          ch += val;
+          nch += val;
         }
       }
-    }
+      return nch;
+    });
   }
   return ch;
 }
@@ -110,6 +110,22 @@ std::string ContactEquationHolder::GetName() const
   return ret;
 }
 
+std::string ContactEquationHolder::GetCircuitNode() const
+{
+  std::string ret;
+  if (double_)
+  {
+    ret = (*double_).GetCircuitNode();
+  }
+#ifdef DEVSIM_EXTENDED_PRECISION
+  if (float128_)
+  {
+    ret = (*float128_).GetCircuitNode();
+  }
+#endif
+  return ret;
+}
+
 void ContactEquationHolder::UpdateContact() const
 {
   if (double_)
@@ -61,6 +61,7 @@ class ContactEquationHolder {
     DoubleType GetCharge() const;
 
     std::string GetName() const;
+    std::string GetCircuitNode() const;
     bool operator==(const ContactEquationHolder &) const;
     void UpdateContact() const;
     template <typename DoubleType>
@@ -19,6 +19,8 @@ SPDX-License-Identifier: Apache-2.0
 #include "EdgeData.hh"
 
 #include "Triangle.hh"
+#include "TriangleEdgeModel.hh"
+#include "TetrahedronEdgeModel.hh"
 
 #include "MatrixEntries.hh"
 
@@ -29,12 +31,208 @@ SPDX-License-Identifier: Apache-2.0
 #include "dsAssert.hh"
 
 #include "EquationErrors.hh"
+#include "ParallelReduce.hh"
 
 #include "Permutation.hh"
 
 #include <cmath>
+#include <algorithm>
+#include <initializer_list>
 using std::abs;
 
+namespace {
+/// The values of a model, where a uniform model, or a sparse model with a zero background, is not expanded
+template <typename T, typename DoubleType>
+class ModelValues {
+  public:
+    explicit ModelValues(const T &m) : values(nullptr), uniform_value(0.0), sparse_indexes(nullptr)
+    {
+      static const std::vector<size_t> none;
+
+      if (m.IsUniform())
+      {
+        uniform_value = m.template GetUniformValue<DoubleType>();
+        if (uniform_value == 0.0)
+        {
+          sparse_indexes = &none;
+        }
+      }
+      else if (m.IsSparse() && (m.template GetUniformValue<DoubleType>() == 0.0))
+      {
+        sparse_indexes = &m.GetSparseIndexes();
+        values = m.template GetSparseValues<DoubleType>().data();
+      }
+      else
+      {
+        values = m.template GetScalarValues<DoubleType>().data();
+      }
+    }
+
+    DoubleType operator[](size_t i) const
+    {
+      if (!sparse_indexes)
+      {
+        return (values) ? values[i] : uniform_value;
+      }
+
+      const auto it = std::lower_bound(sparse_indexes->begin(), sparse_indexes->end(), i);
+      if ((it != sparse_indexes->end()) && (*it == i))
+      {
+        return values[it - sparse_indexes->begin()];
+      }
+      return 0.0;
+    }
+
+    /// The only indexes which may be nonzero, or nullptr when any of them may be
+    const std::vector<size_t> *GetSupport() const
+    {
+      return sparse_indexes;
+    }
+
+  private:
+    const DoubleType *values;
+    DoubleType        uniform_value;
+    const std::vector<size_t> *sparse_indexes;
+};
+
+/// The product of a model and its couple, which is calculated as each entry is assembled
+template <typename T, typename DoubleType>
+class CoupledValues {
+  public:
+    CoupledValues(const T &m, const T &couple) : model_values(m), couple_values(couple)
+    {
+    }
+
+    DoubleType operator[](size_t i) const
+    {
+      return model_values[i] * couple_values[i];
+    }
+
+    const std::vector<size_t> *GetSupport() const
+    {
+      const std::vector<size_t> *ret = model_values.GetSupport();
+      return (ret) ? ret : couple_values.GetSupport();
+    }
+
+  private:
+    ModelValues<T, DoubleType> model_values;
+    ModelValues<T, DoubleType> couple_values;
+};
+
+/// The indexes to assemble, which are every index unless all of the values are sparse
+class AssemblyIndexes {
+  public:
+    AssemblyIndexes(size_t len, std::initializer_list<const std::vector<size_t> *> supports) : length(len), use_all(false)
+    {
+      for (auto support : supports)
+      {
+        if (!support)
+        {
+          use_all = true;
+          return;
+        }
+      }
+
+      std::vector<size_t> merged;
+      for (auto support : supports)
+      {
+        merged.clear();
+        std::set_union(indexes.begin(), indexes.end(), support->begin(), support->end(), std::back_inserter(merged));
+        indexes.swap(merged);
+      }
+    }
+
+    size_t size() const
+    {
+      return (use_all) ? length : indexes.size();
+    }
+
+    size_t operator[](size_t k) const
+    {
+      return (use_all) ? k : indexes[k];
+    }
+
+  private:
+    size_t              length;
+    bool                use_all;
+    std::vector<size_t> indexes;
+};
+
+/// How each type of model is found on the region, and the names of its derivatives with respect to each node
+template <typename T>
+struct AssemblyPlanTraits;
+
+template <>
+struct AssemblyPlanTraits<NodeModel> {
+  static constexpr dsErrors::ModelInfo::ModelType model_type = dsErrors::ModelInfo::NODE;
+  static constexpr const char *suffix[] = {""};
+  static ConstNodeModelPtr GetModel(const Region &r, const std::string &name)
+  {
+    return r.GetNodeModel(name);
+  }
+};
+
+template <>
+struct AssemblyPlanTraits<EdgeModel> {
+  static constexpr dsErrors::ModelInfo::ModelType model_type = dsErrors::ModelInfo::EDGE;
+  static constexpr const char *suffix[] = {"@n0", "@n1"};
+  static ConstEdgeModelPtr GetModel(const Region &r, const std::string &name)
+  {
+    return r.GetEdgeModel(name);
+  }
+};
+
+template <>
+struct AssemblyPlanTraits<TriangleEdgeModel> {
+  static constexpr dsErrors::ModelInfo::ModelType model_type = dsErrors::ModelInfo::ELEMENTEDGE;
+  static constexpr const char *suffix[] = {"@en0", "@en1", "@en2"};
+  static ConstTriangleEdgeModelPtr GetModel(const Region &r, const std::string &name)
+  {
+    return r.GetTriangleEdgeModel(name);
+  }
+};
+
+template <>
+struct AssemblyPlanTraits<TetrahedronEdgeModel> {
+  static constexpr dsErrors::ModelInfo::ModelType model_type = dsErrors::ModelInfo::ELEMENTEDGE;
+  static constexpr const char *suffix[] = {"@en0", "@en1", "@en2", "@en3"};
+  static ConstTetrahedronEdgeModelPtr GetModel(const Region &r, const std::string &name)
+  {
+    return r.GetTetrahedronEdgeModel(name);
+  }
+};
+
+/// Checking for a uniform value calculates a model which is out of date
+template <typename M>
+void PrefetchPlanModels(const M &plans, size_t version, size_t pass, bool derivatives)
+{
+  for (const auto &it : plans)
+  {
+    const auto &plan = it.second;
+    if ((plan.version != version) || (plan.pass != pass))
+    {
+      continue;
+    }
+
+    plan.model->IsUniform();
+    plan.couple->IsUniform();
+
+    if (!derivatives)
+    {
+      continue;
+    }
+
+    for (const auto &derivative : plan.derivatives)
+    {
+      for (const auto &model : derivative.models)
+      {
+        model->IsUniform();
+      }
+    }
+  }
+}
+}
+
 namespace EquationEnum
 {
   // must match enum UpdateType in header
@@ -110,7 +308,7 @@ size_t Equation<DoubleType>::GetRelErrorNodeIndex() const
 
 template <typename DoubleType>
 Equation<DoubleType>::Equation(const std::string &nm, RegionPtr rp, const std::string &var, EquationEnum::UpdateType ut)
-    : myname(nm), myregion(rp), variable(var), absError(0.0), relError(0.0), absErrorNodeIndex(0), relErrorNodeIndex(0), minError(defminError), updateType(ut)
+    : myname(nm), myregion(rp), variable(var), absError(0.0), relError(0.0), absErrorNodeIndex(0), relErrorNodeIndex(0), minError(defminError), updateType(ut), assemblePass(0)
 {
 }
 
@@ -126,9 +324,21 @@ void Equation<DoubleType>::Assemble(dsMath::RealRowColValueVec<DoubleType> &m, d
     // get noncontact node list from Region
     // assemble each row individually
     // or better yet send exclusion list of rows off to the matrix class
+    ++assemblePass;
     DerivedAssemble(m, v, w, t);
 }
 
+template <typename DoubleType>
+void Equation<DoubleType>::PrefetchModels(dsMathEnum::WhatToLoad w) const
+{
+  const size_t version = GetRegion().GetAssemblyVersion();
+  const bool derivatives = (w == dsMathEnum::WhatToLoad::MATRIXONLY) || (w == dsMathEnum::WhatToLoad::MATRIXANDRHS);
+  PrefetchPlanModels(nodeVolumePlans, version, assemblePass, derivatives);
+  PrefetchPlanModels(edgeCouplePlans, version, assemblePass, derivatives);
+  PrefetchPlanModels(triangleEdgeCouplePlans, version, assemblePass, derivatives);
+  PrefetchPlanModels(tetrahedronEdgeCouplePlans, version, assemblePass, derivatives);
+}
+
 template <typename DoubleType>
 void Equation<DoubleType>::Update(NodeModel &nm, const dsMath::DoubleVec_t<DoubleType> &rhs)
 {
@@ -283,30 +493,17 @@ void Equation<DoubleType>::DefaultUpdate(NodeModel &nm, const dsMath::DoubleVec_
 
     nm.SetValues(nvals);
 
-    DoubleType aerr = 0.0;
-    DoubleType rerr = 0.0;
-    size_t     aerr_node = 0;
-
-    for (size_t i = 0; i < upds.size(); ++i)
-    {
-        const DoubleType n1 = abs(upds[i]);
-
-        if (n1 > aerr)
-        {
-          aerr = n1;
-          aerr_node = i;
-        }
-
-        const DoubleType n2 = abs(nvals[i]);
-
-        const DoubleType nrerror =  n1 / (n2 + minError);
-
-        if (nrerror > rerr)
-        {
-            rerr = nrerror;
-        }
+    //// the lowest node index is reported for equal errors, so the result does not depend on the number of threads
+    const auto &amax = dsMath::ParallelMax<DoubleType>(upds.size(), [&](size_t i) {
+        return abs(upds[i]);
+    });
+    const auto &rmax = dsMath::ParallelMax<DoubleType>(upds.size(), [&](size_t i) {
+        return abs(upds[i]) / (abs(nvals[i]) + minError);
+    });
 
-    }
+    const DoubleType aerr = amax.first;
+    const DoubleType rerr = rmax.first;
+    const size_t     aerr_node = amax.second;
 
     setAbsError(aerr);
     setRelError(rerr);
@@ -433,26 +630,125 @@ void Equation<DoubleType>::DefaultNoiseUpdate(const std::string &outputname, con
 }
 
 template <typename DoubleType>
-void Equation<DoubleType>::EdgeAssembleRHS(dsMath::RHSEntryVec<DoubleType> &v, const EdgeScalarData<DoubleType> &eflux, const DoubleType n0_sign, const DoubleType n1_sign)
+template <typename T, size_t N>
+const typename Equation<DoubleType>::template AssemblyPlan<T, N> *Equation<DoubleType>::GetAssemblyPlan(std::map<PlanKey_t, AssemblyPlan<T, N>> &plans, const std::string &model, const std::string &couple)
 {
-    const Region &r = GetRegion();
-    const size_t eqindex0 = r.GetEquationIndex(myname);
-//    dsAssert(eqindex0 != size_t(-1), "UNEXPECTED");
-    if (eqindex0 == size_t(-1))
+  typedef AssemblyPlanTraits<T> traits_t;
+  static_assert(N == sizeof(traits_t::suffix)/sizeof(traits_t::suffix[0]), "UNEXPECTED");
+
+  const Region &r = GetRegion();
+  const size_t version = r.GetAssemblyVersion();
+
+  const PlanKey_t key(model, couple);
+  auto it = plans.find(key);
+  if ((it != plans.end()) && (it->second.version == version))
+  {
+    it->second.pass = assemblePass;
+    return &(it->second);
+  }
+
+  AssemblyPlan<T, N> plan;
+
+  plan.model = traits_t::GetModel(r, model);
+  if (!plan.model)
+  {
+    dsErrors::MissingEquationModel(r, myname, model, traits_t::model_type, OutputStream::OutputType::FATAL);
+    return nullptr;
+  }
+
+  plan.couple = traits_t::GetModel(r, couple);
+  if (!plan.couple)
+  {
+    dsErrors::MissingEquationModel(r, myname, couple, traits_t::model_type, OutputStream::OutputType::FATAL);
+    return nullptr;
+  }
+
+  plan.eqindex = r.GetEquationIndex(myname);
+  if (plan.eqindex == size_t(-1))
+  {
+    dsErrors::MissingEquationIndex(r, myname, "", OutputStream::OutputType::FATAL) ;
+    return nullptr;
+  }
+
+  const VariableList_t &vlist = r.GetVariableList();
+  for (const auto &var : vlist)
+  {
+    const std::string &dermodel = GetDerivativeModelName(model, var);
+
+    std::array<std::string, N> dermodels;
+    typename AssemblyPlan<T, N>::Derivative derivative;
+    size_t number_found = 0;
+    for (size_t i = 0; i < N; ++i)
     {
-      dsErrors::MissingEquationIndex(r, myname, "", OutputStream::OutputType::FATAL) ;
-      return;
+      dermodels[i] = dermodel + traits_t::suffix[i];
+      derivative.models[i] = traits_t::GetModel(r, dermodels[i]);
+      if (derivative.models[i])
+      {
+        ++number_found;
+      }
+    }
+
+    if (number_found == 0)
+    {
+      for (size_t i = 0; i < N; ++i)
+      {
+        dsErrors::MissingEquationModel(r, myname, dermodels[i], traits_t::model_type, OutputStream::OutputType::VERBOSE1);
+      }
+      continue;
     }
 
+    /// Derivatives with respect to every node must exist
+    for (size_t i = 0; i < N; ++i)
+    {
+      if (!derivative.models[i])
+      {
+        dsErrors::MissingEquationModel(r, myname, dermodels[i], traits_t::model_type, OutputStream::OutputType::FATAL);
+        return nullptr;
+      }
+    }
+
+    derivative.eqindex = r.GetEquationIndex(r.GetEquationNameFromVariable(var));
+    if (derivative.eqindex == size_t(-1))
+    {
+      dsErrors::MissingEquationIndex(r, myname, var, OutputStream::OutputType::FATAL) ;
+      return nullptr;
+    }
+
+    plan.derivatives.push_back(derivative);
+  }
+
+  plan.version = version;
+  plan.pass = assemblePass;
+
+  AssemblyPlan<T, N> &ret = plans[key];
+  ret = std::move(plan);
+  return &ret;
+}
+
+template <typename DoubleType>
+void Equation<DoubleType>::EdgeAssembleRHS(dsMath::RHSEntryVec<DoubleType> &v, const EdgeCouplePlan &plan, const DoubleType n0_sign, const DoubleType n1_sign)
+{
+    const Region &r = GetRegion();
+    const size_t eqindex0 = plan.eqindex;
+
+    const CoupledValues<EdgeModel, DoubleType> eflux(*plan.model, *plan.couple);
+
     const ConstEdgeList &el = r.GetEdgeList();
-    for (size_t i = 0 ; i < el.size(); ++i)
+    const AssemblyIndexes indexes(el.size(), {eflux.GetSupport()});
+    for (size_t k = 0 ; k < indexes.size(); ++k)
     {
+        const size_t i = indexes[k];
+
+        const DoubleType rhsval = eflux[i];
+        if (rhsval == 0.0)
+        {
+          continue;
+        }
+
         const ConstNodeList &nl = el[i]->GetNodeList();
         const size_t row0 = r.GetEquationNumber(eqindex0, nl[0]);
         const size_t row1 = r.GetEquationNumber(eqindex0, nl[1]);
 
-        const DoubleType rhsval = eflux[i];
-
         v.push_back(std::make_pair(row0,  n0_sign*rhsval));
         v.push_back(std::make_pair(row1,  n1_sign*rhsval));
     }
@@ -461,66 +757,65 @@ void Equation<DoubleType>::EdgeAssembleRHS(dsMath::RHSEntryVec<DoubleType> &v, c
 /// should have one assembly routine per shape
 /// Other variants should handle case if ElementNodeVolume is used on 3d element
 template <typename DoubleType>
-void Equation<DoubleType>::TriangleEdgeAssembleRHS(dsMath::RHSEntryVec<DoubleType> &v, const TriangleEdgeScalarData<DoubleType> &teflux, const DoubleType n0_sign, const DoubleType n1_sign)
+void Equation<DoubleType>::TriangleEdgeAssembleRHS(dsMath::RHSEntryVec<DoubleType> &v, const TriangleEdgeCouplePlan &plan, const DoubleType n0_sign, const DoubleType n1_sign)
 {
   const Region &r = GetRegion();
-  const size_t eqindex0 = r.GetEquationIndex(myname);
-//  dsAssert(eqindex0 != size_t(-1), "UNEXPECTED");
-  if (eqindex0 == size_t(-1))
-  {
-    dsErrors::MissingEquationIndex(r, myname, "", OutputStream::OutputType::FATAL) ;
-    return;
-  }
+  const size_t eqindex0 = plan.eqindex;
+
+  const CoupledValues<TriangleEdgeModel, DoubleType> teflux(*plan.model, *plan.couple);
 
   const Region::TriangleToConstEdgeList_t &ttelist = r.GetTriangleToEdgeList();
-  for (size_t i = 0 ; i < ttelist.size(); ++i)
+  const AssemblyIndexes indexes(3 * ttelist.size(), {teflux.GetSupport()});
+  for (size_t k = 0 ; k < indexes.size(); ++k)
   {
-    const ConstEdgeList &el = ttelist[i];
-    for (size_t j = 0; j < el.size(); ++j)
+    const size_t eindex = indexes[k];
+
+    const DoubleType rhsval = teflux[eindex];
+    if (rhsval == 0.0)
     {
-      const ConstNodeList &nl = el[j]->GetNodeList();
+      continue;
+    }
 
-      const size_t row0 = r.GetEquationNumber(eqindex0, nl[0]);
-      const size_t row1 = r.GetEquationNumber(eqindex0, nl[1]);
+    const ConstEdgeList &el = ttelist[eindex / 3];
+    const ConstNodeList &nl = el[eindex % 3]->GetNodeList();
 
-      const DoubleType rhsval = teflux[3*i + j];
+    const size_t row0 = r.GetEquationNumber(eqindex0, nl[0]);
+    const size_t row1 = r.GetEquationNumber(eqindex0, nl[1]);
 
-      v.push_back(std::make_pair(row0,  n0_sign * rhsval));
-      v.push_back(std::make_pair(row1,  n1_sign * rhsval));
-    }
+    v.push_back(std::make_pair(row0,  n0_sign * rhsval));
+    v.push_back(std::make_pair(row1,  n1_sign * rhsval));
   }
 }
 
 template <typename DoubleType>
-void Equation<DoubleType>::TetrahedronEdgeAssembleRHS(dsMath::RHSEntryVec<DoubleType> &v, const TetrahedronEdgeScalarData<DoubleType> &teflux, const DoubleType n0_sign, const DoubleType n1_sign)
+void Equation<DoubleType>::TetrahedronEdgeAssembleRHS(dsMath::RHSEntryVec<DoubleType> &v, const TetrahedronEdgeCouplePlan &plan, const DoubleType n0_sign, const DoubleType n1_sign)
 {
   const Region &r = GetRegion();
-  const size_t eqindex0 = r.GetEquationIndex(myname);
-//  dsAssert(eqindex0 != size_t(-1), "UNEXPECTED");
-  if (eqindex0 == size_t(-1))
-  {
-    dsErrors::MissingEquationIndex(r, myname, "", OutputStream::OutputType::FATAL) ;
-    return;
-  }
+  const size_t eqindex0 = plan.eqindex;
+
+  const CoupledValues<TetrahedronEdgeModel, DoubleType> teflux(*plan.model, *plan.couple);
 
   const Region::TetrahedronToConstEdgeDataList_t &ttelist = r.GetTetrahedronToEdgeDataList();
-  for (size_t i = 0 ; i < ttelist.size(); ++i)
+  const AssemblyIndexes indexes(6 * ttelist.size(), {teflux.GetSupport()});
+  for (size_t k = 0 ; k < indexes.size(); ++k)
   {
-    const ConstEdgeDataList &edgeDataList = ttelist[i];
-    for (size_t j = 0; j < edgeDataList.size(); ++j)
+    const size_t eindex = indexes[k];
+
+    const DoubleType rhsval = teflux[eindex];
+    if (rhsval == 0.0)
     {
-      const EdgeData &edgeData = *edgeDataList[j];
-      const Edge     &edge     = *edgeData.edge;
-      const ConstNodeList &nl = edge.GetNodeList();
+      continue;
+    }
 
-      const size_t row0 = r.GetEquationNumber(eqindex0, nl[0]);
-      const size_t row1 = r.GetEquationNumber(eqindex0, nl[1]);
+    const EdgeData &edgeData = *ttelist[eindex / 6][eindex % 6];
+    const Edge     &edge     = *edgeData.edge;
+    const ConstNodeList &nl = edge.GetNodeList();
 
-      const DoubleType rhsval = teflux[6*i + j];
+    const size_t row0 = r.GetEquationNumber(eqindex0, nl[0]);
+    const size_t row1 = r.GetEquationNumber(eqindex0, nl[1]);
 
-      v.push_back(std::make_pair(row0,  n0_sign * rhsval));
-      v.push_back(std::make_pair(row1,  n1_sign * rhsval));
-    }
+    v.push_back(std::make_pair(row0,  n0_sign * rhsval));
+    v.push_back(std::make_pair(row1,  n1_sign * rhsval));
   }
 }
 
@@ -581,43 +876,46 @@ void Equation<DoubleType>::SymmetricEdgeAssembleJacobian(dsMath::RealRowColValue
 /// eder0 is derivative wrt first node
 /// eder1 is derivative wrt second node
 template <typename DoubleType>
-void Equation<DoubleType>::UnSymmetricEdgeAssembleJacobian(dsMath::RealRowColValueVec<DoubleType> &m, const EdgeScalarData<DoubleType> &eder0, const EdgeScalarData<DoubleType> &eder1, const std::string &var, const DoubleType n0_sign, const DoubleType n1_sign)
+void Equation<DoubleType>::UnSymmetricEdgeAssembleJacobian(dsMath::RealRowColValueVec<DoubleType> &m, const EdgeCouplePlan &plan, const typename EdgeCouplePlan::Derivative &derivative, const DoubleType n0_sign, const DoubleType n1_sign)
 {
     const Region &r = GetRegion();
-    const size_t eqindex0 = r.GetEquationIndex(myname);
-//    dsAssert(eqindex0 != size_t(-1), "UNEXPECTED");
-    if (eqindex0 == size_t(-1))
-    {
-      dsErrors::MissingEquationIndex(r, myname, "", OutputStream::OutputType::FATAL) ;
-      return;
-    }
+    const size_t eqindex0 = plan.eqindex;
+    const size_t eqindex1 = derivative.eqindex;
 
-    const size_t eqindex1 = r.GetEquationIndex(r.GetEquationNameFromVariable(var));
-//    dsAssert(eqindex1 != size_t(-1), "UNEXPECTED");
-    if (eqindex1 == size_t(-1))
-    {
-      dsErrors::MissingEquationIndex(r, myname, var, OutputStream::OutputType::FATAL) ;
-      return;
-    }
+    /// integrate wrt volume
+    const CoupledValues<EdgeModel, DoubleType> eder0(*derivative.models[0], *plan.couple);
+    const CoupledValues<EdgeModel, DoubleType> eder1(*derivative.models[1], *plan.couple);
 
     // assemble the edge components to rhs first
     const ConstEdgeList &el = r.GetEdgeList();
-    for (size_t i = 0 ; i < el.size(); ++i)
+    const AssemblyIndexes indexes(el.size(), {eder0.GetSupport(), eder1.GetSupport()});
+    for (size_t k = 0 ; k < indexes.size(); ++k)
     {
+        const size_t i = indexes[k];
+
+        const DoubleType ederval0 = eder0[i];
+        const DoubleType ederval1 = eder1[i];
+
         const ConstNodeList &nl = el[i]->GetNodeList();
         const size_t row0 = r.GetEquationNumber(eqindex0, nl[0]);
         const size_t col0 = r.GetEquationNumber(eqindex1, nl[0]);
         const size_t row1 = r.GetEquationNumber(eqindex0, nl[1]);
         const size_t col1 = r.GetEquationNumber(eqindex1, nl[1]);
 
-        const DoubleType ederval0 = eder0[i];
-        const DoubleType ederval1 = eder1[i];
-
         /// Here we account for the fact stuff moving toward row1 has opposite sign
-        m.push_back(dsMath::RealRowColVal<DoubleType>(row0, col0, n0_sign * ederval0));
-        m.push_back(dsMath::RealRowColVal<DoubleType>(row1, col1, n1_sign * ederval1));
-        m.push_back(dsMath::RealRowColVal<DoubleType>(row0, col1, n0_sign * ederval1));
-        m.push_back(dsMath::RealRowColVal<DoubleType>(row1, col0, n1_sign * ederval0));
+        if (ederval0 != 0.0)
+        {
+          m.push_back(dsMath::RealRowColVal<DoubleType>(row0, col0, n0_sign * ederval0));
+        }
+        if (ederval1 != 0.0)
+        {
+          m.push_back(dsMath::RealRowColVal<DoubleType>(row1, col1, n1_sign * ederval1));
+          m.push_back(dsMath::RealRowColVal<DoubleType>(row0, col1, n0_sign * ederval1));
+        }
+        if (ederval0 != 0.0)
+        {
+          m.push_back(dsMath::RealRowColVal<DoubleType>(row1, col0, n1_sign * ederval0));
+        }
     }
 }
 
@@ -626,67 +924,71 @@ void Equation<DoubleType>::UnSymmetricEdgeAssembleJacobian(dsMath::RealRowColVal
 /// eder1 is derivative wrt second node
 /// eder2 is derivative wrt third node
 template <typename DoubleType>
-void Equation<DoubleType>::UnSymmetricTriangleEdgeAssembleJacobian(dsMath::RealRowColValueVec<DoubleType> &m, const TriangleEdgeScalarData<DoubleType> &eder0, const TriangleEdgeScalarData<DoubleType> &eder1, const TriangleEdgeScalarData<DoubleType> &eder2, const std::string &var, const DoubleType n0_sign, const DoubleType n1_sign)
+void Equation<DoubleType>::UnSymmetricTriangleEdgeAssembleJacobian(dsMath::RealRowColValueVec<DoubleType> &m, const TriangleEdgeCouplePlan &plan, const typename TriangleEdgeCouplePlan::Derivative &derivative, const DoubleType n0_sign, const DoubleType n1_sign)
 {
   const Region &r = GetRegion();
-  const size_t eqindex0 = r.GetEquationIndex(myname);
-//  dsAssert(eqindex0 != size_t(-1), "UNEXPECTED");
-  if (eqindex0 == size_t(-1))
-  {
-    dsErrors::MissingEquationIndex(r, myname, "", OutputStream::OutputType::FATAL) ;
-    return;
-  }
+  const size_t eqindex0 = plan.eqindex;
+  const size_t eqindex1 = derivative.eqindex;
 
-  const size_t eqindex1 = r.GetEquationIndex(r.GetEquationNameFromVariable(var));
-//  dsAssert(eqindex1 != size_t(-1), "UNEXPECTED");
-  if (eqindex1 == size_t(-1))
-  {
-    dsErrors::MissingEquationIndex(r, myname, var, OutputStream::OutputType::FATAL) ;
-    return;
-  }
+  /// integrate wrt volume
+  const CoupledValues<TriangleEdgeModel, DoubleType> eder0(*derivative.models[0], *plan.couple);
+  const CoupledValues<TriangleEdgeModel, DoubleType> eder1(*derivative.models[1], *plan.couple);
+  const CoupledValues<TriangleEdgeModel, DoubleType> eder2(*derivative.models[2], *plan.couple);
 
   const Region::TriangleToConstEdgeList_t &ttelist = r.GetTriangleToEdgeList();
   const ConstTriangleList &triangleList = r.GetTriangleList();
   dsAssert(triangleList.size() == ttelist.size(), "UNEXPECTED");
 
-  for (size_t i = 0 ; i < ttelist.size(); ++i)
+  const AssemblyIndexes indexes(3 * ttelist.size(), {eder0.GetSupport(), eder1.GetSupport(), eder2.GetSupport()});
+  for (size_t k = 0 ; k < indexes.size(); ++k)
   {
-    // assemble the edge components to rhs first
+    const size_t eindex = indexes[k];
+    const size_t i = eindex / 3;
+    const size_t j = eindex % 3;
+
+    const DoubleType ederval0 = eder0[eindex];
+    const DoubleType ederval1 = eder1[eindex];
+    const DoubleType ederval2 = eder2[eindex];
+
     const ConstEdgeList &el = ttelist[i];
 
     const Triangle &triangle = *triangleList[i];
 
     const ConstNodeList &tnl = triangle.GetNodeList();
 
-    for (size_t j = 0 ; j < el.size(); ++j)
-    {
-      const ConstNodeList &nl = el[j]->GetNodeList();
-
-      const Node * const node0 = nl[0];
-      const Node * const node1 = nl[1];
+    const ConstNodeList &nl = el[j]->GetNodeList();
 
-      //// we are guaranteed that the node is across from the edge
-      const Node * const node2 = tnl[j];
+    const Node * const node0 = nl[0];
+    const Node * const node1 = nl[1];
 
-      const size_t row0 = r.GetEquationNumber(eqindex0, node0);
-      const size_t col0 = r.GetEquationNumber(eqindex1, node0);
-      const size_t row1 = r.GetEquationNumber(eqindex0, node1);
-      const size_t col1 = r.GetEquationNumber(eqindex1, node1);
+    //// we are guaranteed that the node is across from the edge
+    const Node * const node2 = tnl[j];
 
-      const size_t col2 = r.GetEquationNumber(eqindex1, node2);
+    const size_t row0 = r.GetEquationNumber(eqindex0, node0);
+    const size_t col0 = r.GetEquationNumber(eqindex1, node0);
+    const size_t row1 = r.GetEquationNumber(eqindex0, node1);
+    const size_t col1 = r.GetEquationNumber(eqindex1, node1);
 
-      const size_t eindex = 3 * i + j;
-      const DoubleType ederval0 = eder0[eindex];
-      const DoubleType ederval1 = eder1[eindex];
-      const DoubleType ederval2 = eder2[eindex];
+    const size_t col2 = r.GetEquationNumber(eqindex1, node2);
 
-      /// Here we account for the fact stuff moving toward row1 has opposite sign
+    /// Here we account for the fact stuff moving toward row1 has opposite sign
+    if (ederval0 != 0.0)
+    {
       m.push_back(dsMath::RealRowColVal<DoubleType>(row0, col0,  n0_sign * ederval0));
+    }
+    if (ederval1 != 0.0)
+    {
       m.push_back(dsMath::RealRowColVal<DoubleType>(row1, col1,  n1_sign * ederval1));
       m.push_back(dsMath::RealRowColVal<DoubleType>(row0, col1,  n0_sign * ederval1));
+    }
+    if (ederval0 != 0.0)
+    {
       m.push_back(dsMath::RealRowColVal<DoubleType>(row1, col0,  n1_sign * ederval0));
+    }
 
-      /// This is true as long as we are projected along the unit vector
+    /// This is true as long as we are projected along the unit vector
+    if (ederval2 != 0.0)
+    {
       m.push_back(dsMath::RealRowColVal<DoubleType>(row0, col2,  n0_sign * ederval2));
       m.push_back(dsMath::RealRowColVal<DoubleType>(row1, col2,  n1_sign * ederval2));
     }
@@ -694,72 +996,76 @@ void Equation<DoubleType>::UnSymmetricTriangleEdgeAssembleJacobian(dsMath::RealR
 }
 
 template <typename DoubleType>
-void Equation<DoubleType>::UnSymmetricTetrahedronEdgeAssembleJacobian(dsMath::RealRowColValueVec<DoubleType> &m, const TetrahedronEdgeScalarData<DoubleType> &eder0, const TetrahedronEdgeScalarData<DoubleType> &eder1, const TetrahedronEdgeScalarData<DoubleType> &eder2, const TetrahedronEdgeScalarData<DoubleType> &eder3, const std::string &var, const DoubleType n0_sign, const DoubleType n1_sign)
+void Equation<DoubleType>::UnSymmetricTetrahedronEdgeAssembleJacobian(dsMath::RealRowColValueVec<DoubleType> &m, const TetrahedronEdgeCouplePlan &plan, const typename TetrahedronEdgeCouplePlan::Derivative &derivative, const DoubleType n0_sign, const DoubleType n1_sign)
 {
   const Region &r = GetRegion();
-  const size_t eqindex0 = r.GetEquationIndex(myname);
-//  dsAssert(eqindex0 != size_t(-1), "UNEXPECTED");
-  if (eqindex0 == size_t(-1))
-  {
-    dsErrors::MissingEquationIndex(r, myname, "", OutputStream::OutputType::FATAL) ;
-    return;
-  }
+  const size_t eqindex0 = plan.eqindex;
+  const size_t eqindex1 = derivative.eqindex;
 
-  const size_t eqindex1 = r.GetEquationIndex(r.GetEquationNameFromVariable(var));
-//  dsAssert(eqindex1 != size_t(-1), "UNEXPECTED");
-  if (eqindex1 == size_t(-1))
-  {
-    dsErrors::MissingEquationIndex(r, myname, var, OutputStream::OutputType::FATAL) ;
-    return;
-  }
+  /// integrate wrt volume
+  const CoupledValues<TetrahedronEdgeModel, DoubleType> eder0(*derivative.models[0], *plan.couple);
+  const CoupledValues<TetrahedronEdgeModel, DoubleType> eder1(*derivative.models[1], *plan.couple);
+  const CoupledValues<TetrahedronEdgeModel, DoubleType> eder2(*derivative.models[2], *plan.couple);
+  const CoupledValues<TetrahedronEdgeModel, DoubleType> eder3(*derivative.models[3], *plan.couple);
 
   const Region::TetrahedronToConstEdgeDataList_t &ttelist = r.GetTetrahedronToEdgeDataList();
   const ConstTetrahedronList &tetrahedronList = r.GetTetrahedronList();
   dsAssert(tetrahedronList.size() == ttelist.size(), "UNEXPECTED");
 
 
-  for (size_t i = 0 ; i < ttelist.size(); ++i)
+  const AssemblyIndexes indexes(6 * ttelist.size(), {eder0.GetSupport(), eder1.GetSupport(), eder2.GetSupport(), eder3.GetSupport()});
+  for (size_t k = 0 ; k < indexes.size(); ++k)
   {
-    // assemble the edge components to rhs first
-    const ConstEdgeDataList &edgeDataList = ttelist[i];
+    const size_t eindex = indexes[k];
 
-    for (size_t j = 0 ; j < edgeDataList.size(); ++j)
-    {
-      const EdgeData &edgeData = *edgeDataList[j];
-      const Edge &edge = *(edgeData.edge);
+    const DoubleType ederval0 = eder0[eindex];
+    const DoubleType ederval1 = eder1[eindex];
+    const DoubleType ederval2 = eder2[eindex];
+    const DoubleType ederval3 = eder3[eindex];
 
-      const ConstNodeList &nl = edge.GetNodeList();
+    const EdgeData &edgeData = *ttelist[eindex / 6][eindex % 6];
+    const Edge &edge = *(edgeData.edge);
 
-      const Node * const node0 = nl[0];
-      const Node * const node1 = nl[1];
+    const ConstNodeList &nl = edge.GetNodeList();
 
-      //// we are guaranteed that the node is across from the edge
-      const Node * const node2 = edgeData.nodeopp[0];
-      const Node * const node3 = edgeData.nodeopp[1];
+    const Node * const node0 = nl[0];
+    const Node * const node1 = nl[1];
 
-      const size_t row0 = r.GetEquationNumber(eqindex0, node0);
-      const size_t col0 = r.GetEquationNumber(eqindex1, node0);
-      const size_t row1 = r.GetEquationNumber(eqindex0, node1);
-      const size_t col1 = r.GetEquationNumber(eqindex1, node1);
+    //// we are guaranteed that the node is across from the edge
+    const Node * const node2 = edgeData.nodeopp[0];
+    const Node * const node3 = edgeData.nodeopp[1];
 
-      const size_t col2 = r.GetEquationNumber(eqindex1, node2);
-      const size_t col3 = r.GetEquationNumber(eqindex1, node3);
+    const size_t row0 = r.GetEquationNumber(eqindex0, node0);
+    const size_t col0 = r.GetEquationNumber(eqindex1, node0);
+    const size_t row1 = r.GetEquationNumber(eqindex0, node1);
+    const size_t col1 = r.GetEquationNumber(eqindex1, node1);
 
-      const size_t eindex = 6 * i + j;
-      const DoubleType ederval0 = eder0[eindex];
-      const DoubleType ederval1 = eder1[eindex];
-      const DoubleType ederval2 = eder2[eindex];
-      const DoubleType ederval3 = eder3[eindex];
+    const size_t col2 = r.GetEquationNumber(eqindex1, node2);
+    const size_t col3 = r.GetEquationNumber(eqindex1, node3);
 
-      /// Here we account for the fact stuff moving toward row1 has opposite sign
+    /// Here we account for the fact stuff moving toward row1 has opposite sign
+    if (ederval0 != 0.0)
+    {
       m.push_back(dsMath::RealRowColVal<DoubleType>(row0, col0,  n0_sign * ederval0));
+    }
+    if (ederval1 != 0.0)
+    {
       m.push_back(dsMath::RealRowColVal<DoubleType>(row1, col1,  n1_sign * ederval1));
       m.push_back(dsMath::RealRowColVal<DoubleType>(row0, col1,  n0_sign * ederval1));
+    }
+    if (ederval0 != 0.0)
+    {
       m.push_back(dsMath::RealRowColVal<DoubleType>(row1, col0,  n1_sign * ederval0));
+    }
 
-      /// This is true as long as we are projected along the unit vector
+    /// This is true as long as we are projected along the unit vector
+    if (ederval2 != 0.0)
+    {
       m.push_back(dsMath::RealRowColVal<DoubleType>(row0, col2,  n0_sign * ederval2));
       m.push_back(dsMath::RealRowColVal<DoubleType>(row1, col2,  n1_sign * ederval2));
+    }
+    if (ederval3 != 0.0)
+    {
       m.push_back(dsMath::RealRowColVal<DoubleType>(row0, col3,  n0_sign * ederval3));
       m.push_back(dsMath::RealRowColVal<DoubleType>(row1, col3,  n1_sign * ederval3));
     }
@@ -768,61 +1074,55 @@ void Equation<DoubleType>::UnSymmetricTetrahedronEdgeAssembleJacobian(dsMath::Re
 
 /// Not scaled by node volume
 template <typename DoubleType>
-void Equation<DoubleType>::NodeAssembleRHS(dsMath::RHSEntryVec<DoubleType> &v, const NodeScalarData<DoubleType> &nrhs)
+void Equation<DoubleType>::NodeAssembleRHS(dsMath::RHSEntryVec<DoubleType> &v, const NodeVolumePlan &plan)
 {
-    // var is the name of the variable we are differentiating with respect to.  It is therefore the column and our equation is the row
-
     const Region &r = GetRegion();
-    const size_t eqindex0 = r.GetEquationIndex(myname);
+    const size_t eqindex0 = plan.eqindex;
 
-//    dsAssert(eqindex0 != size_t(-1), "UNEXPECTED");
-    if (eqindex0 == size_t(-1))
-    {
-      dsErrors::MissingEquationIndex(r, myname, "", OutputStream::OutputType::FATAL) ;
-      return;
-    }
+    // Integrate with volume and charge
+    const CoupledValues<NodeModel, DoubleType> nrhs(*plan.model, *plan.couple);
 
     const ConstNodeList &nl = r.GetNodeList();
-    for (size_t i = 0; i < nl.size(); ++i)
+    const AssemblyIndexes indexes(nl.size(), {nrhs.GetSupport()});
+    for (size_t k = 0; k < indexes.size(); ++k)
     {
+        const size_t i = indexes[k];
+        const DoubleType rhsval = nrhs[i];
+        if (rhsval == 0.0)
+        {
+          continue;
+        }
         const size_t row1 = r.GetEquationNumber(eqindex0, nl[i]);
-        const DoubleType rhsval = nrhs.GetScalarList()[i];
         // Note that the sign is reversed
         v.push_back(std::make_pair(row1, rhsval));
     }
 }
 
 template <typename DoubleType>
-void Equation<DoubleType>::NodeAssembleJacobian(dsMath::RealRowColValueVec<DoubleType> &m, const NodeScalarData<DoubleType> &nder, const std::string &var)
+void Equation<DoubleType>::NodeAssembleJacobian(dsMath::RealRowColValueVec<DoubleType> &m, const NodeVolumePlan &plan, const typename NodeVolumePlan::Derivative &derivative)
 {
-    // var is the name of the variable we are differentiating with respect to.  It is therefore the column and our equation is the row
+    // the derivative is with respect to the variable of the equation, which is the column and our equation is the row
 
     const Region &r = GetRegion();
-    const size_t eqindex0 = r.GetEquationIndex(myname);
-//    dsAssert(eqindex0 != size_t(-1), "UNEXPECTED");
-
-    if (eqindex0 == size_t(-1))
-    {
-      dsErrors::MissingEquationIndex(r, myname, "", OutputStream::OutputType::FATAL) ;
-      return;
-    }
-
-    const size_t eqindex1 = r.GetEquationIndex(r.GetEquationNameFromVariable(var));
-//    dsAssert(eqindex1 != size_t(-1), "UNEXPECTED");
+    const size_t eqindex0 = plan.eqindex;
+    const size_t eqindex1 = derivative.eqindex;
 
-    if (eqindex1 == size_t(-1))
-    {
-      dsErrors::MissingEquationIndex(r, myname, var, OutputStream::OutputType::FATAL) ;
-      return;
-    }
+    const CoupledValues<NodeModel, DoubleType> nder(*derivative.models[0], *plan.couple);
 
     const ConstNodeList &nl = r.GetNodeList();
-    for (size_t i = 0; i < nl.size(); ++i)
+    const AssemblyIndexes indexes(nl.size(), {nder.GetSupport()});
+    for (size_t k = 0; k < indexes.size(); ++k)
     {
+        const size_t i = indexes[k];
+        const DoubleType derval = nder[i];
+        if (derval == 0.0)
+        {
+          continue;
+        }
+
         const size_t row1 = r.GetEquationNumber(eqindex0, nl[i]);
         const size_t row2 = r.GetEquationNumber(eqindex1, nl[i]);
 
-        const DoubleType derval = nder.GetScalarList()[i];
         m.push_back(dsMath::RealRowColVal<DoubleType>(row1, row2, derval));
     }
 }
@@ -838,33 +1138,15 @@ void Equation<DoubleType>::NodeVolumeAssemble(const std::string &model, dsMath::
 template <typename DoubleType>
 void Equation<DoubleType>::NodeVolumeAssemble(const std::string &model, dsMath::RealRowColValueVec<DoubleType> &m, dsMath::RHSEntryVec<DoubleType> &v, dsMathEnum::WhatToLoad w, const std::string &node_volume)
 {
-  const Region &r = GetRegion();
-
-  VariableList_t vlist = r.GetVariableList();
-
-  ConstNodeModelPtr nm = r.GetNodeModel(model);
-//    dsAssert(nm != nullptr, "UNEXPECTED");
-  if (!nm)
+  const NodeVolumePlan *plan = GetAssemblyPlan(nodeVolumePlans, model, node_volume);
+  if (!plan)
   {
-    dsErrors::MissingEquationModel(r, myname, model, dsErrors::ModelInfo::NODE, OutputStream::OutputType::FATAL);
-    return;
-  }
-
-  ConstNodeModelPtr nvol = r.GetNodeModel(node_volume);
-//  dsAssert(nvol, "UNEXPECTED");
-
-  if (!nvol)
-  {
-    dsErrors::MissingEquationModel(r, myname, node_volume, dsErrors::ModelInfo::NODE, OutputStream::OutputType::FATAL);
     return;
   }
 
   if ((w == dsMathEnum::WhatToLoad::RHS) || (w == dsMathEnum::WhatToLoad::MATRIXANDRHS))
   {
-    // Integrate with volume and charge
-    NodeScalarData<DoubleType> nrhs(*nvol);
-    nrhs.times_equal_model(*nm);
-    NodeAssembleRHS(v, nrhs);
+    NodeAssembleRHS(v, *plan);
   }
   else if (w == dsMathEnum::WhatToLoad::MATRIXONLY)
   {
@@ -876,25 +1158,9 @@ void Equation<DoubleType>::NodeVolumeAssemble(const std::string &model, dsMath::
 
   if ((w == dsMathEnum::WhatToLoad::MATRIXONLY) || (w == dsMathEnum::WhatToLoad::MATRIXANDRHS))
   {
-    VariableList_t::iterator it = vlist.begin();
-    for (; it != vlist.end(); ++it)
+    for (const auto &derivative : plan->derivatives)
     {
-      const std::string var(*it);
-
-      std::string dermodel = GetDerivativeModelName(model, var);
-
-      ConstNodeModelPtr ndm = r.GetNodeModel(dermodel);
-
-      if (!ndm)
-      {
-        dsErrors::MissingEquationModel(r, myname, dermodel, dsErrors::ModelInfo::NODE, OutputStream::OutputType::VERBOSE1);
-      }
-      else
-      {
-        NodeScalarData<DoubleType> nder(*nvol);
-        nder.times_equal_model(*ndm);
-        NodeAssembleJacobian(m, nder, var);
-      }
+      NodeAssembleJacobian(m, *plan, derivative);
     }
   }
   else if (w == dsMathEnum::WhatToLoad::RHS)
@@ -937,124 +1203,52 @@ void Equation<DoubleType>::EdgeNodeVolumeAssemble(const std::string &model, dsMa
 template <typename DoubleType>
 void Equation<DoubleType>::EdgeCoupleAssemble(const std::string &model, dsMath::RealRowColValueVec<DoubleType> &m, dsMath::RHSEntryVec<DoubleType> &v, dsMathEnum::WhatToLoad w, const std::string &edge_couple, const DoubleType n0_sign, const DoubleType n1_sign)
 {
-    const Region &r = GetRegion();
-
-    VariableList_t vlist = r.GetVariableList();
-
-    ConstEdgeModelPtr ef = r.GetEdgeModel(model);
-    if (!ef)
-    {
-      dsErrors::MissingEquationModel(r, myname, model, dsErrors::ModelInfo::EDGE, OutputStream::OutputType::FATAL);
-      return;
-    }
-
-    ConstEdgeModelPtr ec = r.GetEdgeModel(edge_couple);
-    if (!ec)
-    {
-      dsErrors::MissingEquationModel(r, myname, edge_couple, dsErrors::ModelInfo::EDGE, OutputStream::OutputType::FATAL);
-      return;
-    }
-
-    if ((w == dsMathEnum::WhatToLoad::RHS) || (w == dsMathEnum::WhatToLoad::MATRIXANDRHS))
-    {
-        EdgeScalarData<DoubleType> eflux = EdgeScalarData<DoubleType>(*ef);
-        eflux.times_equal_model(*ec);
-        EdgeAssembleRHS(v, eflux, n0_sign, n1_sign);
-    }
-    else if (w == dsMathEnum::WhatToLoad::MATRIXONLY)
-    {
-    }
-    else
-    {
-      dsAssert(0, "UNEXPECTED");
-    }
-
-    if ((w == dsMathEnum::WhatToLoad::MATRIXONLY) || (w == dsMathEnum::WhatToLoad::MATRIXANDRHS))
-    {
-      VariableList_t::iterator it = vlist.begin();
-      for ( ; it != vlist.end(); ++it)
-      {
-        const std::string var(*it);
-
-        std::string dermodel0 = GetDerivativeModelName(model, var);
-        std::string dermodel1 = dermodel0;
-
-        //// Ultimately this needs to be a function too
-        dermodel0 += "@n0";
-        dermodel1 += "@n1";
-
-        ConstEdgeModelPtr em0 = r.GetEdgeModel(dermodel0);
-        ConstEdgeModelPtr em1 = r.GetEdgeModel(dermodel1);
-
-        if ((!em0) && (!em1))
-        {
-          dsErrors::MissingEquationModel(r, myname, dermodel0, dsErrors::ModelInfo::EDGE, OutputStream::OutputType::VERBOSE1);
-          dsErrors::MissingEquationModel(r, myname, dermodel1, dsErrors::ModelInfo::EDGE, OutputStream::OutputType::VERBOSE1);
-        }
-        else
-        {
-            /// Both models must exist
-//              dsAssert(em0, "UNEXPECTED");
-//              dsAssert(em1, "UNEXPECTED");
-          if (!em0)
-          {
-            dsErrors::MissingEquationModel(r, myname, dermodel0, dsErrors::ModelInfo::EDGE, OutputStream::OutputType::FATAL);
-            return;
-          }
-
-          if (!em1)
-          {
-            dsErrors::MissingEquationModel(r, myname, dermodel1, dsErrors::ModelInfo::EDGE, OutputStream::OutputType::FATAL);
-            return;
-          }
-
-          EdgeScalarData<DoubleType> eder0 = EdgeScalarData<DoubleType>(*em0);
-          EdgeScalarData<DoubleType> eder1 = EdgeScalarData<DoubleType>(*em1);
+  const EdgeCouplePlan *plan = GetAssemblyPlan(edgeCouplePlans, model, edge_couple);
+  if (!plan)
+  {
+    return;
+  }
 
-          eder0.times_equal_model(*ec); /// integrate wrt volume
-          eder1.times_equal_model(*ec); /// integrate wrt volume
+  if ((w == dsMathEnum::WhatToLoad::RHS) || (w == dsMathEnum::WhatToLoad::MATRIXANDRHS))
+  {
+    EdgeAssembleRHS(v, *plan, n0_sign, n1_sign);
+  }
+  else if (w == dsMathEnum::WhatToLoad::MATRIXONLY)
+  {
+  }
+  else
+  {
+    dsAssert(0, "UNEXPECTED");
+  }
 
-          UnSymmetricEdgeAssembleJacobian(m, eder0, eder1, var, n0_sign, n1_sign);
-        }
-      }
-    }
-    else if (w == dsMathEnum::WhatToLoad::RHS)
-    {
-    }
-    else
+  if ((w == dsMathEnum::WhatToLoad::MATRIXONLY) || (w == dsMathEnum::WhatToLoad::MATRIXANDRHS))
+  {
+    for (const auto &derivative : plan->derivatives)
     {
-      dsAssert(0, "UNEXPECTED");
+      UnSymmetricEdgeAssembleJacobian(m, *plan, derivative, n0_sign, n1_sign);
     }
+  }
+  else if (w == dsMathEnum::WhatToLoad::RHS)
+  {
+  }
+  else
+  {
+    dsAssert(0, "UNEXPECTED");
+  }
 }
 
 template <typename DoubleType>
 void Equation<DoubleType>::TriangleEdgeCoupleAssemble(const std::string &model, dsMath::RealRowColValueVec<DoubleType> &m, dsMath::RHSEntryVec<DoubleType> &v, dsMathEnum::WhatToLoad w, const std::string &edge_couple, const DoubleType n0_sign, const DoubleType n1_sign)
 {
-  const Region &r = GetRegion();
-
-  VariableList_t vlist = r.GetVariableList();
-
-  ConstTriangleEdgeModelPtr ef = r.GetTriangleEdgeModel(model);
-  if (!ef)
-  {
-    dsErrors::MissingEquationModel(r, myname, model, dsErrors::ModelInfo::ELEMENTEDGE, OutputStream::OutputType::FATAL);
-    return;
-  }
-//    dsAssert(ef != nullptr, "UNEXPECTED");
-
-  ConstTriangleEdgeModelPtr ec = r.GetTriangleEdgeModel(edge_couple);
-  if (!ec)
+  const TriangleEdgeCouplePlan *plan = GetAssemblyPlan(triangleEdgeCouplePlans, model, edge_couple);
+  if (!plan)
   {
-    dsErrors::MissingEquationModel(r, myname, edge_couple, dsErrors::ModelInfo::ELEMENTEDGE, OutputStream::OutputType::FATAL);
     return;
   }
-//    dsAssert(ec != nullptr, "UNEXPECTED");
 
   if ((w == dsMathEnum::WhatToLoad::RHS) || (w == dsMathEnum::WhatToLoad::MATRIXANDRHS))
   {
-    TriangleEdgeScalarData<DoubleType> eflux = TriangleEdgeScalarData<DoubleType>(*ef);
-    eflux.times_equal_model(*ec);
-    TriangleEdgeAssembleRHS(v, eflux, n0_sign, n1_sign);
+    TriangleEdgeAssembleRHS(v, *plan, n0_sign, n1_sign);
   }
   else if (w == dsMathEnum::WhatToLoad::MATRIXONLY)
   {
@@ -1066,58 +1260,9 @@ void Equation<DoubleType>::TriangleEdgeCoupleAssemble(const std::string &model,
 
   if ((w == dsMathEnum::WhatToLoad::MATRIXONLY) || (w == dsMathEnum::WhatToLoad::MATRIXANDRHS))
   {
-    VariableList_t::iterator it = vlist.begin();
-    for ( ; it != vlist.end(); ++it)
+    for (const auto &derivative : plan->derivatives)
     {
-      const std::string var(*it);
-
-      std::string dermodel0 = GetDerivativeModelName(model, var);
-      std::string dermodel1 = dermodel0;
-      std::string dermodel2 = dermodel0;
-
-      //// Ultimately this needs to be a function too
-      dermodel0 += "@en0";
-      dermodel1 += "@en1";
-      dermodel2 += "@en2";
-
-      ConstTriangleEdgeModelPtr em0 = r.GetTriangleEdgeModel(dermodel0);
-      ConstTriangleEdgeModelPtr em1 = r.GetTriangleEdgeModel(dermodel1);
-      ConstTriangleEdgeModelPtr em2 = r.GetTriangleEdgeModel(dermodel2);
-
-      if ((!em0) && (!em1) && (!em2))
-      {
-        dsErrors::MissingEquationModel(r, myname, dermodel0, dsErrors::ModelInfo::ELEMENTEDGE, OutputStream::OutputType::VERBOSE1);
-        dsErrors::MissingEquationModel(r, myname, dermodel1, dsErrors::ModelInfo::ELEMENTEDGE, OutputStream::OutputType::VERBOSE1);
-        dsErrors::MissingEquationModel(r, myname, dermodel2, dsErrors::ModelInfo::ELEMENTEDGE, OutputStream::OutputType::VERBOSE1);
-      }
-      else
-      {
-        if (!em0)
-        {
-          dsErrors::MissingEquationModel(r, myname, dermodel0, dsErrors::ModelInfo::ELEMENTEDGE, OutputStream::OutputType::FATAL);
-          return;
-        }
-        if (!em1)
-        {
-          dsErrors::MissingEquationModel(r, myname, dermodel1, dsErrors::ModelInfo::ELEMENTEDGE, OutputStream::OutputType::FATAL);
-          return;
-        }
-        if (!em2)
-        {
-          dsErrors::MissingEquationModel(r, myname, dermodel2, dsErrors::ModelInfo::ELEMENTEDGE, OutputStream::OutputType::FATAL);
-          return;
-        }
-
-        TriangleEdgeScalarData<DoubleType> eder0 = TriangleEdgeScalarData<DoubleType>(*em0);
-        TriangleEdgeScalarData<DoubleType> eder1 = TriangleEdgeScalarData<DoubleType>(*em1);
-        TriangleEdgeScalarData<DoubleType> eder2 = TriangleEdgeScalarData<DoubleType>(*em2);
-
-        eder0.times_equal_model(*ec); /// integrate wrt volume
-        eder1.times_equal_model(*ec); /// integrate wrt volume
-        eder2.times_equal_model(*ec); /// integrate wrt volume
-
-        UnSymmetricTriangleEdgeAssembleJacobian(m, eder0, eder1, eder2, var, n0_sign, n1_sign);
-      }
+      UnSymmetricTriangleEdgeAssembleJacobian(m, *plan, derivative, n0_sign, n1_sign);
     }
   }
   else if (w == dsMathEnum::WhatToLoad::RHS)
@@ -1132,31 +1277,15 @@ void Equation<DoubleType>::TriangleEdgeCoupleAssemble(const std::string &model,
 template <typename DoubleType>
 void Equation<DoubleType>::TetrahedronEdgeCoupleAssemble(const std::string &model, dsMath::RealRowColValueVec<DoubleType> &m, dsMath::RHSEntryVec<DoubleType> &v, dsMathEnum::WhatToLoad w, const std::string &edge_couple, const DoubleType n0_sign, const DoubleType n1_sign)
 {
-  const Region &r = GetRegion();
-
-  VariableList_t vlist = r.GetVariableList();
-
-  ConstTetrahedronEdgeModelPtr ef = r.GetTetrahedronEdgeModel(model);
-  if (!ef)
+  const TetrahedronEdgeCouplePlan *plan = GetAssemblyPlan(tetrahedronEdgeCouplePlans, model, edge_couple);
+  if (!plan)
   {
-    dsErrors::MissingEquationModel(r, myname, model, dsErrors::ModelInfo::ELEMENTEDGE, OutputStream::OutputType::FATAL);
     return;
   }
-//  dsAssert(ef != nullptr, "UNEXPECTED");
-
-  ConstTetrahedronEdgeModelPtr ec = r.GetTetrahedronEdgeModel(edge_couple);
-  if (!ec)
-  {
-    dsErrors::MissingEquationModel(r, myname, edge_couple, dsErrors::ModelInfo::ELEMENTEDGE, OutputStream::OutputType::FATAL);
-    return;
-  }
-//    dsAssert(ec != nullptr, "UNEXPECTED");
 
   if ((w == dsMathEnum::WhatToLoad::RHS) || (w == dsMathEnum::WhatToLoad::MATRIXANDRHS))
   {
-    TetrahedronEdgeScalarData<DoubleType> eflux = TetrahedronEdgeScalarData<DoubleType>(*ef);
-    eflux.times_equal_model(*ec);
-    TetrahedronEdgeAssembleRHS(v, eflux, n0_sign, n1_sign);
+    TetrahedronEdgeAssembleRHS(v, *plan, n0_sign, n1_sign);
   }
   else if (w == dsMathEnum::WhatToLoad::MATRIXONLY)
   {
@@ -1168,69 +1297,9 @@ void Equation<DoubleType>::TetrahedronEdgeCoupleAssemble(const std::string &mode
 
   if ((w == dsMathEnum::WhatToLoad::MATRIXONLY) || (w == dsMathEnum::WhatToLoad::MATRIXANDRHS))
   {
-    VariableList_t::iterator it = vlist.begin();
-    for ( ; it != vlist.end(); ++it)
+    for (const auto &derivative : plan->derivatives)
     {
-      const std::string var(*it);
-
-      std::string dermodel0 = GetDerivativeModelName(model, var);
-      std::string dermodel1 = dermodel0;
-      std::string dermodel2 = dermodel0;
-      std::string dermodel3 = dermodel0;
-
-      //// Ultimately this needs to be a function too
-      dermodel0 += "@en0";
-      dermodel1 += "@en1";
-      dermodel2 += "@en2";
-      dermodel3 += "@en3";
-
-      ConstTetrahedronEdgeModelPtr em0 = r.GetTetrahedronEdgeModel(dermodel0);
-      ConstTetrahedronEdgeModelPtr em1 = r.GetTetrahedronEdgeModel(dermodel1);
-      ConstTetrahedronEdgeModelPtr em2 = r.GetTetrahedronEdgeModel(dermodel2);
-      ConstTetrahedronEdgeModelPtr em3 = r.GetTetrahedronEdgeModel(dermodel3);
-
-      if ((!em0) && (!em1) && (!em2) && (!em3))
-      {
-        dsErrors::MissingEquationModel(r, myname, dermodel0, dsErrors::ModelInfo::ELEMENTEDGE, OutputStream::OutputType::VERBOSE1);
-        dsErrors::MissingEquationModel(r, myname, dermodel1, dsErrors::ModelInfo::ELEMENTEDGE, OutputStream::OutputType::VERBOSE1);
-        dsErrors::MissingEquationModel(r, myname, dermodel2, dsErrors::ModelInfo::ELEMENTEDGE, OutputStream::OutputType::VERBOSE1);
-        dsErrors::MissingEquationModel(r, myname, dermodel3, dsErrors::ModelInfo::ELEMENTEDGE, OutputStream::OutputType::VERBOSE1);
-      }
-      else
-      {
-        if (!em0)
-        {
-          dsErrors::MissingEquationModel(r, myname, dermodel0, dsErrors::ModelInfo::ELEMENTEDGE, OutputStream::OutputType::FATAL);
-          return;
-        }
-        if (!em1)
-        {
-          dsErrors::MissingEquationModel(r, myname, dermodel1, dsErrors::ModelInfo::ELEMENTEDGE, OutputStream::OutputType::FATAL);
-          return;
-        }
-        if (!em2)
-        {
-          dsErrors::MissingEquationModel(r, myname, dermodel2, dsErrors::ModelInfo::ELEMENTEDGE, OutputStream::OutputType::FATAL);
-          return;
-        }
-        if (!em3)
-        {
-          dsErrors::MissingEquationModel(r, myname, dermodel3, dsErrors::ModelInfo::ELEMENTEDGE, OutputStream::OutputType::FATAL);
-          return;
-        }
-
-        TetrahedronEdgeScalarData<DoubleType> eder0 = TetrahedronEdgeScalarData<DoubleType>(*em0);
-        TetrahedronEdgeScalarData<DoubleType> eder1 = TetrahedronEdgeScalarData<DoubleType>(*em1);
-        TetrahedronEdgeScalarData<DoubleType> eder2 = TetrahedronEdgeScalarData<DoubleType>(*em2);
-        TetrahedronEdgeScalarData<DoubleType> eder3 = TetrahedronEdgeScalarData<DoubleType>(*em3);
-
-        eder0.times_equal_model(*ec); /// integrate wrt volume
-        eder1.times_equal_model(*ec); /// integrate wrt volume
-        eder2.times_equal_model(*ec); /// integrate wrt volume
-        eder3.times_equal_model(*ec); /// integrate wrt volume
-
-        UnSymmetricTetrahedronEdgeAssembleJacobian(m, eder0, eder1, eder2, eder3, var, n0_sign, n1_sign);
-      }
+      UnSymmetricTetrahedronEdgeAssembleJacobian(m, *plan, derivative, n0_sign, n1_sign);
     }
   }
   else if (w == dsMathEnum::WhatToLoad::RHS)
@@ -1238,7 +1307,7 @@ void Equation<DoubleType>::TetrahedronEdgeCoupleAssemble(const std::string &mode
   }
   else
   {
-      dsAssert(0, "UNEXPECTED");
+    dsAssert(0, "UNEXPECTED");
   }
 }
 
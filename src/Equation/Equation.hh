@@ -12,6 +12,8 @@ SPDX-License-Identifier: Apache-2.0
 #include <string>
 #include <vector>
 #include <map>
+#include <array>
+#include <memory>
 #include <iosfwd>
 
 class PermutationEntry;
@@ -88,6 +90,10 @@ class Equation {
 
         void Assemble(dsMath::RealRowColValueVec<DoubleType> &, dsMath::RHSEntryVec<DoubleType> &, dsMathEnum::WhatToLoad, dsMathEnum::TimeMode);
 
+        /// Evaluates the models used by the last assembly of this equation, so they are up to date before the next assembly
+        /// The derivative models are only evaluated when the matrix is loaded
+        void PrefetchModels(dsMathEnum::WhatToLoad) const;
+
         const std::string &GetName() const {
             return myname;
         }
@@ -139,22 +145,52 @@ class Equation {
         void setAbsErrorNodeIndex(size_t);
         void setRelErrorNodeIndex(size_t);
 
+        /// The models and equation indices for assembling one model integrated with one couple, which are resolved once from their names
+        /// The plan is resolved again after a model or equation is added to or removed from the region
+        template <typename T, size_t N>
+        struct AssemblyPlan {
+          /// derivatives of the model with respect to one variable at each of the N nodes
+          struct Derivative {
+            size_t                                  eqindex;
+            std::array<std::shared_ptr<const T>, N> models;
+          };
+          size_t                   version = size_t(-1);
+          //// last assembly using this plan
+          size_t                   pass = 0;
+          size_t                   eqindex = size_t(-1);
+          std::shared_ptr<const T> model;
+          std::shared_ptr<const T> couple;
+          //// only the variables with derivative models
+          std::vector<Derivative>  derivatives;
+        };
+
+        using NodeVolumePlan            = AssemblyPlan<NodeModel, 1>;
+        using EdgeCouplePlan            = AssemblyPlan<EdgeModel, 2>;
+        using TriangleEdgeCouplePlan    = AssemblyPlan<TriangleEdgeModel, 3>;
+        using TetrahedronEdgeCouplePlan = AssemblyPlan<TetrahedronEdgeModel, 4>;
+        //// model and couple
+        using PlanKey_t = std::pair<std::string, std::string>;
+
+        /// nullptr if a model or equation is missing
+        template <typename T, size_t N>
+        const AssemblyPlan<T, N> *GetAssemblyPlan(std::map<PlanKey_t, AssemblyPlan<T, N>> &, const std::string &/*model*/, const std::string &/*couple*/);
+
         /// Stuff like potential is symmetric.  It's derivative with respect to a node on either side is of opposite sign.
-        /// Stuff should already be integrated w.r.t. EdgeCouple
-        void EdgeAssembleRHS(dsMath::RHSEntryVec<DoubleType> &, const EdgeScalarData<DoubleType> &/*rhs*/, const DoubleType /*n0_sign*/, const DoubleType /*n1_sign*/);
+        /// The model is multiplied by the couple as it is assembled
+        void EdgeAssembleRHS(dsMath::RHSEntryVec<DoubleType> &, const EdgeCouplePlan &, const DoubleType /*n0_sign*/, const DoubleType /*n1_sign*/);
 
-        void TriangleEdgeAssembleRHS(dsMath::RHSEntryVec<DoubleType> &, const TriangleEdgeScalarData<DoubleType> &/*rhs*/, const DoubleType /*n0_sign*/, const DoubleType /*n1_sign*/);
+        void TriangleEdgeAssembleRHS(dsMath::RHSEntryVec<DoubleType> &, const TriangleEdgeCouplePlan &, const DoubleType /*n0_sign*/, const DoubleType /*n1_sign*/);
 
-        void TetrahedronEdgeAssembleRHS(dsMath::RHSEntryVec<DoubleType> &, const TetrahedronEdgeScalarData<DoubleType> &/*rhs*/, const DoubleType /*n0_sign*/, const DoubleType /*n1_sign*/);
+        void TetrahedronEdgeAssembleRHS(dsMath::RHSEntryVec<DoubleType> &, const TetrahedronEdgeCouplePlan &, const DoubleType /*n0_sign*/, const DoubleType /*n1_sign*/);
 
 //        void SymmetricEdgeAssembleJacobian(dsMath::RealRowColValueVec<DoubleType> &, const EdgeScalarData<DoubleType> &/*der*/, const std::string &/*var*/);
 
-        void UnSymmetricEdgeAssembleJacobian(dsMath::RealRowColValueVec<DoubleType> &, const EdgeScalarData<DoubleType> &/*der0*/, const EdgeScalarData<DoubleType> &/*der1*/, const std::string &/*var*/, const DoubleType /*n0_sign*/, const DoubleType /*n1_sign*/);
-        void UnSymmetricTriangleEdgeAssembleJacobian(dsMath::RealRowColValueVec<DoubleType> &, const TriangleEdgeScalarData<DoubleType> &/*der0*/, const TriangleEdgeScalarData<DoubleType> &/*der1*/, const TriangleEdgeScalarData<DoubleType> &/*der2*/, const std::string &/*var*/, const DoubleType /*n0_sign*/, const DoubleType /*n1_sign*/);
-        void UnSymmetricTetrahedronEdgeAssembleJacobian(dsMath::RealRowColValueVec<DoubleType> &, const TetrahedronEdgeScalarData<DoubleType> &/*der0*/, const TetrahedronEdgeScalarData<DoubleType> &/*der1*/, const TetrahedronEdgeScalarData<DoubleType> &/*der2*/, const TetrahedronEdgeScalarData<DoubleType> &/*der3*/, const std::string &/*var*/, const DoubleType /*n0_sign*/, const DoubleType /*n1_sign*/);
-        /// Stuff should already be integrated w.r.t. NodeVolume
-        void NodeAssembleRHS(dsMath::RHSEntryVec<DoubleType> &, const NodeScalarData<DoubleType> &/*rhs*/);
-        void NodeAssembleJacobian(dsMath::RealRowColValueVec<DoubleType> &, const NodeScalarData<DoubleType> &/*der*/, const std::string &/*var*/);
+        void UnSymmetricEdgeAssembleJacobian(dsMath::RealRowColValueVec<DoubleType> &, const EdgeCouplePlan &, const typename EdgeCouplePlan::Derivative &, const DoubleType /*n0_sign*/, const DoubleType /*n1_sign*/);
+        void UnSymmetricTriangleEdgeAssembleJacobian(dsMath::RealRowColValueVec<DoubleType> &, const TriangleEdgeCouplePlan &, const typename TriangleEdgeCouplePlan::Derivative &, const DoubleType /*n0_sign*/, const DoubleType /*n1_sign*/);
+        void UnSymmetricTetrahedronEdgeAssembleJacobian(dsMath::RealRowColValueVec<DoubleType> &, const TetrahedronEdgeCouplePlan &, const typename TetrahedronEdgeCouplePlan::Derivative &, const DoubleType /*n0_sign*/, const DoubleType /*n1_sign*/);
+        /// The model is multiplied by the node volume as it is assembled
+        void NodeAssembleRHS(dsMath::RHSEntryVec<DoubleType> &, const NodeVolumePlan &);
+        void NodeAssembleJacobian(dsMath::RealRowColValueVec<DoubleType> &, const NodeVolumePlan &, const typename NodeVolumePlan::Derivative &);
 
         void NodeVolumeAssemble(const std::string &, dsMath::RealRowColValueVec<DoubleType> &, dsMath::RHSEntryVec<DoubleType> &, dsMathEnum::WhatToLoad);
         void NodeVolumeAssemble(const std::string &, dsMath::RealRowColValueVec<DoubleType> &, dsMath::RHSEntryVec<DoubleType> &, dsMathEnum::WhatToLoad, const std::string &/*node_volume*/);
@@ -193,6 +229,12 @@ class Equation {
         DoubleType minError;
         static const DoubleType defminError;
         EquationEnum::UpdateType updateType;
+
+        size_t assemblePass;
+        std::map<PlanKey_t, NodeVolumePlan>            nodeVolumePlans;
+        std::map<PlanKey_t, EdgeCouplePlan>            edgeCouplePlans;
+        std::map<PlanKey_t, TriangleEdgeCouplePlan>    triangleEdgeCouplePlans;
+        std::map<PlanKey_t, TetrahedronEdgeCouplePlan> tetrahedronEdgeCouplePlans;
 };
 #endif
 
@@ -315,6 +315,20 @@ void EquationHolder::Assemble(dsMath::RealRowColValueVec<float128> &m, dsMath::R
 }
 #endif
 
+void EquationHolder::PrefetchModels(dsMathEnum::WhatToLoad w) const
+{
+  if (double_)
+  {
+    (*double_).PrefetchModels(w);
+  }
+#ifdef DEVSIM_EXTENDED_PRECISION
+  else if (float128_)
+  {
+    (*float128_).PrefetchModels(w);
+  }
+#endif
+}
+
 void EquationHolder::GetCommandOptions(std::map<std::string, ObjectHolder> &m) const
 {
   if (double_)
@@ -79,6 +79,8 @@ class EquationHolder {
     template <typename DoubleType>
     void Assemble(dsMath::RealRowColValueVec<DoubleType> &, dsMath::RHSEntryVec<DoubleType> &, dsMathEnum::WhatToLoad, dsMathEnum::TimeMode);
 
+    void PrefetchModels(dsMathEnum::WhatToLoad) const;
+
     void GetCommandOptions(std::map<std::string, ObjectHolder> &) const;
 
     ~EquationHolder();
@@ -0,0 +1,255 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#include "GeometryCache.hh"
+#include "Region.hh"
+#include "Node.hh"
+#include "Edge.hh"
+#include "Triangle.hh"
+#include "Tetrahedron.hh"
+#include "GlobalData.hh"
+#include "ObjectHolder.hh"
+#include "OutputStream.hh"
+
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cstring>
+#include <cstdio>
+#include <limits>
+#include <random>
+
+namespace {
+const char fileMagic[8] = {'D', 'S', 'G', 'E', 'O', 'M', '0', '2'};
+
+/// Combines 64 bit words with the splitmix64 finalizer
+/// The check is FNV-1a of the bytes of the same words, so a collision of both is unlikely
+class GeometryHash {
+  public:
+    GeometryHash() : value_(0x9e3779b97f4a7c15ULL), check_(0xcbf29ce484222325ULL)
+    {
+    }
+
+    void Add(std::uint64_t w)
+    {
+      std::uint64_t z = value_ ^ w;
+      z += 0x9e3779b97f4a7c15ULL;
+      z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+      value_ = z ^ (z >> 31);
+
+      for (size_t i = 0; i < 8; ++i)
+      {
+        check_ ^= (w >> (8 * i)) & 0xffULL;
+        check_ *= 0x100000001b3ULL;
+      }
+    }
+
+    void Add(double x)
+    {
+      std::uint64_t w;
+      std::memcpy(&w, &x, sizeof(w));
+      Add(w);
+    }
+
+    void Add(const std::string &s)
+    {
+      Add(static_cast<std::uint64_t>(s.size()));
+      for (const auto &c : s)
+      {
+        Add(static_cast<std::uint64_t>(static_cast<unsigned char>(c)));
+      }
+    }
+
+    template <typename T>
+    void AddElements(const std::vector<T> &elements)
+    {
+      Add(static_cast<std::uint64_t>(elements.size()));
+      for (const auto &element : elements)
+      {
+        for (const auto &node : element->GetNodeList())
+        {
+          Add(static_cast<std::uint64_t>(node->GetIndex()));
+        }
+      }
+    }
+
+    std::uint64_t Get() const
+    {
+      return value_;
+    }
+
+    std::uint64_t GetCheck() const
+    {
+      return check_;
+    }
+
+  private:
+    std::uint64_t value_;
+    std::uint64_t check_;
+};
+
+std::string GetCacheDirectory(const Region &region)
+{
+  std::string ret;
+  const GlobalData &gdata = GlobalData::GetInstance();
+  GlobalData::DBEntry_t dbent = gdata.GetDBEntryOnRegion(&region, "geometry_cache_directory");
+  if (dbent.first)
+  {
+    ret = dbent.second.GetString();
+  }
+  return ret;
+}
+
+struct FileHeader {
+  char          magic[8];
+  std::uint64_t hash;
+  std::uint64_t check;
+  std::uint64_t nodeCount;
+  std::uint64_t edgeCount;
+  std::uint64_t triangleCount;
+  std::uint64_t tetrahedronCount;
+  std::uint64_t valueSize;
+  std::uint64_t count;
+};
+}
+
+template <typename DoubleType>
+GeometryCache<DoubleType>::GeometryCache(const Region &region, const std::string &name) : hash_(0), check_(0), nodeCount_(region.GetNumberNodes()), edgeCount_(region.GetEdgeList().size()), triangleCount_(region.GetTriangleList().size()), tetrahedronCount_(region.GetTetrahedronList().size())
+{
+  const std::string directory = GetCacheDirectory(region);
+  if (directory.empty())
+  {
+    return;
+  }
+
+  GeometryHash h;
+  h.Add(name);
+  h.Add(static_cast<std::uint64_t>(sizeof(DoubleType)));
+  h.Add(static_cast<std::uint64_t>(std::numeric_limits<DoubleType>::digits));
+  h.Add(static_cast<std::uint64_t>(region.GetDimension()));
+
+  const ConstNodeList &nodes = region.GetNodeList();
+  h.Add(static_cast<std::uint64_t>(nodes.size()));
+  for (const auto &node : nodes)
+  {
+    const Vector<double> &p = node->Position();
+    h.Add(p.Getx());
+    h.Add(p.Gety());
+    h.Add(p.Getz());
+  }
+
+  h.AddElements(region.GetEdgeList());
+  h.AddElements(region.GetTriangleList());
+  h.AddElements(region.GetTetrahedronList());
+
+  hash_  = h.Get();
+  check_ = h.GetCheck();
+
+  std::ostringstream os;
+  os << directory << "/" << std::hex << std::setw(16) << std::setfill('0') << hash_ << ".dsgeom";
+  fileName_ = os.str();
+}
+
+template <typename DoubleType>
+bool GeometryCache<DoubleType>::Load(size_t count, std::vector<DoubleType> &values) const
+{
+  if (!IsEnabled())
+  {
+    return false;
+  }
+
+  std::ifstream ifs(fileName_, std::ios::in | std::ios::binary);
+  if (!ifs)
+  {
+    return false;
+  }
+
+  FileHeader header;
+  ifs.read(reinterpret_cast<char *>(&header), sizeof(header));
+  if (!ifs || std::memcmp(header.magic, fileMagic, sizeof(fileMagic)) || (header.hash != hash_) || (header.valueSize != sizeof(DoubleType)) || (header.count != count))
+  {
+    return false;
+  }
+
+  //// the file name only depends on the first hash
+  if ((header.check != check_) || (header.nodeCount != nodeCount_) || (header.edgeCount != edgeCount_) || (header.triangleCount != triangleCount_) || (header.tetrahedronCount != tetrahedronCount_))
+  {
+    std::ostringstream os;
+    os << "Geometry cache file " << fileName_ << " is for a different region and is not used\n";
+    OutputStream::WriteOut(OutputStream::OutputType::VERBOSE1, os.str());
+    return false;
+  }
+
+  values.resize(count);
+  ifs.read(reinterpret_cast<char *>(values.data()), count * sizeof(DoubleType));
+  if (!ifs)
+  {
+    values.clear();
+    return false;
+  }
+
+  return true;
+}
+
+template <typename DoubleType>
+void GeometryCache<DoubleType>::Store(const std::vector<DoubleType> &values) const
+{
+  if (!IsEnabled())
+  {
+    return;
+  }
+
+  //// the file is renamed into place, so another process never reads a partial file
+  std::ostringstream os;
+  os << fileName_ << "." << std::hex << std::random_device()() << ".tmp";
+  const std::string tmpName = os.str();
+
+  bool ok = false;
+  {
+    std::ofstream ofs(tmpName, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (ofs)
+    {
+      FileHeader header;
+      std::memcpy(header.magic, fileMagic, sizeof(fileMagic));
+      header.hash             = hash_;
+      header.check            = check_;
+      header.nodeCount        = nodeCount_;
+      header.edgeCount        = edgeCount_;
+      header.triangleCount    = triangleCount_;
+      header.tetrahedronCount = tetrahedronCount_;
+      header.valueSize        = sizeof(DoubleType);
+      header.count            = values.size();
+      ofs.write(reinterpret_cast<const char *>(&header), sizeof(header));
+      ofs.write(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(DoubleType));
+      ofs.close();
+      ok = static_cast<bool>(ofs);
+    }
+  }
+
+  if (ok && (std::rename(tmpName.c_str(), fileName_.c_str()) != 0))
+  {
+    //// another process may have written the same file first
+    std::ifstream ifs(fileName_, std::ios::in | std::ios::binary);
+    ok = static_cast<bool>(ifs);
+  }
+  std::remove(tmpName.c_str());
+
+  if (!ok)
+  {
+    std::ostringstream os;
+    os << "Could not write geometry cache file " << fileName_ << "\n";
+    OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
+  }
+}
+
+template class GeometryCache<double>;
+#ifdef DEVSIM_EXTENDED_PRECISION
+#include "Float128.hh"
+template class GeometryCache<float128>;
+#endif
+
@@ -0,0 +1,50 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#ifndef GEOMETRY_CACHE_HH
+#define GEOMETRY_CACHE_HH
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+class Region;
+
+/// Stores the values of a geometric model in a file named by a hash of the region geometry
+/// The hash includes the node positions, the edge and element node indexes, the model name, and the value type
+/// The file also has a second independent hash and the number of each entity, which are checked when it is loaded
+/// The files are in the directory from the "geometry_cache_directory" parameter, and are not used when it is not set
+/// The values are stored as their bytes, so a file is only read by the same type of build
+template <typename DoubleType>
+class GeometryCache {
+  public:
+    GeometryCache(const Region &, const std::string &/*model name*/);
+
+    bool IsEnabled() const
+    {
+      return !fileName_.empty();
+    }
+
+    /// Returns false when there is no file with this number of values
+    bool Load(size_t /*count*/, std::vector<DoubleType> &) const;
+
+    void Store(const std::vector<DoubleType> &) const;
+
+  private:
+    GeometryCache(const GeometryCache &);
+    GeometryCache &operator=(const GeometryCache &);
+
+    std::string   fileName_;
+    std::uint64_t hash_;
+    std::uint64_t check_;
+    std::uint64_t nodeCount_;
+    std::uint64_t edgeCount_;
+    std::uint64_t triangleCount_;
+    std::uint64_t tetrahedronCount_;
+};
+#endif
+
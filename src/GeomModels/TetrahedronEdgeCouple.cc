@@ -14,6 +14,8 @@ SPDX-License-Identifier: Apache-2.0
 #include "Node.hh"
 #include "EdgeData.hh"
 #include "Triangle.hh"
+#include "GeometryCache.hh"
+#include "ParallelFor.hh"
 
 template <typename DoubleType>
 TetrahedronEdgeCouple<DoubleType>::TetrahedronEdgeCouple(RegionPtr rp) :
@@ -39,8 +41,17 @@ void TetrahedronEdgeCouple<DoubleType>::calcTetrahedronEdgeScalarValues() const
 template <typename DoubleType>
 void TetrahedronEdgeCouple<DoubleType>::calcTetrahedronEdgeCouple() const
 {
-  const std::vector<Vector<DoubleType>> tetrahedronCenters = GetRegion().template GetTetrahedronCenters<DoubleType>();
-  const std::vector<Vector<DoubleType>> triangleCenters    = GetRegion().template GetTriangleCenters<DoubleType>();
+  //// the element centers are not needed when the values are in the cache
+  const GeometryCache<DoubleType> cache(GetRegion(), GetName());
+  std::vector<DoubleType> ev;
+  if (cache.Load(6*GetRegion().GetNumberTetrahedrons(), ev))
+  {
+    SetValues(ev);
+    return;
+  }
+
+  const std::vector<Vector<DoubleType>> &tetrahedronCenters = GetRegion().template GetTetrahedronCenters<DoubleType>();
+  const std::vector<Vector<DoubleType>> &triangleCenters    = GetRegion().template GetTriangleCenters<DoubleType>();
   const Region::TetrahedronToConstEdgeDataList_t &ttelist = GetRegion().GetTetrahedronToEdgeDataList();
 
   const ConstTetrahedronList &tetrahedronList = GetRegion().GetTetrahedronList();
@@ -51,8 +62,9 @@ void TetrahedronEdgeCouple<DoubleType>::calcTetrahedronEdgeCouple() const
 
   //// Make this part of region, if useful
   std::vector<Vector<DoubleType>> edgeCenters(edgeList.size());
-  for (size_t i = 0; i < edgeList.size(); ++i)
-  {
+  dsMath::ParallelFor(edgeList.size(), [&](size_t b, size_t e) {
+    for (size_t i = b; i < e; ++i)
+    {
       const Edge &edge = *(edgeList[i]);
       const auto &h0 = edge.GetHead()->Position();
       const auto &h1 = edge.GetTail()->Position();
@@ -60,46 +72,45 @@ void TetrahedronEdgeCouple<DoubleType>::calcTetrahedronEdgeCouple() const
       edgeCenter += Vector<DoubleType>(h1.Getx(), h1.Gety(), h1.Getz());
       edgeCenter *= 0.5;
       edgeCenters[i] = edgeCenter;
-  }
-
-
-  Vector<DoubleType> faceToTetCenter[4];
-
-  std::vector<DoubleType> ev(6*tetrahedronList.size());
-
-  for (size_t ti = 0; ti < tetrahedronList.size(); ++ti)
-  {
-    const Vector<DoubleType> &tetrahedronCenter = tetrahedronCenters[ti];
-
-    const ConstTriangleList &triangleList = tetrahedronToTriangleList[ti];
-    /// A tet only has 4 triangles
-    for (size_t i = 0; i < 4; ++i)
-    {
-      Vector<DoubleType> v1 = triangleCenters[triangleList[i]->GetIndex()];
-      v1 -= tetrahedronCenter;
-      faceToTetCenter[i] = v1;
     }
+  });
 
-    const ConstEdgeDataList &edgeDataList = ttelist[ti];
-    for (size_t ei = 0; ei < 6; ++ei)
-    {
-      const EdgeData &edgedata = *(edgeDataList[ei]);
-
-//      const Edge &edge = *(edgedata.edge);
+  ev.resize(6*tetrahedronList.size());
 
-//      const Vector<DoubleType> &edgeCenter = edgeCenters[edge.GetIndex()];
+  //// each tetrahedron writes only its own 6 values, and the sum onto the edges is in GetValuesOnEdges
+  dsMath::ParallelFor(tetrahedronList.size(), [&](size_t b, size_t e) {
+    Vector<DoubleType> faceToTetCenter[4];
 
-      Vector<DoubleType> v0 = tetrahedronCenter;
-      v0 -= edgeCenters[edgedata.edge->GetIndex()];
-
-
-      /// The edgeCouple is from center of Tetrahedron to each triangle side to the tetrahedron edge index
-      const Vector<DoubleType> &v1 = faceToTetCenter[edgedata.triangle_index[0]];
-      const Vector<DoubleType> &v2 = faceToTetCenter[edgedata.triangle_index[1]];
-      ev[6*ti + ei] = 0.5 * (magnitude(cross_prod(v0, v1)) + magnitude(cross_prod(v0, v2)));
+    for (size_t ti = b; ti < e; ++ti)
+    {
+      const Vector<DoubleType> &tetrahedronCenter = tetrahedronCenters[ti];
+
+      const ConstTriangleList &triangleList = tetrahedronToTriangleList[ti];
+      /// A tet only has 4 triangles
+      for (size_t i = 0; i < 4; ++i)
+      {
+        Vector<DoubleType> v1 = triangleCenters[triangleList[i]->GetIndex()];
+        v1 -= tetrahedronCenter;
+        faceToTetCenter[i] = v1;
+      }
+
+      const ConstEdgeDataList &edgeDataList = ttelist[ti];
+      for (size_t ei = 0; ei < 6; ++ei)
+      {
+        const EdgeData &edgedata = *(edgeDataList[ei]);
+
+        Vector<DoubleType> v0 = tetrahedronCenter;
+        v0 -= edgeCenters[edgedata.edge->GetIndex()];
+
+        /// The edgeCouple is from center of Tetrahedron to each triangle side to the tetrahedron edge index
+        const Vector<DoubleType> &v1 = faceToTetCenter[edgedata.triangle_index[0]];
+        const Vector<DoubleType> &v2 = faceToTetCenter[edgedata.triangle_index[1]];
+        ev[6*ti + ei] = 0.5 * (magnitude(cross_prod(v0, v1)) + magnitude(cross_prod(v0, v2)));
+      }
     }
-  }
+  }, 6);
 
+  cache.Store(ev);
   SetValues(ev);
 }
 template <typename DoubleType>
@@ -12,6 +12,7 @@ SPDX-License-Identifier: Apache-2.0
 #include "EdgeModel.hh"
 #include "EdgeData.hh"
 #include "Edge.hh"
+#include "ParallelFor.hh"
 
 template <typename DoubleType>
 TetrahedronNodeVolume<DoubleType>::TetrahedronNodeVolume(RegionPtr rp)
@@ -52,23 +53,27 @@ void TetrahedronNodeVolume<DoubleType>::calcTetrahedronEdgeScalarValues() const
   std::vector<DoubleType> ev(6 * tl.size());
 
 
-  const Region::TetrahedronToConstEdgeDataList_t &ttelist = GetRegion().GetTetrahedronToEdgeDataList();
-  for (size_t tindex = 0; tindex < tl.size(); ++tindex)
-  {
-    const ConstEdgeDataList &edgeDataList = ttelist[tindex];
+  //// the values are expanded before the threads read them
+  const std::vector<DoubleType> &evol_values = evol.GetScalarList();
 
-    /// teindex is 0,1,2,3,4,5
-//    dsAssert(edgeDataList.size() == 6, "UNEXPECTED");
-    for (size_t teindex = 0; teindex < edgeDataList.size(); ++teindex)
+  const Region::TetrahedronToConstEdgeDataList_t &ttelist = GetRegion().GetTetrahedronToEdgeDataList();
+  dsMath::ParallelFor(tl.size(), [&](size_t b, size_t e) {
+    for (size_t tindex = b; tindex < e; ++tindex)
     {
-      DoubleType vol = edge_lengths[edgeDataList[teindex]->edge->GetIndex()];
+      const ConstEdgeDataList &edgeDataList = ttelist[tindex];
+
+      /// teindex is 0,1,2,3,4,5
+      for (size_t teindex = 0; teindex < edgeDataList.size(); ++teindex)
+      {
+        DoubleType vol = edge_lengths[edgeDataList[teindex]->edge->GetIndex()];
 
-      const size_t oindex = 6*tindex + teindex;
+        const size_t oindex = 6*tindex + teindex;
 
-      vol *= evol[oindex];
-      ev[oindex] = vol;
+        vol *= evol_values[oindex];
+        ev[oindex] = vol;
+      }
     }
-  }
+  }, 6);
   SetValues(ev);
 }
 
@@ -12,6 +12,7 @@ SPDX-License-Identifier: Apache-2.0
 #include "Triangle.hh"
 #include "Edge.hh"
 #include "Node.hh"
+#include "GeometryCache.hh"
 
 template <typename DoubleType>
 TriangleEdgeCouple<DoubleType>::TriangleEdgeCouple(RegionPtr rp) :
@@ -32,7 +33,17 @@ void TriangleEdgeCouple<DoubleType>::calcTriangleEdgeScalarValues() const
   dsAssert(dimension == 2, "UNEXPECTED");
 
   const ConstTriangleList &el = GetRegion().GetTriangleList();
-  std::vector<DoubleType> ev(3*el.size());
+
+  //// the element centers are not needed when the values are in the cache
+  const GeometryCache<DoubleType> cache(GetRegion(), GetName());
+  std::vector<DoubleType> ev;
+  if (cache.Load(3*el.size(), ev))
+  {
+    SetValues(ev);
+    return;
+  }
+
+  ev.resize(3*el.size());
 
   for (size_t i = 0; i < el.size(); ++i)
   {
@@ -43,6 +54,7 @@ void TriangleEdgeCouple<DoubleType>::calcTriangleEdgeScalarValues() const
     ev[indexi + 2] = v.Getz();
   }
 
+  cache.Store(ev);
   SetValues(ev);
 }
 
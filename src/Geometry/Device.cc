@@ -452,8 +452,25 @@ void Device::UpdateContacts()
   }
 }
 
+bool Device::HasCircuitNodes() const
+{
+  for (auto &it : contactList)
+  {
+    const ContactEquationPtrMap_t &celist = (it.second)->GetEquationPtrList();
+    for (auto &cit : celist)
+    {
+      if (!(cit.second).GetCircuitNode().empty())
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
 void Device::SignalCallbacksOnInterface(const std::string &nm, const Region *rp) const
 {
+  std::lock_guard<std::recursive_mutex> lock(interfaceSignalMutex);
   for (InterfaceList_t::const_iterator it = interfaceList.begin();
         it != interfaceList.end();
         ++it
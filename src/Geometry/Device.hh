@@ -18,6 +18,7 @@ SPDX-License-Identifier: Apache-2.0
 #include <vector>
 #include <map>
 #include <complex>
+#include <mutex>
 
 
 class PermutationEntry;
@@ -83,6 +84,8 @@ class Device
       void NoiseUpdate(const std::string &/*output*/, const std::vector<PermutationEntry> &/*permvec*/, const std::vector<dsMath::ComplexDouble_t<DoubleType>> &/*result*/);
 
       void UpdateContacts();
+      /// true if any contact equation is connected to a circuit node
+      bool HasCircuitNodes() const;
       // Need to be careful with accessors and stuff
       // maintaining constness of contact
       void AddContact(const ContactPtr &);
@@ -185,6 +188,8 @@ class Device
 
       ContactList_t contactList;
       InterfaceList_t interfaceList;
+      //// the regions on either side of an interface may signal it at the same time
+      mutable std::recursive_mutex interfaceSignalMutex;
 
       CoordinateList_t coordinateList;
 
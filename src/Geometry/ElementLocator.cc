@@ -0,0 +1,366 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#include "ElementLocator.hh"
+#include "Region.hh"
+#include "Node.hh"
+#include "Edge.hh"
+#include "Triangle.hh"
+#include "Tetrahedron.hh"
+#include "ParallelFor.hh"
+#include "dsAssert.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <atomic>
+
+namespace {
+/// Points this far outside of an element, relative to its size, are considered inside
+const double weightTolerance = 1.0e-10;
+
+double GetComponent(const Vector<double> &v, size_t d)
+{
+  return (d == 0) ? v.Getx() : ((d == 1) ? v.Gety() : v.Getz());
+}
+}
+
+ElementLocator::ElementLocator(const Region &region) : dimension_(region.GetDimension()), bucketSize_({1.0, 1.0, 1.0}), bucketCount_({1, 1, 1})
+{
+  dsAssert((dimension_ >= 1) && (dimension_ <= 3), "UNEXPECTED");
+
+  const ConstNodeList &nodes = region.GetNodeList();
+  positions_.resize(nodes.size());
+  for (size_t i = 0; i < nodes.size(); ++i)
+  {
+    positions_[i] = nodes[i]->Position();
+  }
+
+  const size_t numelementnodes = dimension_ + 1;
+  auto AddElements = [&](const auto &elements) {
+    elementNodes_.reserve(numelementnodes * elements.size());
+    for (const auto &element : elements)
+    {
+      for (const auto &node : element->GetNodeList())
+      {
+        elementNodes_.push_back(node->GetIndex());
+      }
+    }
+  };
+
+  if (dimension_ == 1)
+  {
+    AddElements(region.GetEdgeList());
+  }
+  else if (dimension_ == 2)
+  {
+    AddElements(region.GetTriangleList());
+  }
+  else
+  {
+    AddElements(region.GetTetrahedronList());
+  }
+
+  const size_t numelements = elementNodes_.size() / numelementnodes;
+  if (numelements == 0)
+  {
+    bucketPtr_.assign(2, 0);
+    return;
+  }
+
+  Vector<double> upper;
+  lower_ = positions_[elementNodes_[0]];
+  upper  = lower_;
+  for (const auto &p : positions_)
+  {
+    lower_ = Vector<double>(std::min(lower_.Getx(), p.Getx()), std::min(lower_.Gety(), p.Gety()), std::min(lower_.Getz(), p.Getz()));
+    upper  = Vector<double>(std::max(upper.Getx(), p.Getx()), std::max(upper.Gety(), p.Gety()), std::max(upper.Getz(), p.Getz()));
+  }
+
+  //// about one element for each bucket
+  double volume = 1.0;
+  std::array<double, 3> extent = {1.0, 1.0, 1.0};
+  for (size_t d = 0; d < dimension_; ++d)
+  {
+    extent[d] = GetComponent(upper, d) - GetComponent(lower_, d);
+    if (extent[d] <= 0.0)
+    {
+      extent[d] = 1.0;
+    }
+    volume *= extent[d];
+  }
+  const double size = std::pow(volume / static_cast<double>(numelements), 1.0 / static_cast<double>(dimension_));
+
+  size_t numbuckets = 1;
+  for (size_t d = 0; d < dimension_; ++d)
+  {
+    const double count = std::ceil(extent[d] / size);
+    bucketCount_[d] = std::max<size_t>(1, std::min<size_t>(numelements, static_cast<size_t>(count)));
+    bucketSize_[d]  = extent[d] / static_cast<double>(bucketCount_[d]);
+    numbuckets *= bucketCount_[d];
+  }
+
+  //// each element is in every bucket overlapping its bounding box
+  auto ForElementBuckets = [&](size_t e, const auto &f) {
+    std::array<size_t, 3> lo = {0, 0, 0};
+    std::array<size_t, 3> hi = {0, 0, 0};
+    for (size_t n = 0; n < numelementnodes; ++n)
+    {
+      const std::array<size_t, 3> b = GetBucket(positions_[elementNodes_[numelementnodes * e + n]]);
+      for (size_t d = 0; d < 3; ++d)
+      {
+        lo[d] = (n == 0) ? b[d] : std::min(lo[d], b[d]);
+        hi[d] = (n == 0) ? b[d] : std::max(hi[d], b[d]);
+      }
+    }
+    for (size_t i = lo[0]; i <= hi[0]; ++i)
+    {
+      for (size_t j = lo[1]; j <= hi[1]; ++j)
+      {
+        for (size_t k = lo[2]; k <= hi[2]; ++k)
+        {
+          f((i * bucketCount_[1] + j) * bucketCount_[2] + k);
+        }
+      }
+    }
+  };
+
+  bucketPtr_.assign(numbuckets + 1, 0);
+  for (size_t e = 0; e < numelements; ++e)
+  {
+    ForElementBuckets(e, [&](size_t b) {++bucketPtr_[b + 1];});
+  }
+  for (size_t b = 0; b < numbuckets; ++b)
+  {
+    bucketPtr_[b + 1] += bucketPtr_[b];
+  }
+
+  bucketElements_.resize(bucketPtr_.back());
+  std::vector<size_t> position(bucketPtr_.begin(), bucketPtr_.end() - 1);
+  for (size_t e = 0; e < numelements; ++e)
+  {
+    ForElementBuckets(e, [&](size_t b) {bucketElements_[position[b]++] = e;});
+  }
+}
+
+std::array<size_t, 3> ElementLocator::GetBucket(const Vector<double> &p) const
+{
+  std::array<size_t, 3> ret = {0, 0, 0};
+  for (size_t d = 0; d < dimension_; ++d)
+  {
+    const double x = std::floor((GetComponent(p, d) - GetComponent(lower_, d)) / bucketSize_[d]);
+    if (x <= 0.0)
+    {
+      ret[d] = 0;
+    }
+    else if (x >= static_cast<double>(bucketCount_[d] - 1))
+    {
+      ret[d] = bucketCount_[d] - 1;
+    }
+    else
+    {
+      ret[d] = static_cast<size_t>(x);
+    }
+  }
+  return ret;
+}
+
+double ElementLocator::GetWeights(size_t e, const Vector<double> &p, Weights_t &weights) const
+{
+  const size_t *nodes = &elementNodes_[(dimension_ + 1) * e];
+  const Vector<double> &p0 = positions_[nodes[0]];
+
+  //// solve for the weights of nodes 1 to dimension with the edges from node 0
+  double a[3][3] = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+  double b[3] = {0.0, 0.0, 0.0};
+  for (size_t d = 0; d < dimension_; ++d)
+  {
+    for (size_t n = 0; n < dimension_; ++n)
+    {
+      a[d][n] = GetComponent(positions_[nodes[n + 1]], d) - GetComponent(p0, d);
+    }
+    b[d] = GetComponent(p, d) - GetComponent(p0, d);
+  }
+
+  const double det = a[0][0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1])
+                   - a[0][1] * (a[1][0] * a[2][2] - a[1][2] * a[2][0])
+                   + a[0][2] * (a[1][0] * a[2][1] - a[1][1] * a[2][0]);
+  if (det == 0.0)
+  {
+    return -std::numeric_limits<double>::max();
+  }
+
+  weights = {0.0, 0.0, 0.0, 0.0};
+  double sum = 0.0;
+  for (size_t n = 0; n < dimension_; ++n)
+  {
+    //// Cramer's rule, with column n replaced
+    double c[3][3];
+    for (size_t i = 0; i < 3; ++i)
+    {
+      for (size_t j = 0; j < 3; ++j)
+      {
+        c[i][j] = (j == n) ? b[i] : a[i][j];
+      }
+    }
+    const double dn = c[0][0] * (c[1][1] * c[2][2] - c[1][2] * c[2][1])
+                    - c[0][1] * (c[1][0] * c[2][2] - c[1][2] * c[2][0])
+                    + c[0][2] * (c[1][0] * c[2][1] - c[1][1] * c[2][0]);
+    weights[n + 1] = dn / det;
+    sum += weights[n + 1];
+  }
+  weights[0] = 1.0 - sum;
+
+  double minweight = weights[0];
+  for (size_t n = 1; n <= dimension_; ++n)
+  {
+    minweight = std::min(minweight, weights[n]);
+  }
+  return minweight;
+}
+
+bool ElementLocator::Locate(const Vector<double> &p, ElementNodes_t &nodes, Weights_t &weights) const
+{
+  const size_t numelementnodes = dimension_ + 1;
+  const std::array<size_t, 3> home = GetBucket(p);
+
+  nodes   = {0, 0, 0, 0};
+  weights = {0.0, 0.0, 0.0, 0.0};
+
+  size_t maxradius = 0;
+  for (size_t d = 0; d < dimension_; ++d)
+  {
+    maxradius = std::max(maxradius, bucketCount_[d]);
+  }
+
+  size_t best = size_t(-1);
+  double bestweight = -std::numeric_limits<double>::max();
+  Weights_t bestweights = {0.0, 0.0, 0.0, 0.0};
+
+  //// search the shells of buckets around the bucket of the point
+  //// after an element is found outside of the point, one more shell is searched for a nearer one
+  for (size_t r = 0; r <= maxradius; ++r)
+  {
+    std::array<size_t, 3> lo;
+    std::array<size_t, 3> hi;
+    for (size_t d = 0; d < 3; ++d)
+    {
+      lo[d] = (home[d] > r) ? home[d] - r : 0;
+      hi[d] = std::min(home[d] + r, bucketCount_[d] - 1);
+    }
+
+    for (size_t i = lo[0]; i <= hi[0]; ++i)
+    {
+      for (size_t j = lo[1]; j <= hi[1]; ++j)
+      {
+        for (size_t k = lo[2]; k <= hi[2]; ++k)
+        {
+          const size_t distance = std::max({
+            (i > home[0]) ? i - home[0] : home[0] - i,
+            (j > home[1]) ? j - home[1] : home[1] - j,
+            (k > home[2]) ? k - home[2] : home[2] - k});
+          if (distance != r)
+          {
+            continue;
+          }
+
+          const size_t b = (i * bucketCount_[1] + j) * bucketCount_[2] + k;
+          for (size_t bi = bucketPtr_[b]; bi < bucketPtr_[b + 1]; ++bi)
+          {
+            const size_t e = bucketElements_[bi];
+            Weights_t w;
+            const double minweight = GetWeights(e, p, w);
+            if (minweight > bestweight)
+            {
+              best = e;
+              bestweight = minweight;
+              bestweights = w;
+            }
+          }
+        }
+      }
+    }
+
+    if (bestweight >= -weightTolerance)
+    {
+      break;
+    }
+    else if ((best != size_t(-1)) && (r > 0))
+    {
+      break;
+    }
+  }
+
+  if (best == size_t(-1))
+  {
+    return false;
+  }
+
+  const bool inside = (bestweight >= -weightTolerance);
+  if (!inside)
+  {
+    //// limit the weights to the element
+    double sum = 0.0;
+    for (size_t n = 0; n < numelementnodes; ++n)
+    {
+      bestweights[n] = std::max(bestweights[n], 0.0);
+      sum += bestweights[n];
+    }
+    for (size_t n = 0; n < numelementnodes; ++n)
+    {
+      bestweights[n] /= sum;
+    }
+  }
+
+  for (size_t n = 0; n < numelementnodes; ++n)
+  {
+    nodes[n] = elementNodes_[numelementnodes * best + n];
+  }
+  weights = bestweights;
+
+  return inside;
+}
+
+template <typename DoubleType>
+size_t InterpolateNodeValues(const ElementLocator &locator, const std::vector<DoubleType> &values, const Region &region, std::vector<DoubleType> &result)
+{
+  const ConstNodeList &nodes = region.GetNodeList();
+  const size_t numelementnodes = locator.GetDimension() + 1;
+
+  result.assign(nodes.size(), DoubleType(0.0));
+
+  std::atomic<size_t> outside(0);
+  dsMath::ParallelFor(nodes.size(), [&](size_t b, size_t e) {
+    size_t count = 0;
+    ElementLocator::ElementNodes_t enodes;
+    ElementLocator::Weights_t      weights;
+    for (size_t i = b; i < e; ++i)
+    {
+      if (!locator.Locate(nodes[i]->Position(), enodes, weights))
+      {
+        ++count;
+      }
+
+      DoubleType v(0.0);
+      for (size_t n = 0; n < numelementnodes; ++n)
+      {
+        v += static_cast<DoubleType>(weights[n]) * values[enodes[n]];
+      }
+      result[i] = v;
+    }
+    outside += count;
+  }, 64);
+
+  return outside;
+}
+
+template size_t InterpolateNodeValues(const ElementLocator &, const std::vector<double> &, const Region &, std::vector<double> &);
+#ifdef DEVSIM_EXTENDED_PRECISION
+#include "Float128.hh"
+template size_t InterpolateNodeValues(const ElementLocator &, const std::vector<float128> &, const Region &, std::vector<float128> &);
+#endif
+
@@ -0,0 +1,69 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#ifndef ELEMENT_LOCATOR_HH
+#define ELEMENT_LOCATOR_HH
+#include "Vector.hh"
+
+#include <vector>
+#include <array>
+#include <cstddef>
+
+class Region;
+
+/// Finds the element of a region containing a point, and the barycentric weights of its nodes
+/// The elements are the edges in 1D, the triangles in 2D, and the tetrahedra in 3D
+/// The elements are stored in a uniform grid of buckets covering the region, in compressed row format
+class ElementLocator {
+  public:
+    typedef std::array<size_t, 4> ElementNodes_t;
+    typedef std::array<double, 4> Weights_t;
+
+    explicit ElementLocator(const Region &);
+
+    size_t GetDimension() const
+    {
+      return dimension_;
+    }
+
+    bool HasElements() const
+    {
+      return !elementNodes_.empty();
+    }
+
+    /// Returns false when the point is outside of the region
+    /// The nearest element found is then used, with its weights limited to the element
+    /// This may be called from several threads at the same time
+    bool Locate(const Vector<double> &, ElementNodes_t &, Weights_t &) const;
+
+  private:
+    ElementLocator(const ElementLocator &);
+    ElementLocator &operator=(const ElementLocator &);
+
+    /// The smallest weight is negative when the point is outside of the element
+    double GetWeights(size_t /*element*/, const Vector<double> &, Weights_t &) const;
+
+    std::array<size_t, 3> GetBucket(const Vector<double> &) const;
+
+    size_t dimension_;
+    std::vector<Vector<double>> positions_;
+    //// dimension + 1 node indexes for each element
+    std::vector<size_t>         elementNodes_;
+
+    Vector<double>        lower_;
+    std::array<double, 3> bucketSize_;
+    std::array<size_t, 3> bucketCount_;
+    std::vector<size_t>   bucketPtr_;
+    std::vector<size_t>   bucketElements_;
+};
+
+/// The node values of the destination region are interpolated from the source region
+/// Returns the number of destination nodes outside of the source region
+template <typename DoubleType>
+size_t InterpolateNodeValues(const ElementLocator &, const std::vector<DoubleType> &/*source values*/, const Region &/*destination*/, std::vector<DoubleType> &/*result*/);
+#endif
+
@@ -136,6 +136,7 @@ void Interface::Assemble(dsMath::RealRowColValueVec<DoubleType> &m, dsMath::RHSE
 void Interface::RegisterCallback(const std::string &mod, const std::string &dep)
 {
     DependencyMap[mod].insert(dep);
+    DependentMap[dep].insert(mod);
 }
 
 void Interface::UnregisterCallback(const std::string &mod)
@@ -143,6 +144,18 @@ void Interface::UnregisterCallback(const std::string &mod)
     DependencyMap_t::iterator it = DependencyMap.find(mod);
     if (it != DependencyMap.end())
     {
+        for (const auto &dep : it->second)
+        {
+            DependencyMap_t::iterator dit = DependentMap.find(dep);
+            if (dit != DependentMap.end())
+            {
+                dit->second.erase(mod);
+                if (dit->second.empty())
+                {
+                    DependentMap.erase(dit);
+                }
+            }
+        }
         DependencyMap.erase(it);
     }
 }
@@ -150,17 +163,12 @@ void Interface::UnregisterCallback(const std::string &mod)
 void Interface::SignalCallbacks(const std::string &str)
 {
   typedef std::set<std::string> list_t;
+  //// copied, since the models being notified signal their own dependents
   list_t list;
-  DependencyMap_t::iterator it = DependencyMap.begin();
-  const DependencyMap_t::iterator end = DependencyMap.end();
-  for ( ; it != end; ++it)
+  DependencyMap_t::const_iterator it = DependentMap.find(str);
+  if (it != DependentMap.end())
   {
-    // If this one has a dependency on str
-    if ((*it).second.count(str))
-    {
-      // put it in the set to be notified
-      list.insert(it->first);
-    }
+    list = it->second;
   }
 
   list_t::iterator lit = list.begin();
@@ -185,6 +185,8 @@ class Interface {
         NameToInterfaceNodeModelMap_t interfaceNodeModels;
 
         DependencyMap_t DependencyMap;
+        //// the models which depend on each model or parameter name
+        DependencyMap_t DependentMap;
 
         WeakInterfaceModelExprDataCachePtr<double>   interfaceModelExprDataCache_double;
 #ifdef DEVSIM_EXTENDED_PRECISION
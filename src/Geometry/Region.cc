@@ -29,6 +29,7 @@ SPDX-License-Identifier: Apache-2.0
 #include "InterfaceNodeModel.hh"
 
 #include "dsAssert.hh"
+#include "ParallelFor.hh"
 
 #include <algorithm>
 #include <vector>
@@ -125,16 +126,27 @@ const TetrahedronElementField<DoubleType> &Region::GetTetrahedronElementField()
   return *tetrahedronElementField;
 }
 
+//// the centers are calculated on first use, since the geometric models may be read from the cache
 template <typename DoubleType>
 const std::vector<Vector<DoubleType> > &Region::GetTriangleCenters() const
 {
-  return GetGeometryField<DoubleType>().triangleCenters;
+  auto &triangleCenters = GetGeometryField<DoubleType>().triangleCenters;
+  if (triangleCenters.size() != triangleList.size())
+  {
+    SetTriangleCenters();
+  }
+  return triangleCenters;
 }
 
 template <typename DoubleType>
 const std::vector<Vector<DoubleType> > &Region::GetTetrahedronCenters() const
 {
-  return GetGeometryField<DoubleType>().tetrahedronCenters;
+  auto &tetrahedronCenters = GetGeometryField<DoubleType>().tetrahedronCenters;
+  if (tetrahedronCenters.size() != tetrahedronList.size())
+  {
+    SetTetrahedronCenters();
+  }
+  return tetrahedronCenters;
 }
 
 template <typename DoubleType>
@@ -196,6 +208,7 @@ Region::Region(std::string regName, std::string mat, size_t d, ConstDevicePtr dp
         triangleList.reserve(DEFAULT_NUMBER_NODES);
 
     numequations = 0;
+    assemblyVersion = 0;
     baseeqnnum = size_t(-1);
 }
 
@@ -305,8 +318,11 @@ void Region::AddTetrahedronList(ConstTetrahedronList &nl)
 /// Need to first make sure to set indexes on nodes
 void Region::SetNodeIndexes()
 {
-  // Sort based on node index
-  std::sort(nodeList.begin(), nodeList.end(), NodeCompIndex());
+  // Sort based on node index, unless the mesher has already ordered them
+  if (!std::is_sorted(nodeList.begin(), nodeList.end(), NodeCompIndex()))
+  {
+    std::sort(nodeList.begin(), nodeList.end(), NodeCompIndex());
+  }
   // Swap trick to remove excess consumption
   std::vector<ConstNodePtr>(nodeList).swap(nodeList);
   // Number elements locally
@@ -328,8 +344,11 @@ void Region::SetNodeIndexes()
 /// then edges
 void Region::SetEdgeIndexes()
 {
-  // Sort based on node index
-  std::sort(edgeList.begin(), edgeList.end(), EdgeCompIndex());
+  // Sort based on edge index, unless the mesher has already ordered them
+  if (!std::is_sorted(edgeList.begin(), edgeList.end(), EdgeCompIndex()))
+  {
+    std::sort(edgeList.begin(), edgeList.end(), EdgeCompIndex());
+  }
   // Swap trick to remove excess consumption
   std::vector<ConstEdgePtr>(edgeList).swap(edgeList);
   // Number elements locally
@@ -374,11 +393,7 @@ void Region::CreateNodeToEdgeList()
     nodeToEdgeList[nh].push_back(edgeList[i]);
     nodeToEdgeList[nt].push_back(edgeList[i]);
   }
-
-  for (size_t i = 0; i < nodeToEdgeList.size(); ++i)
-  {
-    std::sort(nodeToEdgeList[i].begin(), nodeToEdgeList[i].end(), EdgeCompIndex());
-  }
+  // the edges are visited in the order of their index, so each list is already sorted
 }
 
 /// Requires Node Indexes to be set
@@ -395,12 +410,8 @@ void Region::CreateNodeToTriangleList()
       nodeToTriangleList[nodes[j]->GetIndex()].push_back(ctp);
     }
   }
-
   // triangle intersection below requires sorted vectors
-  for (size_t i = 0; i < nodeToTriangleList.size(); ++i)
-  {
-    std::sort(nodeToTriangleList[i].begin(), nodeToTriangleList[i].end(), TriangleCompIndex());
-  }
+  // the triangles are visited in the order of their index, so each list is already sorted
 }
 
 /// Requires Node Indexes to be set
@@ -423,10 +434,7 @@ void Region::CreateNodeToTetrahedronList()
   }
 
   // tetrahedron intersection below requires sorted vectors
-  for (size_t i = 0; i < nodeToTetrahedronList.size(); ++i)
-  {
-    std::sort(nodeToTetrahedronList[i].begin(), nodeToTetrahedronList[i].end(), TetrahedronCompIndex());
-  }
+  // the tetrahedra are visited in the order of their index, so each list is already sorted
 }
 
 /// Requires Node, edge, and triangle indices to be set
@@ -687,49 +695,58 @@ void Region::CreateTetrahedronToTriangleList()
   }
 }
 
-void Region::SetTriangleCenters()
+void Region::SetTriangleCenters() const
 {
+  //// each element only writes its own center
 #ifdef DEVSIM_EXTENDED_PRECISION
   auto &triangleCenters_float128 = GetGeometryField<float128>().triangleCenters;
   auto &triangleCenters_double = GetGeometryField<double>().triangleCenters;
   triangleCenters_float128.resize(triangleList.size());
   triangleCenters_double.resize(triangleList.size());
-  for (size_t i = 0; i < triangleList.size(); ++i)
-  {
-    Vector<float128> &center = triangleCenters_float128[i];
-    center = GetCenter<float128>(*triangleList[i]);
-    triangleCenters_double[i] = Vector<double>(static_cast<double>(center.Getx()), static_cast<double>(center.Gety()), static_cast<double>(center.Getz()));
-  }
+  dsMath::ParallelFor(triangleList.size(), [&](size_t b, size_t e) {
+    for (size_t i = b; i < e; ++i)
+    {
+      Vector<float128> &center = triangleCenters_float128[i];
+      center = GetCenter<float128>(*triangleList[i]);
+      triangleCenters_double[i] = Vector<double>(static_cast<double>(center.Getx()), static_cast<double>(center.Gety()), static_cast<double>(center.Getz()));
+    }
+  });
 #else
   auto &triangleCenters_double = GetGeometryField<double>().triangleCenters;
   triangleCenters_double.resize(triangleList.size());
-  for (size_t i = 0; i < triangleList.size(); ++i)
-  {
-    triangleCenters_double[i] = GetCenter<double>(*triangleList[i]);
-  }
+  dsMath::ParallelFor(triangleList.size(), [&](size_t b, size_t e) {
+    for (size_t i = b; i < e; ++i)
+    {
+      triangleCenters_double[i] = GetCenter<double>(*triangleList[i]);
+    }
+  });
 #endif
 }
 
-void Region::SetTetrahedronCenters()
+void Region::SetTetrahedronCenters() const
 {
 #ifdef DEVSIM_EXTENDED_PRECISION
   auto &tetrahedronCenters_float128 = GetGeometryField<float128>().tetrahedronCenters;
   auto &tetrahedronCenters_double = GetGeometryField<double>().tetrahedronCenters;
   tetrahedronCenters_float128.resize(tetrahedronList.size());
   tetrahedronCenters_double.resize(tetrahedronList.size());
-  for (size_t i = 0; i < tetrahedronList.size(); ++i)
-  {
-    Vector<float128> &center = tetrahedronCenters_float128[i];
-    center = GetCenter<float128>(*tetrahedronList[i]);
-    tetrahedronCenters_double[i] = Vector<double>(static_cast<double>(center.Getx()), static_cast<double>(center.Gety()), static_cast<double>(center.Getz()));
-  }
+  dsMath::ParallelFor(tetrahedronList.size(), [&](size_t b, size_t e) {
+    for (size_t i = b; i < e; ++i)
+    {
+      Vector<float128> &center = tetrahedronCenters_float128[i];
+      center = GetCenter<float128>(*tetrahedronList[i]);
+      tetrahedronCenters_double[i] = Vector<double>(static_cast<double>(center.Getx()), static_cast<double>(center.Gety()), static_cast<double>(center.Getz()));
+    }
+  });
 #else
   auto &tetrahedronCenters_double = GetGeometryField<double>().tetrahedronCenters;
   tetrahedronCenters_double.resize(tetrahedronList.size());
-  for (size_t i = 0; i < tetrahedronList.size(); ++i)
-  {
-    tetrahedronCenters_double[i] = GetCenter<double>(*tetrahedronList[i]);
-  }
+  dsMath::ParallelFor(tetrahedronList.size(), [&](size_t b, size_t e) {
+    for (size_t i = b; i < e; ++i)
+    {
+      tetrahedronCenters_double[i] = GetCenter<double>(*tetrahedronList[i]);
+    }
+  });
 #endif
 }
 
@@ -751,7 +768,6 @@ void Region::FinalizeMesh()
     CreateNodeToTriangleList();
     CreateEdgeToTriangleList();
     CreateTriangleToEdgeList();
-    SetTriangleCenters();
   }
 
   if (!tetrahedronList.empty())
@@ -773,7 +789,6 @@ void Region::FinalizeMesh()
     CreateTriangleToTetrahedronList();
     CreateTetrahedronToTriangleList();
     CreateTetrahedronToEdgeDataList();
-    SetTetrahedronCenters();
   }
 
   finalized = true;
@@ -836,6 +851,7 @@ void Region::DeleteNodeModel(const std::string &nm)
   {
     UnregisterCallback(nm);
     nodeModels.erase(it);
+    ++assemblyVersion;
     //// Anything depending on this model is notified it is out of date
     //// However, it is not removed as a dependency for that model
     this->SignalCallbacks(nm);
@@ -849,6 +865,7 @@ void Region::DeleteEdgeModel(const std::string &nm)
   {
     UnregisterCallback(nm);
     edgeModels.erase(it);
+    ++assemblyVersion;
     //// Anything depending on this model is notified it is out of date
     //// However, it is not removed as a dependency for that model
     this->SignalCallbacks(nm);
@@ -862,6 +879,7 @@ void Region::DeleteTriangleEdgeModel(const std::string &nm)
   {
     UnregisterCallback(nm);
     triangleEdgeModels.erase(it);
+    ++assemblyVersion;
     //// Anything depending on this model is notified it is out of date
     //// However, it is not removed as a dependency for that model
     this->SignalCallbacks(nm);
@@ -875,6 +893,7 @@ void Region::DeleteTetrahedronEdgeModel(const std::string &nm)
   {
     UnregisterCallback(nm);
     tetrahedronEdgeModels.erase(it);
+    ++assemblyVersion;
     //// Anything depending on this model is notified it is out of date
     //// However, it is not removed as a dependency for that model
     this->SignalCallbacks(nm);
@@ -884,6 +903,7 @@ void Region::DeleteTetrahedronEdgeModel(const std::string &nm)
 void Region::AddNodeModel(NodeModelPtr nmp)
 {
     const std::string &nm = nmp->GetName();
+    ++assemblyVersion;
     if (nodeModels.count(nm))
     {
         std::ostringstream os;
@@ -922,6 +942,7 @@ void Region::AddNodeModel(NodeModelPtr nmp)
 void Region::AddEdgeModel(EdgeModelPtr emp)
 {
     const std::string &nm = emp->GetName();
+    ++assemblyVersion;
     if (edgeModels.count(nm))
     {
         std::ostringstream os;
@@ -960,6 +981,7 @@ void Region::AddEdgeModel(EdgeModelPtr emp)
 void Region::AddTriangleEdgeModel(TriangleEdgeModelPtr emp)
 {
     const std::string &nm = emp->GetName();
+    ++assemblyVersion;
     if (triangleEdgeModels.count(nm))
     {
         std::ostringstream os;
@@ -998,6 +1020,7 @@ void Region::AddTriangleEdgeModel(TriangleEdgeModelPtr emp)
 void Region::AddTetrahedronEdgeModel(TetrahedronEdgeModelPtr emp)
 {
     const std::string &nm = emp->GetName();
+    ++assemblyVersion;
     if (tetrahedronEdgeModels.count(nm))
     {
         std::ostringstream os;
@@ -1040,6 +1063,7 @@ void Region::AddTetrahedronEdgeModel(TetrahedronEdgeModelPtr emp)
 void Region::RegisterCallback(const std::string &mod, const std::string &dep)
 {
     DependencyMap[mod].insert(dep);
+    DependentMap[dep].insert(mod);
 }
 
 void Region::UnregisterCallback(const std::string &mod)
@@ -1048,10 +1072,30 @@ void Region::UnregisterCallback(const std::string &mod)
     DependencyMap_t::iterator it = DependencyMap.find(mod);
     if (it != DependencyMap.end())
     {
+        for (const auto &dep : it->second)
+        {
+            DependencyMap_t::iterator dit = DependentMap.find(dep);
+            if (dit != DependentMap.end())
+            {
+                dit->second.erase(mod);
+                if (dit->second.empty())
+                {
+                    DependentMap.erase(dit);
+                }
+            }
+        }
         DependencyMap.erase(it);
     }
 }
 
+void Region::ClearParameterValue(size_t symbol) const
+{
+    if (symbol < parameterValues.size())
+    {
+        parameterValues[symbol] = ParameterValue();
+    }
+}
+
 /*
  * Does not yet handle cyclic dependencies
  * Does not mark the original dependency as being old
@@ -1059,17 +1103,12 @@ void Region::UnregisterCallback(const std::string &mod)
 void Region::SignalCallbacks(const std::string &str)
 {
   typedef std::set<std::string> list_t;
+  //// copied, since the models being notified signal their own dependents
   list_t list;
-  DependencyMap_t::iterator it = DependencyMap.begin();
-  const DependencyMap_t::iterator end = DependencyMap.end();
-  for ( ; it != end; ++it)
+  DependencyMap_t::const_iterator it = DependentMap.find(str);
+  if (it != DependentMap.end())
   {
-    // If this one has a dependency on str
-    if ((*it).second.count(str))
-    {
-      // put it in the set to be notified
-      list.insert(it->first);
-    }
+    list = it->second;
   }
 
   list_t::iterator lit = list.begin();
@@ -1129,6 +1168,8 @@ void Region::AddEquation(EquationHolder &eq)
   const std::string nm  = eq.GetName();
   const std::string var = eq.GetVariable();
 
+  ++assemblyVersion;
+
   if (equationPointerMap.count(nm))
   {
     EquationHolder &oeq = equationPointerMap[nm];
@@ -1213,6 +1254,7 @@ void Region::DeleteEquation(EquationHolder &eq)
     }
   }
   numequations = equationPointerMap.size();
+  ++assemblyVersion;
 }
 
 EquationPtrMap_t &Region::GetEquationPtrList()
@@ -1396,6 +1438,18 @@ void Region::Assemble(dsMath::RealRowColValueVec<DoubleType> &m, dsMath::RHSEntr
     }
 }
 
+void Region::PrefetchModels(dsMathEnum::WhatToLoad w) const
+{
+    if (numequations)
+    {
+      const EquationPtrMap_t &ep = GetEquationPtrList();
+      for (const auto &it : ep)
+      {
+        it.second.PrefetchModels(w);
+      }
+    }
+}
+
 void Region::BackupSolutions(const std::string &suffix)
 {
   const std::vector<std::string> &vlist = GetVariableList();
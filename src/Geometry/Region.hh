@@ -165,6 +165,14 @@ class Region
       typedef std::map<std::string, NodeModelPtr> NodeModelList_t;
       typedef std::map<std::string, std::set<std::string> > DependencyMap_t;
 
+      /// The value of a parameter on this region, after searching the region, device, and global parameters
+      struct ParameterValue {
+        bool   resolved = false;
+        bool   found    = false;
+        double value    = 0.0;
+      };
+      typedef std::vector<ParameterValue> ParameterValueList_t;
+
       Region(std::string, std::string, size_t, ConstDevicePtr);
       ~Region();
       void AddNode(const NodePtr &);
@@ -280,6 +288,15 @@ class Region
       // unregister a model when it is destructed
       void UnregisterCallback(const std::string &);
 
+      /// Indexed by the parameter symbols from GlobalData, where an entry is resolved when first used
+      ParameterValueList_t &GetParameterValueList() const
+      {
+        return parameterValues;
+      }
+
+      /// The parameter is resolved again when it is next used
+      void ClearParameterValue(size_t /*symbol*/) const;
+
       // note that these can be used to alias the same model with multiple names
       void AddNodeModel(NodeModelPtr);
       void AddEdgeModel(EdgeModelPtr);
@@ -338,6 +355,13 @@ class Region
 
       VariableList_t GetVariableList() const;
 
+      /// Incremented when a model or an equation is added or removed
+      /// The equations use this to know when their assembly plans must be resolved again
+      size_t GetAssemblyVersion() const
+      {
+        return assemblyVersion;
+      }
+
     template <typename DoubleType>
     DoubleType GetAbsError() const
     {
@@ -360,6 +384,10 @@ class Region
     template <typename DoubleType>
     void Assemble(dsMath::RealRowColValueVec<DoubleType> &, dsMath::RHSEntryVec<DoubleType> &, dsMathEnum::WhatToLoad, dsMathEnum::TimeMode);
 
+    /// Evaluates the models the equations used in their last assembly
+    /// The models of different regions may be evaluated at the same time
+    void PrefetchModels(dsMathEnum::WhatToLoad) const;
+
     void BackupSolutions(const std::string &);
     void RestoreSolutions(const std::string &);
 
@@ -422,8 +450,8 @@ class Region
       void CreateTetrahedronToEdgeDataList();
       void CreateTetrahedronToTriangleList();
       void CreateTriangleToTetrahedronList();
-      void SetTriangleCenters();
-      void SetTetrahedronCenters();
+      void SetTriangleCenters() const;
+      void SetTetrahedronCenters() const;
 
       bool UseExtendedPrecisionType(const std::string &t) const;
 
@@ -479,9 +507,14 @@ class Region
       TetrahedronEdgeModelList_t tetrahedronEdgeModels;
 
       DependencyMap_t DependencyMap;
+      //// the models which depend on each model or parameter name
+      DependencyMap_t DependentMap;
+
+      mutable ParameterValueList_t parameterValues;
 
       size_t baseeqnnum; // base equation number for this region
       size_t numequations;
+      size_t assemblyVersion;
       bool   finalized;
       ConstDevicePtr device;
       const   std::string deviceName;
@@ -6,6 +6,7 @@ SPDX-License-Identifier: Apache-2.0
 ***/
 
 #include "Bernoulli.hh"
+#include "VectorMath.hh"
 #include <cmath>
 #include <limits>
 
@@ -184,12 +185,113 @@ DoubleType derBernoulli(DoubleType x)
   return ret;
 }
 
+template <typename DoubleType>
+void BernoulliArray(const DoubleType *x, DoubleType *result, size_t n)
+{
+  for (size_t i = 0; i < n; ++i)
+  {
+    result[i] = Bernoulli<DoubleType>(x[i]);
+  }
+}
+
+template <typename DoubleType>
+void derBernoulliArray(const DoubleType *x, DoubleType *result, size_t n)
+{
+  for (size_t i = 0; i < n; ++i)
+  {
+    result[i] = derBernoulli<DoubleType>(x[i]);
+  }
+}
+
+namespace {
+DEVSIM_VECTOR_CLONES
+void BernoulliVector(const double *x, double *result, size_t n)
+{
+  for (size_t i = 0; i < n; ++i)
+  {
+    result[i] = VectorMath::Bernoulli(x[i]);
+  }
+}
+
+DEVSIM_VECTOR_CLONES
+void derBernoulliVector(const double *x, double *result, size_t n)
+{
+  for (size_t i = 0; i < n; ++i)
+  {
+    result[i] = VectorMath::derBernoulli(x[i]);
+  }
+}
+}
+
+template <>
+void BernoulliArray(const double *x, double *result, size_t n)
+{
+  BernoulliVector(x, result, n);
+}
+
+template <>
+void derBernoulliArray(const double *x, double *result, size_t n)
+{
+  derBernoulliVector(x, result, n);
+}
+
 template double Bernoulli<double>(double);
 template double derBernoulli<double>(double);
 #ifdef DEVSIM_EXTENDED_PRECISION
 #include "Float128.hh"
 template float128 Bernoulli<float128>(float128);
 template float128 derBernoulli<float128>(float128);
+template void BernoulliArray<float128>(const float128 *, float128 *, size_t);
+template void derBernoulliArray<float128>(const float128 *, float128 *, size_t);
+#endif
+
+#ifdef DEVSIM_UNIT_TEST
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+//// compares the array versions with the scalar versions
+int main()
+{
+  std::vector<double> x;
+  for (double v = -800.0; v <= 800.0; v += 0.0625)
+  {
+    x.push_back(v);
+  }
+  for (double v = 1.0; v > 1.0e-300; v *= 0.5)
+  {
+    x.push_back(v);
+    x.push_back(-v);
+  }
+  x.push_back(0.0);
+
+  std::vector<double> b(x.size());
+  std::vector<double> db(x.size());
+  BernoulliArray(x.data(), b.data(), x.size());
+  derBernoulliArray(x.data(), db.data(), x.size());
+
+  double maxb  = 0.0;
+  double maxdb = 0.0;
+  for (size_t i = 0; i < x.size(); ++i)
+  {
+    const double sb  = Bernoulli(x[i]);
+    const double sdb = derBernoulli(x[i]);
+    /// values flushed to 0 by the array version are ignored
+    if (fabs(sb) > 1.0e-300)
+    {
+      maxb = std::max(maxb, fabs(b[i] - sb) / fabs(sb));
+    }
+    /// the scalar version loses accuracy from cancellation near 0
+    if (fabs(sdb) > 1.0e-300 && fabs(x[i]) > 1.0e-2)
+    {
+      maxdb = std::max(maxdb, fabs(db[i] - sdb) / fabs(sdb));
+    }
+  }
+  std::cout << std::setprecision(3);
+  std::cout << "B max relative difference " << maxb << "\n";
+  std::cout << "dBdx max relative difference " << maxdb << "\n";
+  return ((maxb < 1.0e-14) && (maxdb < 1.0e-12)) ? 0 : 1;
+}
 #endif
 
 
@@ -11,4 +11,15 @@ template <typename DoubleType>
 DoubleType Bernoulli(DoubleType x);
 template <typename DoubleType>
 DoubleType derBernoulli(DoubleType x);
+
+#include <cstddef>
+/// Evaluate n values at once, the double precision versions are vectorized
+template <typename DoubleType>
+void BernoulliArray(const DoubleType *x, DoubleType *result, size_t n);
+template <typename DoubleType>
+void derBernoulliArray(const DoubleType *x, DoubleType *result, size_t n);
+template <>
+void BernoulliArray(const double *x, double *result, size_t n);
+template <>
+void derBernoulliArray(const double *x, double *result, size_t n);
 #endif
@@ -198,15 +198,60 @@ T dFermidx(T Eta)
     return 1.0/dInvFermidx(Fermi(Eta));
 }
 
+//// The regime branches are kept, since evaluating both regimes would double the number of log and pow calls
+template <typename T>
+void InvFermiArray(const T *r, T *result, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        result[i] = InvFermi(r[i]);
+    }
+}
+
+template <typename T>
+void dInvFermidxArray(const T *r, T *result, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        result[i] = dInvFermidx(r[i]);
+    }
+}
+
+template <typename T>
+void FermiArray(const T *Eta, T *result, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        result[i] = Fermi(Eta[i]);
+    }
+}
+
+template <typename T>
+void dFermidxArray(const T *Eta, T *result, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        result[i] = dFermidx(Eta[i]);
+    }
+}
+
 template double InvFermi<double>(double);
 template double dInvFermidx<double>(double);
 template double Fermi<double>(double);
 template double dFermidx<double>(double);
+template void InvFermiArray<double>(const double *, double *, size_t);
+template void dInvFermidxArray<double>(const double *, double *, size_t);
+template void FermiArray<double>(const double *, double *, size_t);
+template void dFermidxArray<double>(const double *, double *, size_t);
 #ifdef DEVSIM_EXTENDED_PRECISION
 template float128 InvFermi<float128>(float128);
 template float128 dInvFermidx<float128>(float128);
 template float128 Fermi<float128>(float128);
 template float128 dFermidx<float128>(float128);
+template void InvFermiArray<float128>(const float128 *, float128 *, size_t);
+template void dInvFermidxArray<float128>(const float128 *, float128 *, size_t);
+template void FermiArray<float128>(const float128 *, float128 *, size_t);
+template void dFermidxArray<float128>(const float128 *, float128 *, size_t);
 #endif
 
 #ifdef DEVSIM_UNIT_TEST
@@ -15,4 +15,15 @@ template <typename T>
 T Fermi(T /*n*/);
 template <typename T>
 T dFermidx(T /*n*/);
+
+#include <cstddef>
+/// Evaluate n values at once
+template <typename T>
+void InvFermiArray(const T * /*r*/, T * /*result*/, size_t /*n*/);
+template <typename T>
+void dInvFermidxArray(const T * /*r*/, T * /*result*/, size_t /*n*/);
+template <typename T>
+void FermiArray(const T * /*eta*/, T * /*result*/, size_t /*n*/);
+template <typename T>
+void dFermidxArray(const T * /*eta*/, T * /*result*/, size_t /*n*/);
 #endif
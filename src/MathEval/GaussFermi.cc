@@ -99,12 +99,39 @@ inline T calcK(const T &s, const T &S, const T &H)
   return K;
 }
 
+
+//// The two regions of the approximation, shared by the scalar and array versions
+template <typename T>
+inline T gfiLow(const T &zeta, const T &S, const T &K)
+{
+    return exp(0.5 * S + zeta) / (exp(K*(zeta+S)) + 1);
 }
 
 template <typename T>
-T gfi(T zeta, T s)
+inline T gfiHigh(const T &zeta, const T &s, const T &H)
 {
     const T &sqrt2 = MC<T>::sqrt2;
+    return 0.5 * erfc(-zeta / (s*sqrt2) * H);
+}
+
+template <typename T>
+inline T dgfidxLow(const T &zeta, const T &S, const T &K)
+{
+    const T den_inv = 1. / (exp(K * (S + zeta)) + 1.);
+    return exp(0.5 * S + zeta) * den_inv * (1. - K*exp(K * (S+zeta)) * den_inv);
+}
+
+template <typename T>
+inline T dgfidxHigh(const T &zeta, const T &s, const T &S, const T &H)
+{
+    const T &one_div_root_two_pi = MC<T>::one_div_root_two_pi;
+    return one_div_root_two_pi * H / s * exp(-0.5 * pow(H*zeta,2)/S);
+}
+}
+
+template <typename T>
+T gfi(T zeta, T s)
+{
     const T S = s * s;
 
     T H = calcH(s, S);
@@ -113,11 +140,11 @@ T gfi(T zeta, T s)
     if (zeta < -S)
     {
         const T K = calcK(s, S, H);
-        value = exp(0.5 * S + zeta) / (exp(K*(zeta+S)) + 1);
+        value = gfiLow(zeta, S, K);
     }
     else
     {
-        value = 0.5 * erfc(-zeta / (s*sqrt2) * H);
+        value = gfiHigh(zeta, s, H);
     }
 
     return value;
@@ -134,18 +161,69 @@ T dgfidx(T zeta, T s)
     if (zeta < -S)
     {
         const T K = calcK(s, S, H);
-        const T den_inv = 1. / (exp(K * (S + zeta)) + 1.);
-        dvalue = exp(0.5 * S + zeta) * den_inv * (1. - K*exp(K * (S+zeta)) * den_inv);
+        dvalue = dgfidxLow(zeta, S, K);
     }
     else
     {
-        const T &one_div_root_two_pi = MC<T>::one_div_root_two_pi;
-        dvalue = one_div_root_two_pi * H / s * exp(-0.5 * pow(H*zeta,2)/S);
+        dvalue = dgfidxHigh(zeta, s, S, H);
     }
 
     return dvalue;
 }
 
+//// s is usually the same for the whole region, so H and K are only calculated once
+template <typename T>
+void gfiArray(const T *zeta, T s, T *result, size_t n)
+{
+    const T S = s * s;
+    const T H = calcH(s, S);
+    T K = 0.0;
+    bool has_K = false;
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (zeta[i] < -S)
+        {
+            if (!has_K)
+            {
+                K = calcK(s, S, H);
+                has_K = true;
+            }
+            result[i] = gfiLow(zeta[i], S, K);
+        }
+        else
+        {
+            result[i] = gfiHigh(zeta[i], s, H);
+        }
+    }
+}
+
+template <typename T>
+void dgfidxArray(const T *zeta, T s, T *result, size_t n)
+{
+    const T S = s * s;
+    const T H = calcH(s, S);
+    T K = 0.0;
+    bool has_K = false;
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (zeta[i] < -S)
+        {
+            if (!has_K)
+            {
+                K = calcK(s, S, H);
+                has_K = true;
+            }
+            result[i] = dgfidxLow(zeta[i], S, K);
+        }
+        else
+        {
+            result[i] = dgfidxHigh(zeta[i], s, S, H);
+        }
+    }
+}
+
 //### inverse function for Gaussian Fermi Integral
 
 namespace {
@@ -240,12 +318,16 @@ template double gfi<double>(double, double);
 template double dgfidx<double>(double, double);
 template double igfi<double>(double, double);
 template double digfidx<double>(double, double);
+template void gfiArray<double>(const double *, double, double *, size_t);
+template void dgfidxArray<double>(const double *, double, double *, size_t);
 
 #ifdef DEVSIM_EXTENDED_PRECISION
 template float128 gfi<float128>(float128, float128);
 template float128 dgfidx<float128>(float128, float128);
 template float128 igfi<float128>(float128, float128);
 template float128 digfidx<float128>(float128, float128);
+template void gfiArray<float128>(const float128 *, float128, float128 *, size_t);
+template void dgfidxArray<float128>(const float128 *, float128, float128 *, size_t);
 #endif
 
 #ifdef DEVSIM_UNIT_TEST
@@ -17,4 +17,12 @@ T igfi(T g, T s);
 
 template <typename T>
 T digfidx(T g, T s);
+
+#include <cstddef>
+/// Evaluate n values of zeta at once for the same s
+template <typename T>
+void gfiArray(const T *zeta, T s, T *result, size_t n);
+
+template <typename T>
+void dgfidxArray(const T *zeta, T s, T *result, size_t n);
 #endif
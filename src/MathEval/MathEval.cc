@@ -26,15 +26,25 @@ SPDX-License-Identifier: Apache-2.0
 using std::abs;
 #include <sstream>
 #include <map>
+#include <algorithm>
 #include "BoostSpecialFunctions.hh"
 using my_policy::use_errno;
 
-template <> MathEval<double> *MathEval<double>::instance_ = nullptr;
+#include "SimulationContext.hh"
+#include <type_traits>
+
 #ifdef DEVSIM_EXTENDED_PRECISION
 #include "Float128.hh"
-template <> MathEval<float128> *MathEval<float128>::instance_ = nullptr;
 #endif
 
+namespace {
+template <typename DoubleType>
+constexpr SimulationContext::InstanceSlot GetMathEvalSlot()
+{
+  return std::is_same<DoubleType, double>::value ? SimulationContext::InstanceSlot::MATHEVAL_DOUBLE : SimulationContext::InstanceSlot::MATHEVAL_EXTENDED;
+}
+}
+
 namespace Eqomfp {
   template <typename T>
   struct TernaryTblEntry {
@@ -64,6 +74,19 @@ namespace Eqomfp {
       const char *desc;
   };
 
+  //// array versions replace the element by element evaluation of the function with the same name
+  template <typename T>
+  struct UnaryArrayTblEntry {
+      const char *name;
+      unaryarrayfuncptr<T> func;
+  };
+
+  template <typename T>
+  struct BinaryArrayTblEntry {
+      const char *name;
+      binaryarrayfuncptr<T> func;
+  };
+
 
 namespace eval64 {
 #if defined(__MINGW32__) || defined(__MINGW64__)
@@ -161,6 +184,22 @@ using ::derfc_invdx;
   {nullptr, nullptr, nullptr}
   };
 
+  UnaryArrayTblEntry<double> UnaryArrayTable_double[] = {
+  {"B",           BernoulliArray},
+  {"dBdx",        derBernoulliArray},
+  {"Fermi",       FermiArray},
+  {"dFermidx",    dFermidxArray},
+  {"InvFermi",    InvFermiArray},
+  {"dInvFermidx", dInvFermidxArray},
+  {nullptr, nullptr}
+  };
+
+  BinaryArrayTblEntry<double> BinaryArrayTable_double[] = {
+  {"gfi",    gfiArray},
+  {"dgfidx", dgfidxArray},
+  {nullptr, nullptr}
+  };
+
   TernaryTblEntry<double> TernaryTable_double[] = {
   {"ifelse",  ifelsefunc,  "ifelse(obj1, obj2, obj3) -- if (obj1) then (obj2) else (obj3)"},
   {"kahan3",  kahan3,  "kahan(obj1, obj2, obj3) -- kahan summation"},
@@ -307,6 +346,22 @@ using ::derfc_invdx;
   {">=",  logical_gte,  "obj1 >= obj2       -- logical greater than equal"},
     {nullptr, nullptr, nullptr}
   };
+  UnaryArrayTblEntry<float128> UnaryArrayTable_float128[] = {
+  {"B",           BernoulliArray},
+  {"dBdx",        derBernoulliArray},
+  {"Fermi",       FermiArray},
+  {"dFermidx",    dFermidxArray},
+  {"InvFermi",    InvFermiArray},
+  {"dInvFermidx", dInvFermidxArray},
+  {nullptr, nullptr}
+  };
+
+  BinaryArrayTblEntry<float128> BinaryArrayTable_float128[] = {
+  {"gfi",    gfiArray},
+  {"dgfidx", dgfidxArray},
+  {nullptr, nullptr}
+  };
+
   TernaryTblEntry<float128> TernaryTable_float128[] = {
   {"ifelse",  ifelsefunc,  "ifelse(obj1, obj2, obj3) -- if (obj1) then (obj2) else (obj3)"},
   {"kahan3",  kahan3,  "kahan(obj1, obj2, obj3) -- kahan summation"},
@@ -328,6 +383,10 @@ struct Tables{
   static Eqomfp::TernaryTblEntry<DoubleType> &GetTernaryTable(size_t);
   template <typename DoubleType>
   static Eqomfp::QuaternaryTblEntry<DoubleType> &GetQuaternaryTable(size_t);
+  template <typename DoubleType>
+  static Eqomfp::UnaryArrayTblEntry<DoubleType> &GetUnaryArrayTable(size_t);
+  template <typename DoubleType>
+  static Eqomfp::BinaryArrayTblEntry<DoubleType> &GetBinaryArrayTable(size_t);
 };
 
 template <>
@@ -350,6 +409,16 @@ Eqomfp::QuaternaryTblEntry<double> &Tables::GetQuaternaryTable(size_t i)
 {
   return QuaternaryTable_double[i];
 }
+template <>
+Eqomfp::UnaryArrayTblEntry<double> &Tables::GetUnaryArrayTable(size_t i)
+{
+  return UnaryArrayTable_double[i];
+}
+template <>
+Eqomfp::BinaryArrayTblEntry<double> &Tables::GetBinaryArrayTable(size_t i)
+{
+  return BinaryArrayTable_double[i];
+}
 
 #ifdef DEVSIM_EXTENDED_PRECISION
 template <>
@@ -372,6 +441,16 @@ Eqomfp::QuaternaryTblEntry<float128> &Tables::GetQuaternaryTable(size_t i)
 {
   return QuaternaryTable_float128[i];
 }
+template <>
+Eqomfp::UnaryArrayTblEntry<float128> &Tables::GetUnaryArrayTable(size_t i)
+{
+  return UnaryArrayTable_float128[i];
+}
+template <>
+Eqomfp::BinaryArrayTblEntry<float128> &Tables::GetBinaryArrayTable(size_t i)
+{
+  return BinaryArrayTable_float128[i];
+}
 #endif
 
 }
@@ -389,19 +468,21 @@ MathEval<DoubleType>::~MathEval()
 template <typename DoubleType>
 MathEval<DoubleType> &MathEval<DoubleType>::GetInstance()
 {
-  if (!instance_)
+  MathEval<DoubleType> *instance = static_cast<MathEval<DoubleType> *>(SimulationContext::GetInstance(GetMathEvalSlot<DoubleType>()));
+  if (!instance)
   {
-    instance_ = new MathEval();
-    instance_->InitializeBuiltInMathFunc();
+    instance = new MathEval();
+    instance->InitializeBuiltInMathFunc();
+    SimulationContext::SetInstance(GetMathEvalSlot<DoubleType>(), instance);
   }
-  return *instance_;
+  return *instance;
 }
 
 template <typename DoubleType>
 void MathEval<DoubleType>::DestroyInstance()
 {
-  delete instance_;
-  instance_ = nullptr;
+  delete static_cast<MathEval<DoubleType> *>(SimulationContext::GetInstance(GetMathEvalSlot<DoubleType>()));
+  SimulationContext::SetInstance(GetMathEvalSlot<DoubleType>(), nullptr);
 }
 
 template <typename DoubleType>
@@ -433,6 +514,93 @@ void MathEval<DoubleType>::InitializeBuiltInMathFunc()
   }
 
   FuncPtrMap_["pow"] = Eqomfp::MathWrapperPtr<DoubleType>(new Eqomfp::PowWrapper<DoubleType>("pow"));
+
+  //// vector arguments are passed directly to the array versions
+  for (size_t i = 0; Eqomfp::Tables::GetUnaryArrayTable<DoubleType>(i).name != nullptr; ++i)
+  {
+    const std::string &name   = Eqomfp::Tables::GetUnaryArrayTable<DoubleType>(i).name;
+    Eqomfp::unaryarrayfuncptr<DoubleType> afunc = Eqomfp::Tables::GetUnaryArrayTable<DoubleType>(i).func;
+    Eqomfp::unaryfuncptr<DoubleType> func = nullptr;
+    for (size_t j = 0; Eqomfp::Tables::GetUnaryTable<DoubleType>(j).name != nullptr; ++j)
+    {
+      if (name == Eqomfp::Tables::GetUnaryTable<DoubleType>(j).name)
+      {
+        func = Eqomfp::Tables::GetUnaryTable<DoubleType>(j).func;
+        break;
+      }
+    }
+    dsAssert(func != nullptr, "UNEXPECTED");
+    FuncPtrMap_[name]       = Eqomfp::MathWrapperPtr<DoubleType>(new Eqomfp::ArrayMathWrapper1<DoubleType>(name, func, afunc));
+  }
+  for (size_t i = 0; Eqomfp::Tables::GetBinaryArrayTable<DoubleType>(i).name != nullptr; ++i)
+  {
+    const std::string &name   = Eqomfp::Tables::GetBinaryArrayTable<DoubleType>(i).name;
+    Eqomfp::binaryarrayfuncptr<DoubleType> afunc = Eqomfp::Tables::GetBinaryArrayTable<DoubleType>(i).func;
+    Eqomfp::binaryfuncptr<DoubleType> func = nullptr;
+    for (size_t j = 0; Eqomfp::Tables::GetBinaryTable<DoubleType>(j).name != nullptr; ++j)
+    {
+      if (name == Eqomfp::Tables::GetBinaryTable<DoubleType>(j).name)
+      {
+        func = Eqomfp::Tables::GetBinaryTable<DoubleType>(j).func;
+        break;
+      }
+    }
+    dsAssert(func != nullptr, "UNEXPECTED");
+    FuncPtrMap_[name]       = Eqomfp::MathWrapperPtr<DoubleType>(new Eqomfp::ArrayMathWrapper2<DoubleType>(name, func, afunc));
+  }
+}
+
+template <typename DoubleType>
+const void *MathEval<DoubleType>::GetBuiltInFunctionPointer(const std::string &func, size_t nargs) const
+{
+  //// the vector reductions are not elementwise
+  if (tclMathFuncMap_.count(func) || (func.compare(0, 4, "vec_") == 0))
+  {
+    return nullptr;
+  }
+
+  if (nargs == 1)
+  {
+    for (size_t i = 0; Eqomfp::Tables::GetUnaryTable<DoubleType>(i).name != nullptr; ++i)
+    {
+      if (func == Eqomfp::Tables::GetUnaryTable<DoubleType>(i).name)
+      {
+        return reinterpret_cast<const void *>(Eqomfp::Tables::GetUnaryTable<DoubleType>(i).func);
+      }
+    }
+  }
+  else if (nargs == 2)
+  {
+    for (size_t i = 0; Eqomfp::Tables::GetBinaryTable<DoubleType>(i).name != nullptr; ++i)
+    {
+      if (func == Eqomfp::Tables::GetBinaryTable<DoubleType>(i).name)
+      {
+        return reinterpret_cast<const void *>(Eqomfp::Tables::GetBinaryTable<DoubleType>(i).func);
+      }
+    }
+  }
+  else if (nargs == 3)
+  {
+    for (size_t i = 0; Eqomfp::Tables::GetTernaryTable<DoubleType>(i).name != nullptr; ++i)
+    {
+      if (func == Eqomfp::Tables::GetTernaryTable<DoubleType>(i).name)
+      {
+        return reinterpret_cast<const void *>(Eqomfp::Tables::GetTernaryTable<DoubleType>(i).func);
+      }
+    }
+  }
+  else if (nargs == 4)
+  {
+    for (size_t i = 0; Eqomfp::Tables::GetQuaternaryTable<DoubleType>(i).name != nullptr; ++i)
+    {
+      if (func == Eqomfp::Tables::GetQuaternaryTable<DoubleType>(i).name)
+      {
+        return reinterpret_cast<const void *>(Eqomfp::Tables::GetQuaternaryTable<DoubleType>(i).func);
+      }
+    }
+  }
+
+  return nullptr;
 }
 
 template <typename DoubleType>
@@ -464,7 +632,7 @@ DoubleType MathEval<DoubleType>::EvaluateMathFunc(const std::string &func, std::
 template <typename DoubleType>
 void MathEval<DoubleType>::EvaluateTclMathFunc(const std::string &func, std::vector<DoubleType> &dvals, const std::vector<const std::vector<DoubleType> *> &vvals, std::string &error, std::vector<DoubleType> &result) const
 {
-  tclMathFuncMap_t::const_iterator it = tclMathFuncMap_.find(func);
+  typename tclMathFuncMap_t::const_iterator it = tclMathFuncMap_.find(func);
 
   if (it == tclMathFuncMap_.end())
   {
@@ -472,7 +640,7 @@ void MathEval<DoubleType>::EvaluateTclMathFunc(const std::string &func, std::vec
     return;
   }
 
-  const size_t tclcount = (it->second).second;
+  const size_t tclcount = (it->second).nargs;
 
   const size_t cnt = vvals.size();
 
@@ -486,7 +654,7 @@ void MathEval<DoubleType>::EvaluateTclMathFunc(const std::string &func, std::vec
   }
   else
   {
-    ObjectHolder procedure = (it->second).first;
+    ObjectHolder procedure = (it->second).procedure;
 
     Interpreter MyInterp;
     //// put the objects in here
@@ -509,6 +677,12 @@ void MathEval<DoubleType>::EvaluateTclMathFunc(const std::string &func, std::vec
       }
     }
 
+    if ((numelems != 0) && (it->second).vectorized)
+    {
+      EvaluateVectorizedTclMathFunc(procedure, vvals, tclObjVector, numelems, error, result);
+      return;
+    }
+
     //// This means we just want to get the one value for constant arguments
     if (numelems == 0)
     {
@@ -556,6 +730,48 @@ void MathEval<DoubleType>::EvaluateTclMathFunc(const std::string &func, std::vec
   }
 }
 
+template <typename DoubleType>
+void MathEval<DoubleType>::EvaluateVectorizedTclMathFunc(ObjectHolder &procedure, const std::vector<const std::vector<DoubleType> *> &vvals, std::vector<ObjectHolder> &tclObjVector, size_t numelems, std::string &error, std::vector<DoubleType> &result) const
+{
+  //// the constant arguments are already set
+  for (size_t i = 0; i < vvals.size(); ++i)
+  {
+    if (vvals[i])
+    {
+      tclObjVector[i] = CreateDoublePODArray(*vvals[i]);
+    }
+  }
+
+  Interpreter MyInterp;
+  bool ok = MyInterp.RunCommand(procedure, tclObjVector);
+  if (!ok)
+  {
+    error += MyInterp.GetErrorString();
+    return;
+  }
+
+  ObjectHolder out = MyInterp.GetResult();
+  std::vector<double> outvals;
+  ok = out.GetDoubleList(outvals);
+  if (!ok)
+  {
+    std::ostringstream os;
+    os << "Could not convert " << out.GetString() << " to a list of doubles\n";
+    error += os.str();
+  }
+  else if (outvals.size() != numelems)
+  {
+    std::ostringstream os;
+    os << "Expected " << numelems << " values and " << outvals.size() << " were returned\n";
+    error += os.str();
+  }
+  else
+  {
+    result.resize(numelems);
+    std::copy(outvals.begin(), outvals.end(), result.begin());
+  }
+}
+
 template <typename DoubleType>
 void MathEval<DoubleType>::EvaluateMathFunc(const std::string &func, std::vector<DoubleType> &dvals, const std::vector<const std::vector<DoubleType> *> &vvals, std::string &error, std::vector<DoubleType> &result, size_t vlen) const
 {
@@ -580,7 +796,7 @@ void MathEval<DoubleType>::EvaluateMathFunc(const std::string &func, std::vector
 }
 
 template <typename DoubleType>
-bool MathEval<DoubleType>::AddTclMath(const std::string &funcname, ObjectHolder procedure, size_t numargs, std::string &error)
+bool MathEval<DoubleType>::AddTclMath(const std::string &funcname, ObjectHolder procedure, size_t numargs, bool vectorized, std::string &error)
 {
   if (!procedure.IsCallable())
   {
@@ -590,7 +806,7 @@ bool MathEval<DoubleType>::AddTclMath(const std::string &funcname, ObjectHolder
   }
   else
   {
-    tclMathFuncMap_[funcname] = std::make_pair(procedure, numargs);
+    tclMathFuncMap_[funcname] = TclMathFunc{procedure, numargs, vectorized};
   }
   return error.empty();
 }
@@ -9,13 +9,12 @@ SPDX-License-Identifier: Apache-2.0
 #define MATH_EVAL_HH
 
 #include "MathWrapper.hh"
+#include "ObjectHolder.hh"
 
 #include <vector>
 #include <string>
 #include <map>
 
-class ObjectHolder;
-
 template <typename DoubleType>
 class MathEval {
 // first is function name
@@ -30,7 +29,11 @@ class MathEval {
     static MathEval &GetInstance();
     static void DestroyInstance();
 
-    bool AddTclMath(const std::string &, ObjectHolder, size_t, std::string & /*error_string*/);
+    bool AddTclMath(const std::string &, ObjectHolder, size_t, bool /*vectorized*/, std::string & /*error_string*/);
+
+    /// Scalar version of a built in function, for models compiled to native code
+    /// Returns nullptr if there is no built in function with this number of arguments, or it is replaced by a registered function
+    const void *GetBuiltInFunctionPointer(const std::string &, size_t /*nargs*/) const;
 
   private:
     MathEval();
@@ -38,13 +41,20 @@ class MathEval {
     MathEval &operator=(const MathEval &);
     MathEval(const MathEval &);
 
-    static MathEval *instance_;
     std::map<std::string, Eqomfp::MathWrapperPtr<DoubleType>> FuncPtrMap_;
 
-    typedef std::map<std::string, std::pair<ObjectHolder, size_t> > tclMathFuncMap_t;
+    struct TclMathFunc {
+      ObjectHolder procedure;
+      size_t       nargs;
+      //// called once with arrays for the vector arguments, instead of once per element
+      bool         vectorized;
+    };
+    typedef std::map<std::string, TclMathFunc> tclMathFuncMap_t;
     tclMathFuncMap_t                      tclMathFuncMap_;
 
     void InitializeBuiltInMathFunc();
+
+    void EvaluateVectorizedTclMathFunc(ObjectHolder &, const std::vector<const std::vector<DoubleType> *> &, std::vector<ObjectHolder> &, size_t, std::string &, std::vector<DoubleType> &) const;
 };
 #endif
 
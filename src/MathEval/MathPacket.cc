@@ -8,6 +8,7 @@ SPDX-License-Identifier: Apache-2.0
 #include "MathPacket.hh"
 #include "MathWrapper.hh"
 #include "GetNumberOfThreads.hh"
+#include "SimulationContext.hh"
 #include <future>
 #include <memory>
 
@@ -130,7 +131,7 @@ std::string MathPacketRun(const MathWrapper<DoubleType> &func, const std::vector
 
 template <typename DoubleType>
 MathPacketRange<DoubleType>::MathPacketRange(MathPacket<DoubleType> &mp, size_t b, size_t e)
-  : mathPacket_(mp), beg_(b), end_(e)
+  : mathPacket_(mp), beg_(b), end_(e), context_(SimulationContext::GetCurrent())
 {
 }
 
@@ -138,6 +139,7 @@ MathPacketRange<DoubleType>::MathPacketRange(MathPacket<DoubleType> &mp, size_t
 template <typename DoubleType>
 void MathPacketRange<DoubleType>::operator()()
 {
+  SimulationContext::ScopedContext scope(context_);
   mathPacket_(beg_, end_);
 }
 
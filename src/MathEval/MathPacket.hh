@@ -10,6 +10,8 @@ SPDX-License-Identifier: Apache-2.0
 
 #include "FPECheck.hh"
 
+class SimulationContext;
+
 #include <string>
 #include <vector>
 
@@ -62,6 +64,8 @@ class MathPacketRange
     MathPacket<DoubleType> &mathPacket_;
     size_t     beg_;
     size_t     end_;
+    //// the worker thread uses the context of the calling thread
+    SimulationContext &context_;
 };
 }
 #endif
@@ -191,6 +191,33 @@ DoubleType MathWrapper4<DoubleType>::DerivedEvaluate(const std::vector<DoubleTyp
   return funcptr_(vals[0], vals[1], vals[2], vals[3]);
 }
 
+template <typename DoubleType>
+void ArrayMathWrapper1<DoubleType>::DerivedEvaluate(const std::vector<DoubleType> &/*dvals*/, const std::vector<const std::vector<DoubleType> *> &vvals, std::vector<DoubleType> &result, const size_t vbeg, const size_t vend) const
+{
+  dsAssert(vvals[0] != nullptr, "UNEXPECTED");
+
+  if (vend > vbeg)
+  {
+    arrayfuncptr_(&((*vvals[0])[vbeg]), &result[vbeg], vend - vbeg);
+  }
+}
+
+template <typename DoubleType>
+void ArrayMathWrapper2<DoubleType>::DerivedEvaluate(const std::vector<DoubleType> &dvals, const std::vector<const std::vector<DoubleType> *> &vvals, std::vector<DoubleType> &result, const size_t vbeg, const size_t vend) const
+{
+  if (vvals[0] && !vvals[1])
+  {
+    if (vend > vbeg)
+    {
+      arrayfuncptr_(&((*vvals[0])[vbeg]), dvals[1], &result[vbeg], vend - vbeg);
+    }
+  }
+  else
+  {
+    MathWrapper2<DoubleType>::DerivedEvaluate(dvals, vvals, result, vbeg, vend);
+  }
+}
+
 namespace
 {
 template <typename DoubleType>
@@ -275,6 +302,8 @@ template class MathWrapper1<double>;
 template class MathWrapper2<double>;
 template class MathWrapper3<double>;
 template class MathWrapper4<double>;
+template class ArrayMathWrapper1<double>;
+template class ArrayMathWrapper2<double>;
 template class PowWrapper<double>;
 
 #ifdef DEVSIM_EXTENDED_PRECISION
@@ -283,6 +312,8 @@ template class MathWrapper1<float128>;
 template class MathWrapper2<float128>;
 template class MathWrapper3<float128>;
 template class MathWrapper4<float128>;
+template class ArrayMathWrapper1<float128>;
+template class ArrayMathWrapper2<float128>;
 template class PowWrapper<float128>;
 #endif
 
@@ -27,6 +27,13 @@ using ternaryfuncptr = DoubleType (*)(DoubleType, DoubleType, DoubleType);
 template <typename DoubleType>
 using quaternaryfuncptr = DoubleType (*)(DoubleType, DoubleType, DoubleType, DoubleType);
 
+//// array versions evaluate n values at once
+template <typename DoubleType>
+using unaryarrayfuncptr = void (*)(const DoubleType *, DoubleType *, size_t);
+//// the second argument is the same for every value
+template <typename DoubleType>
+using binaryarrayfuncptr = void (*)(const DoubleType *, DoubleType, DoubleType *, size_t);
+
 
 template <typename DoubleType>
 class MathWrapper {
@@ -121,6 +128,38 @@ class MathWrapper4 : public MathWrapper<DoubleType> {
     quaternaryfuncptr<DoubleType> funcptr_;
 };
 
+//// 1 with an array version for vector arguments
+template <typename DoubleType>
+class ArrayMathWrapper1 : public MathWrapper1<DoubleType> {
+  public:
+    ArrayMathWrapper1(const std::string &name, unaryfuncptr<DoubleType> fptr, unaryarrayfuncptr<DoubleType> aptr) : MathWrapper1<DoubleType>(name, fptr), arrayfuncptr_(aptr) {};
+    ~ArrayMathWrapper1() {}
+
+  protected:
+
+    void DerivedEvaluate(const std::vector<DoubleType> &/*dvals*/, const std::vector<const std::vector<DoubleType> *> &/*vvals*/, std::vector<DoubleType> &/*result*/, size_t /*vbeg*/, size_t /*vend*/) const;
+    using MathWrapper1<DoubleType>::DerivedEvaluate;
+
+  private:
+    unaryarrayfuncptr<DoubleType> arrayfuncptr_;
+};
+
+//// 2 with an array version when only the first argument is a vector
+template <typename DoubleType>
+class ArrayMathWrapper2 : public MathWrapper2<DoubleType> {
+  public:
+    ArrayMathWrapper2(const std::string &name, binaryfuncptr<DoubleType> fptr, binaryarrayfuncptr<DoubleType> aptr) : MathWrapper2<DoubleType>(name, fptr), arrayfuncptr_(aptr) {};
+    ~ArrayMathWrapper2() {}
+
+  protected:
+
+    void DerivedEvaluate(const std::vector<DoubleType> &/*dvals*/, const std::vector<const std::vector<DoubleType> *> &/*vvals*/, std::vector<DoubleType> &/*result*/, size_t /*vbeg*/, size_t /*vend*/) const;
+    using MathWrapper2<DoubleType>::DerivedEvaluate;
+
+  private:
+    binaryarrayfuncptr<DoubleType> arrayfuncptr_;
+};
+
 template <typename DoubleType>
 class PowWrapper : public MathWrapper<DoubleType> {
   public:
@@ -0,0 +1,127 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#ifndef VECTOR_MATH_HH
+#define VECTOR_MATH_HH
+
+#include <cstdint>
+#include <cstring>
+
+/// Builds AVX-512, AVX2, and baseline versions of a function, with the best one selected at load time
+/// Elsewhere the function is built for the target architecture of the compiler
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__linux__) && !defined(__ANDROID__)
+#define DEVSIM_VECTOR_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define DEVSIM_VECTOR_CLONES
+#endif
+
+/// Inline building blocks for the array versions of the math functions
+/// They have no data dependent branches, so that loops calling them can be vectorized
+namespace VectorMath {
+
+/// Range reduction for exp(y) and expm1(y), where y <= 0
+/// exp(y) = scale * (1 + p), and tiny is set when exp(y) is below the smallest normal number
+/// This does not raise floating point exceptions for any non-positive input
+inline void ExpNonPositiveParts(double y, double &scale, double &p, bool &tiny)
+{
+  /// 1.5 * 2^52, rounds to the nearest integer
+  static constexpr double shifter = 6755399441055744.0;
+  static constexpr double log2e   = 1.4426950408889634074;
+  /// ln(2) split so that k * ln2_hi is exact
+  static constexpr double ln2_hi  = 6.93147180369123816490e-01;
+  static constexpr double ln2_lo  = 1.90821492927058770002e-10;
+
+  tiny = y < -708.0;
+  const double ys = tiny ? 0.0 : y;
+
+  const double t  = ys * log2e + shifter;
+  const double kd = t - shifter;
+  const double r  = (ys - kd * ln2_hi) - kd * ln2_lo;
+
+  /// taylor series of expm1(r) for |r| <= ln(2)/2
+  double q = 1.0 / 6227020800.0;
+  q = q * r + 1.0 / 479001600.0;
+  q = q * r + 1.0 / 39916800.0;
+  q = q * r + 1.0 / 3628800.0;
+  q = q * r + 1.0 / 362880.0;
+  q = q * r + 1.0 / 40320.0;
+  q = q * r + 1.0 / 5040.0;
+  q = q * r + 1.0 / 720.0;
+  q = q * r + 1.0 / 120.0;
+  q = q * r + 1.0 / 24.0;
+  q = q * r + 1.0 / 6.0;
+  q = q * r + 0.5;
+  p = r + (r * r) * q;
+
+  /// 2^k from the low bits of the shifted value, where -1023 < k <= 0
+  uint64_t bits;
+  std::memcpy(&bits, &t, sizeof(double));
+  bits = (bits + 1023) << 52;
+  std::memcpy(&scale, &bits, sizeof(double));
+}
+
+/// exp(y) for y <= 0, flushed to 0 below the smallest normal number
+inline double ExpNonPositive(double y)
+{
+  double scale;
+  double p;
+  bool   tiny;
+  ExpNonPositiveParts(y, scale, p, tiny);
+  return tiny ? 0.0 : scale + scale * p;
+}
+
+/// expm1(y) for y <= 0
+inline double ExpM1NonPositive(double y)
+{
+  double scale;
+  double p;
+  bool   tiny;
+  ExpNonPositiveParts(y, scale, p, tiny);
+  return tiny ? -1.0 : scale * p + (scale - 1.0);
+}
+
+/// x / (exp(x) - 1)
+inline double Bernoulli(double x)
+{
+  const double a  = (x < 0.0) ? -x : x;
+  /// exp(-|x|) - 1, which never overflows
+  const double em = ExpM1NonPositive(-a);
+  const double e  = ExpNonPositive(-a);
+  const bool zero = (a == 0.0);
+  const double num = (x > 0.0) ? a * e : a;
+  const double den = zero ? 1.0 : -em;
+  return zero ? 1.0 : num / den;
+}
+
+/// (exp(x) - 1 - x * exp(x)) / (exp(x) - 1)^2
+inline double derBernoulli(double x)
+{
+  const double a  = (x < 0.0) ? -x : x;
+  const double em = ExpM1NonPositive(-a);
+  const double e  = ExpNonPositive(-a);
+
+  /// the closed form has cancellation near 0, where the taylor series is used
+  const bool small = a < 0.25;
+
+  const double num = (x > 0.0) ? e * (-em - a) : (em + a * e);
+  const double den = small ? 1.0 : em * em;
+  const double closed = num / den;
+
+  const double x2 = x * x;
+  double s = -691.0 / 108972864000.0;
+  s = s * x2 + 1.0 / 4790016.0;
+  s = s * x2 - 1.0 / 151200.0;
+  s = s * x2 + 1.0 / 5040.0;
+  s = s * x2 - 1.0 / 180.0;
+  s = s * x2 + 1.0 / 6.0;
+  const double series = -0.5 + x * s;
+
+  return small ? series : closed;
+}
+}
+#endif
+
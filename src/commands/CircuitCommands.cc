@@ -226,6 +226,7 @@ circuitElementCmd(CommandHandler &data)
         im = new IdealCapacitor(&nk, name.c_str(), n1.c_str(), n2.c_str());
         im->addParam(std::string("C"), value);
         ik.addInstanceModel(im);
+        ik.addLinearElement(name, LinearElementBatch::ElementType::CAPACITOR, nk.AddNode(n1), nk.AddNode(n2), value);
         data.SetEmptyResult();
     }
     else if (type == 'L' || type == 'l')
@@ -240,6 +241,7 @@ circuitElementCmd(CommandHandler &data)
         im = new IdealResistor(&nk, name.c_str(), n1.c_str(), n2.c_str());
         im->addParam(std::string("R"), value);
         ik.addInstanceModel(im);
+        ik.addLinearElement(name, LinearElementBatch::ElementType::RESISTOR, nk.AddNode(n1), nk.AddNode(n2), value);
         data.SetEmptyResult();
     }
     else
@@ -340,6 +342,7 @@ circuitAlterCmd(CommandHandler &data)
 
     if (ok)
     {
+      ik.alterLinearElement(name, param, value);
       data.SetEmptyResult();
     }
     else
@@ -356,6 +359,91 @@ circuitAlterCmd(CommandHandler &data)
     }
 }
 
+void
+circuitPulseCmd(CommandHandler &data)
+{
+    std::string errorString;
+
+    static dsGetArgs::Option option[] =
+    {
+        {"name",  "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
+        {"v1",    "0.0", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::REQUIRED, nullptr},
+        {"v2",    "0.0", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::REQUIRED, nullptr},
+        {"td",    "0.0", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+        {"tr",    "0.0", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+        {"tf",    "0.0", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+        {"pw",    "0.0", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+        {"per",   "0.0", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+        {nullptr,  nullptr, dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL, nullptr}
+    };
+
+    bool error = data.processOptions(option, errorString);
+
+    if (error)
+    {
+      data.SetErrorResult(errorString);
+      return;
+    }
+
+    const std::string &name = data.GetStringOption("name");
+    const double v1  = data.GetDoubleOption("v1");
+    const double v2  = data.GetDoubleOption("v2");
+    const double td  = data.GetDoubleOption("td");
+    const double tr  = data.GetDoubleOption("tr");
+    const double tf  = data.GetDoubleOption("tf");
+    const double pw  = data.GetDoubleOption("pw");
+    const double per = data.GetDoubleOption("per");
+
+    if ((td < 0.0) || (tr < 0.0) || (tf < 0.0) || (pw < 0.0) || (per < 0.0))
+    {
+        errorString += "-td, -tr, -tf, -pw, and -per cannot be negative\n";
+    }
+    else if ((per > 0.0) && ((tr + pw + tf) > per))
+    {
+        std::ostringstream os;
+        os << "-per " << per << " must be at least the sum of -tr, -pw, and -tf\n";
+        errorString += os.str();
+    }
+
+    InstanceKeeper &ik = InstanceKeeper::instance();
+    InstanceModelPtr im = ik.getInstanceModel(name);
+
+    if (!im)
+    {
+        std::ostringstream os;
+        os << "Cannot find circuit element -name  \"" << name <<
+              "\"\n";
+        errorString += os.str();
+    }
+
+    if (!errorString.empty())
+    {
+        data.SetErrorResult(errorString);
+        return;
+    }
+
+    SignalPtr x(new Pulse(v1, v2, td, tr, tf, pw, per));
+
+    if (auto vp = std::dynamic_pointer_cast<IdealVoltage>(im))
+    {
+        vp->setSignal(x);
+        data.SetEmptyResult();
+    }
+    else if (auto ip = std::dynamic_pointer_cast<IdealCurrent>(im))
+    {
+        ip->setSignal(x);
+        data.SetEmptyResult();
+    }
+    else
+    {
+        std::ostringstream os;
+        os << "Circuit element -name  \"" << name <<
+              "\" is not a voltage or current source\n";
+        errorString += os.str();
+        data.SetErrorResult(errorString);
+    }
+}
+
 void
 circuitNodeAliasCmd(CommandHandler &data)
 {
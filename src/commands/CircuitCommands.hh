@@ -20,6 +20,7 @@ void circuitGetCircuitNodeListCmd(CommandHandler &);
 void circuitGetCircuitNodeValueCmd(CommandHandler &);
 void circuitGetCircuitSolutionListCmd(CommandHandler &);
 void circuitNodeAliasCmd(CommandHandler &);
+void circuitPulseCmd(CommandHandler &);
 }
 #endif
 
@@ -23,6 +23,8 @@ SPDX-License-Identifier: Apache-2.0
 #include "Edge.hh"
 #include "Node.hh"
 #include "OutputStream.hh"
+#include "SimulationContext.hh"
+#include "ObjectHolder.hh"
 
 #include <sstream>
 
@@ -30,6 +32,7 @@ using namespace dsValidate;
 
 void devsim_initialization();
 void ResetAllData();
+void ResetContextData();
 namespace dsCommand {
 
 void resetDevsimCmd (CommandHandler &data)
@@ -51,13 +54,153 @@ void resetDevsimCmd (CommandHandler &data)
         return;
     }
 
-    OutputStream::WriteOut(OutputStream::OutputType::INFO, "Resetting DEVSIM\n");
-    ResetAllData();
-    devsim_initialization();
+    SimulationContext &context = SimulationContext::GetCurrent();
+    if (&context == &SimulationContext::GetGlobal())
+    {
+      OutputStream::WriteOut(OutputStream::OutputType::INFO, "Resetting DEVSIM\n");
+      ResetAllData();
+      devsim_initialization();
+    }
+    else
+    {
+      //// The symbolic engine is shared with the other contexts, so only the context data is reset
+      std::ostringstream os;
+      os << "Resetting simulation context \"" << context.GetName() << "\"\n";
+      OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
+      ResetContextData();
+    }
     data.SetEmptyResult();
     return;
 }
 
+namespace {
+//// A new context starts with the global parameters of the global context
+void CopyGlobalParameters(SimulationContext &context)
+{
+    std::vector<std::pair<std::string, ObjectHolder>> entries;
+    {
+      SimulationContext::ScopedContext scope(SimulationContext::GetGlobal());
+      const GlobalData &gdata = GlobalData::GetInstance();
+      for (auto &name : gdata.GetDBEntryListOnGlobal())
+      {
+        entries.push_back(std::make_pair(name, gdata.GetDBEntryOnGlobal(name).second));
+      }
+    }
+
+    SimulationContext::ScopedContext scope(context);
+    GlobalData &gdata = GlobalData::GetInstance();
+    for (auto &entry : entries)
+    {
+      gdata.AddDBEntryOnGlobal(entry.first, entry.second);
+    }
+}
+}
+
+/// Create, delete, and select the simulation context used by the calling thread
+void simulationContextCmd(CommandHandler &data)
+{
+    std::string errorString;
+
+    const std::string commandName = data.GetCommandName();
+
+    dsGetArgs::Option *option;
+    if ((commandName == "get_simulation_context") || (commandName == "get_simulation_context_list"))
+    {
+      static dsGetArgs::Option getoption[] =
+      {
+        {nullptr,  nullptr, dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL, nullptr}
+      };
+      option = getoption;
+    }
+    else if (commandName == "set_simulation_context")
+    {
+      static dsGetArgs::Option setoption[] =
+      {
+        {"name", "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL, nullptr},
+        {nullptr,  nullptr, dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL, nullptr}
+      };
+      option = setoption;
+    }
+    else
+    {
+      static dsGetArgs::Option nameoption[] =
+      {
+        {"name", "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, nullptr},
+        {nullptr,  nullptr, dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL, nullptr}
+      };
+      option = nameoption;
+    }
+
+    bool error = data.processOptions(option, errorString);
+
+    if (error)
+    {
+        data.SetErrorResult(errorString);
+        return;
+    }
+
+    if (commandName == "get_simulation_context")
+    {
+      data.SetStringResult(SimulationContext::GetCurrent().GetName());
+      return;
+    }
+    else if (commandName == "get_simulation_context_list")
+    {
+      data.SetStringListResult(SimulationContext::GetContextNames());
+      return;
+    }
+
+    const std::string &name = data.GetStringOption("name");
+
+    if (commandName == "create_simulation_context")
+    {
+      SimulationContext *context = SimulationContext::CreateContext(name, errorString);
+      if (!context)
+      {
+        data.SetErrorResult(errorString);
+        return;
+      }
+      CopyGlobalParameters(*context);
+    }
+    else if (commandName == "set_simulation_context")
+    {
+      if (!SimulationContext::SelectContext(name, errorString))
+      {
+        data.SetErrorResult(errorString);
+        return;
+      }
+    }
+    else if (commandName == "delete_simulation_context")
+    {
+      SimulationContext *context = SimulationContext::FindContext(name);
+      if (context && (context != &SimulationContext::GetGlobal()))
+      {
+        if (context->IsInUse())
+        {
+          std::ostringstream os;
+          os << "Simulation context \"" << name << "\" is in use by a thread\n";
+          data.SetErrorResult(os.str());
+          return;
+        }
+
+        SimulationContext::ScopedContext scope(*context);
+        ResetContextData();
+      }
+
+      if (!SimulationContext::RemoveContext(name, errorString))
+      {
+        data.SetErrorResult(errorString);
+        return;
+      }
+    }
+    else
+    {
+      dsAssert(false, "UNEXPECTED");
+    }
+
+    data.SetEmptyResult();
+}
+
 /// Get the list of all the devices currently loaded
 /// There is only an error if there are no devices
 void getDeviceListCmd(CommandHandler &data)
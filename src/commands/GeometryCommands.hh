@@ -12,6 +12,7 @@ namespace dsCommand {
 struct Commands;
 extern Commands GeometryCommands[];
 void resetDevsimCmd(CommandHandler &);
+void simulationContextCmd(CommandHandler &);
 void getDeviceListCmd(CommandHandler &);
 void getRegionListCmd(CommandHandler &);
 void getElementNodeListCmd(CommandHandler &);
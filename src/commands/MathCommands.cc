@@ -47,9 +47,16 @@ solveCmdImpl(CommandHandler &data)
   const DoubleType gamma  = data.GetDoubleOption("gamma");
 
   const bool convergence_info = data.GetBooleanOption("info");
+  const bool timing_info = data.GetBooleanOption("timing");
   ObjectHolderMap_t ohm;
   ObjectHolderMap_t *p_ohm = nullptr;
 
+  //// the times differ between runs, so they are not part of the default info
+  if (timing_info && !convergence_info)
+  {
+    errorString += "\"timing\" option requires \"info\"\n";
+  }
+
   if (convergence_info)
   {
     if (type == "ac" || type == "noise")
@@ -122,6 +129,7 @@ solveCmdImpl(CommandHandler &data)
   solver.SetMaxDiv(maximum_divergence);
   solver.SetMaxAbsError(maximum_error);
   solver.SetSymbolicIterationLimit(static_cast<size_t>(symbolic_iteration_limit));
+  solver.SetReportTiming(timing_info);
 
   std::unique_ptr<dsMath::LinearSolver<DoubleType>> linearSolver;
 
@@ -235,6 +243,7 @@ solveCmd(CommandHandler &data)
     {"gamma",        "1.0", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL},
     // empty string converts to bool for python
     {"info", "", dsGetArgs::optionType::BOOLEAN, dsGetArgs::requiredType::OPTIONAL},
+    {"timing", "", dsGetArgs::optionType::BOOLEAN, dsGetArgs::requiredType::OPTIONAL},
     {nullptr,  nullptr, dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL}
   };
 //      {"callback",      "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL},
@@ -268,6 +277,361 @@ solveCmd(CommandHandler &data)
   }
 }
 
+template <typename DoubleType>
+void
+solveContinuationCmdImpl(CommandHandler &data)
+{
+  std::string errorString;
+
+  const std::string &solver_type = data.GetStringOption("solver_type");
+  const bool convergence_info = data.GetBooleanOption("info");
+
+  dsMath::ContinuationParams<DoubleType> params;
+  params.device    = data.GetStringOption("device");
+  params.parameter = data.GetStringOption("parameter");
+  params.end_value = data.GetDoubleOption("end_value");
+  params.step_size = data.GetDoubleOption("step_size");
+  params.max_step  = data.GetDoubleOption("maximum_step");
+
+  const int target_iterations = data.GetIntegerOption("target_iterations");
+  const int maximum_failures  = data.GetIntegerOption("maximum_failures");
+
+  ObjectHolder callback = data.GetObjectHolder("callback");
+  if (callback.IsCallable())
+  {
+    params.callback = &callback;
+  }
+  else if (!callback.GetString().empty())
+  {
+    errorString += "\"callback\" must be callable\n";
+  }
+
+  if (params.step_size <= 0.0)
+  {
+    errorString += "\"step_size\" must be greater than 0\n";
+  }
+
+  //// otherwise the solver uses a fraction of the sweep
+  if (data.IsSpecified("minimum_step"))
+  {
+    params.min_step = data.GetDoubleOption("minimum_step");
+    if (params.min_step <= 0.0)
+    {
+      errorString += "\"minimum_step\" must be greater than 0\n";
+    }
+  }
+
+  if (target_iterations <= 0)
+  {
+    errorString += "\"target_iterations\" must be greater than 0\n";
+  }
+  params.target_iterations = static_cast<size_t>(target_iterations);
+
+  if (maximum_failures <= 0)
+  {
+    errorString += "\"maximum_failures\" must be greater than 0\n";
+  }
+  params.max_failures = static_cast<size_t>(maximum_failures);
+
+  if (!errorString.empty())
+  {
+    data.SetErrorResult(errorString);
+    return;
+  }
+
+  dsMath::Newton<DoubleType> solver;
+  solver.SetAbsError(data.GetDoubleOption("absolute_error"));
+  solver.SetRelError(data.GetDoubleOption("relative_error"));
+  solver.SetMaxIter(data.GetIntegerOption("maximum_iterations"));
+  solver.SetMaxDiv(data.GetIntegerOption("maximum_divergence"));
+  solver.SetMaxAbsError(data.GetDoubleOption("maximum_error"));
+  solver.SetSymbolicIterationLimit(static_cast<size_t>(data.GetIntegerOption("symbolic_iteration_limit")));
+
+  std::unique_ptr<dsMath::LinearSolver<DoubleType>> linearSolver;
+
+  if (solver_type == "direct")
+  {
+    linearSolver = std::unique_ptr<dsMath::LinearSolver<DoubleType>>(new dsMath::DirectLinearSolver<DoubleType>);
+  }
+  else if (solver_type == "iterative")
+  {
+#if defined(USE_ITERATIVE_SOLVER)
+    linearSolver = std::unique_ptr<dsMath::LinearSolver<DoubleType>>(new dsMath::IterativeLinearSolver<DoubleType>);
+#else
+    errorString = "\"iterative\" is not a supported simulation type in this build\n";
+    data.SetErrorResult(errorString);
+    return;
+#endif
+  }
+  else
+  {
+    errorString = "\"direct\" and \"iterative\" are the only valid simulation types\n";
+    data.SetErrorResult(errorString);
+    return;
+  }
+
+  ObjectHolderMap_t ohm;
+  bool res = solver.ContinuationSolve(*linearSolver, params, (convergence_info) ? &ohm : nullptr);
+
+  if (convergence_info)
+  {
+    data.SetObjectResult(ObjectHolder(ohm));
+  }
+  else if (!res)
+  {
+    data.SetErrorResult("Convergence failure!\n");
+  }
+  else
+  {
+    data.SetEmptyResult();
+  }
+}
+
+void
+solveContinuationCmd(CommandHandler &data)
+{
+  std::string errorString;
+
+  static dsGetArgs::Option option[] =
+  {
+    {"device",             "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, mustBeValidDevice},
+    {"parameter",          "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
+    {"end_value",          "", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::REQUIRED},
+    {"step_size",          "", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::REQUIRED},
+    {"minimum_step",       "", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL},
+    {"maximum_step",       "0", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL},
+    {"target_iterations",  "4", dsGetArgs::optionType::INTEGER, dsGetArgs::requiredType::OPTIONAL},
+    {"maximum_failures",   "10", dsGetArgs::optionType::INTEGER, dsGetArgs::requiredType::OPTIONAL},
+    {"callback",           "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL},
+    {"absolute_error",     "0", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL},
+    {"relative_error",     "0", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL},
+    {"maximum_error",      "MAXDOUBLE", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL},
+    {"maximum_iterations", "20", dsGetArgs::optionType::INTEGER, dsGetArgs::requiredType::OPTIONAL},
+    {"maximum_divergence", "20", dsGetArgs::optionType::INTEGER, dsGetArgs::requiredType::OPTIONAL},
+    {"symbolic_iteration_limit", "1", dsGetArgs::optionType::INTEGER, dsGetArgs::requiredType::OPTIONAL},
+    {"solver_type",        "direct", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL},
+    {"info", "", dsGetArgs::optionType::BOOLEAN, dsGetArgs::requiredType::OPTIONAL},
+    {nullptr,  nullptr, dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL}
+  };
+
+  bool error = data.processOptions(option, errorString);
+
+  if (error)
+  {
+      data.SetErrorResult(errorString);
+      return;
+  }
+
+  bool extended_solver = false;
+  GlobalData &gdata = GlobalData::GetInstance();
+  auto dbent = gdata.GetDBEntryOnGlobal("extended_solver");
+  if (dbent.first)
+  {
+    auto oh = dbent.second.GetBoolean();
+    extended_solver = (oh.first && oh.second);
+  }
+
+  if (extended_solver)
+  {
+    solveContinuationCmdImpl<extended_type>(data);
+  }
+  else
+  {
+    solveContinuationCmdImpl<double>(data);
+  }
+}
+
+template <typename DoubleType>
+void
+solveTransientCmdImpl(CommandHandler &data)
+{
+  std::string errorString;
+
+  const std::string &solver_type = data.GetStringOption("solver_type");
+  const std::string &method = data.GetStringOption("method");
+  const bool convergence_info = data.GetBooleanOption("info");
+
+  dsMath::TransientParams<DoubleType> params;
+  params.start_time = data.GetDoubleOption("start_time");
+  params.stop_time  = data.GetDoubleOption("stop_time");
+  params.step_size  = data.GetDoubleOption("tdelta");
+  params.max_step   = data.GetDoubleOption("maximum_step");
+  params.gamma      = data.GetDoubleOption("gamma");
+
+  const int target_iterations = data.GetIntegerOption("target_iterations");
+  const int maximum_failures  = data.GetIntegerOption("maximum_failures");
+
+  if (method == "bdf1")
+  {
+    params.method = dsMath::TransientParams<DoubleType>::Method::BDF1;
+  }
+  else if (method == "trbdf2")
+  {
+    params.method = dsMath::TransientParams<DoubleType>::Method::TRBDF2;
+  }
+  else
+  {
+    errorString += "\"bdf1\" and \"trbdf2\" are the only valid methods\n";
+  }
+
+  ObjectHolder callback = data.GetObjectHolder("callback");
+  if (callback.IsCallable())
+  {
+    params.callback = &callback;
+  }
+  else if (!callback.GetString().empty())
+  {
+    errorString += "\"callback\" must be callable\n";
+  }
+
+  if (params.step_size <= 0.0)
+  {
+    errorString += "\"tdelta\" must be greater than 0\n";
+  }
+
+  if (params.stop_time <= params.start_time)
+  {
+    errorString += "\"stop_time\" must be greater than \"start_time\"\n";
+  }
+
+  //// otherwise the solver uses a fraction of the simulated time
+  if (data.IsSpecified("minimum_step"))
+  {
+    params.min_step = data.GetDoubleOption("minimum_step");
+    if (params.min_step <= 0.0)
+    {
+      errorString += "\"minimum_step\" must be greater than 0\n";
+    }
+  }
+
+  if ((params.gamma <= 0.0) || (params.gamma >= 1.0))
+  {
+    errorString += "\"gamma\" must be between 0 and 1\n";
+  }
+
+  if (target_iterations <= 0)
+  {
+    errorString += "\"target_iterations\" must be greater than 0\n";
+  }
+  params.target_iterations = static_cast<size_t>(target_iterations);
+
+  if (maximum_failures <= 0)
+  {
+    errorString += "\"maximum_failures\" must be greater than 0\n";
+  }
+  params.max_failures = static_cast<size_t>(maximum_failures);
+
+  if (!errorString.empty())
+  {
+    data.SetErrorResult(errorString);
+    return;
+  }
+
+  dsMath::Newton<DoubleType> solver;
+  solver.SetAbsError(data.GetDoubleOption("absolute_error"));
+  solver.SetRelError(data.GetDoubleOption("relative_error"));
+  solver.SetQRelError(data.GetDoubleOption("charge_error"));
+  solver.SetMaxIter(data.GetIntegerOption("maximum_iterations"));
+  solver.SetMaxDiv(data.GetIntegerOption("maximum_divergence"));
+  solver.SetMaxAbsError(data.GetDoubleOption("maximum_error"));
+  solver.SetSymbolicIterationLimit(static_cast<size_t>(data.GetIntegerOption("symbolic_iteration_limit")));
+
+  std::unique_ptr<dsMath::LinearSolver<DoubleType>> linearSolver;
+
+  if (solver_type == "direct")
+  {
+    linearSolver = std::unique_ptr<dsMath::LinearSolver<DoubleType>>(new dsMath::DirectLinearSolver<DoubleType>);
+  }
+  else if (solver_type == "iterative")
+  {
+#if defined(USE_ITERATIVE_SOLVER)
+    linearSolver = std::unique_ptr<dsMath::LinearSolver<DoubleType>>(new dsMath::IterativeLinearSolver<DoubleType>);
+#else
+    errorString = "\"iterative\" is not a supported simulation type in this build\n";
+    data.SetErrorResult(errorString);
+    return;
+#endif
+  }
+  else
+  {
+    errorString = "\"direct\" and \"iterative\" are the only valid simulation types\n";
+    data.SetErrorResult(errorString);
+    return;
+  }
+
+  ObjectHolderMap_t ohm;
+  bool res = solver.TransientSolve(*linearSolver, params, (convergence_info) ? &ohm : nullptr);
+
+  if (convergence_info)
+  {
+    data.SetObjectResult(ObjectHolder(ohm));
+  }
+  else if (!res)
+  {
+    data.SetErrorResult("Convergence failure!\n");
+  }
+  else
+  {
+    data.SetEmptyResult();
+  }
+}
+
+void
+solveTransientCmd(CommandHandler &data)
+{
+  std::string errorString;
+
+  static dsGetArgs::Option option[] =
+  {
+    {"stop_time",          "", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::REQUIRED},
+    {"tdelta",             "", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::REQUIRED},
+    {"start_time",         "0", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL},
+    {"method",             "trbdf2", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL},
+    {"gamma",              "0.5857864376269049", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL},
+    {"minimum_step",       "", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL},
+    {"maximum_step",       "0", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL},
+    {"target_iterations",  "4", dsGetArgs::optionType::INTEGER, dsGetArgs::requiredType::OPTIONAL},
+    {"maximum_failures",   "10", dsGetArgs::optionType::INTEGER, dsGetArgs::requiredType::OPTIONAL},
+    {"callback",           "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL},
+    {"absolute_error",     "0", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL},
+    {"relative_error",     "0", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL},
+    {"charge_error",       "0", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL},
+    {"maximum_error",      "MAXDOUBLE", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL},
+    {"maximum_iterations", "20", dsGetArgs::optionType::INTEGER, dsGetArgs::requiredType::OPTIONAL},
+    {"maximum_divergence", "20", dsGetArgs::optionType::INTEGER, dsGetArgs::requiredType::OPTIONAL},
+    {"symbolic_iteration_limit", "1", dsGetArgs::optionType::INTEGER, dsGetArgs::requiredType::OPTIONAL},
+    {"solver_type",        "direct", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL},
+    {"info", "", dsGetArgs::optionType::BOOLEAN, dsGetArgs::requiredType::OPTIONAL},
+    {nullptr,  nullptr, dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL}
+  };
+
+  bool error = data.processOptions(option, errorString);
+
+  if (error)
+  {
+      data.SetErrorResult(errorString);
+      return;
+  }
+
+  bool extended_solver = false;
+  GlobalData &gdata = GlobalData::GetInstance();
+  auto dbent = gdata.GetDBEntryOnGlobal("extended_solver");
+  if (dbent.first)
+  {
+    auto oh = dbent.second.GetBoolean();
+    extended_solver = (oh.first && oh.second);
+  }
+
+  if (extended_solver)
+  {
+    solveTransientCmdImpl<extended_type>(data);
+  }
+  else
+  {
+    solveTransientCmdImpl<double>(data);
+  }
+}
+
 template <typename DoubleType>
 void
 getMatrixAndRHSCmdImpl(CommandHandler &data)
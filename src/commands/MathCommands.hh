@@ -14,6 +14,8 @@ extern Commands MathCommands[];
 void getContactCurrentCmd(CommandHandler &);
 void getContactCurrentCmd(CommandHandler &);
 void solveCmd(CommandHandler &);
+void solveContinuationCmd(CommandHandler &);
+void solveTransientCmd(CommandHandler &);
 void getMatrixAndRHSCmd(CommandHandler &);
 void setInitialConditionCmd(CommandHandler &);
 }
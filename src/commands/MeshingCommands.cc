@@ -14,6 +14,7 @@ SPDX-License-Identifier: Apache-2.0
 #include "MeshKeeper.hh"
 #include "Mesh1d.hh"
 #include "Mesh2d.hh"
+#include "Mesh3d.hh"
 #include "DevsimReader.hh"
 #include "DevsimWriter.hh"
 #include "DevsimRestartWriter.hh"
@@ -22,6 +23,9 @@ SPDX-License-Identifier: Apache-2.0
 #include "dsAssert.hh"
 #include "GmshReader.hh"
 #include "GmshLoader.hh"
+#include "DevsimLoader.hh"
+#include "MeshRefinement.hh"
+#include "OutputStream.hh"
 
 #include "Device.hh"
 #include "Region.hh"
@@ -69,6 +73,10 @@ create1dMeshCmd(CommandHandler &data)
     {
         mp = new dsMesh::Mesh2d(meshName);
     }
+    else if (commandName == "create_3d_mesh")
+    {
+        mp = new dsMesh::Mesh3d(meshName);
+    }
     else
     {
         dsAssert(0, "UNEXPECTED");
@@ -236,6 +244,46 @@ add1dMeshLineCmd(CommandHandler &data)
     }
 }
 
+namespace {
+/// The add_2d and add_3d commands are for the structured mesh of the same dimension
+size_t GetStructuredDimension(const std::string &commandName)
+{
+    return (commandName.compare(0, 7, "add_3d_") == 0) ? 3 : 2;
+}
+
+/// Sets the error result when the mesh does not have this dimension
+dsMesh::StructuredMesh *GetStructuredMesh(CommandHandler &data, const std::string &meshName, size_t dimension)
+{
+    dsMesh::MeshKeeper &mdata = dsMesh::MeshKeeper::GetInstance();
+    dsMesh::MeshPtr mp = mdata.GetMesh(meshName);
+    dsMesh::StructuredMesh *smp = dynamic_cast<dsMesh::StructuredMesh *>(mp);
+    if (!smp || (smp->GetDimension() != dimension))
+    {
+        std::ostringstream os;
+        os << meshName << " is not a " << dimension << "D mesh\n";
+        data.SetErrorResult(os.str());
+        smp = nullptr;
+    }
+    return smp;
+}
+
+dsMesh::BoundingBox GetBoundingBox(CommandHandler &data, size_t dimension)
+{
+    const double xl = data.GetDoubleOption("xl");
+    const double xh = data.GetDoubleOption("xh");
+    const double yl = data.GetDoubleOption("yl");
+    const double yh = data.GetDoubleOption("yh");
+    const double bl = data.GetDoubleOption("bloat");
+    if (dimension == 3)
+    {
+        const double zl = data.GetDoubleOption("zl");
+        const double zh = data.GetDoubleOption("zh");
+        return dsMesh::BoundingBox(xl, xh, yl, yh, zl, zh, bl);
+    }
+    return dsMesh::BoundingBox(xl, xh, yl, yh, bl);
+}
+}
+
 void
 add2dMeshLineCmd(CommandHandler &data)
 {
@@ -273,14 +321,10 @@ add2dMeshLineCmd(CommandHandler &data)
         ns = ps;
     }
 
-    dsMesh::MeshKeeper &mdata = dsMesh::MeshKeeper::GetInstance();
-    dsMesh::MeshPtr mp = mdata.GetMesh(meshName);
-    dsMesh::Mesh2dPtr m2dp = dynamic_cast<dsMesh::Mesh2dPtr>(mp);
-    if (!m2dp)
+    const size_t dimension = GetStructuredDimension(commandName);
+    dsMesh::StructuredMesh *smp = GetStructuredMesh(data, meshName, dimension);
+    if (!smp)
     {
-      std::ostringstream os;
-      os << meshName << " is not a 2D mesh\n";
-      data.SetErrorResult(os.str());
       return;
     }
     else
@@ -288,13 +332,19 @@ add2dMeshLineCmd(CommandHandler &data)
         if (dirName == "x")
         {
             dsMesh::MeshLine2dPtr mlp(new dsMesh::MeshLine2d(pos, ps, ns));
-            m2dp->AddLine(dsMesh::LineDirection::XDIR, mlp);
+            smp->AddLine(dsMesh::LineDirection::XDIR, mlp);
             data.SetEmptyResult();
         }
         else if (dirName == "y")
         {
             dsMesh::MeshLine2dPtr mlp(new dsMesh::MeshLine2d(pos, ps, ns));
-            m2dp->AddLine(dsMesh::LineDirection::YDIR, mlp);
+            smp->AddLine(dsMesh::LineDirection::YDIR, mlp);
+            data.SetEmptyResult();
+        }
+        else if ((dirName == "z") && (dimension == 3))
+        {
+            dsMesh::MeshLine2dPtr mlp(new dsMesh::MeshLine2d(pos, ps, ns));
+            smp->AddLine(dsMesh::LineDirection::ZDIR, mlp);
             data.SetEmptyResult();
         }
         else
@@ -409,18 +459,43 @@ add2dInterfaceCmd(CommandHandler &data)
 
     using namespace dsGetArgs;
 
-    static dsGetArgs::Option option[] = {
-        {"mesh",   "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, meshMustNotBeFinalized},
-        {"name",   "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
-        {"region0",    "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
-        {"region1",    "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
-        {"xl", "-MAXDOUBLE", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
-        {"xh", "MAXDOUBLE",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
-        {"yl", "-MAXDOUBLE", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
-        {"yh", "MAXDOUBLE",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
-        {"bloat", "1.0e-10",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
-        {nullptr,  nullptr,  dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL,  nullptr}
-    };
+    const size_t dimension = GetStructuredDimension(commandName);
+
+    dsGetArgs::Option *option;
+    if (dimension == 2)
+    {
+        static dsGetArgs::Option option2d[] = {
+            {"mesh",   "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, meshMustNotBeFinalized},
+            {"name",   "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
+            {"region0",    "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
+            {"region1",    "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
+            {"xl", "-MAXDOUBLE", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"xh", "MAXDOUBLE",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"yl", "-MAXDOUBLE", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"yh", "MAXDOUBLE",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"bloat", "1.0e-10",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {nullptr,  nullptr,  dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL,  nullptr}
+        };
+        option = option2d;
+    }
+    else
+    {
+        static dsGetArgs::Option option3d[] = {
+            {"mesh",   "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, meshMustNotBeFinalized},
+            {"name",   "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
+            {"region0",    "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
+            {"region1",    "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
+            {"xl", "-MAXDOUBLE", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"xh", "MAXDOUBLE",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"yl", "-MAXDOUBLE", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"yh", "MAXDOUBLE",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"zl", "-MAXDOUBLE", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"zh", "MAXDOUBLE",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"bloat", "1.0e-10",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {nullptr,  nullptr,  dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL,  nullptr}
+        };
+        option = option3d;
+    }
 
     bool error = data.processOptions(option, errorString);
 
@@ -434,20 +509,10 @@ add2dInterfaceCmd(CommandHandler &data)
     const std::string &name = data.GetStringOption("name");
     const std::string &region0Name  = data.GetStringOption("region0");
     const std::string &region1Name  = data.GetStringOption("region1");
-    const double xl = data.GetDoubleOption("xl");
-    const double xh = data.GetDoubleOption("xh");
-    const double yl = data.GetDoubleOption("yl");
-    const double yh = data.GetDoubleOption("yh");
-    const double bl = data.GetDoubleOption("bloat");
 
-    dsMesh::MeshKeeper &mdata = dsMesh::MeshKeeper::GetInstance();
-    dsMesh::MeshPtr mp = mdata.GetMesh(meshName);
-    dsMesh::Mesh2dPtr m2dp = dynamic_cast<dsMesh::Mesh2dPtr>(mp);
-    if (!m2dp)
+    dsMesh::StructuredMesh *smp = GetStructuredMesh(data, meshName, dimension);
+    if (!smp)
     {
-        std::ostringstream os;
-        os << meshName << " is not a 2D mesh\n";
-        data.SetErrorResult(os.str());
         return;
     }
     else
@@ -462,8 +527,8 @@ add2dInterfaceCmd(CommandHandler &data)
         else
         {
             dsMesh::MeshInterface2dPtr ip(new dsMesh::MeshInterface2d(name, region0Name, region1Name));
-            m2dp->AddInterface(ip);
-            dsMesh::BoundingBox bb(xl, xh, yl, yh, bl);
+            smp->AddInterface(ip);
+            dsMesh::BoundingBox bb = GetBoundingBox(data, dimension);
             ip->AddBoundingBox(bb);
             data.SetEmptyResult();
         }
@@ -479,18 +544,43 @@ add2dContactCmd(CommandHandler &data)
 
     using namespace dsGetArgs;
 
-    static dsGetArgs::Option option[] = {
-        {"mesh",   "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, meshMustNotBeFinalized},
-        {"name",   "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
-        {"material", "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
-        {"region",  "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
-        {"xl", "-MAXDOUBLE", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
-        {"xh", "MAXDOUBLE",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
-        {"yl", "-MAXDOUBLE", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
-        {"yh", "MAXDOUBLE",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
-        {"bloat", "1.0e-10",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
-        {nullptr,  nullptr,  dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL,  nullptr}
-    };
+    const size_t dimension = GetStructuredDimension(commandName);
+
+    dsGetArgs::Option *option;
+    if (dimension == 2)
+    {
+        static dsGetArgs::Option option2d[] = {
+            {"mesh",   "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, meshMustNotBeFinalized},
+            {"name",   "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
+            {"material", "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
+            {"region",  "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
+            {"xl", "-MAXDOUBLE", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"xh", "MAXDOUBLE",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"yl", "-MAXDOUBLE", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"yh", "MAXDOUBLE",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"bloat", "1.0e-10",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {nullptr,  nullptr,  dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL,  nullptr}
+        };
+        option = option2d;
+    }
+    else
+    {
+        static dsGetArgs::Option option3d[] = {
+            {"mesh",   "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, meshMustNotBeFinalized},
+            {"name",   "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
+            {"material", "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
+            {"region",  "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
+            {"xl", "-MAXDOUBLE", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"xh", "MAXDOUBLE",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"yl", "-MAXDOUBLE", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"yh", "MAXDOUBLE",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"zl", "-MAXDOUBLE", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"zh", "MAXDOUBLE",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"bloat", "1.0e-10",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {nullptr,  nullptr,  dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL,  nullptr}
+        };
+        option = option3d;
+    }
 
     bool error = data.processOptions(option, errorString);
 
@@ -504,27 +594,17 @@ add2dContactCmd(CommandHandler &data)
     const std::string &name = data.GetStringOption("name");
     const std::string &regionName  = data.GetStringOption("region");
     const std::string &materialName = data.GetStringOption("material");
-    const double xl = data.GetDoubleOption("xl");
-    const double xh = data.GetDoubleOption("xh");
-    const double yl = data.GetDoubleOption("yl");
-    const double yh = data.GetDoubleOption("yh");
-    const double bl = data.GetDoubleOption("bloat");
 
-    dsMesh::MeshKeeper &mdata = dsMesh::MeshKeeper::GetInstance();
-    dsMesh::MeshPtr mp = mdata.GetMesh(meshName);
-    dsMesh::Mesh2dPtr m2dp = dynamic_cast<dsMesh::Mesh2dPtr>(mp);
-    if (!m2dp)
+    dsMesh::StructuredMesh *smp = GetStructuredMesh(data, meshName, dimension);
+    if (!smp)
     {
-        std::ostringstream os;
-        os << meshName << " is not a 2D mesh\n";
-        data.SetErrorResult(os.str());
         return;
     }
     else
     {
         dsMesh::MeshContact2dPtr cp(new dsMesh::MeshContact2d(name, materialName, regionName));
-        m2dp->AddContact(cp);
-        dsMesh::BoundingBox bb(xl, xh, yl, yh, bl);
+        smp->AddContact(cp);
+        dsMesh::BoundingBox bb = GetBoundingBox(data, dimension);
         cp->AddBoundingBox(bb);
         data.SetEmptyResult();
     }
@@ -586,17 +666,41 @@ add2dRegionCmd(CommandHandler &data)
     const std::string commandName = data.GetCommandName();
 
     using namespace dsGetArgs;
-    static dsGetArgs::Option option[] = {
-        {"mesh",     "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, meshMustNotBeFinalized},
-        {"region",   "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
-        {"material", "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
-        {"xl", "-MAXDOUBLE", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
-        {"xh", "MAXDOUBLE",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
-        {"yl", "-MAXDOUBLE", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
-        {"yh", "MAXDOUBLE",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
-        {"bloat", "1.0e-10",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
-        {nullptr,  nullptr, dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL, nullptr}
-    };
+    const size_t dimension = GetStructuredDimension(commandName);
+
+    dsGetArgs::Option *option;
+    if (dimension == 2)
+    {
+        static dsGetArgs::Option option2d[] = {
+            {"mesh",     "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, meshMustNotBeFinalized},
+            {"region",   "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
+            {"material", "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
+            {"xl", "-MAXDOUBLE", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"xh", "MAXDOUBLE",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"yl", "-MAXDOUBLE", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"yh", "MAXDOUBLE",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"bloat", "1.0e-10",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {nullptr,  nullptr, dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL, nullptr}
+        };
+        option = option2d;
+    }
+    else
+    {
+        static dsGetArgs::Option option3d[] = {
+            {"mesh",     "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, meshMustNotBeFinalized},
+            {"region",   "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
+            {"material", "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
+            {"xl", "-MAXDOUBLE", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"xh", "MAXDOUBLE",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"yl", "-MAXDOUBLE", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"yh", "MAXDOUBLE",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"zl", "-MAXDOUBLE", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"zh", "MAXDOUBLE",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {"bloat", "1.0e-10",  dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+            {nullptr,  nullptr, dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL, nullptr}
+        };
+        option = option3d;
+    }
 
     bool error = data.processOptions(option, errorString);
 
@@ -609,27 +713,17 @@ add2dRegionCmd(CommandHandler &data)
     const std::string &meshName = data.GetStringOption("mesh");
     const std::string &regionName = data.GetStringOption("region");
     const std::string &materialName = data.GetStringOption("material");
-    const double xl = data.GetDoubleOption("xl");
-    const double xh = data.GetDoubleOption("xh");
-    const double yl = data.GetDoubleOption("yl");
-    const double yh = data.GetDoubleOption("yh");
-    const double bl = data.GetDoubleOption("bloat");
 
-    dsMesh::MeshKeeper &mdata = dsMesh::MeshKeeper::GetInstance();
-    dsMesh::MeshPtr mp = mdata.GetMesh(meshName);
-    dsMesh::Mesh2dPtr m2dp = dynamic_cast<dsMesh::Mesh2dPtr>(mp);
-    if (!m2dp)
+    dsMesh::StructuredMesh *smp = GetStructuredMesh(data, meshName, dimension);
+    if (!smp)
     {
-        std::ostringstream os;
-        os << meshName << " is not a 2D mesh\n";
-        data.SetErrorResult(os.str());
         return;
     }
     else
     {
         dsMesh::MeshRegion2dPtr rp(new dsMesh::MeshRegion2d(regionName, materialName));
-        m2dp->AddRegion(rp);
-        dsMesh::BoundingBox bb(xl, xh, yl, yh, bl);
+        smp->AddRegion(rp);
+        dsMesh::BoundingBox bb = GetBoundingBox(data, dimension);
         rp->AddBoundingBox(bb);
         data.SetEmptyResult();
     }
@@ -1313,5 +1407,80 @@ void createInterfaceFromNodesCmd(CommandHandler &data)
   dev->AddInterface(interface);
   data.SetEmptyResult();
 }
-}
 
+/**
+The marked edges of a device are split, and the result is a new finalized mesh
+*/
+void
+refineMeshCmd(CommandHandler &data)
+{
+    std::string errorString;
+
+    const std::string commandName = data.GetCommandName();
+
+    using namespace dsGetArgs;
+    static dsGetArgs::Option option[] = {
+        {"device",     "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, mustBeValidDevice},
+        {"mesh",       "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, meshCannotExist},
+        {"edge_model", "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
+        {"threshold",  "0.0", dsGetArgs::optionType::FLOAT, dsGetArgs::requiredType::OPTIONAL, nullptr},
+        {nullptr,  nullptr,  dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL,  nullptr}
+    };
+
+    bool error = data.processOptions(option, errorString);
+
+    if (error)
+    {
+        data.SetErrorResult(errorString);
+        return;
+    }
+
+    const std::string &deviceName = data.GetStringOption("device");
+    const std::string &meshName   = data.GetStringOption("mesh");
+    const std::string &edgeModel  = data.GetStringOption("edge_model");
+    const double       threshold  = data.GetDoubleOption("threshold");
+
+    const Device &device = *GlobalData::GetInstance().GetDevice(deviceName);
+
+    dsMesh::MeshRefinement refinement(device);
+
+    //// regions without the model are only split to match their neighbors
+    bool found = false;
+    for (const auto &rit : device.GetRegionList())
+    {
+        found = refinement.MarkEdges(*(rit.second), edgeModel, threshold) || found;
+    }
+
+    if (!found)
+    {
+        std::ostringstream os;
+        os << "Edge model " << edgeModel << " does not exist on any region of device " << deviceName << "\n";
+        data.SetErrorResult(os.str());
+        return;
+    }
+
+    const size_t marked = refinement.GetNumberMarkedEdges();
+    refinement.CloseMarkedEdges();
+
+    dsMesh::DevsimLoader *mp = new dsMesh::DevsimLoader(meshName);
+    refinement.CreateMesh(*mp);
+
+    {
+        std::ostringstream os;
+        os << "Refining " << refinement.GetNumberMarkedEdges() << " edges of device " << deviceName << " into mesh " << meshName << ", with " << marked << " edges above the threshold\n";
+        OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
+    }
+
+    bool ret = mp->Finalize(errorString);
+    if (!ret)
+    {
+        delete mp;
+        data.SetErrorResult(errorString);
+        return;
+    }
+
+    dsMesh::MeshKeeper &mdata = dsMesh::MeshKeeper::GetInstance();
+    mdata.AddMesh(mp);
+    data.SetEmptyResult();
+}
+}
@@ -31,6 +31,7 @@ void deleteDeviceCmd(CommandHandler &);
 void deleteMeshCmd(CommandHandler &);
 void finalizeMeshCmd(CommandHandler &);
 void loadDevicesCmd(CommandHandler &);
+void refineMeshCmd(CommandHandler &);
 void writeDevicesCmd(CommandHandler &);
 void getMeshListCmd(CommandHandler &);
 }
@@ -60,6 +60,8 @@ SPDX-License-Identifier: Apache-2.0
 #include "VectorTriangleEdgeModel.hh"
 #include "VectorTetrahedronEdgeModel.hh"
 
+#include "ElementLocator.hh"
+
 #include <sstream>
 #include <iomanip>
 #include <utility>
@@ -1102,6 +1104,135 @@ setNodeValuesCmd(CommandHandler &data)
     }
 }
 
+/// Interpolates a node model of another device onto a node solution
+void
+interpolateNodeSolutionCmd(CommandHandler &data)
+{
+    std::string errorString;
+
+    using namespace dsGetArgs;
+    static dsGetArgs::Option option[] =
+    {
+        {"device",      "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, mustBeValidDevice},
+        {"region",      "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
+        {"name",        "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, stringCannotBeEmpty},
+        {"from_device", "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED, mustBeValidDevice},
+        {"from_region", "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL, nullptr},
+        {"from_name",   "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL, nullptr},
+        {nullptr,  nullptr, dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL}
+    };
+
+    bool error = data.processOptions(option, errorString);
+
+    if (error)
+    {
+        data.SetErrorResult(errorString);
+        return;
+    }
+
+    const std::string &deviceName = data.GetStringOption("device");
+    const std::string &regionName = data.GetStringOption("region");
+    const std::string &name = data.GetStringOption("name");
+    std::string fromDeviceName = data.GetStringOption("from_device");
+    std::string fromRegionName = data.GetStringOption("from_region");
+    std::string fromName = data.GetStringOption("from_name");
+    if (fromRegionName.empty())
+    {
+      fromRegionName = regionName;
+    }
+    if (fromName.empty())
+    {
+      fromName = name;
+    }
+
+    Device *dev = nullptr;
+    Region *reg = nullptr;
+    errorString = ValidateDeviceAndRegion(deviceName, regionName, dev, reg);
+    if (!errorString.empty())
+    {
+        data.SetErrorResult(errorString);
+        return;
+    }
+
+    Device *fromdev = nullptr;
+    Region *fromreg = nullptr;
+    errorString = ValidateDeviceAndRegion(fromDeviceName, fromRegionName, fromdev, fromreg);
+    if (!errorString.empty())
+    {
+        data.SetErrorResult(errorString);
+        return;
+    }
+
+    auto nm_name = std::const_pointer_cast<NodeModel, const NodeModel>(reg->GetNodeModel(name));
+    auto nm_from = fromreg->GetNodeModel(fromName);
+
+    if (dev->GetDimension() != fromdev->GetDimension())
+    {
+      std::ostringstream os;
+      os << "Device " << deviceName << " and device " << fromDeviceName << " do not have the same dimension\n";
+      errorString += os.str();
+    }
+    else if (!nm_name)
+    {
+      std::ostringstream os;
+      os << "Model " << name << " does not exist\n";
+      errorString += os.str();
+    }
+    else if (!nm_from)
+    {
+      std::ostringstream os;
+      os << "Model " << fromName << " does not exist on region " << fromRegionName << " of device " << fromDeviceName << "\n";
+      errorString += os.str();
+    }
+
+    if (!errorString.empty())
+    {
+      data.SetErrorResult(errorString);
+      return;
+    }
+
+    const ElementLocator locator(*fromreg);
+    if (!locator.HasElements())
+    {
+      std::ostringstream os;
+      os << "Region " << fromRegionName << " of device " << fromDeviceName << " has no elements\n";
+      data.SetErrorResult(os.str());
+      return;
+    }
+
+    size_t outside = 0;
+    if (std::dynamic_pointer_cast<NodeSolution<double>>(nm_name))
+    {
+      std::vector<double> values;
+      outside = InterpolateNodeValues(locator, nm_from->GetScalarValues<double>(), *reg, values);
+      nm_name->SetValues(values);
+    }
+#ifdef DEVSIM_EXTENDED_PRECISION
+    else if (std::dynamic_pointer_cast<NodeSolution<float128>>(nm_name))
+    {
+      std::vector<float128> values;
+      outside = InterpolateNodeValues(locator, nm_from->GetScalarValues<float128>(), *reg, values);
+      nm_name->SetValues(values);
+    }
+#endif
+    else
+    {
+      std::ostringstream os;
+      os << "Model " << name << " is not a node solution\n";
+      data.SetErrorResult(os.str());
+      return;
+    }
+
+    if (outside != 0)
+    {
+      std::ostringstream os;
+      os << outside << " nodes of region " << regionName << " are outside of region " << fromRegionName << " of device " << fromDeviceName << ", and use the values of the nearest element\n";
+      OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
+    }
+
+    data.SetEmptyResult();
+}
+
 void
 setNodeValueCmd(CommandHandler &data)
 {
@@ -2119,6 +2250,7 @@ registerFunctionCmd(CommandHandler &data)
     {"name",      "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED},
     {"procedure", "", dsGetArgs::optionType::STRING, dsGetArgs::requiredType::REQUIRED},
     {"nargs",     "", dsGetArgs::optionType::INTEGER, dsGetArgs::requiredType::REQUIRED},
+    {"vectorized", "", dsGetArgs::optionType::BOOLEAN, dsGetArgs::requiredType::OPTIONAL},
     {nullptr,     nullptr, dsGetArgs::optionType::STRING, dsGetArgs::requiredType::OPTIONAL}
   };
 
@@ -2135,6 +2267,7 @@ registerFunctionCmd(CommandHandler &data)
   const std::string &name  = data.GetStringOption("name");
   const int nargs          = data.GetIntegerOption("nargs");
   ObjectHolder procedure   = data.GetObjectHolder("procedure");
+  const bool vectorized    = data.GetBooleanOption("vectorized");
 
   int num = nargs;
 
@@ -2146,9 +2279,9 @@ registerFunctionCmd(CommandHandler &data)
   }
 
 #ifdef DEVSIM_EXTENDED_PRECISION
-  MathEval<float128>::GetInstance().AddTclMath(name, procedure, static_cast<size_t>(nargs), errorString);
+  MathEval<float128>::GetInstance().AddTclMath(name, procedure, static_cast<size_t>(nargs), vectorized, errorString);
 #endif
-  MathEval<double>::GetInstance().AddTclMath(name, procedure, static_cast<size_t>(nargs), errorString);
+  MathEval<double>::GetInstance().AddTclMath(name, procedure, static_cast<size_t>(nargs), vectorized, errorString);
 
   if (!errorString.empty())
   {
@@ -25,6 +25,7 @@ void debugTriangleCmd(CommandHandler &);
 void getInterfaceModelListCmd(CommandHandler &);
 void getInterfaceValuesCmd(CommandHandler &);
 void getNodeModelListCmd(CommandHandler &);
+void interpolateNodeSolutionCmd(CommandHandler &);
 void printEdgeValuesCmd(CommandHandler &);
 void printElementEdgeValuesCmd(CommandHandler &);
 void printNodeValuesCmd(CommandHandler &);
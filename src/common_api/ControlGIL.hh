@@ -19,7 +19,8 @@ class MasterGILControl
 
     private:
         bool owned = false;
-        static void *thread_state_;
+        /// per thread, so that solves in separate simulation contexts may run concurrently
+        static thread_local void *thread_state_;
 };
 
 class EnsurePythonGIL
@@ -16,11 +16,10 @@ SPDX-License-Identifier: Apache-2.0
 #include "Float128.hh"
 #endif
 
-void ResetAllData()
+void ResetContextData()
 {
     InstanceKeeper::delete_instance();
     NodeKeeper::delete_instance();
-    EngineAPI::ResetAllData();
     dsMesh::MeshKeeper::DestroyInstance();
     MathEval<double>::DestroyInstance();
 #if defined(DEVSIM_EXTENDED_PRECISION)
@@ -33,3 +32,9 @@ void ResetAllData()
     GlobalData::DestroyInstance();
 }
 
+void ResetAllData()
+{
+    ResetContextData();
+    EngineAPI::ResetAllData();
+}
+
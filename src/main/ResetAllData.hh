@@ -7,4 +7,8 @@ SPDX-License-Identifier: Apache-2.0
 
 #pragma once
 
+/// Destroys the data owned by the current simulation context
+void ResetContextData();
+
+/// Also resets the symbolic expression engine, which is shared by all contexts
 void ResetAllData();
@@ -38,6 +38,7 @@ void devsim_initialization()
 #if defined (USE_SUPERLU_PRECONDITIONER)
     solvers.push_back(ObjectHolder("superlu"));
 #endif
+    solvers.push_back(ObjectHolder("sparse_lu"));
     features["direct_solver"] = ObjectHolder(solvers);
     features["license"] = ObjectHolder("Apache License, Version 2.0");
     features["website"] = ObjectHolder("https://devsim.org");
@@ -0,0 +1,81 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#include "AMGPreconditioner.hh"
+#include "AlgebraicMultigrid.hh"
+#include "CompressedMatrix.hh"
+#include "OutputStream.hh"
+#include "dsAssert.hh"
+
+#include <sstream>
+
+namespace dsMath {
+template <typename DoubleType>
+dsMath::CompressionType AMGPreconditioner<DoubleType>::GetRealMatrixCompressionType() const
+{
+  return dsMath::CompressionType::CRM;
+}
+
+template <typename DoubleType>
+dsMath::CompressionType AMGPreconditioner<DoubleType>::GetComplexMatrixCompressionType() const
+{
+  return dsMath::CompressionType::CRM;
+}
+
+template <typename DoubleType>
+AMGPreconditioner<DoubleType>::~AMGPreconditioner()
+{
+}
+
+template <typename DoubleType>
+AMGPreconditioner<DoubleType>::AMGPreconditioner(size_t numeqns, PEnum::TransposeType_t transpose) : Preconditioner<DoubleType>(numeqns, transpose), amg_(new AlgebraicMultigrid<DoubleType>())
+{
+  dsAssert(transpose == PEnum::TransposeType_t::NOTRANS, "UNEXPECTED");
+}
+
+template <typename DoubleType>
+bool AMGPreconditioner<DoubleType>::DerivedLUFactor(Matrix<DoubleType> *m)
+{
+  CompressedMatrix<DoubleType> *cm = dynamic_cast<CompressedMatrix<DoubleType> *>(m);
+  if (!cm)
+  {
+    dsAssert(cm != nullptr, "UNEXPECTED");
+    return false;
+  }
+  dsAssert(cm->GetCompressionType() == CompressionType::CRM, "UNEXPECTED");
+  dsAssert(cm->GetMatrixType() == MatrixType::REAL, "UNEXPECTED");
+
+  const bool ret = amg_->Setup(cm->GetRows(), cm->GetCols(), cm->GetReal());
+
+  std::ostringstream os;
+  os << "AMG levels " << amg_->GetNumberLevels() << " operator complexity " << amg_->GetOperatorComplexity() << "\n";
+  OutputStream::WriteOut(OutputStream::OutputType::VERBOSE1, os.str());
+
+  return ret;
+}
+
+template <typename DoubleType>
+bool AMGPreconditioner<DoubleType>::DerivedLUSolve(DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const
+{
+  amg_->Apply(x, b);
+  return true;
+}
+
+template <typename DoubleType>
+bool AMGPreconditioner<DoubleType>::DerivedLUSolve(ComplexDoubleVec_t<DoubleType> &, const ComplexDoubleVec_t<DoubleType> &) const
+{
+  dsAssert(false, "UNEXPECTED");
+  return false;
+}
+}
+
+template class dsMath::AMGPreconditioner<double>;
+#ifdef DEVSIM_EXTENDED_PRECISION
+#include "Float128.hh"
+template class dsMath::AMGPreconditioner<float128>;
+#endif
+
@@ -0,0 +1,37 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#ifndef AMG_PRECONDITIONER_HH
+#define AMG_PRECONDITIONER_HH
+#include "Preconditioner.hh"
+#include <memory>
+
+namespace dsMath {
+template <typename DoubleType>
+class AlgebraicMultigrid;
+
+/// One V-cycle of smoothed aggregation multigrid on the compressed row matrix
+template <typename DoubleType>
+class AMGPreconditioner : public Preconditioner<DoubleType> {
+  public:
+    virtual ~AMGPreconditioner();
+
+    AMGPreconditioner(size_t /*numeqns*/, PEnum::TransposeType_t /*tranpose*/);
+    dsMath::CompressionType GetRealMatrixCompressionType() const override;
+    dsMath::CompressionType GetComplexMatrixCompressionType() const override;
+
+  protected:
+    bool DerivedLUSolve(DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const override;
+    bool DerivedLUSolve(ComplexDoubleVec_t<DoubleType> &x, const ComplexDoubleVec_t<DoubleType> &b) const override;
+    bool DerivedLUFactor(Matrix<DoubleType> *) override;     // Factor the matrix
+
+  private:
+    std::unique_ptr<AlgebraicMultigrid<DoubleType>> amg_;
+};
+}
+#endif
+
@@ -0,0 +1,581 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#include "AlgebraicMultigrid.hh"
+#include "DenseMatrix.hh"
+#include "ParallelFor.hh"
+#include "dsAssert.hh"
+
+#include <algorithm>
+#include <utility>
+#include <cmath>
+using std::abs;
+
+namespace dsMath {
+template <typename DoubleType>
+void SparseRows<DoubleType>::Multiply(const DoubleVec_t<DoubleType> &x, DoubleVec_t<DoubleType> &y) const
+{
+  y.resize(rows);
+  ParallelFor(rows, [&](size_t beg, size_t end) {
+    for (size_t i = beg; i < end; ++i)
+    {
+      DoubleType sum = 0.0;
+      for (int j = rowptr[i]; j < rowptr[i + 1]; ++j)
+      {
+        sum += vals[j] * x[cols[j]];
+      }
+      y[i] = sum;
+    }
+  });
+}
+
+template <typename DoubleType>
+SparseRows<DoubleType> SparseRows<DoubleType>::Transpose() const
+{
+  SparseRows ret;
+  ret.rows    = columns;
+  ret.columns = rows;
+  ret.rowptr.assign(columns + 1, 0);
+  for (const auto c : cols)
+  {
+    ++ret.rowptr[c + 1];
+  }
+  for (size_t i = 0; i < columns; ++i)
+  {
+    ret.rowptr[i + 1] += ret.rowptr[i];
+  }
+
+  ret.cols.resize(cols.size());
+  ret.vals.resize(vals.size());
+  IntVec_t next(ret.rowptr.begin(), ret.rowptr.end() - 1);
+  //// the rows are visited in order, so the columns of the result are sorted
+  for (size_t i = 0; i < rows; ++i)
+  {
+    for (int j = rowptr[i]; j < rowptr[i + 1]; ++j)
+    {
+      const int p = next[cols[j]]++;
+      ret.cols[p] = static_cast<int>(i);
+      ret.vals[p] = vals[j];
+    }
+  }
+  return ret;
+}
+
+/// Gustavson's algorithm, where the pattern of each row is counted before it is filled
+template <typename DoubleType>
+SparseRows<DoubleType> SparseRows<DoubleType>::Multiply(const SparseRows &b) const
+{
+  dsAssert(columns == b.rows, "UNEXPECTED");
+
+  SparseRows ret;
+  ret.rows    = rows;
+  ret.columns = b.columns;
+  ret.rowptr.assign(rows + 1, 0);
+
+  ParallelFor(rows, [&](size_t beg, size_t end) {
+    std::vector<size_t> marker(b.columns, size_t(-1));
+    for (size_t i = beg; i < end; ++i)
+    {
+      int count = 0;
+      for (int k = rowptr[i]; k < rowptr[i + 1]; ++k)
+      {
+        const size_t r = cols[k];
+        for (int j = b.rowptr[r]; j < b.rowptr[r + 1]; ++j)
+        {
+          const size_t c = b.cols[j];
+          if (marker[c] != i)
+          {
+            marker[c] = i;
+            ++count;
+          }
+        }
+      }
+      ret.rowptr[i + 1] = count;
+    }
+  });
+
+  for (size_t i = 0; i < rows; ++i)
+  {
+    ret.rowptr[i + 1] += ret.rowptr[i];
+  }
+  ret.cols.resize(ret.rowptr[rows]);
+  ret.vals.resize(ret.rowptr[rows]);
+
+  ParallelFor(rows, [&](size_t beg, size_t end) {
+    std::vector<int> position(b.columns, -1);
+    std::vector<std::pair<int, DoubleType>> row;
+    for (size_t i = beg; i < end; ++i)
+    {
+      row.clear();
+      for (int k = rowptr[i]; k < rowptr[i + 1]; ++k)
+      {
+        const size_t r = cols[k];
+        const DoubleType a = vals[k];
+        for (int j = b.rowptr[r]; j < b.rowptr[r + 1]; ++j)
+        {
+          const int c = b.cols[j];
+          if (position[c] < 0)
+          {
+            position[c] = static_cast<int>(row.size());
+            row.push_back(std::make_pair(c, a * b.vals[j]));
+          }
+          else
+          {
+            row[position[c]].second += a * b.vals[j];
+          }
+        }
+      }
+
+      std::sort(row.begin(), row.end(), [](const std::pair<int, DoubleType> &x, const std::pair<int, DoubleType> &y) {return x.first < y.first;});
+      int p = ret.rowptr[i];
+      for (const auto &e : row)
+      {
+        position[e.first] = -1;
+        ret.cols[p] = e.first;
+        ret.vals[p] = e.second;
+        ++p;
+      }
+    }
+  });
+
+  return ret;
+}
+
+template <typename DoubleType>
+AlgebraicMultigrid<DoubleType>::AlgebraicMultigrid() : strengthThreshold_(0.08), coarseSize_(500), maxLevels_(12), sweeps_(2)
+{
+}
+
+template <typename DoubleType>
+AlgebraicMultigrid<DoubleType>::~AlgebraicMultigrid()
+{
+}
+
+/// Three passes: aggregates of a row and all of its strong neighbors,
+/// rows joining a neighboring aggregate, and aggregates of the rows which are left
+template <typename DoubleType>
+size_t AlgebraicMultigrid<DoubleType>::Aggregate(const SparseRows<DoubleType> &A, std::vector<int> &aggregate) const
+{
+  const size_t n = A.rows;
+
+  DoubleVec_t<DoubleType> diag(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    for (int j = A.rowptr[i]; j < A.rowptr[i + 1]; ++j)
+    {
+      if (static_cast<size_t>(A.cols[j]) == i)
+      {
+        diag[i] += A.vals[j];
+      }
+    }
+  }
+
+  //// strong off diagonal connections of each row
+  IntVec_t sptr(n + 1, 0);
+  IntVec_t scols;
+  scols.reserve(A.cols.size());
+  const DoubleType theta = strengthThreshold_;
+  for (size_t i = 0; i < n; ++i)
+  {
+    for (int j = A.rowptr[i]; j < A.rowptr[i + 1]; ++j)
+    {
+      const size_t c = A.cols[j];
+      if ((c != i) && (A.vals[j] != 0.0) && (abs(A.vals[j]) >= theta * sqrt(abs(diag[i] * diag[c]))))
+      {
+        scols.push_back(static_cast<int>(c));
+      }
+    }
+    sptr[i + 1] = static_cast<int>(scols.size());
+  }
+
+  const int unassigned = -2;
+  aggregate.assign(n, unassigned);
+  int count = 0;
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    if (sptr[i] == sptr[i + 1])
+    {
+      aggregate[i] = -1;
+      continue;
+    }
+    if (aggregate[i] != unassigned)
+    {
+      continue;
+    }
+    bool free = true;
+    for (int j = sptr[i]; free && (j < sptr[i + 1]); ++j)
+    {
+      free = (aggregate[scols[j]] == unassigned);
+    }
+    if (free)
+    {
+      aggregate[i] = count;
+      for (int j = sptr[i]; j < sptr[i + 1]; ++j)
+      {
+        aggregate[scols[j]] = count;
+      }
+      ++count;
+    }
+  }
+
+  //// only join the aggregates from the first pass, so they do not grow along a chain
+  const std::vector<int> first(aggregate);
+  for (size_t i = 0; i < n; ++i)
+  {
+    if (first[i] != unassigned)
+    {
+      continue;
+    }
+    for (int j = sptr[i]; j < sptr[i + 1]; ++j)
+    {
+      if (first[scols[j]] >= 0)
+      {
+        aggregate[i] = first[scols[j]];
+        break;
+      }
+    }
+  }
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    if (aggregate[i] != unassigned)
+    {
+      continue;
+    }
+    aggregate[i] = count;
+    for (int j = sptr[i]; j < sptr[i + 1]; ++j)
+    {
+      if (aggregate[scols[j]] == unassigned)
+      {
+        aggregate[scols[j]] = count;
+      }
+    }
+    ++count;
+  }
+
+  return count;
+}
+
+/// The tentative interpolation is exact for the near null space vector, and is smoothed by one weighted Jacobi step
+/// The vector is replaced by its representation on the coarse level
+template <typename DoubleType>
+SparseRows<DoubleType> AlgebraicMultigrid<DoubleType>::CreateInterpolation(const Level &level, const std::vector<int> &aggregate, size_t count, DoubleVec_t<DoubleType> &nullspace) const
+{
+  const SparseRows<DoubleType> &A = level.A;
+  const size_t n = A.rows;
+
+  DoubleVec_t<DoubleType> norms(count);
+  for (size_t i = 0; i < n; ++i)
+  {
+    if (aggregate[i] >= 0)
+    {
+      norms[aggregate[i]] += nullspace[i] * nullspace[i];
+    }
+  }
+  for (auto &x : norms)
+  {
+    x = sqrt(x);
+  }
+
+  SparseRows<DoubleType> P0;
+  P0.rows    = n;
+  P0.columns = count;
+  P0.rowptr.assign(n + 1, 0);
+  for (size_t i = 0; i < n; ++i)
+  {
+    if (aggregate[i] >= 0)
+    {
+      P0.cols.push_back(aggregate[i]);
+      P0.vals.push_back(nullspace[i] / norms[aggregate[i]]);
+    }
+    P0.rowptr[i + 1] = static_cast<int>(P0.cols.size());
+  }
+  nullspace.swap(norms);
+
+  const DoubleType omega = (level.rho > 0.0) ? (4.0 / (3.0 * level.rho)) : 0.0;
+
+  const SparseRows<DoubleType> &AP0 = A.Multiply(P0);
+
+  SparseRows<DoubleType> P;
+  P.rows    = n;
+  P.columns = count;
+  P.rowptr.assign(n + 1, 0);
+  for (size_t i = 0; i < n; ++i)
+  {
+    bool found = (aggregate[i] < 0);
+    for (int j = AP0.rowptr[i]; j < AP0.rowptr[i + 1]; ++j)
+    {
+      found = found || (AP0.cols[j] == aggregate[i]);
+    }
+    P.rowptr[i + 1] = P.rowptr[i] + (AP0.rowptr[i + 1] - AP0.rowptr[i]) + (found ? 0 : 1);
+  }
+  P.cols.resize(P.rowptr[n]);
+  P.vals.resize(P.rowptr[n]);
+
+  ParallelFor(n, [&](size_t beg, size_t end) {
+    for (size_t i = beg; i < end; ++i)
+    {
+      int p = P.rowptr[i];
+      const DoubleType scale = -omega * level.dinv[i];
+      bool added = (aggregate[i] < 0);
+      for (int j = AP0.rowptr[i]; j < AP0.rowptr[i + 1]; ++j)
+      {
+        const int c = AP0.cols[j];
+        if (!added && (aggregate[i] < c))
+        {
+          P.cols[p] = aggregate[i];
+          P.vals[p] = P0.vals[P0.rowptr[i]];
+          ++p;
+          added = true;
+        }
+        P.cols[p] = c;
+        P.vals[p] = scale * AP0.vals[j];
+        if (c == aggregate[i])
+        {
+          P.vals[p] += P0.vals[P0.rowptr[i]];
+          added = true;
+        }
+        ++p;
+      }
+      if (!added)
+      {
+        P.cols[p] = aggregate[i];
+        P.vals[p] = P0.vals[P0.rowptr[i]];
+        ++p;
+      }
+      dsAssert(p == P.rowptr[i + 1], "UNEXPECTED");
+    }
+  });
+
+  return P;
+}
+
+/// The spectral radius of inv(D) A is estimated by power iteration from a fixed vector
+template <typename DoubleType>
+void AlgebraicMultigrid<DoubleType>::CreateSmoother(Level &level) const
+{
+  const SparseRows<DoubleType> &A = level.A;
+  const size_t n = A.rows;
+
+  level.dinv.assign(n, 0.0);
+  for (size_t i = 0; i < n; ++i)
+  {
+    DoubleType d = 0.0;
+    for (int j = A.rowptr[i]; j < A.rowptr[i + 1]; ++j)
+    {
+      if (static_cast<size_t>(A.cols[j]) == i)
+      {
+        d += A.vals[j];
+      }
+    }
+    level.dinv[i] = (d != 0.0) ? (1.0 / d) : 0.0;
+  }
+
+  DoubleVec_t<DoubleType> v(n);
+  DoubleVec_t<DoubleType> w(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    v[i] = 1.0 + 0.1 * static_cast<DoubleType>(i % 7);
+  }
+
+  level.rho = 0.0;
+  for (size_t k = 0; (k < 15) && (n != 0); ++k)
+  {
+    DoubleType vnorm = 0.0;
+    for (size_t i = 0; i < n; ++i)
+    {
+      vnorm += v[i] * v[i];
+    }
+
+    A.Multiply(v, w);
+    DoubleType wnorm = 0.0;
+    for (size_t i = 0; i < n; ++i)
+    {
+      w[i] *= level.dinv[i];
+      wnorm += w[i] * w[i];
+    }
+    wnorm = sqrt(wnorm);
+
+    if (wnorm == 0.0)
+    {
+      break;
+    }
+
+    level.rho = wnorm / sqrt(vnorm);
+    for (size_t i = 0; i < n; ++i)
+    {
+      v[i] = w[i] / wnorm;
+    }
+  }
+
+  const DoubleType omega = (level.rho > 0.0) ? (4.0 / (3.0 * level.rho)) : 0.0;
+  level.smoother.resize(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    level.smoother[i] = omega * level.dinv[i];
+  }
+}
+
+template <typename DoubleType>
+bool AlgebraicMultigrid<DoubleType>::Setup(const IntVec_t &rowptr, const IntVec_t &cols, const DoubleVec_t<DoubleType> &vals)
+{
+  levels_.clear();
+  coarse_.reset();
+
+  levels_.emplace_back();
+  {
+    SparseRows<DoubleType> &A = levels_.back().A;
+    A.rows    = rowptr.size() - 1;
+    A.columns = A.rows;
+    A.rowptr  = rowptr;
+    A.cols    = cols;
+    A.vals    = vals;
+  }
+
+  //// the constant is the near null space of the finest level
+  DoubleVec_t<DoubleType> nullspace(levels_.back().A.rows, 1.0);
+  std::vector<int> aggregate;
+  CreateSmoother(levels_.back());
+  while ((levels_.back().A.rows > coarseSize_) && (levels_.size() < maxLevels_))
+  {
+    Level &fine = levels_.back();
+    const size_t count = Aggregate(fine.A, aggregate);
+    //// coarsening has stalled
+    if ((count == 0) || (10 * count > 9 * fine.A.rows))
+    {
+      break;
+    }
+
+    fine.P = CreateInterpolation(fine, aggregate, count, nullspace);
+    fine.R = fine.P.Transpose();
+    SparseRows<DoubleType> Ac = fine.R.Multiply(fine.A.Multiply(fine.P));
+
+    levels_.emplace_back();
+    levels_.back().A = std::move(Ac);
+    CreateSmoother(levels_.back());
+  }
+
+  //// a coarsest level which is too large is only smoothed
+  const SparseRows<DoubleType> &Ac = levels_.back().A;
+  if (Ac.rows <= 4 * coarseSize_)
+  {
+    coarse_ = std::unique_ptr<DenseMatrix<DoubleType>>(new DenseMatrix<DoubleType>(Ac.rows));
+    DenseMatrix<DoubleType> &dm = *coarse_;
+    for (size_t i = 0; i < Ac.rows; ++i)
+    {
+      for (int j = Ac.rowptr[i]; j < Ac.rowptr[i + 1]; ++j)
+      {
+        dm(i, Ac.cols[j]) += Ac.vals[j];
+      }
+    }
+    if (!dm.LUFactor())
+    {
+      coarse_.reset();
+    }
+  }
+
+  return true;
+}
+
+template <typename DoubleType>
+double AlgebraicMultigrid<DoubleType>::GetOperatorComplexity() const
+{
+  double total = 0.0;
+  for (const auto &level : levels_)
+  {
+    total += static_cast<double>(level.A.vals.size());
+  }
+  return (levels_.empty() || levels_[0].A.vals.empty()) ? 0.0 : total / static_cast<double>(levels_[0].A.vals.size());
+}
+
+template <typename DoubleType>
+void AlgebraicMultigrid<DoubleType>::Smooth(const Level &level, DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const
+{
+  const SparseRows<DoubleType> &A = level.A;
+  const DoubleVec_t<DoubleType> &s = level.smoother;
+  DoubleVec_t<DoubleType> &r = level.r;
+  for (size_t k = 0; k < sweeps_; ++k)
+  {
+    A.Multiply(x, r);
+    ParallelFor(A.rows, [&](size_t beg, size_t end) {
+      for (size_t i = beg; i < end; ++i)
+      {
+        x[i] += s[i] * (b[i] - r[i]);
+      }
+    });
+  }
+}
+
+template <typename DoubleType>
+void AlgebraicMultigrid<DoubleType>::Cycle(size_t l, DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const
+{
+  const Level &level = levels_[l];
+  const size_t n = level.A.rows;
+
+  if (l + 1 == levels_.size())
+  {
+    if (coarse_)
+    {
+      x = b;
+      coarse_->Solve(x.data());
+    }
+    else
+    {
+      x.assign(n, 0.0);
+      for (size_t i = 0; i < 10; ++i)
+      {
+        Smooth(level, x, b);
+      }
+    }
+    return;
+  }
+
+  x.assign(n, 0.0);
+  Smooth(level, x, b);
+
+  DoubleVec_t<DoubleType> &r = level.r;
+  level.A.Multiply(x, r);
+  ParallelFor(n, [&](size_t beg, size_t end) {
+    for (size_t i = beg; i < end; ++i)
+    {
+      r[i] = b[i] - r[i];
+    }
+  });
+
+  const Level &coarse = levels_[l + 1];
+  level.R.Multiply(r, coarse.b);
+  Cycle(l + 1, coarse.x, coarse.b);
+
+  //// r is the correction
+  level.P.Multiply(coarse.x, r);
+  ParallelFor(n, [&](size_t beg, size_t end) {
+    for (size_t i = beg; i < end; ++i)
+    {
+      x[i] += r[i];
+    }
+  });
+
+  Smooth(level, x, b);
+}
+
+template <typename DoubleType>
+void AlgebraicMultigrid<DoubleType>::Apply(DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const
+{
+  dsAssert(!levels_.empty(), "UNEXPECTED");
+  Cycle(0, x, b);
+}
+}
+
+template struct dsMath::SparseRows<double>;
+template class dsMath::AlgebraicMultigrid<double>;
+#ifdef DEVSIM_EXTENDED_PRECISION
+#include "Float128.hh"
+template struct dsMath::SparseRows<float128>;
+template class dsMath::AlgebraicMultigrid<float128>;
+#endif
+
@@ -0,0 +1,110 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#ifndef DS_ALGEBRAIC_MULTIGRID_HH
+#define DS_ALGEBRAIC_MULTIGRID_HH
+
+#include "dsMathTypes.hh"
+
+#include <vector>
+#include <memory>
+
+namespace dsMath {
+template <typename T> class DenseMatrix;
+
+/// Compressed row matrix for the multigrid levels
+template <typename DoubleType>
+struct SparseRows {
+  size_t                  rows    = 0;
+  size_t                  columns = 0;
+  IntVec_t                rowptr;
+  IntVec_t                cols;
+  DoubleVec_t<DoubleType> vals;
+
+  /// y = A x
+  void Multiply(const DoubleVec_t<DoubleType> &/*x*/, DoubleVec_t<DoubleType> &/*y*/) const;
+
+  SparseRows Transpose() const;
+
+  /// this * b
+  SparseRows Multiply(const SparseRows &/*b*/) const;
+};
+
+/// Smoothed aggregation multigrid, applied as one V-cycle
+/// The aggregates are formed from the strong connections, and the constant vector is interpolated exactly
+/// The smoother is weighted Jacobi, and the coarsest level is factored with a dense LU
+template <typename DoubleType>
+class AlgebraicMultigrid {
+  public:
+    AlgebraicMultigrid();
+    ~AlgebraicMultigrid();
+
+    /// The matrix is in compressed row format
+    bool Setup(const IntVec_t &/*rowptr*/, const IntVec_t &/*cols*/, const DoubleVec_t<DoubleType> &/*vals*/);
+
+    /// x is the result of one V-cycle from a zero initial guess
+    void Apply(DoubleVec_t<DoubleType> &/*x*/, const DoubleVec_t<DoubleType> &/*b*/) const;
+
+    size_t GetNumberLevels() const
+    {
+      return levels_.size();
+    }
+
+    /// Entries of all of the levels, divided by the entries of the finest level
+    double GetOperatorComplexity() const;
+
+    void SetStrengthThreshold(double x)
+    {
+      strengthThreshold_ = x;
+    }
+
+    void SetCoarseSize(size_t x)
+    {
+      coarseSize_ = x;
+    }
+
+    void SetSweeps(size_t x)
+    {
+      sweeps_ = x;
+    }
+
+  private:
+    AlgebraicMultigrid(const AlgebraicMultigrid &);
+    AlgebraicMultigrid &operator=(const AlgebraicMultigrid &);
+
+    struct Level {
+      SparseRows<DoubleType>  A;
+      //// interpolation from the next coarser level, and its transpose
+      SparseRows<DoubleType>  P;
+      SparseRows<DoubleType>  R;
+      //// inverse of the diagonal, and the weighted jacobi smoother
+      DoubleVec_t<DoubleType> dinv;
+      DoubleVec_t<DoubleType> smoother;
+      //// estimate of the spectral radius of inv(D) A
+      DoubleType              rho = 0.0;
+      mutable DoubleVec_t<DoubleType> x;
+      mutable DoubleVec_t<DoubleType> b;
+      mutable DoubleVec_t<DoubleType> r;
+    };
+
+    /// aggregate of each row, or -1 for the rows without strong connections
+    size_t Aggregate(const SparseRows<DoubleType> &, std::vector<int> &) const;
+    SparseRows<DoubleType> CreateInterpolation(const Level &, const std::vector<int> &, size_t, DoubleVec_t<DoubleType> &/*nullspace*/) const;
+    void CreateSmoother(Level &) const;
+    void Smooth(const Level &, DoubleVec_t<DoubleType> &, const DoubleVec_t<DoubleType> &) const;
+    void Cycle(size_t /*level*/, DoubleVec_t<DoubleType> &, const DoubleVec_t<DoubleType> &) const;
+
+    std::vector<Level>                      levels_;
+    std::unique_ptr<DenseMatrix<DoubleType>> coarse_;
+    double strengthThreshold_;
+    size_t coarseSize_;
+    size_t maxLevels_;
+    size_t sweeps_;
+};
+}
+#endif
+
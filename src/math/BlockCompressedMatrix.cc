@@ -0,0 +1,330 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#include "BlockCompressedMatrix.hh"
+#include "CompressedMatrix.hh"
+#include "dsAssert.hh"
+
+#include <algorithm>
+
+namespace dsMath {
+
+BlockLayout::BlockLayout(size_t numeqns, size_t block_size) : blockSize_(std::max<size_t>(block_size, 1)), block_(numeqns, size_t(-1)), offset_(numeqns, size_t(-1))
+{
+}
+
+void BlockLayout::AddBlock(const std::vector<size_t> &eqs)
+{
+  dsAssert(!eqs.empty() && (eqs.size() <= blockSize_), "UNEXPECTED");
+
+  const size_t b = GetNumberBlocks();
+  equation_.resize(equation_.size() + blockSize_, size_t(-1));
+  for (size_t i = 0; i < eqs.size(); ++i)
+  {
+    const size_t eq = eqs[i];
+    dsAssert(block_[eq] == size_t(-1), "UNEXPECTED");
+    block_[eq]  = b;
+    offset_[eq] = i;
+    equation_[b * blockSize_ + i] = eq;
+  }
+}
+
+void BlockLayout::Finalize()
+{
+  std::vector<size_t> eqs(1);
+  for (size_t i = 0; i < block_.size(); ++i)
+  {
+    if (block_[i] == size_t(-1))
+    {
+      eqs[0] = i;
+      AddBlock(eqs);
+    }
+  }
+}
+
+template <typename DoubleType>
+BlockCompressedMatrix<DoubleType>::BlockCompressedMatrix(const BlockLayout &layout) : Matrix<DoubleType>(layout.GetNumberEquations()), layout_(layout), hasOutOfPattern_(false), patternVersion_(0)
+{
+  rowPtr_.assign(layout_.GetNumberBlocks() + 1, 0);
+  outOfPattern_.resize(layout_.GetNumberBlocks());
+}
+
+template <typename DoubleType>
+BlockCompressedMatrix<DoubleType>::~BlockCompressedMatrix()
+{
+}
+
+template <typename DoubleType>
+int BlockCompressedMatrix<DoubleType>::FindBlock(size_t brow, size_t bcol) const
+{
+  const auto begin = colIndex_.begin() + rowPtr_[brow];
+  const auto end   = colIndex_.begin() + rowPtr_[brow + 1];
+  const auto it = std::lower_bound(begin, end, static_cast<int>(bcol));
+  return ((it != end) && (*it == static_cast<int>(bcol))) ? static_cast<int>(it - colIndex_.begin()) : -1;
+}
+
+template <typename DoubleType>
+void BlockCompressedMatrix<DoubleType>::AddEntry(int r, int c, DoubleType v)
+{
+  const size_t k = GetBlockSize();
+  const size_t brow = layout_.GetBlock(r);
+  const size_t bcol = layout_.GetBlock(c);
+  const size_t pos  = layout_.GetOffset(r) * k + layout_.GetOffset(c);
+
+  const int index = FindBlock(brow, bcol);
+  if (index >= 0)
+  {
+    values_[index * k * k + pos] += v;
+  }
+  else
+  {
+    auto &block = outOfPattern_[brow][bcol];
+    if (block.empty())
+    {
+      block.resize(k * k);
+    }
+    block[pos] += v;
+    hasOutOfPattern_ = true;
+  }
+}
+
+template <typename DoubleType>
+void BlockCompressedMatrix<DoubleType>::AddEntry(int, int, ComplexDouble_t<DoubleType>)
+{
+  dsAssert(false, "UNEXPECTED");
+}
+
+template <typename DoubleType>
+void BlockCompressedMatrix<DoubleType>::AddImagEntry(int, int, DoubleType)
+{
+  dsAssert(false, "UNEXPECTED");
+}
+
+template <typename DoubleType>
+void BlockCompressedMatrix<DoubleType>::ClearMatrix()
+{
+  std::fill(values_.begin(), values_.end(), static_cast<DoubleType>(0.0));
+  if (hasOutOfPattern_)
+  {
+    for (auto &row : outOfPattern_)
+    {
+      row.clear();
+    }
+    hasOutOfPattern_ = false;
+  }
+}
+
+template <typename DoubleType>
+void BlockCompressedMatrix<DoubleType>::Finalize()
+{
+  if (!hasOutOfPattern_)
+  {
+    return;
+  }
+
+  const size_t k2 = GetBlockSize() * GetBlockSize();
+  const size_t nb = GetNumberBlocks();
+
+  //// the existing blocks keep their values
+  for (size_t i = 0; i < nb; ++i)
+  {
+    auto &row = outOfPattern_[i];
+    for (int j = rowPtr_[i]; j < rowPtr_[i + 1]; ++j)
+    {
+      auto &block = row[colIndex_[j]];
+      if (block.empty())
+      {
+        block.resize(k2);
+      }
+      for (size_t l = 0; l < k2; ++l)
+      {
+        block[l] += values_[j * k2 + l];
+      }
+    }
+  }
+
+  size_t len = 0;
+  for (const auto &row : outOfPattern_)
+  {
+    len += row.size();
+  }
+
+  rowPtr_.assign(nb + 1, 0);
+  colIndex_.clear();
+  colIndex_.reserve(len);
+  values_.clear();
+  values_.reserve(len * k2);
+  for (size_t i = 0; i < nb; ++i)
+  {
+    auto &row = outOfPattern_[i];
+    for (const auto &block : row)
+    {
+      colIndex_.push_back(static_cast<int>(block.first));
+      values_.insert(values_.end(), block.second.begin(), block.second.end());
+    }
+    rowPtr_[i + 1] = static_cast<int>(colIndex_.size());
+    row.clear();
+  }
+
+  hasOutOfPattern_ = false;
+  ++patternVersion_;
+}
+
+template <typename DoubleType>
+void BlockCompressedMatrix<DoubleType>::GatherVector(const DoubleVec_t<DoubleType> &x, DoubleVec_t<DoubleType> &bx) const
+{
+  const size_t k = GetBlockSize();
+  const size_t len = GetNumberBlocks() * k;
+  bx.resize(len);
+  for (size_t i = 0; i < len; ++i)
+  {
+    const size_t eq = layout_.GetEquation(i / k, i % k);
+    bx[i] = (eq == size_t(-1)) ? static_cast<DoubleType>(0.0) : x[eq];
+  }
+}
+
+template <typename DoubleType>
+void BlockCompressedMatrix<DoubleType>::ScatterVector(const DoubleVec_t<DoubleType> &bx, DoubleVec_t<DoubleType> &x) const
+{
+  const size_t k = GetBlockSize();
+  const size_t len = GetNumberBlocks() * k;
+  x.resize(layout_.GetNumberEquations());
+  for (size_t i = 0; i < len; ++i)
+  {
+    const size_t eq = layout_.GetEquation(i / k, i % k);
+    if (eq != size_t(-1))
+    {
+      x[eq] = bx[i];
+    }
+  }
+}
+
+template <typename DoubleType>
+void BlockCompressedMatrix<DoubleType>::Multiply(const DoubleVec_t<DoubleType> &x, DoubleVec_t<DoubleType> &y) const
+{
+  dsAssert(!hasOutOfPattern_, "UNEXPECTED");
+
+  const size_t k  = GetBlockSize();
+  const size_t k2 = k * k;
+  const size_t nb = GetNumberBlocks();
+
+  GatherVector(x, bx_);
+  by_.assign(nb * k, static_cast<DoubleType>(0.0));
+
+  for (size_t i = 0; i < nb; ++i)
+  {
+    DoubleType *yi = &by_[i * k];
+    for (int j = rowPtr_[i]; j < rowPtr_[i + 1]; ++j)
+    {
+      const DoubleType *a  = &values_[j * k2];
+      const DoubleType *xj = &bx_[colIndex_[j] * k];
+      for (size_t r = 0; r < k; ++r)
+      {
+        DoubleType sum = 0.0;
+        for (size_t c = 0; c < k; ++c)
+        {
+          sum += a[r * k + c] * xj[c];
+        }
+        yi[r] += sum;
+      }
+    }
+  }
+
+  ScatterVector(by_, y);
+}
+
+template <typename DoubleType>
+void BlockCompressedMatrix<DoubleType>::TransposeMultiply(const DoubleVec_t<DoubleType> &x, DoubleVec_t<DoubleType> &y) const
+{
+  dsAssert(!hasOutOfPattern_, "UNEXPECTED");
+
+  const size_t k  = GetBlockSize();
+  const size_t k2 = k * k;
+  const size_t nb = GetNumberBlocks();
+
+  GatherVector(x, bx_);
+  by_.assign(nb * k, static_cast<DoubleType>(0.0));
+
+  for (size_t i = 0; i < nb; ++i)
+  {
+    const DoubleType *xi = &bx_[i * k];
+    for (int j = rowPtr_[i]; j < rowPtr_[i + 1]; ++j)
+    {
+      const DoubleType *a  = &values_[j * k2];
+      DoubleType       *yj = &by_[colIndex_[j] * k];
+      for (size_t r = 0; r < k; ++r)
+      {
+        for (size_t c = 0; c < k; ++c)
+        {
+          yj[c] += a[r * k + c] * xi[r];
+        }
+      }
+    }
+  }
+
+  ScatterVector(by_, y);
+}
+
+template <typename DoubleType>
+void BlockCompressedMatrix<DoubleType>::Multiply(const ComplexDoubleVec_t<DoubleType> &, ComplexDoubleVec_t<DoubleType> &) const
+{
+  dsAssert(false, "UNEXPECTED");
+}
+
+template <typename DoubleType>
+void BlockCompressedMatrix<DoubleType>::TransposeMultiply(const ComplexDoubleVec_t<DoubleType> &, ComplexDoubleVec_t<DoubleType> &) const
+{
+  dsAssert(false, "UNEXPECTED");
+}
+
+template <typename DoubleType>
+CompressedMatrix<DoubleType> *BlockCompressedMatrix<DoubleType>::CreateCompressedMatrix(CompressionType ct) const
+{
+  dsAssert(!hasOutOfPattern_, "UNEXPECTED");
+
+  const size_t k  = GetBlockSize();
+  const size_t k2 = k * k;
+  const size_t nb = GetNumberBlocks();
+
+  CompressedMatrix<DoubleType> *ret = new CompressedMatrix<DoubleType>(layout_.GetNumberEquations(), MatrixType::REAL, ct);
+
+  for (size_t i = 0; i < nb; ++i)
+  {
+    for (int j = rowPtr_[i]; j < rowPtr_[i + 1]; ++j)
+    {
+      const DoubleType *a = &values_[j * k2];
+      for (size_t r = 0; r < k; ++r)
+      {
+        const size_t row = layout_.GetEquation(i, r);
+        if (row == size_t(-1))
+        {
+          continue;
+        }
+        for (size_t c = 0; c < k; ++c)
+        {
+          const size_t col = layout_.GetEquation(colIndex_[j], c);
+          //// the zeros inside of a block are not part of the scalar pattern
+          if ((col != size_t(-1)) && ((a[r * k + c] != 0.0) || (row == col)))
+          {
+            ret->AddEntry(row, col, a[r * k + c]);
+          }
+        }
+      }
+    }
+  }
+
+  ret->Finalize();
+  return ret;
+}
+}
+
+template class dsMath::BlockCompressedMatrix<double>;
+#ifdef DEVSIM_EXTENDED_PRECISION
+#include "Float128.hh"
+template class dsMath::BlockCompressedMatrix<float128>;
+#endif
+
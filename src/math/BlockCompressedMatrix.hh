@@ -0,0 +1,150 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#ifndef DS_BLOCK_COMPRESSED_MATRIX_HH
+#define DS_BLOCK_COMPRESSED_MATRIX_HH
+
+#include "Matrix.hh"
+#include "dsMathTypes.hh"
+
+#include <vector>
+#include <map>
+
+namespace dsMath {
+template <typename DoubleType>
+class CompressedMatrix;
+enum class CompressionType;
+
+/// Groups the equations into dense blocks of up to block_size equations
+/// The equations on one node are in one block
+class BlockLayout {
+  public:
+    BlockLayout(size_t /*numeqns*/, size_t /*block_size*/);
+
+    /// The equations are the next block, in the order of their position in the block
+    void AddBlock(const std::vector<size_t> &);
+
+    /// Each equation not in a block gets its own block
+    void Finalize();
+
+    size_t GetNumberEquations() const
+    {
+      return block_.size();
+    }
+
+    size_t GetBlockSize() const
+    {
+      return blockSize_;
+    }
+
+    size_t GetNumberBlocks() const
+    {
+      return equation_.size() / blockSize_;
+    }
+
+    size_t GetBlock(size_t eq) const
+    {
+      return block_[eq];
+    }
+
+    size_t GetOffset(size_t eq) const
+    {
+      return offset_[eq];
+    }
+
+    /// size_t(-1) for the padding of blocks with fewer equations than the block size
+    size_t GetEquation(size_t block, size_t offset) const
+    {
+      return equation_[block * blockSize_ + offset];
+    }
+
+  private:
+    size_t              blockSize_;
+    std::vector<size_t> block_;
+    std::vector<size_t> offset_;
+    std::vector<size_t> equation_;
+};
+
+/// Block compressed row matrix, with a dense block for each pair of coupled blocks
+/// Each block is stored by row, and the block columns of each block row are sorted
+/// Only real matrices are supported
+template <typename DoubleType>
+class BlockCompressedMatrix : public Matrix<DoubleType> {
+    public:
+        explicit BlockCompressedMatrix(const BlockLayout &);
+        ~BlockCompressedMatrix();
+
+        void AddEntry(int, int, DoubleType) override;
+        void AddEntry(int, int, ComplexDouble_t<DoubleType>) override;
+        void AddImagEntry(int, int, DoubleType) override;
+
+        /// The values are zeroed, and the block pattern is kept
+        void ClearMatrix() override;
+
+        /// Blocks added outside of the pattern are merged into a new pattern
+        void Finalize() override;
+
+        void Multiply(const DoubleVec_t<DoubleType> &/*x*/, DoubleVec_t<DoubleType> &/*y*/) const override;
+        void TransposeMultiply(const DoubleVec_t<DoubleType> &/*x*/, DoubleVec_t<DoubleType> &/*y*/) const override;
+        void Multiply(const ComplexDoubleVec_t<DoubleType> &/*x*/, ComplexDoubleVec_t<DoubleType> &/*y*/) const override;
+        void TransposeMultiply(const ComplexDoubleVec_t<DoubleType> &/*x*/, ComplexDoubleVec_t<DoubleType> &/*y*/) const override;
+
+        const BlockLayout &GetLayout() const
+        {
+          return layout_;
+        }
+
+        size_t GetBlockSize() const
+        {
+          return layout_.GetBlockSize();
+        }
+
+        size_t GetNumberBlocks() const
+        {
+          return layout_.GetNumberBlocks();
+        }
+
+        /// The pattern changes when Finalize merges new blocks
+        size_t GetPatternVersion() const
+        {
+          return patternVersion_;
+        }
+
+        const IntVec_t                &GetRowPtr() const {return rowPtr_;}
+        const IntVec_t                &GetColIndex() const {return colIndex_;}
+        const DoubleVec_t<DoubleType> &GetValues() const {return values_;}
+
+        /// Index of the block in the pattern, or -1
+        int FindBlock(size_t /*brow*/, size_t /*bcol*/) const;
+
+        /// Between the equation numbering and the block numbering, where the padding is 0
+        void GatherVector(const DoubleVec_t<DoubleType> &/*x*/, DoubleVec_t<DoubleType> &/*bx*/) const;
+        void ScatterVector(const DoubleVec_t<DoubleType> &/*bx*/, DoubleVec_t<DoubleType> &/*x*/) const;
+
+        /// Scalar copy for the direct solvers
+        CompressedMatrix<DoubleType> *CreateCompressedMatrix(CompressionType) const;
+
+    private:
+        BlockCompressedMatrix();
+        BlockCompressedMatrix(const BlockCompressedMatrix &);
+        BlockCompressedMatrix &operator=(const BlockCompressedMatrix &);
+
+        typedef std::map<size_t, DoubleVec_t<DoubleType>> BlockRow_t;
+
+        BlockLayout             layout_;
+        IntVec_t                rowPtr_;
+        IntVec_t                colIndex_;
+        DoubleVec_t<DoubleType> values_;
+        std::vector<BlockRow_t> outOfPattern_;
+        bool                    hasOutOfPattern_;
+        size_t                  patternVersion_;
+        mutable DoubleVec_t<DoubleType> bx_;
+        mutable DoubleVec_t<DoubleType> by_;
+};
+}
+#endif
+
@@ -0,0 +1,363 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#include "BlockILUPreconditioner.hh"
+#include "BlockCompressedMatrix.hh"
+#include "CompressedMatrix.hh"
+#include "OutputStream.hh"
+#include "dsAssert.hh"
+
+#include <algorithm>
+#include <sstream>
+#include <cmath>
+using std::abs;
+
+namespace dsMath {
+namespace {
+/// Gauss-Jordan elimination with partial pivoting, a is destroyed
+/// A zero pivot is replaced by 1, which is also the case for the padding of the block
+template <typename DoubleType>
+size_t InvertBlock(DoubleType *a, DoubleType *inv, size_t k)
+{
+  size_t zero_pivots = 0;
+  for (size_t i = 0; i < k; ++i)
+  {
+    for (size_t j = 0; j < k; ++j)
+    {
+      inv[i * k + j] = (i == j) ? 1.0 : 0.0;
+    }
+  }
+
+  for (size_t c = 0; c < k; ++c)
+  {
+    size_t p = c;
+    for (size_t r = c + 1; r < k; ++r)
+    {
+      if (abs(a[r * k + c]) > abs(a[p * k + c]))
+      {
+        p = r;
+      }
+    }
+
+    if (p != c)
+    {
+      for (size_t j = 0; j < k; ++j)
+      {
+        std::swap(a[p * k + j], a[c * k + j]);
+        std::swap(inv[p * k + j], inv[c * k + j]);
+      }
+    }
+
+    if (a[c * k + c] == 0.0)
+    {
+      a[c * k + c] = 1.0;
+      ++zero_pivots;
+    }
+
+    const DoubleType d = 1.0 / a[c * k + c];
+    for (size_t j = 0; j < k; ++j)
+    {
+      a[c * k + j]   *= d;
+      inv[c * k + j] *= d;
+    }
+
+    for (size_t r = 0; r < k; ++r)
+    {
+      const DoubleType f = a[r * k + c];
+      if ((r == c) || (f == 0.0))
+      {
+        continue;
+      }
+      for (size_t j = 0; j < k; ++j)
+      {
+        a[r * k + j]   -= f * a[c * k + j];
+        inv[r * k + j] -= f * inv[c * k + j];
+      }
+    }
+  }
+  return zero_pivots;
+}
+
+/// c = a * b
+template <typename DoubleType>
+void MultiplyBlock(const DoubleType *a, const DoubleType *b, DoubleType *c, size_t k)
+{
+  for (size_t i = 0; i < k; ++i)
+  {
+    for (size_t j = 0; j < k; ++j)
+    {
+      DoubleType sum = 0.0;
+      for (size_t l = 0; l < k; ++l)
+      {
+        sum += a[i * k + l] * b[l * k + j];
+      }
+      c[i * k + j] = sum;
+    }
+  }
+}
+
+/// y -= a * x
+template <typename DoubleType>
+void SubtractBlockVector(const DoubleType *a, const DoubleType *x, DoubleType *y, size_t k)
+{
+  for (size_t i = 0; i < k; ++i)
+  {
+    DoubleType sum = 0.0;
+    for (size_t j = 0; j < k; ++j)
+    {
+      sum += a[i * k + j] * x[j];
+    }
+    y[i] -= sum;
+  }
+}
+
+/// y = a * x
+template <typename DoubleType>
+void MultiplyBlockVector(const DoubleType *a, const DoubleType *x, DoubleType *y, size_t k)
+{
+  for (size_t i = 0; i < k; ++i)
+  {
+    DoubleType sum = 0.0;
+    for (size_t j = 0; j < k; ++j)
+    {
+      sum += a[i * k + j] * x[j];
+    }
+    y[i] = sum;
+  }
+}
+}
+
+template <typename DoubleType>
+dsMath::CompressionType BlockILUPreconditioner<DoubleType>::GetRealMatrixCompressionType() const
+{
+  return dsMath::CompressionType::CRM;
+}
+
+template <typename DoubleType>
+dsMath::CompressionType BlockILUPreconditioner<DoubleType>::GetComplexMatrixCompressionType() const
+{
+  return dsMath::CompressionType::CRM;
+}
+
+template <typename DoubleType>
+BlockILUPreconditioner<DoubleType>::~BlockILUPreconditioner()
+{
+}
+
+template <typename DoubleType>
+BlockILUPreconditioner<DoubleType>::BlockILUPreconditioner(size_t numeqns, PEnum::TransposeType_t transpose, BlockILUType type) : Preconditioner<DoubleType>(numeqns, transpose), type_(type), matrix_(nullptr), zeroPivots_(0)
+{
+  dsAssert(transpose == PEnum::TransposeType_t::NOTRANS, "UNEXPECTED");
+}
+
+template <typename DoubleType>
+void BlockILUPreconditioner<DoubleType>::FactorJacobi()
+{
+  const size_t k  = matrix_->GetBlockSize();
+  const size_t k2 = k * k;
+  const size_t nb = matrix_->GetNumberBlocks();
+  const DoubleVec_t<DoubleType> &values = matrix_->GetValues();
+
+  DoubleVec_t<DoubleType> block(k2);
+  for (size_t i = 0; i < nb; ++i)
+  {
+    if (diagIndex_[i] < 0)
+    {
+      std::fill(block.begin(), block.end(), static_cast<DoubleType>(0.0));
+    }
+    else
+    {
+      std::copy(&values[diagIndex_[i] * k2], &values[diagIndex_[i] * k2] + k2, block.begin());
+    }
+    zeroPivots_ += InvertBlock(block.data(), &diagInverse_[i * k2], k);
+  }
+}
+
+/// The blocks left of the diagonal are replaced by L, and the others by U
+/// The update of a block is skipped when it is not in the pattern
+template <typename DoubleType>
+void BlockILUPreconditioner<DoubleType>::FactorILU0()
+{
+  const size_t k  = matrix_->GetBlockSize();
+  const size_t k2 = k * k;
+  const size_t nb = matrix_->GetNumberBlocks();
+  const IntVec_t &rowPtr   = matrix_->GetRowPtr();
+  const IntVec_t &colIndex = matrix_->GetColIndex();
+
+  factor_ = matrix_->GetValues();
+
+  //// position of each block column in the current block row
+  std::vector<int> position(nb, -1);
+  DoubleVec_t<DoubleType> lik(k2);
+  DoubleVec_t<DoubleType> update(k2);
+  DoubleVec_t<DoubleType> block(k2);
+
+  for (size_t i = 0; i < nb; ++i)
+  {
+    for (int j = rowPtr[i]; j < rowPtr[i + 1]; ++j)
+    {
+      position[colIndex[j]] = j;
+    }
+
+    for (int j = rowPtr[i]; (j < rowPtr[i + 1]) && (static_cast<size_t>(colIndex[j]) < i); ++j)
+    {
+      const size_t kb = colIndex[j];
+      MultiplyBlock(&factor_[j * k2], &diagInverse_[kb * k2], lik.data(), k);
+      std::copy(lik.begin(), lik.end(), &factor_[j * k2]);
+
+      if (diagIndex_[kb] < 0)
+      {
+        continue;
+      }
+
+      for (int l = diagIndex_[kb] + 1; l < rowPtr[kb + 1]; ++l)
+      {
+        const int p = position[colIndex[l]];
+        if (p < 0)
+        {
+          continue;
+        }
+        MultiplyBlock(lik.data(), &factor_[l * k2], update.data(), k);
+        for (size_t m = 0; m < k2; ++m)
+        {
+          factor_[p * k2 + m] -= update[m];
+        }
+      }
+    }
+
+    if (diagIndex_[i] < 0)
+    {
+      std::fill(block.begin(), block.end(), static_cast<DoubleType>(0.0));
+    }
+    else
+    {
+      std::copy(&factor_[diagIndex_[i] * k2], &factor_[diagIndex_[i] * k2] + k2, block.begin());
+    }
+    zeroPivots_ += InvertBlock(block.data(), &diagInverse_[i * k2], k);
+
+    for (int j = rowPtr[i]; j < rowPtr[i + 1]; ++j)
+    {
+      position[colIndex[j]] = -1;
+    }
+  }
+}
+
+template <typename DoubleType>
+bool BlockILUPreconditioner<DoubleType>::DerivedLUFactor(Matrix<DoubleType> *m)
+{
+  matrix_ = dynamic_cast<BlockCompressedMatrix<DoubleType> *>(m);
+  if (!matrix_)
+  {
+    dsAssert(matrix_ != nullptr, "UNEXPECTED");
+    return false;
+  }
+
+  const size_t k  = matrix_->GetBlockSize();
+  const size_t nb = matrix_->GetNumberBlocks();
+
+  diagIndex_.resize(nb);
+  for (size_t i = 0; i < nb; ++i)
+  {
+    diagIndex_[i] = matrix_->FindBlock(i, i);
+  }
+
+  diagInverse_.resize(nb * k * k);
+  zeroPivots_ = 0;
+
+  if (type_ == BlockILUType::JACOBI)
+  {
+    factor_.clear();
+    FactorJacobi();
+  }
+  else
+  {
+    FactorILU0();
+  }
+
+  //// the padding of the blocks is not counted
+  size_t padding = 0;
+  const BlockLayout &layout = matrix_->GetLayout();
+  for (size_t i = 0; i < nb; ++i)
+  {
+    for (size_t j = 0; j < k; ++j)
+    {
+      padding += (layout.GetEquation(i, j) == size_t(-1)) ? 1 : 0;
+    }
+  }
+
+  if (zeroPivots_ > padding)
+  {
+    std::ostringstream os;
+    os << "Block preconditioner replaced " << (zeroPivots_ - padding) << " zero pivots\n";
+    OutputStream::WriteOut(OutputStream::OutputType::VERBOSE1, os.str());
+  }
+
+  return true;
+}
+
+template <typename DoubleType>
+bool BlockILUPreconditioner<DoubleType>::DerivedLUSolve(DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const
+{
+  const size_t k  = matrix_->GetBlockSize();
+  const size_t k2 = k * k;
+  const size_t nb = matrix_->GetNumberBlocks();
+
+  matrix_->GatherVector(b, bx_);
+  by_.resize(bx_.size());
+
+  if (type_ == BlockILUType::JACOBI)
+  {
+    for (size_t i = 0; i < nb; ++i)
+    {
+      MultiplyBlockVector(&diagInverse_[i * k2], &bx_[i * k], &by_[i * k], k);
+    }
+  }
+  else
+  {
+    const IntVec_t &rowPtr   = matrix_->GetRowPtr();
+    const IntVec_t &colIndex = matrix_->GetColIndex();
+
+    //// L has identity blocks on the diagonal
+    for (size_t i = 0; i < nb; ++i)
+    {
+      DoubleType *yi = &bx_[i * k];
+      for (int j = rowPtr[i]; (j < rowPtr[i + 1]) && (static_cast<size_t>(colIndex[j]) < i); ++j)
+      {
+        SubtractBlockVector(&factor_[j * k2], &bx_[colIndex[j] * k], yi, k);
+      }
+    }
+
+    for (size_t ii = nb; ii > 0; --ii)
+    {
+      const size_t i = ii - 1;
+      DoubleType *yi = &bx_[i * k];
+      for (int j = rowPtr[i + 1] - 1; (j >= rowPtr[i]) && (static_cast<size_t>(colIndex[j]) > i); --j)
+      {
+        SubtractBlockVector(&factor_[j * k2], &by_[colIndex[j] * k], yi, k);
+      }
+      MultiplyBlockVector(&diagInverse_[i * k2], yi, &by_[i * k], k);
+    }
+  }
+
+  matrix_->ScatterVector(by_, x);
+  return true;
+}
+
+template <typename DoubleType>
+bool BlockILUPreconditioner<DoubleType>::DerivedLUSolve(ComplexDoubleVec_t<DoubleType> &, const ComplexDoubleVec_t<DoubleType> &) const
+{
+  dsAssert(false, "UNEXPECTED");
+  return false;
+}
+}
+
+template class dsMath::BlockILUPreconditioner<double>;
+#ifdef DEVSIM_EXTENDED_PRECISION
+#include "Float128.hh"
+template class dsMath::BlockILUPreconditioner<float128>;
+#endif
+
@@ -0,0 +1,59 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#ifndef BLOCK_ILU_PRECONDITIONER_HH
+#define BLOCK_ILU_PRECONDITIONER_HH
+#include "Preconditioner.hh"
+#include <vector>
+
+namespace dsMath {
+template <typename DoubleType>
+class BlockCompressedMatrix;
+
+enum class BlockILUType {JACOBI, ILU0};
+
+/// Preconditioners on the dense blocks of a BlockCompressedMatrix
+/// JACOBI inverts the diagonal blocks
+/// ILU0 is the incomplete block factorization without fill outside of the block pattern
+template <typename DoubleType>
+class BlockILUPreconditioner : public Preconditioner<DoubleType> {
+  public:
+    virtual ~BlockILUPreconditioner();
+
+    BlockILUPreconditioner(size_t /*numeqns*/, PEnum::TransposeType_t /*tranpose*/, BlockILUType);
+    dsMath::CompressionType GetRealMatrixCompressionType() const override;
+    dsMath::CompressionType GetComplexMatrixCompressionType() const override;
+
+    bool UsesBlockMatrix() const override
+    {
+      return true;
+    }
+
+  protected:
+    bool DerivedLUSolve(DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const override;
+    bool DerivedLUSolve(ComplexDoubleVec_t<DoubleType> &x, const ComplexDoubleVec_t<DoubleType> &b) const override;
+    bool DerivedLUFactor(Matrix<DoubleType> *) override;     // Factor the matrix
+
+  private:
+    void FactorJacobi();
+    void FactorILU0();
+
+    BlockILUType type_;
+    const BlockCompressedMatrix<DoubleType> *matrix_;
+    //// the factors share the block pattern of the matrix
+    DoubleVec_t<DoubleType> factor_;
+    //// inverse of each diagonal block of the factor
+    DoubleVec_t<DoubleType> diagInverse_;
+    //// index of each diagonal block in the pattern
+    std::vector<int>        diagIndex_;
+    size_t                  zeroPivots_;
+    mutable DoubleVec_t<DoubleType> bx_;
+    mutable DoubleVec_t<DoubleType> by_;
+};
+}
+#endif
+
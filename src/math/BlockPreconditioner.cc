@@ -10,6 +10,7 @@ SPDX-License-Identifier: Apache-2.0
 #include "dsAssert.hh"
 #include "Matrix.hh"
 #include "CompressedMatrix.hh"
+#include "BlockCompressedMatrix.hh"
 #include "GlobalData.hh"
 #include "Device.hh"
 #include "Region.hh"
@@ -19,6 +20,7 @@ SPDX-License-Identifier: Apache-2.0
 #include <algorithm>
 #include <sstream>
 #include <map>
+#include <memory>
 
 #include <cmath>
 using std::abs;
@@ -284,6 +286,15 @@ template <typename DoubleType>
 bool BlockPreconditioner<DoubleType>::DerivedLUFactor(Matrix<DoubleType> *m)
 {
   CompressedMatrix<DoubleType> *cm = dynamic_cast<CompressedMatrix<DoubleType> *>(m);
+
+  //// the direct solvers only take the scalar format
+  std::unique_ptr<CompressedMatrix<DoubleType>> scalar;
+  if (auto bm = dynamic_cast<BlockCompressedMatrix<DoubleType> *>(m); bm)
+  {
+    scalar = std::unique_ptr<CompressedMatrix<DoubleType>>(bm->CreateCompressedMatrix(CompressionType::CCM));
+    cm = scalar.get();
+  }
+
   if (!cm)
   {
     dsAssert(cm != nullptr, "UNEXPECTED");
@@ -312,15 +323,15 @@ bool BlockPreconditioner<DoubleType>::DerivedLUFactor(Matrix<DoubleType> *m)
 }
 
 template <typename DoubleType>
-void BlockPreconditioner<DoubleType>::DerivedLUSolve(DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const
+bool BlockPreconditioner<DoubleType>::DerivedLUSolve(DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const
 {
-  block_preconditioner_->LUSolve(x, b);
+  return block_preconditioner_->LUSolve(x, b);
 }
 
 template <typename DoubleType>
-void BlockPreconditioner<DoubleType>::DerivedLUSolve(ComplexDoubleVec_t<DoubleType> &x, const ComplexDoubleVec_t<DoubleType> &b) const
+bool BlockPreconditioner<DoubleType>::DerivedLUSolve(ComplexDoubleVec_t<DoubleType> &x, const ComplexDoubleVec_t<DoubleType> &b) const
 {
-  block_preconditioner_->LUSolve(x, b);
+  return block_preconditioner_->LUSolve(x, b);
 }
 }
 
@@ -67,8 +67,8 @@ class BlockPreconditioner : public Preconditioner<DoubleType> {
     dsMath::CompressionType GetComplexMatrixCompressionType() const override;
 
   protected:
-    void DerivedLUSolve(DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const override;
-    void DerivedLUSolve(ComplexDoubleVec_t<DoubleType> &x, const ComplexDoubleVec_t<DoubleType> &b) const override;
+    bool DerivedLUSolve(DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const override;
+    bool DerivedLUSolve(ComplexDoubleVec_t<DoubleType> &x, const ComplexDoubleVec_t<DoubleType> &b) const override;
     bool DerivedLUFactor(Matrix<DoubleType> *) override;     // Factor the matrix
 
   private:
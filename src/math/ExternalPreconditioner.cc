@@ -240,7 +240,7 @@ bool ExternalPreconditioner<DoubleType>::DerivedLUFactor(Matrix<DoubleType> *m)
 }
 
 template <typename DoubleType>
-void ExternalPreconditioner<DoubleType>::DerivedLUSolve(DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const
+bool ExternalPreconditioner<DoubleType>::DerivedLUSolve(DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const
 {
   dsAssert(command_handle_.IsCallable(), "python solver command is not callable\n");
   dsAssert(!command_data_.empty(), "python solver invalid data\n");
@@ -296,10 +296,11 @@ void ExternalPreconditioner<DoubleType>::DerivedLUSolve(DoubleVec_t<DoubleType>
       dsAssert(ret && (x.size() == b.size()), "Mismatch in returned x");
     }
   }
+  return true;
 }
 
 template <typename DoubleType>
-void ExternalPreconditioner<DoubleType>::DerivedLUSolve(ComplexDoubleVec_t<DoubleType> &x, const ComplexDoubleVec_t<DoubleType> &b) const
+bool ExternalPreconditioner<DoubleType>::DerivedLUSolve(ComplexDoubleVec_t<DoubleType> &x, const ComplexDoubleVec_t<DoubleType> &b) const
 {
   dsAssert(command_handle_.IsCallable(), "python solver command is not callable\n");
   dsAssert(!command_data_.empty(), "python solver invalid data\n");
@@ -358,6 +359,7 @@ void ExternalPreconditioner<DoubleType>::DerivedLUSolve(ComplexDoubleVec_t<Doubl
       dsAssert(ret && (x.size() == b.size()), "Mismatch in returned x");
     }
   }
+  return true;
 }
 }
 
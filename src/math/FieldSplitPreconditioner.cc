@@ -0,0 +1,449 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#include "FieldSplitPreconditioner.hh"
+#include "BlockILUPreconditioner.hh"
+#include "BlockCompressedMatrix.hh"
+#include "AMGPreconditioner.hh"
+#include "CompressedMatrix.hh"
+#include "SolverUtil.hh"
+#include "GlobalData.hh"
+#include "ObjectHolder.hh"
+#include "Device.hh"
+#include "Region.hh"
+#include "EquationHolder.hh"
+#include "OutputStream.hh"
+#include "dsAssert.hh"
+
+#include <algorithm>
+#include <sstream>
+#include <utility>
+#include <map>
+
+namespace dsMath {
+template <typename DoubleType>
+dsMath::CompressionType FieldSplitPreconditioner<DoubleType>::GetRealMatrixCompressionType() const
+{
+  return dsMath::CompressionType::CRM;
+}
+
+template <typename DoubleType>
+dsMath::CompressionType FieldSplitPreconditioner<DoubleType>::GetComplexMatrixCompressionType() const
+{
+  return dsMath::CompressionType::CRM;
+}
+
+template <typename DoubleType>
+FieldSplitPreconditioner<DoubleType>::~FieldSplitPreconditioner()
+{
+}
+
+template <typename DoubleType>
+FieldSplitPreconditioner<DoubleType>::FieldSplitPreconditioner(size_t numeqns, PEnum::TransposeType_t transpose, FieldSplitType type) : Preconditioner<DoubleType>(numeqns, transpose), type_(type), matrix_(nullptr)
+{
+  dsAssert(transpose == PEnum::TransposeType_t::NOTRANS, "UNEXPECTED");
+}
+
+template <typename DoubleType>
+void FieldSplitPreconditioner<DoubleType>::SetEquationOrder(const std::vector<size_t> &order)
+{
+  equationOrder_ = order;
+  fields_.clear();
+}
+
+/// The fields are in the order their variables are first found, and the circuit is last
+template <typename DoubleType>
+void FieldSplitPreconditioner<DoubleType>::CreateFields()
+{
+  const size_t numeqns = Preconditioner<DoubleType>::size();
+
+  fields_.clear();
+  fieldOfRow_.assign(numeqns, size_t(-1));
+
+  std::map<std::string, size_t> fieldIndex;
+  std::vector<std::string>      fieldNames;
+
+  GlobalData &gdata = GlobalData::GetInstance();
+  for (auto dit : gdata.GetDeviceList())
+  {
+    for (auto rit : dit.second->GetRegionList())
+    {
+      const Region &region = *(rit.second);
+      if ((region.GetNumberEquations() == 0) || (region.GetBaseEquationNumber() == size_t(-1)))
+      {
+        continue;
+      }
+
+      std::vector<std::pair<size_t, std::string>> variables;
+      for (const auto &eit : region.GetEquationPtrList())
+      {
+        variables.push_back(std::make_pair(region.GetEquationIndex(eit.first), eit.second.GetVariable()));
+      }
+      std::sort(variables.begin(), variables.end());
+
+      for (const auto &v : variables)
+      {
+        if (!fieldIndex.count(v.second))
+        {
+          fieldIndex[v.second] = fieldNames.size();
+          fieldNames.push_back(v.second);
+        }
+        const size_t f = fieldIndex[v.second];
+
+        for (auto np : region.GetNodeList())
+        {
+          const size_t eq = region.GetEquationNumber(v.first, np);
+          const size_t row = (equationOrder_.empty()) ? eq : equationOrder_[eq];
+          if (row < numeqns)
+          {
+            fieldOfRow_[row] = f;
+          }
+        }
+      }
+    }
+  }
+
+  const size_t circuit = fieldNames.size();
+  fieldNames.push_back("circuit");
+  for (auto &f : fieldOfRow_)
+  {
+    if (f == size_t(-1))
+    {
+      f = circuit;
+    }
+  }
+
+  if (type_ == FieldSplitType::SCHUR)
+  {
+    //// the selected field, and all of the others
+    std::string name = "Potential";
+    auto dbent = gdata.GetDBEntryOnGlobal("field_split_schur_field");
+    if (dbent.first)
+    {
+      name = dbent.second.GetString();
+    }
+
+    size_t first = 0;
+    if (fieldIndex.count(name))
+    {
+      first = fieldIndex[name];
+    }
+    else
+    {
+      std::ostringstream os;
+      os << "\"field_split_schur_field\" \"" << name << "\" is not a solution variable, using \"" << fieldNames[0] << "\".\n";
+      OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
+    }
+
+    for (auto &f : fieldOfRow_)
+    {
+      f = (f == first) ? 0 : 1;
+    }
+    fieldNames = {fieldNames[first], "schur"};
+  }
+
+  fields_.resize(fieldNames.size());
+  for (size_t i = 0; i < fields_.size(); ++i)
+  {
+    fields_[i].name = fieldNames[i];
+  }
+
+  localRow_.resize(numeqns);
+  for (size_t i = 0; i < numeqns; ++i)
+  {
+    Field &field = fields_[fieldOfRow_[i]];
+    localRow_[i] = field.rows.size();
+    field.rows.push_back(i);
+  }
+
+  for (auto &field : fields_)
+  {
+    if (!field.rows.empty())
+    {
+      CreateFieldSolver(field);
+    }
+  }
+}
+
+template <typename DoubleType>
+void FieldSplitPreconditioner<DoubleType>::CreateFieldSolver(Field &field)
+{
+  GlobalData &gdata = GlobalData::GetInstance();
+
+  std::string solver = "direct";
+  if (auto dbent = gdata.GetDBEntryOnGlobal("field_split_solver_" + field.name); dbent.first)
+  {
+    solver = dbent.second.GetString();
+  }
+  else if (auto dbent = gdata.GetDBEntryOnGlobal("field_split_solver"); dbent.first)
+  {
+    solver = dbent.second.GetString();
+  }
+
+  const size_t len = field.rows.size();
+  if (solver == "ilu")
+  {
+    field.solver = std::unique_ptr<Preconditioner<DoubleType>>(new BlockILUPreconditioner<DoubleType>(len, PEnum::TransposeType_t::NOTRANS, BlockILUType::ILU0));
+  }
+  else if (solver == "amg")
+  {
+    field.solver = std::unique_ptr<Preconditioner<DoubleType>>(new AMGPreconditioner<DoubleType>(len, PEnum::TransposeType_t::NOTRANS));
+  }
+  else
+  {
+    if (solver != "direct")
+    {
+      std::ostringstream os;
+      os << "Field split solver \"" << solver << "\" for \"" << field.name << "\" is not \"direct\", \"ilu\", or \"amg\", using \"direct\".\n";
+      OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
+    }
+    field.solver = std::unique_ptr<Preconditioner<DoubleType>>(CreateDirectPreconditioner<DoubleType>(len));
+  }
+
+  std::ostringstream os;
+  os << "Field split \"" << field.name << "\" equations " << len << " solver \"" << solver << "\"\n";
+  OutputStream::WriteOut(OutputStream::OutputType::VERBOSE1, os.str());
+}
+
+/// The schur complement is A22 - A21 inv(D11) A12
+template <typename DoubleType>
+bool FieldSplitPreconditioner<DoubleType>::FactorField(Field &field, bool schur)
+{
+  const size_t len = field.rows.size();
+  if (field.solver->UsesBlockMatrix())
+  {
+    BlockLayout layout(len, 1);
+    layout.Finalize();
+    field.matrix = std::unique_ptr<Matrix<DoubleType>>(new BlockCompressedMatrix<DoubleType>(layout));
+  }
+  else
+  {
+    field.matrix = std::unique_ptr<Matrix<DoubleType>>(CreateMatrix(field.solver.get()));
+  }
+
+  const IntVec_t &Ap = matrix_->GetRows();
+  const IntVec_t &Ai = matrix_->GetCols();
+  const DoubleVec_t<DoubleType> &Ax = matrix_->GetReal();
+
+  const size_t f = fieldOfRow_[field.rows[0]];
+  Matrix<DoubleType> &m = *field.matrix;
+  for (size_t i = 0; i < len; ++i)
+  {
+    const size_t r = field.rows[i];
+    m.AddEntry(i, i, 0.0);
+    for (int j = Ap[r]; j < Ap[r + 1]; ++j)
+    {
+      const size_t c = Ai[j];
+      if (fieldOfRow_[c] == f)
+      {
+        m.AddEntry(i, localRow_[c], Ax[j]);
+      }
+      else if (schur)
+      {
+        const DoubleType s = Ax[j] * schurDiagInverse_[localRow_[c]];
+        if (s == 0.0)
+        {
+          continue;
+        }
+        for (int k = Ap[c]; k < Ap[c + 1]; ++k)
+        {
+          const size_t cc = Ai[k];
+          if (fieldOfRow_[cc] == f)
+          {
+            m.AddEntry(i, localRow_[cc], -s * Ax[k]);
+          }
+        }
+      }
+    }
+  }
+  m.Finalize();
+
+  field.b.resize(len);
+  field.x.resize(len);
+
+  return field.solver->LUFactor(field.matrix.get());
+}
+
+template <typename DoubleType>
+bool FieldSplitPreconditioner<DoubleType>::DerivedLUFactor(Matrix<DoubleType> *m)
+{
+  matrix_ = dynamic_cast<CompressedMatrix<DoubleType> *>(m);
+  if (!matrix_)
+  {
+    dsAssert(matrix_ != nullptr, "UNEXPECTED");
+    return false;
+  }
+  dsAssert(matrix_->GetCompressionType() == CompressionType::CRM, "UNEXPECTED");
+  dsAssert(matrix_->GetMatrixType() == MatrixType::REAL, "UNEXPECTED");
+
+  if (fields_.empty())
+  {
+    CreateFields();
+  }
+
+  if (type_ == FieldSplitType::SCHUR)
+  {
+    const Field &first = fields_[0];
+    const IntVec_t &Ap = matrix_->GetRows();
+    const IntVec_t &Ai = matrix_->GetCols();
+    const DoubleVec_t<DoubleType> &Ax = matrix_->GetReal();
+    schurDiagInverse_.assign(first.rows.size(), 0.0);
+    for (size_t i = 0; i < first.rows.size(); ++i)
+    {
+      const size_t r = first.rows[i];
+      DoubleType d = 0.0;
+      for (int j = Ap[r]; j < Ap[r + 1]; ++j)
+      {
+        if (static_cast<size_t>(Ai[j]) == r)
+        {
+          d += Ax[j];
+        }
+      }
+      schurDiagInverse_[i] = (d != 0.0) ? (1.0 / d) : 0.0;
+    }
+  }
+
+  bool ret = true;
+  for (size_t i = 0; ret && (i < fields_.size()); ++i)
+  {
+    if (!fields_[i].rows.empty())
+    {
+      ret = FactorField(fields_[i], (type_ == FieldSplitType::SCHUR) && (i == 1));
+    }
+  }
+  return ret;
+}
+
+template <typename DoubleType>
+void FieldSplitPreconditioner<DoubleType>::FieldResidual(const Field &field, const DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const
+{
+  const IntVec_t &Ap = matrix_->GetRows();
+  const IntVec_t &Ai = matrix_->GetCols();
+  const DoubleVec_t<DoubleType> &Ax = matrix_->GetReal();
+
+  for (size_t i = 0; i < field.rows.size(); ++i)
+  {
+    const size_t r = field.rows[i];
+    DoubleType sum = b[r];
+    for (int j = Ap[r]; j < Ap[r + 1]; ++j)
+    {
+      sum -= Ax[j] * x[Ai[j]];
+    }
+    field.b[i] = sum;
+  }
+}
+
+template <typename DoubleType>
+bool FieldSplitPreconditioner<DoubleType>::SolveField(const Field &field) const
+{
+  return field.solver->LUSolve(field.x, field.b);
+}
+
+template <typename DoubleType>
+bool FieldSplitPreconditioner<DoubleType>::DerivedLUSolve(DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const
+{
+  x.assign(b.size(), 0.0);
+
+  bool ret = true;
+
+  if (type_ == FieldSplitType::SCHUR)
+  {
+    const Field &first = fields_[0];
+    const Field &rest  = fields_[1];
+
+    //// y1 = inv(A11) b1
+    if (!first.rows.empty())
+    {
+      FieldResidual(first, x, b);
+      ret = SolveField(first) && ret;
+      for (size_t i = 0; i < first.rows.size(); ++i)
+      {
+        x[first.rows[i]] = first.x[i];
+      }
+    }
+
+    if (rest.rows.empty())
+    {
+      return ret;
+    }
+
+    //// x2 = inv(S) (b2 - A21 y1)
+    FieldResidual(rest, x, b);
+    ret = SolveField(rest) && ret;
+
+    if (first.rows.empty())
+    {
+      for (size_t i = 0; i < rest.rows.size(); ++i)
+      {
+        x[rest.rows[i]] = rest.x[i];
+      }
+      return ret;
+    }
+
+    //// x1 = y1 - inv(A11) A12 x2
+    work_.assign(b.size(), 0.0);
+    for (size_t i = 0; i < rest.rows.size(); ++i)
+    {
+      work_[rest.rows[i]] = rest.x[i];
+    }
+    const DoubleVec_t<DoubleType> zero(b.size(), 0.0);
+    FieldResidual(first, work_, zero);
+    ret = SolveField(first) && ret;
+    for (size_t i = 0; i < first.rows.size(); ++i)
+    {
+      x[first.rows[i]] += first.x[i];
+    }
+    for (size_t i = 0; i < rest.rows.size(); ++i)
+    {
+      x[rest.rows[i]] = rest.x[i];
+    }
+    return ret;
+  }
+
+  //// the additive update is from the residual of the zero vector
+  for (const auto &field : fields_)
+  {
+    if (field.rows.empty())
+    {
+      continue;
+    }
+
+    if (type_ == FieldSplitType::MULTIPLICATIVE)
+    {
+      FieldResidual(field, x, b);
+    }
+    else
+    {
+      for (size_t i = 0; i < field.rows.size(); ++i)
+      {
+        field.b[i] = b[field.rows[i]];
+      }
+    }
+    ret = SolveField(field) && ret;
+
+    for (size_t i = 0; i < field.rows.size(); ++i)
+    {
+      x[field.rows[i]] = field.x[i];
+    }
+  }
+  return ret;
+}
+
+template <typename DoubleType>
+bool FieldSplitPreconditioner<DoubleType>::DerivedLUSolve(ComplexDoubleVec_t<DoubleType> &, const ComplexDoubleVec_t<DoubleType> &) const
+{
+  dsAssert(false, "UNEXPECTED");
+  return false;
+}
+}
+
+template class dsMath::FieldSplitPreconditioner<double>;
+#ifdef DEVSIM_EXTENDED_PRECISION
+#include "Float128.hh"
+template class dsMath::FieldSplitPreconditioner<float128>;
+#endif
+
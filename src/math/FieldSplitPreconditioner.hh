@@ -0,0 +1,73 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#ifndef FIELD_SPLIT_PRECONDITIONER_HH
+#define FIELD_SPLIT_PRECONDITIONER_HH
+#include "Preconditioner.hh"
+#include <vector>
+#include <string>
+#include <memory>
+
+namespace dsMath {
+template <typename DoubleType>
+class CompressedMatrix;
+
+/// ADDITIVE solves each field independently
+/// MULTIPLICATIVE solves the fields in order, with the residual updated from the fields already solved
+/// SCHUR eliminates the first field from the others, where the schur complement uses the diagonal of the first field
+enum class FieldSplitType {ADDITIVE, MULTIPLICATIVE, SCHUR};
+
+/// The rows are grouped by the solution variable of their equation over all of the regions
+/// The equations which are not on a region, such as the circuit, are one more field
+template <typename DoubleType>
+class FieldSplitPreconditioner : public Preconditioner<DoubleType> {
+  public:
+    virtual ~FieldSplitPreconditioner();
+
+    FieldSplitPreconditioner(size_t /*numeqns*/, PEnum::TransposeType_t /*tranpose*/, FieldSplitType);
+    dsMath::CompressionType GetRealMatrixCompressionType() const override;
+    dsMath::CompressionType GetComplexMatrixCompressionType() const override;
+
+    void SetEquationOrder(const std::vector<size_t> &) override;
+
+  protected:
+    bool DerivedLUSolve(DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const override;
+    bool DerivedLUSolve(ComplexDoubleVec_t<DoubleType> &x, const ComplexDoubleVec_t<DoubleType> &b) const override;
+    bool DerivedLUFactor(Matrix<DoubleType> *) override;     // Factor the matrix
+
+  private:
+    struct Field {
+      std::string                                 name;
+      //// matrix rows, in increasing order
+      std::vector<size_t>                         rows;
+      std::unique_ptr<Preconditioner<DoubleType>> solver;
+      std::unique_ptr<Matrix<DoubleType>>         matrix;
+      mutable DoubleVec_t<DoubleType>             b;
+      mutable DoubleVec_t<DoubleType>             x;
+    };
+
+    void CreateFields();
+    /// The field solver is from the "field_split_solver_<name>", or "field_split_solver" parameter
+    void CreateFieldSolver(Field &);
+    bool FactorField(Field &, bool /*schur*/);
+    bool SolveField(const Field &) const;
+    /// r = b - A x for the rows of the field
+    void FieldResidual(const Field &, const DoubleVec_t<DoubleType> &/*x*/, const DoubleVec_t<DoubleType> &/*b*/) const;
+
+    FieldSplitType                  type_;
+    std::vector<Field>              fields_;
+    std::vector<size_t>             fieldOfRow_;
+    std::vector<size_t>             localRow_;
+    std::vector<size_t>             equationOrder_;
+    const CompressedMatrix<DoubleType> *matrix_;
+    //// inverse of the diagonal of the first field for the schur complement
+    DoubleVec_t<DoubleType>         schurDiagInverse_;
+    mutable DoubleVec_t<DoubleType> work_;
+};
+}
+#endif
+
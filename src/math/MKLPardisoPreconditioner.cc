@@ -414,15 +414,17 @@ bool MKLPardisoPreconditioner<DoubleType>::DerivedLUFactor(Matrix<DoubleType> *m
 }
 
 template <typename DoubleType>
-void MKLPardisoPreconditioner<DoubleType>::DerivedLUSolve(DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const
+bool MKLPardisoPreconditioner<DoubleType>::DerivedLUSolve(DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const
 {
   mklpardisodata_->LUSolve(x, b);
+  return true;
 }
 
 template <typename DoubleType>
-void MKLPardisoPreconditioner<DoubleType>::DerivedLUSolve(ComplexDoubleVec_t<DoubleType> &x, const ComplexDoubleVec_t<DoubleType> &b) const
+bool MKLPardisoPreconditioner<DoubleType>::DerivedLUSolve(ComplexDoubleVec_t<DoubleType> &x, const ComplexDoubleVec_t<DoubleType> &b) const
 {
   mklpardisodata_->LUSolve(x, b);
+  return true;
 }
 }
 
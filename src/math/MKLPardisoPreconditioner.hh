@@ -24,8 +24,8 @@ class MKLPardisoPreconditioner : public Preconditioner<DoubleType>
 
     protected:
         bool DerivedLUFactor(Matrix<DoubleType> *) override;
-        void DerivedLUSolve(DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const override;
-        void DerivedLUSolve(ComplexDoubleVec_t<DoubleType> &x, const ComplexDoubleVec_t<DoubleType> &b) const override;
+        bool DerivedLUSolve(DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const override;
+        bool DerivedLUSolve(ComplexDoubleVec_t<DoubleType> &x, const ComplexDoubleVec_t<DoubleType> &b) const override;
 
         ~MKLPardisoPreconditioner();
 
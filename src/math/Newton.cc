@@ -12,11 +12,15 @@ SPDX-License-Identifier: Apache-2.0
 #include "InstanceKeeper.hh"
 #include "NodeKeeper.hh"
 #include "CompressedMatrix.hh"
+#include "BlockCompressedMatrix.hh"
 #include "Preconditioner.hh"
 #include "SolverUtil.hh"
 #include "LinearSolver.hh"
 #include "Device.hh"
 #include "Region.hh"
+#include "Interface.hh"
+#include "Node.hh"
+#include "Edge.hh"
 #include "EquationHolder.hh"
 #include "OutputStream.hh"
 #include "dsAssert.hh"
@@ -26,6 +30,7 @@ SPDX-License-Identifier: Apache-2.0
 #include "ObjectHolder.hh"
 #include "Interpreter.hh"
 #include "dsTimer.hh"
+#include "AssemblyCacheScope.hh"
 
 #ifdef DEVSIM_EXTENDED_PRECISION
 #include "Float128.hh"
@@ -33,8 +38,17 @@ SPDX-License-Identifier: Apache-2.0
 #include "BoostConstants.hh"
 
 #include "ControlGIL.hh"
+#include "GetNumberOfThreads.hh"
+#include "SimulationContext.hh"
+#include "FPECheck.hh"
+#include "SparseOrdering.hh"
+#include "ParallelReduce.hh"
 
 #include <sstream>
+#include <future>
+#include <atomic>
+#include <algorithm>
+#include <chrono>
 #include <iomanip>
 #include <cmath>
 #include <cstdlib>
@@ -42,87 +56,257 @@ using std::abs;
 
 namespace dsMath {
 
+/// Accumulated wall time in seconds of each phase of the newton iteration
+struct NewtonTiming
+{
+  double assemble     = 0.0;
+  double finalize     = 0.0;
+  double linear_solve = 0.0;
+  double factor       = 0.0;
+  double solve        = 0.0;
+  double update       = 0.0;
+
+  template <typename DoubleType>
+  void AddPreconditioner(const Preconditioner<DoubleType> &preconditioner)
+  {
+    factor += preconditioner.GetFactorTime();
+    solve  += preconditioner.GetSolveTime();
+  }
+
+  void Add(const NewtonTiming &t)
+  {
+    assemble     += t.assemble;
+    finalize     += t.finalize;
+    linear_solve += t.linear_solve;
+    factor       += t.factor;
+    solve        += t.solve;
+    update       += t.update;
+  }
+
+  ObjectHolder GetObject(double total) const
+  {
+    ObjectHolderMap_t ret;
+    ret["assemble"]     = ObjectHolder(assemble);
+    ret["finalize"]     = ObjectHolder(finalize);
+    ret["linear_solve"] = ObjectHolder(linear_solve);
+    ret["factor"]       = ObjectHolder(factor);
+    ret["solve"]        = ObjectHolder(solve);
+    ret["update"]       = ObjectHolder(update);
+    ret["total"]        = ObjectHolder(total);
+    return ObjectHolder(ret);
+  }
+};
+
+namespace {
+/// Adds the elapsed time to total when it goes out of scope
+class PhaseTimer
+{
+  public:
+    explicit PhaseTimer(double &total) : total_(total), tic_(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~PhaseTimer()
+    {
+      total_ += Elapsed();
+    }
+
+    double Elapsed() const
+    {
+      return std::chrono::duration<double>(std::chrono::steady_clock::now() - tic_).count();
+    }
+
+  private:
+    PhaseTimer(const PhaseTimer &);
+    PhaseTimer &operator=(const PhaseTimer &);
+
+    double &total_;
+    std::chrono::steady_clock::time_point tic_;
+};
+}
+
+template <typename DoubleType>
+struct Newton<DoubleType>::EquationBlock
+{
+  /// range of the equation numbers
+  size_t begin = 0;
+  size_t end   = 0;
+  std::vector<Device *> devices;
+  bool has_circuit = false;
+
+  std::unique_ptr<Preconditioner<DoubleType>> preconditioner;
+  std::unique_ptr<Matrix<DoubleType>>         matrix;
+
+  bool       converged        = false;
+  bool       solveok          = true;
+  bool       max_error_hit    = false;
+  size_t     divergence_count = 0;
+  DoubleType last_rel_err     = 0.0;
+  DoubleType last_abs_err     = 0.0;
+
+  NewtonTiming timing;
+};
+
 template <typename DoubleType>
 Newton<DoubleType>::Newton() {}
 
 template <typename DoubleType>
 Newton<DoubleType>::~Newton() {};
 
-template <typename DoubleType>
-size_t Newton<DoubleType>::NumberEquationsAndSetDimension()
+namespace {
+bool IsVerbose()
 {
   GlobalData &gdata = GlobalData::GetInstance();
+  auto dbent = gdata.GetDBEntryOnGlobal("debug_level");
+  return OutputStream::GetVerbosity(dbent.second.GetString()) != OutputStream::Verbosity_t::V0;
+}
+}
+
+template <typename DoubleType>
+size_t Newton<DoubleType>::NumberDeviceEquations(Device &dev, size_t eqnnum, bool verbose)
+{
+  std::ostringstream os;
+
+  const std::string &name = dev.GetName();
+
+  dev.SetBaseEquationNumber(eqnnum);
+  const size_t maxnum = dev.CalcMaxEquationNumber(verbose);
+
+  if (maxnum != size_t(-1))
+  {
+    if (verbose)
+    {
+      os << "Device \"" << name << "\" has equations " << eqnnum << ":" << maxnum << "\n";
+    }
+    eqnnum = maxnum + 1;
+  }
+  else
+  {
+    if (verbose)
+    {
+      os << "Device \"" << name << "\" has no equations.\n";
+    }
+  }
+  if (verbose)
+  {
+    OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
+  }
+
+  if (dev.GetDimension() > dimension)
+  {
+    dimension = dev.GetDimension();
+  }
+
+  return eqnnum;
+}
 
-  bool verbose = false;
+template <typename DoubleType>
+size_t Newton<DoubleType>::NumberCircuitEquations(size_t eqnnum, bool verbose)
+{
+  NodeKeeper &nk = NodeKeeper::instance();
+  if (nk.HaveNodes())
   {
-    auto dbent = gdata.GetDBEntryOnGlobal("debug_level");
-    verbose = OutputStream::GetVerbosity(dbent.second.GetString()) != OutputStream::Verbosity_t::V0;
+    nk.SetNodeNumbers(eqnnum, verbose);
+    size_t maxnum = nk.GetMaxEquationNumber();
+    if (verbose)
+    {
+      std::ostringstream os;
+      os << "Circuit has equations " << eqnnum << ":" << maxnum << "\n";
+      OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
+    }
+    eqnnum = maxnum + 1;
   }
+  return eqnnum;
+}
+
+template <typename DoubleType>
+size_t Newton<DoubleType>::NumberEquationsAndSetDimension()
+{
+  GlobalData &gdata = GlobalData::GetInstance();
 
+  const bool verbose = IsVerbose();
 
   size_t eqnnum = 0;
 
   dimension = 0;
 
   const GlobalData::DeviceList_t &dlist = gdata.GetDeviceList();
+  for (auto &dit : dlist)
   {
-    GlobalData::DeviceList_t::const_iterator dit  = dlist.begin();
-    GlobalData::DeviceList_t::const_iterator dend = dlist.end();
-    for ( ; dit != dend; ++dit)
-    {
-      std::ostringstream os;
+    eqnnum = NumberDeviceEquations(*(dit.second), eqnnum, verbose);
+  }
 
-      const std::string &name = (dit->first);
+  eqnnum = NumberCircuitEquations(eqnnum, verbose);
 
-      Device &dev =     *(dit->second);
-      dev.SetBaseEquationNumber(eqnnum);
-      const size_t maxnum = dev.CalcMaxEquationNumber(verbose);
+  return eqnnum;
+}
 
-      if (maxnum != size_t(-1))
-      {
-        if (verbose)
-        {
-          os << "Device \"" << name << "\" has equations " << eqnnum << ":" << maxnum << "\n";
-        }
-        eqnnum = maxnum + 1;
-      }
-      else
-      {
-        if (verbose)
-        {
-          os << "Device \"" << name << "\" has no equations.\n";
-        }
-      }
-      if (verbose)
-      {
-        OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
-      }
+/*
+  Devices connected to the circuit are numbered last, together with the
+  circuit, so that every block is a contiguous range of equations.
+  Custom equations may couple any equations, so there is only one block.
+*/
+template <typename DoubleType>
+size_t Newton<DoubleType>::NumberEquationBlocks(std::vector<EquationBlock> &blocks)
+{
+  GlobalData &gdata = GlobalData::GetInstance();
+  NodeKeeper &nk    = NodeKeeper::instance();
 
-      if (dev.GetDimension() > dimension)
-      {
-        dimension = dev.GetDimension();
-      }
-    }
+  blocks.clear();
+
+  if (!gdata.GetTclEquationList().empty())
+  {
+    return NumberEquationsAndSetDimension();
   }
 
+  const bool verbose    = IsVerbose();
+  const bool have_nodes = nk.HaveNodes();
+
+  size_t eqnnum = 0;
+
+  dimension = 0;
+
+  std::vector<Device *> coupled;
+
+  const GlobalData::DeviceList_t &dlist = gdata.GetDeviceList();
+  for (auto &dit : dlist)
   {
-    NodeKeeper &nk = NodeKeeper::instance();
-    if (nk.HaveNodes())
+    Device &dev = *(dit.second);
+    if (have_nodes && dev.HasCircuitNodes())
     {
-      nk.SetNodeNumbers(eqnnum, verbose);
-      size_t maxnum = nk.GetMaxEquationNumber();
-#if 1
-      if (verbose)
-      {
-        std::ostringstream os;
-        os << "Circuit has equations " << eqnnum << ":" << maxnum << "\n";
-        OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
-      }
-#endif
-      eqnnum = maxnum + 1;
+      coupled.push_back(&dev);
+      continue;
+    }
+
+    const size_t begin = eqnnum;
+    eqnnum = NumberDeviceEquations(dev, eqnnum, verbose);
+    if (eqnnum != begin)
+    {
+      blocks.emplace_back();
+      EquationBlock &block = blocks.back();
+      block.begin = begin;
+      block.end   = eqnnum;
+      block.devices.push_back(&dev);
     }
   }
 
+  const size_t begin = eqnnum;
+  for (auto dev : coupled)
+  {
+    eqnnum = NumberDeviceEquations(*dev, eqnnum, verbose);
+  }
+  eqnnum = NumberCircuitEquations(eqnnum, verbose);
+
+  if (eqnnum != begin)
+  {
+    blocks.emplace_back();
+    EquationBlock &block = blocks.back();
+    block.begin       = begin;
+    block.end         = eqnnum;
+    block.devices     = coupled;
+    block.has_circuit = have_nodes;
+  }
+
   return eqnnum;
 }
 
@@ -228,8 +412,8 @@ void Newton<DoubleType>::LoadIntoMatrix(const RealRowColValueVec<DoubleType> &rc
 {
   for (typename RealRowColValueVec<DoubleType>::const_iterator it = rcv.begin(); it != rcv.end(); ++it)
   {
-    const size_t row = it->row + offset;
-    const size_t col = it->col + offset;
+    const size_t row = OrderedEquation(it->row + offset);
+    const size_t col = OrderedEquation(it->col + offset);
     const T val = scl * it->val;
 //    std::cerr << "RCV: " << row << "\t" << col << "\t" << val << "\n";
     mat.AddEntry(row, col, val);
@@ -251,14 +435,14 @@ void Newton<DoubleType>::LoadIntoMatrixPermutated(const RealRowColValueVec<Doubl
       continue;
     }
 
-    const auto col = it->col + offset;
+    const auto col = OrderedEquation(it->col + offset);
     const T val = scl * it->val;
-    row += offset;
+    row = OrderedEquation(row + offset);
     mat.AddEntry(row, col, val);
 
     if (Entry.KeepCopy())
     {
-      original_row += offset;
+      original_row = OrderedEquation(original_row + offset);
       mat.AddEntry(original_row, col, val);
     }
   }
@@ -303,11 +487,78 @@ void Newton<DoubleType>::LoadIntoRHSPermutated(const RHSEntryVec<DoubleType> &r,
   }
 }
 
+template <typename DoubleType>
+void Newton<DoubleType>::PrefetchModels(dsMathEnum::WhatToLoad w)
+{
+  std::vector<const Region *> regions;
+
+  GlobalData &gdata = GlobalData::GetInstance();
+  const GlobalData::DeviceList_t &dlist = gdata.GetDeviceList();
+  for (const auto &dit : dlist)
+  {
+    const Device::RegionList_t &rlist = dit.second->GetRegionList();
+    for (const auto &rit : rlist)
+    {
+      if (rit.second->GetNumberEquations())
+      {
+        regions.push_back(rit.second);
+      }
+    }
+  }
+
+  //// otherwise the models are evaluated as they are assembled
+  const size_t num_threads = std::min(ThreadInfo::GetNumberOfThreads(), regions.size());
+  if (num_threads < 2)
+  {
+    return;
+  }
+
+  dsTimer timer("PrefetchModels");
+
+  SimulationContext &context = SimulationContext::GetCurrent();
+  std::atomic<size_t> next(0);
+
+  auto worker = [&]() -> FPECheck::FPEFlag_t {
+    SimulationContext::ScopedContext scope(context);
+    AssemblyCacheScope cache_scope("PrefetchModels");
+    FPECheck::ClearFPE();
+    for (size_t i = next++; i < regions.size(); i = next++)
+    {
+      regions[i]->PrefetchModels(w);
+    }
+    return FPECheck::getFPEFlags();
+  };
+
+  std::vector<std::future<FPECheck::FPEFlag_t>> futures;
+  for (size_t i = 0; i < num_threads; ++i)
+  {
+    futures.push_back(std::async(std::launch::async, worker));
+  }
+
+  FPECheck::FPEFlag_t fpeFlag = FPECheck::getClearedFlag();
+  for (auto &f : futures)
+  {
+    fpeFlag = FPECheck::combineFPEFlags(fpeFlag, f.get());
+  }
+
+  if (FPECheck::CheckFPE(fpeFlag))
+  {
+    //// Raise FPE in the main thread
+    FPECheck::raiseFPE(fpeFlag);
+  }
+}
+
 template <typename DoubleType>
 template <typename T>
 void Newton<DoubleType>::LoadMatrixAndRHS(Matrix<DoubleType> &matrix, std::vector<T> &rhs, permvec_t &permvec, dsMathEnum::WhatToLoad w, dsMathEnum::TimeMode t, T scl)
 {
   dsTimer timer("LoadMatrixAndRHS");
+  AssemblyCacheScope cache_scope("LoadMatrixAndRHS");
+
+  if (w != dsMathEnum::WhatToLoad::PERMUTATIONSONLY)
+  {
+    PrefetchModels(w);
+  }
 
   RHSEntryVec<DoubleType>    v;
   RealRowColValueVec<DoubleType> m;
@@ -421,7 +672,7 @@ void Newton<DoubleType>::LoadMatrixAndRHSAC(Matrix<DoubleType> &matrix, ComplexD
 }
 
 template <typename DoubleType>
-void Newton<DoubleType>::RestoreSolutions()
+void Newton<DoubleType>::RestoreSolutions(const std::string &suffix)
 {
   GlobalData &gdata = GlobalData::GetInstance();
 
@@ -436,7 +687,7 @@ void Newton<DoubleType>::RestoreSolutions()
       std::string name = (dit->first);
       Device &dev =     *(dit->second);
       //// Transient may have other backup suffixes
-      dev.RestoreSolutions("_prev");
+      dev.RestoreSolutions(suffix);
     }
   }
 
@@ -444,13 +695,13 @@ void Newton<DoubleType>::RestoreSolutions()
     NodeKeeper &nk = NodeKeeper::instance();
     if (nk.HaveNodes())
     {
-      nk.CopySolution("dcop_prev", "dcop");
+      nk.CopySolution("dcop" + suffix, "dcop");
     }
   }
 }
 
 template <typename DoubleType>
-void Newton<DoubleType>::BackupSolutions()
+void Newton<DoubleType>::BackupSolutions(const std::string &suffix)
 {
   GlobalData &gdata = GlobalData::GetInstance();
 
@@ -465,7 +716,7 @@ void Newton<DoubleType>::BackupSolutions()
       std::string name = (dit->first);
       Device &dev =     *(dit->second);
       //// Transient may have other backup suffixes
-      dev.BackupSolutions("_prev");
+      dev.BackupSolutions(suffix);
     }
   }
 
@@ -473,21 +724,21 @@ void Newton<DoubleType>::BackupSolutions()
     NodeKeeper &nk = NodeKeeper::instance();
     if (nk.HaveNodes())
     {
-      nk.InitializeSolution("dcop_prev");
-      nk.CopySolution("dcop", "dcop_prev");
+      nk.InitializeSolution("dcop" + suffix);
+      nk.CopySolution("dcop", "dcop" + suffix);
     }
   }
 }
 
 
 namespace {
-void CallUpdateSolution(NodeKeeper &nk, const std::string &name, std::vector<double> &result)
+void CallUpdateSolution(NodeKeeper &nk, const std::string &name, const std::vector<double> &result)
 {
   nk.UpdateSolution(name, result);
 }
 
 #ifdef DEVSIM_EXTENDED_PRECISION
-void CallUpdateSolution(NodeKeeper &nk, const std::string &name, std::vector<float128> &result)
+void CallUpdateSolution(NodeKeeper &nk, const std::string &name, const std::vector<float128> &result)
 {
   std::vector<double> tmp(result.size());
   for (size_t i = 0; i < result.size(); ++i)
@@ -515,6 +766,40 @@ void CallACUpdateSolution(NodeKeeper &nk, const std::string &rname, const std::s
 }
 #endif
 
+//// Discards matrix entries when only the right hand side is needed
+template <typename DoubleType>
+class RHSOnlyMatrix : public Matrix<DoubleType> {
+  public:
+    explicit RHSOnlyMatrix(size_t sz) : Matrix<DoubleType>(sz) {}
+    void AddEntry(int, int, DoubleType) {}
+    void AddEntry(int, int, ComplexDouble_t<DoubleType>) {}
+    void AddImagEntry(int, int, DoubleType) {}
+    void ClearMatrix() {}
+    void Finalize() {}
+    void Multiply(const DoubleVec_t<DoubleType> &, DoubleVec_t<DoubleType> &) const {}
+    void TransposeMultiply(const DoubleVec_t<DoubleType> &, DoubleVec_t<DoubleType> &) const {}
+    void Multiply(const ComplexDoubleVec_t<DoubleType> &, ComplexDoubleVec_t<DoubleType> &) const {}
+    void TransposeMultiply(const ComplexDoubleVec_t<DoubleType> &, ComplexDoubleVec_t<DoubleType> &) const {}
+};
+}
+
+template <typename DoubleType>
+void Newton<DoubleType>::ApplyUpdate(const DoubleVec_t<DoubleType> &result)
+{
+  GlobalData &gdata = GlobalData::GetInstance();
+  const GlobalData::DeviceList_t &dlist = gdata.GetDeviceList();
+  for (auto dit : dlist)
+  {
+    Device *dev = dit.second;
+    dev->Update(result);
+  }
+
+  NodeKeeper &nk = NodeKeeper::instance();
+  if (nk.HaveNodes())
+  {
+    CallUpdateSolution(nk, "dcop", result);
+    nk.TriggerCallbacksOnNodes();
+  }
 }
 
 template <typename DoubleType>
@@ -524,6 +809,9 @@ void Newton<DoubleType>::GetMatrixAndRHSForExternalUse(CompressionType ct, Objec
 
   const size_t numeqns = NumberEquationsAndSetDimension();
 
+  //// the matrix is returned in the natural order
+  equationOrder.clear();
+
   if (nk.HaveNodes())
   {
     nk.InitializeSolution("dcop");
@@ -614,11 +902,22 @@ bool Newton<DoubleType>::Solve(LinearSolver<DoubleType> &itermethod, const TimeM
 {
   MasterGILControl gil;
 
+  double total_time = 0.0;
+  PhaseTimer total_timer(total_time);
+  NewtonTiming timing;
+
   NodeKeeper &nk = NodeKeeper::instance();
   GlobalData &gdata = GlobalData::GetInstance();
   const GlobalData::DeviceList_t      &dlist = gdata.GetDeviceList();
 
-  const size_t numeqns = NumberEquationsAndSetDimension();
+  std::vector<EquationBlock> blocks;
+  const bool use_blocks = timeinfo.IsDCOnly() && allowBlockSolve;
+  const size_t numeqns = (use_blocks) ? NumberEquationBlocks(blocks) : NumberEquationsAndSetDimension();
+
+  if (blocks.size() > 1)
+  {
+    return BlockSolve(itermethod, blocks, numeqns, ohm);
+  }
 
   if (nk.HaveNodes())
   {
@@ -627,18 +926,23 @@ bool Newton<DoubleType>::Solve(LinearSolver<DoubleType> &itermethod, const TimeM
 
   PrintNumberEquations(numeqns, ohm);
 
+  NumberEquationOrdering(numeqns, ohm);
+
   std::unique_ptr<Preconditioner<DoubleType>> preconditioner;
 
   std::unique_ptr<Matrix<DoubleType>> matrix;
 
   preconditioner = std::unique_ptr<Preconditioner<DoubleType>>(CreatePreconditioner(itermethod, numeqns));
+  preconditioner->SetEquationOrder(equationOrder);
 
-  matrix = std::unique_ptr<Matrix<DoubleType>>(CreateMatrix(preconditioner.get()));
+  matrix = std::unique_ptr<Matrix<DoubleType>>(CreateSolverMatrix(*preconditioner, 0));
 
   DoubleVec_t<DoubleType> rhs(numeqns);
 
   bool converged = false;
 
+  iterationCount = 0;
+
   BackupSolutions();
 
   /////
@@ -688,18 +992,21 @@ bool Newton<DoubleType>::Solve(LinearSolver<DoubleType> &itermethod, const TimeM
 
 //        std::cerr << "Begin Load Matrix\n";
     /// This is the resistive portion (always assembled
-    if (timeinfo.IsDCOnly())
-    {
-      LoadMatrixAndRHS(*matrix, rhs, permvec, dsMathEnum::WhatToLoad::MATRIXANDRHS, dsMathEnum::TimeMode::DC, static_cast<DoubleType>(1.0));
-    }
-    else
     {
-      LoadMatrixAndRHS(*matrix, rhs, permvec, dsMathEnum::WhatToLoad::MATRIXANDRHS, dsMathEnum::TimeMode::DC, timeinfo.b0);
-
-      /// This assembles the time derivative current
-      if (timeinfo.a0 != 0.0)
+      PhaseTimer assemble_timer(timing.assemble);
+      if (timeinfo.IsDCOnly())
+      {
+        LoadMatrixAndRHS(*matrix, rhs, permvec, dsMathEnum::WhatToLoad::MATRIXANDRHS, dsMathEnum::TimeMode::DC, static_cast<DoubleType>(1.0));
+      }
+      else
       {
-        LoadMatrixAndRHS(*matrix, rhs, permvec, dsMathEnum::WhatToLoad::MATRIXANDRHS, dsMathEnum::TimeMode::TIME, timeinfo.a0);
+        LoadMatrixAndRHS(*matrix, rhs, permvec, dsMathEnum::WhatToLoad::MATRIXANDRHS, dsMathEnum::TimeMode::DC, timeinfo.b0);
+
+        /// This assembles the time derivative current
+        if (timeinfo.a0 != 0.0)
+        {
+          LoadMatrixAndRHS(*matrix, rhs, permvec, dsMathEnum::WhatToLoad::MATRIXANDRHS, dsMathEnum::TimeMode::TIME, timeinfo.a0);
+        }
       }
     }
 
@@ -708,7 +1015,10 @@ bool Newton<DoubleType>::Solve(LinearSolver<DoubleType> &itermethod, const TimeM
     result.clear();
     result.resize(numeqns);
 
-    matrix->Finalize();
+    {
+      PhaseTimer finalize_timer(timing.finalize);
+      matrix->Finalize();
+    }
 
 //        std::cerr << "Begin Solve Matrix\n";
     // iter is 0 based
@@ -720,7 +1030,11 @@ bool Newton<DoubleType>::Solve(LinearSolver<DoubleType> &itermethod, const TimeM
       }
     }
 
-    bool solveok = itermethod.Solve(*matrix, *preconditioner, result, rhs);
+    bool solveok = false;
+    {
+      PhaseTimer linear_timer(timing.linear_solve);
+      solveok = SolveOrdered(itermethod, *matrix, *preconditioner, result, rhs);
+    }
     if (!solveok)
     {
       break;
@@ -728,21 +1042,11 @@ bool Newton<DoubleType>::Solve(LinearSolver<DoubleType> &itermethod, const TimeM
 //        std::cerr << "End Solve Matrix\n";
 
     {
-      GlobalData::DeviceList_t::const_iterator dit  = dlist.begin();
-      GlobalData::DeviceList_t::const_iterator dend = dlist.end();
-      for ( ; dit != dend; ++dit)
-      {
-        std::string name = (dit->first);
-        Device *dev =      (dit->second);
-        dev->Update(result);
-      }
+      PhaseTimer update_timer(timing.update);
+      ApplyUpdate(result);
     }
 
-    if (nk.HaveNodes())
-    {
-      CallUpdateSolution(nk, "dcop", result);
-      nk.TriggerCallbacksOnNodes();
-    }
+    iterationCount = iter + 1;
 
     PrintIteration(iter, p_iteration_map);
     {
@@ -801,7 +1105,11 @@ bool Newton<DoubleType>::Solve(LinearSolver<DoubleType> &itermethod, const TimeM
       }
     }
 
-    matrix->ClearMatrix();
+    //// the converged jacobian is kept for reuse by SolveParameterTangent
+    if (!converged)
+    {
+      matrix->ClearMatrix();
+    }
     if (p_iteration_map)
     {
       iteration_list.push_back(ObjectHolder(iteration_map));
@@ -810,11 +1118,12 @@ bool Newton<DoubleType>::Solve(LinearSolver<DoubleType> &itermethod, const TimeM
 
   DoubleVec_t<DoubleType> newI;
   DoubleVec_t<DoubleType> newQ;
+  RHSOnlyMatrix<DoubleType> rhsonly(numeqns);
   if (timeinfo.IsTransient())
   {
     //// New charge based on new assemble
     newQ.resize(numeqns);
-    LoadMatrixAndRHS(*matrix, newQ, permvec, dsMathEnum::WhatToLoad::RHS, dsMathEnum::TimeMode::TIME, static_cast<DoubleType>(1.0));
+    LoadMatrixAndRHS(rhsonly, newQ, permvec, dsMathEnum::WhatToLoad::RHS, dsMathEnum::TimeMode::TIME, static_cast<DoubleType>(1.0));
 
     //// Check to see if your projection was correct
     if (timeinfo.IsIntegration())
@@ -823,12 +1132,20 @@ bool Newton<DoubleType>::Solve(LinearSolver<DoubleType> &itermethod, const TimeM
     }
   }
 
+  timing.AddPreconditioner(*preconditioner);
+
   if (!converged)
   {
     RestoreSolutions();
   }
   else
   {
+    if (timeinfo.IsDCOnly())
+    {
+      factoredMatrix = std::move(matrix);
+      factoredPreconditioner = std::move(preconditioner);
+      factoredPermvec = permvec;
+    }
 
     GlobalData::DeviceList_t::const_iterator dit  = dlist.begin();
     GlobalData::DeviceList_t::const_iterator dend = dlist.end();
@@ -851,7 +1168,7 @@ bool Newton<DoubleType>::Solve(LinearSolver<DoubleType> &itermethod, const TimeM
     if (timeinfo.IsTransient())
     {
       newI.resize(numeqns);
-      LoadMatrixAndRHS(*matrix, newI, permvec, dsMathEnum::WhatToLoad::RHS, dsMathEnum::TimeMode::DC, static_cast<DoubleType>(1.0));
+      LoadMatrixAndRHS(rhsonly, newI, permvec, dsMathEnum::WhatToLoad::RHS, dsMathEnum::TimeMode::DC, static_cast<DoubleType>(1.0));
       UpdateTransientCurrent(timeinfo, numeqns, newI, newQ);
     }
 
@@ -861,32 +1178,1027 @@ bool Newton<DoubleType>::Solve(LinearSolver<DoubleType> &itermethod, const TimeM
   {
     (*ohm)["iterations"] = ObjectHolder(iteration_list);
     (*ohm)["converged"] = ObjectHolder(converged);
+    if (reportTiming)
+    {
+      (*ohm)["timing"] = timing.GetObject(total_timer.Elapsed());
+    }
   }
 
   return converged;
 }
 
 template <typename DoubleType>
-void Newton<DoubleType>::PrintNumberEquations(size_t numeqns, ObjectHolderMap_t *ohm)
+void Newton<DoubleType>::LoadBlockMatrixAndRHS(EquationBlock &block, DoubleVec_t<DoubleType> &rhs, permvec_t &permvec)
 {
-  std::ostringstream os;
-  os << "number of equations " << numeqns << "\n";
-  OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
-  if (ohm)
+  //// shifts the global equation numbers to the start of the block
+  const size_t offset = size_t(0) - block.begin;
+  const DoubleType scl = 1.0;
+
+  Matrix<DoubleType> &matrix = *block.matrix;
+
+  AssemblyCacheScope cache_scope("LoadBlockMatrixAndRHS");
+
+  RHSEntryVec<DoubleType>    v;
+  RealRowColValueVec<DoubleType> m;
+
+  RHSEntryVec<DoubleType>    pv;
+  RealRowColValueVec<DoubleType> pm;
+
+  for (auto dev : block.devices)
   {
-    (*ohm)["number_of_equations"] = ObjectHolder(static_cast<int>(numeqns));
+    m.clear();
+    v.clear();
+
+    AssembleContactsAndInterfaces(m, v, permvec, *dev, dsMathEnum::WhatToLoad::MATRIXANDRHS, dsMathEnum::TimeMode::DC);
+    LoadIntoMatrix(m, matrix, scl, offset);
+    LoadIntoRHS(v, rhs, scl, offset);
+
+    pm.clear();
+    pv.clear();
+
+    AssembleBulk(pm, pv, *dev, dsMathEnum::WhatToLoad::MATRIXANDRHS, dsMathEnum::TimeMode::DC);
+    LoadIntoMatrixPermutated(pm, matrix, permvec, scl, offset);
+    LoadIntoRHSPermutated(pv, rhs, permvec, scl, offset);
   }
-}
 
-template <typename DoubleType>
-void Newton<DoubleType>::PrintIteration(size_t iter, ObjectHolderMap_t *ohm)
-{
-  std::ostringstream os;
-  os << "Iteration: " << iter << "\n";
-  OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
-  if (ohm)
+  if (block.has_circuit)
   {
-    (*ohm)["iteration"] = ObjectHolder(static_cast<int>(iter));
+    NodeKeeper &nk = NodeKeeper::instance();
+    const size_t circuit_offset = nk.GetMinEquationNumber() + offset;
+    m.clear();
+    v.clear();
+    LoadMatrixAndRHSOnCircuit(m, v, dsMathEnum::WhatToLoad::MATRIXANDRHS, dsMathEnum::TimeMode::DC);
+    LoadIntoMatrix(m, matrix, scl, circuit_offset);
+    LoadIntoRHS(v, rhs, scl, circuit_offset);
+  }
+}
+
+//// Each block only writes its own section of result, so blocks may be run concurrently
+template <typename DoubleType>
+void Newton<DoubleType>::IterateBlock(LinearSolver<DoubleType> &itermethod, EquationBlock &block, permvec_t &permvec, DoubleVec_t<DoubleType> &result, bool new_symbolic)
+{
+  const size_t numeqns = block.end - block.begin;
+
+  DoubleVec_t<DoubleType> rhs(numeqns);
+  DoubleVec_t<DoubleType> x(numeqns);
+
+  Matrix<DoubleType> &matrix = *block.matrix;
+  NewtonTiming &timing = block.timing;
+
+  {
+    PhaseTimer assemble_timer(timing.assemble);
+    LoadBlockMatrixAndRHS(block, rhs, permvec);
+  }
+
+  {
+    PhaseTimer finalize_timer(timing.finalize);
+    matrix.Finalize();
+  }
+
+  if (new_symbolic)
+  {
+    if (auto cm = dynamic_cast<CompressedMatrix<DoubleType> *>(&matrix); cm)
+    {
+      cm->SetSymbolicStatus(SymbolicStatus_t::NEW_SYMBOLIC);
+    }
+  }
+
+  {
+    PhaseTimer linear_timer(timing.linear_solve);
+    block.solveok = itermethod.Solve(matrix, *block.preconditioner, x, rhs);
+  }
+
+  matrix.ClearMatrix();
+
+  if (!block.solveok)
+  {
+    return;
+  }
+
+  PhaseTimer update_timer(timing.update);
+
+  std::copy(x.begin(), x.end(), result.begin() + block.begin);
+
+  for (auto dev : block.devices)
+  {
+    dev->Update(result);
+  }
+
+  if (block.has_circuit)
+  {
+    NodeKeeper &nk = NodeKeeper::instance();
+    CallUpdateSolution(nk, "dcop", result);
+    nk.TriggerCallbacksOnNodes();
+  }
+}
+
+/*
+  Each block is factored separately.  Blocks which have converged are no
+  longer assembled, and the solve succeeds when every block has converged.
+*/
+template <typename DoubleType>
+bool Newton<DoubleType>::BlockSolve(LinearSolver<DoubleType> &itermethod, std::vector<EquationBlock> &blocks, size_t numeqns, ObjectHolderMap_t *ohm)
+{
+  double total_time = 0.0;
+  PhaseTimer total_timer(total_time);
+
+  NodeKeeper &nk = NodeKeeper::instance();
+  GlobalData &gdata = GlobalData::GetInstance();
+  const GlobalData::DeviceList_t      &dlist = gdata.GetDeviceList();
+
+  //// each block is assembled with its own offset
+  equationOrder.clear();
+
+  if (nk.HaveNodes())
+  {
+    nk.InitializeSolution("dcop");
+  }
+
+  PrintNumberEquations(numeqns, ohm);
+
+  if (IsVerbose())
+  {
+    std::ostringstream os;
+    os << "number of uncoupled blocks " << blocks.size() << "\n";
+    OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
+  }
+
+  if (ohm)
+  {
+    (*ohm)["number_of_blocks"] = ObjectHolder(static_cast<int>(blocks.size()));
+  }
+
+  //// there is no factorization of the whole jacobian for SolveParameterTangent
+  factoredPreconditioner.reset();
+  factoredMatrix.reset();
+  factoredPermvec.clear();
+
+  for (auto &block : blocks)
+  {
+    block.preconditioner = std::unique_ptr<Preconditioner<DoubleType>>(CreatePreconditioner(itermethod, block.end - block.begin));
+    //// the rows of the other blocks are not in this matrix
+    std::vector<size_t> blockOrder(numeqns, size_t(-1));
+    for (size_t i = block.begin; i < block.end; ++i)
+    {
+      blockOrder[i] = i - block.begin;
+    }
+    block.preconditioner->SetEquationOrder(blockOrder);
+    block.matrix = std::unique_ptr<Matrix<DoubleType>>(CreateSolverMatrix(*block.preconditioner, block.begin));
+  }
+
+  iterationCount = 0;
+
+  BackupSolutions();
+
+  permvec_t permvec(numeqns);
+  for (size_t i = 0; i < permvec.size(); ++i)
+  {
+    permvec[i] = PermutationEntry(i, false);
+  }
+
+  {
+    RHSOnlyMatrix<DoubleType> rhsonly(numeqns);
+    DoubleVec_t<DoubleType> rhs(numeqns);
+    LoadMatrixAndRHS(rhsonly, rhs, permvec, dsMathEnum::WhatToLoad::PERMUTATIONSONLY, dsMathEnum::TimeMode::DC, static_cast<DoubleType>(1.0));
+  }
+
+  DoubleVec_t<DoubleType> result(numeqns);
+
+  const size_t symbolic_iter_max = (std::getenv("DEVSIM_NEW_SYMBOLIC") == nullptr) ? symbolicIterationLimit : size_t(-1);
+
+  bool converged = false;
+  bool failed = false;
+
+  ObjectHolderList_t iteration_list;
+
+  std::vector<EquationBlock *> active;
+
+  for (size_t iter = 0; (iter < maxiter) && (!converged) && (!failed); ++iter)
+  {
+    active.clear();
+    for (auto &block : blocks)
+    {
+      if (!block.converged)
+      {
+        active.push_back(&block);
+      }
+    }
+
+    const bool new_symbolic = (iter < symbolic_iter_max);
+
+    const size_t num_threads = std::min(ThreadInfo::GetNumberOfThreads(), active.size());
+    if (num_threads > 1)
+    {
+      SimulationContext &context = SimulationContext::GetCurrent();
+      std::atomic<size_t> next(0);
+
+      auto worker = [&]() -> FPECheck::FPEFlag_t {
+        SimulationContext::ScopedContext scope(context);
+        FPECheck::ClearFPE();
+        for (size_t i = next++; i < active.size(); i = next++)
+        {
+          IterateBlock(itermethod, *active[i], permvec, result, new_symbolic);
+        }
+        return FPECheck::getFPEFlags();
+      };
+
+      std::vector<std::future<FPECheck::FPEFlag_t>> futures;
+      for (size_t i = 0; i < num_threads; ++i)
+      {
+        futures.push_back(std::async(std::launch::async, worker));
+      }
+
+      FPECheck::FPEFlag_t fpeFlag = FPECheck::getClearedFlag();
+      for (auto &f : futures)
+      {
+        fpeFlag = FPECheck::combineFPEFlags(fpeFlag, f.get());
+      }
+
+      if (FPECheck::CheckFPE(fpeFlag))
+      {
+        //// Raise FPE in the main thread
+        FPECheck::raiseFPE(fpeFlag);
+      }
+    }
+    else
+    {
+      for (auto block : active)
+      {
+        IterateBlock(itermethod, *block, permvec, result, new_symbolic);
+      }
+    }
+
+    if (std::any_of(active.begin(), active.end(), [](const EquationBlock *b) {return !b->solveok;}))
+    {
+      failed = true;
+      break;
+    }
+
+    iterationCount = iter + 1;
+
+    ObjectHolderMap_t iteration_map;
+    ObjectHolderMap_t *p_iteration_map = nullptr;
+    if (ohm)
+    {
+      p_iteration_map = &iteration_map;
+    }
+
+    PrintIteration(iter, p_iteration_map);
+
+    ObjectHolderList_t dobjlist;
+    for (auto pblock : active)
+    {
+      EquationBlock &block = *pblock;
+
+      bool block_converged = true;
+
+      for (auto dev : block.devices)
+      {
+        const Device &device = *dev;
+        const DoubleType devrerr = device.GetRelError<DoubleType>();
+        const DoubleType devaerr = device.GetAbsError<DoubleType>();
+
+        if (ohm)
+        {
+          ObjectHolderMap_t dmap;
+          PrintDeviceErrors(device, &dmap);
+          dobjlist.push_back(ObjectHolder(dmap));
+        }
+        else
+        {
+          PrintDeviceErrors(device, ohm);
+        }
+
+        bool diverged = ((devrerr > relLimit) && (devrerr > block.last_rel_err))
+           || ((devaerr > absLimit) && (devaerr > block.last_abs_err));
+        if (diverged)
+        {
+          block.divergence_count += 1;
+        }
+        else
+        {
+          block.divergence_count = 0;
+        }
+        block.last_rel_err = devrerr;
+        block.last_abs_err = devaerr;
+
+        block_converged = block_converged && (devrerr < relLimit) && (devaerr < absLimit);
+
+        block.max_error_hit = block.max_error_hit || (devaerr > maxLimit);
+      }
+
+      if (block.has_circuit)
+      {
+        const DoubleType cirrerr = nk.GetRelError("dcop");
+        const DoubleType ciraerr = nk.GetAbsError("dcop");
+        PrintCircuitErrors(p_iteration_map);
+        block_converged = block_converged && (cirrerr < relLimit) && (ciraerr < absLimit);
+        block.max_error_hit = block.max_error_hit || (ciraerr > maxLimit);
+      }
+
+      block.converged = block_converged;
+
+      failed = failed || block.max_error_hit || (block.divergence_count >= maxDivergenceCount);
+    }
+
+    if (p_iteration_map)
+    {
+      (*p_iteration_map)["devices"] = ObjectHolder(dobjlist);
+      iteration_list.push_back(ObjectHolder(iteration_map));
+    }
+
+    converged = std::all_of(blocks.begin(), blocks.end(), [](const EquationBlock &b) {return b.converged;});
+  }
+
+  if (!converged)
+  {
+    RestoreSolutions();
+  }
+  else
+  {
+    for (auto &dit : dlist)
+    {
+      dit.second->UpdateContacts();
+    }
+
+    if (nk.HaveNodes() && IsVerbose())
+    {
+      nk.PrintSolution("dcop");
+    }
+  }
+
+  if (ohm)
+  {
+    (*ohm)["iterations"] = ObjectHolder(iteration_list);
+    (*ohm)["converged"] = ObjectHolder(converged);
+    if (reportTiming)
+    {
+      //// the time of each phase is summed over the blocks
+      NewtonTiming timing;
+      for (auto &block : blocks)
+      {
+        timing.Add(block.timing);
+        timing.AddPreconditioner(*block.preconditioner);
+      }
+      (*ohm)["timing"] = timing.GetObject(total_timer.Elapsed());
+    }
+  }
+
+  return converged;
+}
+
+namespace {
+void SetDeviceParameter(const std::string &device, const std::string &parameter, double value)
+{
+  GlobalData &gdata = GlobalData::GetInstance();
+  gdata.AddDBEntryOnDevice(device, parameter, ObjectHolder(value));
+}
+}
+
+/*
+  The contact bias only enters the right hand side, so the derivative of the
+  residual is the difference of two rhs assemblies at the current solution.
+  The tangent is then a back substitution with the last converged factorization.
+*/
+template <typename DoubleType>
+bool Newton<DoubleType>::SolveParameterTangent(const ContinuationParams<DoubleType> &params, DoubleType value, DoubleType delta, DoubleVec_t<DoubleType> &tangent)
+{
+  if (!factoredPreconditioner)
+  {
+    return false;
+  }
+
+  const size_t numeqns = factoredPermvec.size();
+
+  RHSOnlyMatrix<DoubleType> rhsonly(numeqns);
+  DoubleVec_t<DoubleType> rhs0(numeqns);
+  DoubleVec_t<DoubleType> rhs1(numeqns);
+
+  LoadMatrixAndRHS(rhsonly, rhs0, factoredPermvec, dsMathEnum::WhatToLoad::RHS, dsMathEnum::TimeMode::DC, static_cast<DoubleType>(1.0));
+  SetDeviceParameter(params.device, params.parameter, static_cast<double>(value + delta));
+  LoadMatrixAndRHS(rhsonly, rhs1, factoredPermvec, dsMathEnum::WhatToLoad::RHS, dsMathEnum::TimeMode::DC, static_cast<DoubleType>(1.0));
+  SetDeviceParameter(params.device, params.parameter, static_cast<double>(value));
+
+  for (size_t i = 0; i < numeqns; ++i)
+  {
+    rhs1[i] -= rhs0[i];
+  }
+
+  tangent.clear();
+  tangent.resize(numeqns);
+
+  bool ret = false;
+  if (equationOrder.empty())
+  {
+    ret = factoredPreconditioner->LUSolve(tangent, rhs1);
+  }
+  else
+  {
+    DoubleVec_t<DoubleType> ordered_rhs(numeqns);
+    DoubleVec_t<DoubleType> ordered_tangent(numeqns);
+    ApplyEquationOrder(rhs1, ordered_rhs);
+    ret = factoredPreconditioner->LUSolve(ordered_tangent, ordered_rhs);
+    RemoveEquationOrder(ordered_tangent, tangent);
+  }
+  if (ret)
+  {
+    for (auto &t : tangent)
+    {
+      t /= delta;
+    }
+  }
+  return ret;
+}
+
+template <typename DoubleType>
+bool Newton<DoubleType>::ContinuationSolve(LinearSolver<DoubleType> &itermethod, const ContinuationParams<DoubleType> &params, ObjectHolderMap_t *ohm)
+{
+  GlobalData &gdata = GlobalData::GetInstance();
+
+  auto dbent = gdata.GetDBEntryOnDevice(params.device, params.parameter);
+  ObjectHolder::DoubleEntry_t start = dbent.second.GetDouble();
+  if (!dbent.first || !start.first)
+  {
+    std::ostringstream os;
+    os << "Parameter \"" << params.parameter << "\" on device \"" << params.device << "\" does not have a starting value.\n";
+    OutputStream::WriteOut(OutputStream::OutputType::ERROR, os.str());
+    return false;
+  }
+
+  const std::string backup_suffix = "_continuation";
+
+  ObjectHolderList_t point_list;
+
+  DoubleType value = start.second;
+  DoubleType step  = abs(params.step_size);
+  if (params.end_value < value)
+  {
+    step = -step;
+  }
+
+  const size_t target_iterations = (params.target_iterations > 0) ? params.target_iterations : 1;
+
+  DoubleType min_step = params.min_step;
+  if (min_step <= 0.0)
+  {
+    min_step = 1.0e-6 * abs(params.end_value - value);
+  }
+  size_t failures = 0;
+
+  //// the tangent needs the factorization of the whole jacobian
+  allowBlockSolve = false;
+
+  bool converged = Solve(itermethod, TimeMethods::DCOnly<DoubleType>(), nullptr);
+
+  DoubleVec_t<DoubleType> tangent;
+  bool have_tangent = false;
+
+  while (converged && (value != params.end_value))
+  {
+    DoubleType next_value = value + step;
+    if (((step > 0.0) && (next_value > params.end_value)) || ((step < 0.0) && (next_value < params.end_value)))
+    {
+      next_value = params.end_value;
+    }
+    const DoubleType delta = next_value - value;
+
+    if (!have_tangent)
+    {
+      have_tangent = SolveParameterTangent(params, value, delta, tangent);
+    }
+
+    {
+      std::ostringstream os;
+      os << "Continuation: \"" << params.parameter << "\" " << std::scientific << std::setprecision(5) << value << " -> " << next_value << "\n";
+      OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
+    }
+
+    BackupSolutions(backup_suffix);
+
+    SetDeviceParameter(params.device, params.parameter, static_cast<double>(next_value));
+
+    if (have_tangent)
+    {
+      DoubleVec_t<DoubleType> prediction(tangent);
+      for (auto &p : prediction)
+      {
+        p *= delta;
+      }
+      ApplyUpdate(prediction);
+    }
+
+    const bool step_converged = Solve(itermethod, TimeMethods::DCOnly<DoubleType>(), nullptr);
+
+    if (ohm)
+    {
+      ObjectHolderMap_t pmap;
+      pmap["value"] = ObjectHolder(static_cast<double>(next_value));
+      pmap["iterations"] = ObjectHolder(static_cast<int>(iterationCount));
+      pmap["converged"] = ObjectHolder(step_converged);
+      point_list.push_back(ObjectHolder(pmap));
+    }
+
+    if (step_converged)
+    {
+      value = next_value;
+      have_tangent = false;
+      failures = 0;
+
+      if (params.callback)
+      {
+        Interpreter MyInterp;
+        std::vector<ObjectHolder> arguments{ObjectHolder(params.device)};
+        if (!MyInterp.RunCommand(*params.callback, arguments))
+        {
+          std::ostringstream os;
+          os << "Error when evaluating continuation callback with result \"" << MyInterp.GetErrorString() << "\"\n";
+          OutputStream::WriteOut(OutputStream::OutputType::FATAL, os.str().c_str());
+        }
+      }
+
+      //// aim for the target number of iterations on the next step
+      DoubleType factor = static_cast<DoubleType>(target_iterations) / static_cast<DoubleType>((iterationCount > 0) ? iterationCount : 1);
+      if (factor > 2.0)
+      {
+        factor = 2.0;
+      }
+      else if (factor < 0.5)
+      {
+        factor = 0.5;
+      }
+      step *= factor;
+    }
+    else
+    {
+      RestoreSolutions(backup_suffix);
+      SetDeviceParameter(params.device, params.parameter, static_cast<double>(value));
+      //// the tangent is per unit parameter, so it is still valid for the smaller step
+      step *= 0.5;
+      ++failures;
+      if (failures >= params.max_failures)
+      {
+        std::ostringstream os;
+        os << "Continuation failed to converge " << failures << " times in a row\n";
+        OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
+        converged = false;
+      }
+      else if (abs(step) < min_step)
+      {
+        std::ostringstream os;
+        os << "Continuation step " << std::scientific << std::setprecision(5) << abs(step) << " is below minimum step " << min_step << "\n";
+        OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
+        converged = false;
+      }
+    }
+
+    if ((params.max_step > 0.0) && (abs(step) > params.max_step))
+    {
+      step = (step > 0.0) ? params.max_step : -params.max_step;
+    }
+  }
+
+  if (ohm)
+  {
+    (*ohm)["points"] = ObjectHolder(point_list);
+    (*ohm)["converged"] = ObjectHolder(converged);
+  }
+
+  allowBlockSolve = true;
+
+  return converged;
+}
+
+template <typename DoubleType>
+bool Newton<DoubleType>::TransientSolve(LinearSolver<DoubleType> &itermethod, const TransientParams<DoubleType> &params, ObjectHolderMap_t *ohm)
+{
+  InstanceKeeper &ik = InstanceKeeper::instance();
+  TimeData<DoubleType> &tinst = TimeData<DoubleType>::GetInstance();
+
+  if (!tinst.ExistsQ(TimePoint_t::TM0))
+  {
+    OutputStream::WriteOut(OutputStream::OutputType::ERROR, "A \"transient_dc\" solve is required before the transient simulation.\n");
+    return false;
+  }
+
+  const std::string backup_suffix = "_transient";
+
+  ObjectHolderList_t point_list;
+
+  DoubleType time = params.start_time;
+  DoubleType step = params.step_size;
+
+  const size_t target_iterations = (params.target_iterations > 0) ? params.target_iterations : 1;
+
+  DoubleType min_step = params.min_step;
+  if (min_step <= 0.0)
+  {
+    min_step = 1.0e-9 * (params.stop_time - params.start_time);
+  }
+  size_t failures = 0;
+
+  //// the history from before the simulation may not be smooth
+  bool restart = true;
+  bool converged = true;
+
+  while (converged && (time < params.stop_time))
+  {
+    //// a break point within roundoff of the current time has already been reached
+    DoubleType next_break = static_cast<DoubleType>(ik.NextBreakPoint(static_cast<double>(time)));
+    while ((next_break - time) <= 1.0e-9 * params.step_size)
+    {
+      next_break = static_cast<DoubleType>(ik.NextBreakPoint(static_cast<double>(next_break)));
+    }
+    const DoubleType target = (next_break < params.stop_time) ? next_break : params.stop_time;
+
+    if ((params.max_step > 0.0) && (step > params.max_step))
+    {
+      step = params.max_step;
+    }
+
+    //// land exactly on the target, and split the remaining interval instead of leaving a sliver of a step before it
+    DoubleType h = step;
+    const bool lands = ((time + h) >= target);
+    if (lands)
+    {
+      h = target - time;
+    }
+    else if ((time + 2.0 * h) > target)
+    {
+      h = 0.5 * (target - time);
+    }
+    const DoubleType next_time = (lands) ? target : time + h;
+
+    const bool use_bdf1 = restart || (params.method == TransientParams<DoubleType>::Method::BDF1);
+
+    {
+      std::ostringstream os;
+      os << "Transient: " << ((use_bdf1) ? "BDF1 " : "TR-BDF2 ") << std::scientific << std::setprecision(5) << time << " -> " << next_time << "\n";
+      OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
+    }
+
+    BackupSolutions(backup_suffix);
+    tinst.Backup();
+
+    bool step_converged = false;
+    size_t iterations = 0;
+    if (use_bdf1)
+    {
+      ik.updateSignals(static_cast<double>(next_time));
+      step_converged = Solve(itermethod, TimeMethods::BDF1<DoubleType>(h, 1.0), nullptr);
+      iterations = iterationCount;
+    }
+    else
+    {
+      ik.updateSignals(static_cast<double>(time + params.gamma * h));
+      step_converged = Solve(itermethod, TimeMethods::TR<DoubleType>(h, params.gamma), nullptr);
+      iterations = iterationCount;
+      if (step_converged)
+      {
+        ik.updateSignals(static_cast<double>(next_time));
+        step_converged = Solve(itermethod, TimeMethods::BDF2<DoubleType>(h, params.gamma), nullptr);
+        iterations = std::max(iterations, iterationCount);
+      }
+    }
+
+    if (ohm)
+    {
+      ObjectHolderMap_t pmap;
+      pmap["time"] = ObjectHolder(static_cast<double>(next_time));
+      pmap["iterations"] = ObjectHolder(static_cast<int>(iterations));
+      pmap["converged"] = ObjectHolder(step_converged);
+      pmap["method"] = ObjectHolder(std::string((use_bdf1) ? "bdf1" : "trbdf2"));
+      point_list.push_back(ObjectHolder(pmap));
+    }
+
+    if (step_converged)
+    {
+      time = next_time;
+      failures = 0;
+
+      if (params.callback)
+      {
+        Interpreter MyInterp;
+        std::vector<ObjectHolder> arguments{ObjectHolder(static_cast<double>(time))};
+        if (!MyInterp.RunCommand(*params.callback, arguments))
+        {
+          std::ostringstream os;
+          os << "Error when evaluating transient callback with result \"" << MyInterp.GetErrorString() << "\"\n";
+          OutputStream::WriteOut(OutputStream::OutputType::FATAL, os.str().c_str());
+        }
+      }
+
+      //// the source derivative is discontinuous at a break point
+      restart = lands && (target == next_break);
+      if (restart)
+      {
+        step = params.step_size;
+      }
+      else
+      {
+        //// aim for the target number of iterations on the next step
+        DoubleType factor = static_cast<DoubleType>(target_iterations) / static_cast<DoubleType>((iterations > 0) ? iterations : 1);
+        if (factor > 2.0)
+        {
+          factor = 2.0;
+        }
+        else if (factor < 0.5)
+        {
+          factor = 0.5;
+        }
+        step = h * factor;
+      }
+    }
+    else
+    {
+      RestoreSolutions(backup_suffix);
+      tinst.Restore();
+      ik.updateSignals(static_cast<double>(time));
+      step = 0.5 * h;
+      ++failures;
+      if (failures >= params.max_failures)
+      {
+        std::ostringstream os;
+        os << "Transient failed to converge " << failures << " times in a row\n";
+        OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
+        converged = false;
+      }
+      else if (step < min_step)
+      {
+        std::ostringstream os;
+        os << "Transient step " << std::scientific << std::setprecision(5) << step << " is below minimum step " << min_step << "\n";
+        OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
+        converged = false;
+      }
+    }
+  }
+
+  if (ohm)
+  {
+    (*ohm)["points"] = ObjectHolder(point_list);
+    (*ohm)["time"] = ObjectHolder(static_cast<double>(time));
+    (*ohm)["converged"] = ObjectHolder(converged);
+  }
+
+  return converged;
+}
+
+/// The equations on each node are one block, and the circuit equations are blocks of one
+template <typename DoubleType>
+Matrix<DoubleType> *Newton<DoubleType>::CreateSolverMatrix(Preconditioner<DoubleType> &preconditioner, size_t begin)
+{
+  if (!preconditioner.UsesBlockMatrix())
+  {
+    return CreateMatrix(&preconditioner);
+  }
+
+  const size_t numeqns = preconditioner.size();
+  const size_t end = begin + numeqns;
+
+  std::vector<const Region *> regions;
+  size_t block_size = 1;
+  for (auto dit : GlobalData::GetInstance().GetDeviceList())
+  {
+    for (auto rit : dit.second->GetRegionList())
+    {
+      const Region *rp = rit.second;
+      const size_t base = rp->GetBaseEquationNumber();
+      if ((rp->GetNumberEquations() != 0) && (base != size_t(-1)) && (base >= begin) && (base < end))
+      {
+        regions.push_back(rp);
+        block_size = std::max(block_size, rp->GetNumberEquations());
+      }
+    }
+  }
+
+  BlockLayout layout(numeqns, block_size);
+  std::vector<size_t> eqs;
+  for (auto rp : regions)
+  {
+    for (auto np : rp->GetNodeList())
+    {
+      eqs.clear();
+      for (size_t i = 0; i < rp->GetNumberEquations(); ++i)
+      {
+        eqs.push_back(OrderedEquation(rp->GetEquationNumber(i, np)) - begin);
+      }
+      layout.AddBlock(eqs);
+    }
+  }
+  layout.Finalize();
+
+  if (IsVerbose())
+  {
+    std::ostringstream os;
+    os << "block matrix: block size " << layout.GetBlockSize() << " number of blocks " << layout.GetNumberBlocks() << "\n";
+    OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
+  }
+
+  return new BlockCompressedMatrix<DoubleType>(layout);
+}
+
+template <typename DoubleType>
+void Newton<DoubleType>::NumberEquationOrdering(size_t numeqns, ObjectHolderMap_t *ohm)
+{
+  GlobalData &gdata = GlobalData::GetInstance();
+
+  std::string name;
+  auto dbent = gdata.GetDBEntryOnGlobal("equation_ordering");
+  if (dbent.first)
+  {
+    name = dbent.second.GetString();
+  }
+
+  SparseOrdering::OrderingType type = SparseOrdering::OrderingType::NONE;
+  if (!SparseOrdering::GetOrderingType(name, type))
+  {
+    std::ostringstream os;
+    os << "\"equation_ordering\" parameter \"" << name << "\" is not \"none\", \"rcm\", \"amd\", or \"nd\".\n";
+    OutputStream::WriteOut(OutputStream::OutputType::ERROR, os.str());
+    type = SparseOrdering::OrderingType::NONE;
+  }
+
+  if (type == SparseOrdering::OrderingType::NONE)
+  {
+    equationOrder.clear();
+    equationOrderName.clear();
+    return;
+  }
+
+  //// the ordering is kept while the device equations are numbered the same way
+  const GlobalData::DeviceList_t &dlist = gdata.GetDeviceList();
+  std::vector<const Region *> regions;
+  std::ostringstream key;
+  key << name << " " << numeqns;
+  for (auto dit : dlist)
+  {
+    for (auto rit : dit.second->GetRegionList())
+    {
+      const Region *rp = rit.second;
+      if (rp->GetNumberEquations() != 0)
+      {
+        regions.push_back(rp);
+        key << " " << rp->GetBaseEquationNumber();
+      }
+    }
+  }
+
+  if ((equationOrderName == key.str()) && (equationOrder.size() == numeqns))
+  {
+    return;
+  }
+
+  //// all of the equations on a node share one vertex, so they are numbered together
+  std::map<const Region *, size_t> vertex_offset;
+  std::vector<std::pair<const Region *, size_t>> vertices;
+  for (auto rp : regions)
+  {
+    vertex_offset[rp] = vertices.size();
+    for (size_t i = 0; i < rp->GetNumberNodes(); ++i)
+    {
+      vertices.push_back(std::make_pair(rp, i));
+    }
+  }
+
+  SparseOrdering::Graph_t graph(vertices.size());
+  for (auto rp : regions)
+  {
+    const size_t offset = vertex_offset[rp];
+    for (auto ep : rp->GetEdgeList())
+    {
+      const size_t h = offset + ep->GetHead()->GetIndex();
+      const size_t t = offset + ep->GetTail()->GetIndex();
+      graph[h].push_back(t);
+      graph[t].push_back(h);
+    }
+  }
+
+  for (auto dit : dlist)
+  {
+    for (auto iit : dit.second->GetInterfaceList())
+    {
+      const Interface &interface = *(iit.second);
+      auto it0 = vertex_offset.find(interface.GetRegion0());
+      auto it1 = vertex_offset.find(interface.GetRegion1());
+      if ((it0 == vertex_offset.end()) || (it1 == vertex_offset.end()))
+      {
+        continue;
+      }
+      const auto &nodes0 = interface.GetNodes0();
+      const auto &nodes1 = interface.GetNodes1();
+      for (size_t i = 0; i < nodes0.size(); ++i)
+      {
+        const size_t v0 = it0->second + nodes0[i]->GetIndex();
+        const size_t v1 = it1->second + nodes1[i]->GetIndex();
+        graph[v0].push_back(v1);
+        graph[v1].push_back(v0);
+      }
+    }
+  }
+
+  const std::vector<size_t> &order = SparseOrdering::ComputeOrdering(graph, type);
+
+  equationOrder.assign(numeqns, size_t(-1));
+  size_t next = 0;
+  for (auto v : order)
+  {
+    const Region *rp = vertices[v].first;
+    ConstNodePtr np = rp->GetNodeList()[vertices[v].second];
+    for (size_t i = 0; i < rp->GetNumberEquations(); ++i)
+    {
+      equationOrder[rp->GetEquationNumber(i, np)] = next++;
+    }
+  }
+
+  //// the circuit equations remain at the end
+  for (auto &e : equationOrder)
+  {
+    if (e == size_t(-1))
+    {
+      e = next++;
+    }
+  }
+  dsAssert(next == numeqns, "UNEXPECTED");
+
+  equationOrderName = key.str();
+
+  const SparseOrdering::Statistics before = SparseOrdering::GetStatistics(graph, std::vector<size_t>());
+  const SparseOrdering::Statistics after = SparseOrdering::GetStatistics(graph, order);
+
+  std::ostringstream os;
+  os << "equation ordering " << name << ": node bandwidth " << before.bandwidth << " -> " << after.bandwidth << ", node fill " << before.fill << " -> " << after.fill << "\n";
+  OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
+
+  if (ohm)
+  {
+    ObjectHolderMap_t omap;
+    omap["type"] = ObjectHolder(name);
+    omap["bandwidth_before"] = ObjectHolder(static_cast<int>(before.bandwidth));
+    omap["bandwidth_after"] = ObjectHolder(static_cast<int>(after.bandwidth));
+    omap["fill_before"] = ObjectHolder(static_cast<double>(before.fill));
+    omap["fill_after"] = ObjectHolder(static_cast<double>(after.fill));
+    (*ohm)["ordering"] = ObjectHolder(omap);
+  }
+}
+
+template <typename DoubleType>
+void Newton<DoubleType>::ApplyEquationOrder(const DoubleVec_t<DoubleType> &x, DoubleVec_t<DoubleType> &y) const
+{
+  const size_t len = x.size();
+  y.resize(len);
+  for (size_t i = 0; i < len; ++i)
+  {
+    y[equationOrder[i]] = x[i];
+  }
+}
+
+template <typename DoubleType>
+void Newton<DoubleType>::RemoveEquationOrder(const DoubleVec_t<DoubleType> &x, DoubleVec_t<DoubleType> &y) const
+{
+  const size_t len = x.size();
+  y.resize(len);
+  for (size_t i = 0; i < len; ++i)
+  {
+    y[i] = x[equationOrder[i]];
+  }
+}
+
+template <typename DoubleType>
+bool Newton<DoubleType>::SolveOrdered(LinearSolver<DoubleType> &itermethod, Matrix<DoubleType> &matrix, Preconditioner<DoubleType> &preconditioner, DoubleVec_t<DoubleType> &result, DoubleVec_t<DoubleType> &rhs)
+{
+  if (equationOrder.empty())
+  {
+    return itermethod.Solve(matrix, preconditioner, result, rhs);
+  }
+
+  DoubleVec_t<DoubleType> ordered_rhs;
+  DoubleVec_t<DoubleType> ordered_result(result.size());
+  ApplyEquationOrder(rhs, ordered_rhs);
+  const bool ret = itermethod.Solve(matrix, preconditioner, ordered_result, ordered_rhs);
+  RemoveEquationOrder(ordered_result, result);
+  return ret;
+}
+
+template <typename DoubleType>
+void Newton<DoubleType>::PrintNumberEquations(size_t numeqns, ObjectHolderMap_t *ohm)
+{
+  std::ostringstream os;
+  os << "number of equations " << numeqns << "\n";
+  OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
+  if (ohm)
+  {
+    (*ohm)["number_of_equations"] = ObjectHolder(static_cast<int>(numeqns));
+  }
+}
+
+template <typename DoubleType>
+void Newton<DoubleType>::PrintIteration(size_t iter, ObjectHolderMap_t *ohm)
+{
+  std::ostringstream os;
+  os << "Iteration: " << iter << "\n";
+  OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
+  if (ohm)
+  {
+    (*ohm)["iteration"] = ObjectHolder(static_cast<int>(iter));
   }
 }
 
@@ -1044,20 +2356,16 @@ bool Newton<DoubleType>::CheckTransientProjection(const TimeMethods::TimeParams<
   tinst.AssembleI(TimePoint_t::TM0, - timeinfo.tdelta, projectQ);
   tinst.AssembleQ(TimePoint_t::TM0, 1.0,    projectQ);
 
-  DoubleType qrel = 0.0;
-  for (size_t i = 0; i < numeqns; ++i)
-  {
+  const DoubleType qrel = ParallelMax<DoubleType>(numeqns, [&](size_t i) {
     const DoubleType &qproj = projectQ[i];
     const DoubleType &qnew  = newQ[i];
+    DoubleType qr = 0.0;
     if (qnew != 0.0)
     {
-      const DoubleType qr = abs(qnew - qproj)/(1.0e-20 + abs(qnew) + abs(qproj));
-      if (qr > qrel)
-      {
-        qrel = qr;
-      }
+      qr = abs(qnew - qproj)/(1.0e-20 + abs(qnew) + abs(qproj));
     }
-  }
+    return qr;
+  }).first;
   std::ostringstream os;
   os << "Charge Relative Error " << std::scientific << std::setprecision(5) << qrel << "\n";
   OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
@@ -1160,6 +2468,9 @@ bool Newton<DoubleType>::ACSolve(LinearSolver<DoubleType> &itermethod, DoubleTyp
 
   const size_t numeqns = NumberEquationsAndSetDimension();
 
+  //// the complex matrix is assembled in the natural order
+  equationOrder.clear();
+
   if (nk.HaveNodes())
   {
     nk.InitializeSolution("ssac_real");
@@ -1246,6 +2557,9 @@ bool Newton<DoubleType>::NoiseSolve(const std::string &output_name, LinearSolver
   NodeKeeper &nk = NodeKeeper::instance();
   const size_t numeqns = NumberEquationsAndSetDimension();
 
+  //// the complex matrix is assembled in the natural order
+  equationOrder.clear();
+
   size_t outputeqnnum = size_t(-1);
 
   if (!nk.HaveNodes())
@@ -14,6 +14,8 @@ SPDX-License-Identifier: Apache-2.0
 #include <vector>
 #include <complex>
 #include <map>
+#include <memory>
+#include <string>
 
 class PermutationEntry;
 
@@ -31,6 +33,9 @@ class Matrix;
 template <typename DoubleType>
 class LinearSolver;
 
+template <typename DoubleType>
+class Preconditioner;
+
 namespace TimeMethods {
     enum class TimeMethod_t {DCONLY, INTEGRATEDC, INTEGRATETR, INTEGRATEBDF1, INTEGRATEBDF2};
 
@@ -143,6 +148,45 @@ struct TR : public TimeParams<DoubleType>
 
 }
 
+/// Parameters for stepping a device parameter, such as a contact bias, from its current value to end_value
+template <typename DoubleType>
+struct ContinuationParams {
+  std::string device;
+  std::string parameter;
+  DoubleType  end_value = 0.0;
+  DoubleType  step_size = 0.0;
+  /// A value of 0 uses a millionth of the sweep
+  DoubleType  min_step = 0.0;
+  DoubleType  max_step = 0.0;
+  /// The step is grown or shrunk so each point converges in about this many iterations
+  size_t      target_iterations = 4;
+  /// The sweep fails after this many points in a row fail to converge
+  size_t      max_failures = 10;
+  /// Called with the device name after each converged point
+  ObjectHolder *callback = nullptr;
+};
+
+/// Parameters for integrating from start_time to stop_time, with steps clipped to the break points of the circuit sources
+template <typename DoubleType>
+struct TransientParams {
+  enum class Method {BDF1, TRBDF2};
+  Method      method = Method::TRBDF2;
+  DoubleType  start_time = 0.0;
+  DoubleType  stop_time = 0.0;
+  DoubleType  step_size = 0.0;
+  /// A value of 0 uses a billionth of the simulated time, since steps must resolve the source edges
+  DoubleType  min_step = 0.0;
+  DoubleType  max_step = 0.0;
+  /// Fraction of each TR-BDF2 step taken with the trapezoidal rule
+  DoubleType  gamma = 0.0;
+  /// The step is grown or shrunk so each point converges in about this many iterations
+  size_t      target_iterations = 4;
+  /// The simulation fails after this many points in a row fail to converge
+  size_t      max_failures = 10;
+  /// Called with the time after each converged point
+  ObjectHolder *callback = nullptr;
+};
+
 template <typename DoubleType>
 class Newton {
     public:
@@ -159,6 +203,12 @@ class Newton {
 
         bool Solve(LinearSolver<DoubleType> &, const TimeMethods::TimeParams<DoubleType> &, ObjectHolderMap_t *ohm);
 
+        /// DC sweep of a device parameter using the tangent from the last converged factorization as the initial guess
+        bool ContinuationSolve(LinearSolver<DoubleType> &, const ContinuationParams<DoubleType> &, ObjectHolderMap_t *ohm);
+
+        /// Transient simulation landing exactly on each source break point, and restarting with BDF1 after it
+        bool TransientSolve(LinearSolver<DoubleType> &, const TransientParams<DoubleType> &, ObjectHolderMap_t *ohm);
+
         bool ACSolve(LinearSolver<DoubleType> &, DoubleType);
 
         bool NoiseSolve(const std::string &, LinearSolver<DoubleType> &, DoubleType);
@@ -191,6 +241,10 @@ class Newton {
         {
             symbolicIterationLimit = x;
         }
+        void SetReportTiming(bool x)
+        {
+            reportTiming = x;
+        }
 
 
     protected:
@@ -213,9 +267,40 @@ class Newton {
         void PrintIteration(size_t, ObjectHolderMap_t *);
 
         size_t NumberEquationsAndSetDimension();
+        size_t NumberDeviceEquations(Device &, size_t /*eqnnum*/, bool /*verbose*/);
+        size_t NumberCircuitEquations(size_t /*eqnnum*/, bool /*verbose*/);
 
-        void BackupSolutions();
-        void RestoreSolutions();
+        /// Devices, and the circuit, which share no equations
+        struct EquationBlock;
+        /// Numbers the equations so that each block is contiguous
+        size_t NumberEquationBlocks(std::vector<EquationBlock> &);
+        bool BlockSolve(LinearSolver<DoubleType> &, std::vector<EquationBlock> &, size_t /*numeqns*/, ObjectHolderMap_t *ohm);
+        void IterateBlock(LinearSolver<DoubleType> &, EquationBlock &, permvec_t &, DoubleVec_t<DoubleType> &, bool /*new_symbolic*/);
+        void LoadBlockMatrixAndRHS(EquationBlock &, DoubleVec_t<DoubleType> &, permvec_t &);
+
+        void BackupSolutions(const std::string &suffix = "_prev");
+        void RestoreSolutions(const std::string &suffix = "_prev");
+
+        void ApplyUpdate(const DoubleVec_t<DoubleType> &);
+
+        /// Renumbers the matrix from the "equation_ordering" parameter
+        void NumberEquationOrdering(size_t /*numeqns*/, ObjectHolderMap_t *);
+        size_t OrderedEquation(size_t i) const
+        {
+          return (equationOrder.empty()) ? i : equationOrder[i];
+        }
+        /// between the assembled rhs and the ordered matrix
+        void ApplyEquationOrder(const DoubleVec_t<DoubleType> &, DoubleVec_t<DoubleType> &) const;
+        void RemoveEquationOrder(const DoubleVec_t<DoubleType> &, DoubleVec_t<DoubleType> &) const;
+        bool SolveOrdered(LinearSolver<DoubleType> &, Matrix<DoubleType> &, Preconditioner<DoubleType> &, DoubleVec_t<DoubleType> &, DoubleVec_t<DoubleType> &);
+
+        /// The matrix for the preconditioner, where begin is the first equation of an uncoupled block
+        Matrix<DoubleType> *CreateSolverMatrix(Preconditioner<DoubleType> &, size_t /*begin*/);
+
+        bool SolveParameterTangent(const ContinuationParams<DoubleType> &, DoubleType /*value*/, DoubleType /*delta*/, DoubleVec_t<DoubleType> &);
+
+        /// The models of each region are evaluated on their own thread before the equations are assembled
+        void PrefetchModels(dsMathEnum::WhatToLoad);
 
         template <typename T>
         void LoadMatrixAndRHS(Matrix<DoubleType> &, std::vector<T> &, permvec_t &, dsMathEnum::WhatToLoad, dsMathEnum::TimeMode, T);
@@ -245,10 +330,26 @@ class Newton {
         DoubleType relLimit = 0.0;  /// The calculated rel error
         DoubleType maxLimit = 0.0; // The maximum absolute error before solver failure
         DoubleType qrelLimit = 0.0;
+        bool reportTiming = false; // add the phase times to the info of Solve
 
 
         size_t dimension = 0;
 
+        /// Number of iterations taken by the last call to Solve
+        size_t iterationCount = 0;
+
+        /// DC solves factor uncoupled blocks separately, and in parallel
+        bool allowBlockSolve = true;
+
+        /// Factorization of the jacobian from the last converged call to Solve
+        std::unique_ptr<Preconditioner<DoubleType>> factoredPreconditioner;
+        std::unique_ptr<Matrix<DoubleType>>         factoredMatrix;
+        permvec_t                                   factoredPermvec;
+
+        /// The matrix row and column of each equation, empty for the natural numbering
+        /// Only the matrix is renumbered, and the rhs and update are permuted around the linear solve
+        std::vector<size_t> equationOrder;
+        std::string         equationOrderName;
 };
 }
 #endif
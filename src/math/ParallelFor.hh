@@ -0,0 +1,66 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#ifndef DS_PARALLEL_FOR_HH
+#define DS_PARALLEL_FOR_HH
+
+#include <cstddef>
+#include <future>
+#include <vector>
+#include <algorithm>
+
+#include "GetNumberOfThreads.hh"
+#include "FPECheck.hh"
+
+namespace dsMath {
+/// Calls f(begin, end) on contiguous ranges covering [0, len)
+/// The "threads_available" and "threads_task_size" parameters set the number of ranges
+/// Each range must only write its own entries, so the result does not depend on the number of threads
+/// Each index is counted as grain items when comparing with the task size
+template <typename F>
+void ParallelFor(size_t len, const F &f, size_t grain = 1)
+{
+  const size_t num_threads = ThreadInfo::GetNumberOfThreads();
+  const size_t task_size   = std::max<size_t>(ThreadInfo::GetMinimumTaskSize(), 1);
+  const size_t num_tasks   = std::min({num_threads, len, (len * grain) / task_size});
+
+  if (num_tasks < 2)
+  {
+    f(0, len);
+    return;
+  }
+
+  auto worker = [&f](size_t b, size_t e) -> FPECheck::FPEFlag_t {
+    FPECheck::ClearFPE();
+    f(b, e);
+    return FPECheck::getFPEFlags();
+  };
+
+  std::vector<std::future<FPECheck::FPEFlag_t>> futures;
+  const size_t step = len / num_tasks;
+  for (size_t i = 0; i < num_tasks; ++i)
+  {
+    const size_t b = i * step;
+    const size_t e = (i + 1 == num_tasks) ? len : b + step;
+    futures.push_back(std::async(std::launch::async, worker, b, e));
+  }
+
+  FPECheck::FPEFlag_t fpeFlag = FPECheck::getClearedFlag();
+  for (auto &fut : futures)
+  {
+    fpeFlag = FPECheck::combineFPEFlags(fpeFlag, fut.get());
+  }
+
+  if (FPECheck::CheckFPE(fpeFlag))
+  {
+    //// Raise FPE in the calling thread
+    FPECheck::raiseFPE(fpeFlag);
+  }
+}
+}
+#endif
+
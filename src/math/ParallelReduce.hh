@@ -0,0 +1,131 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#ifndef DS_PARALLEL_REDUCE_HH
+#define DS_PARALLEL_REDUCE_HH
+
+#include "ParallelFor.hh"
+
+#include <cmath>
+#include <vector>
+#include <utility>
+
+namespace dsMath {
+/// Compensated summation (Neumaier)
+template <typename DoubleType>
+class CompensatedSum {
+  public:
+    CompensatedSum() : sum_(0.0), correction_(0.0)
+    {
+    }
+
+    void Add(DoubleType v)
+    {
+      using std::abs;
+      const DoubleType t = sum_ + v;
+      if (abs(sum_) >= abs(v))
+      {
+        correction_ += (sum_ - t) + v;
+      }
+      else
+      {
+        correction_ += (v - t) + sum_;
+      }
+      sum_ = t;
+    }
+
+    DoubleType GetValue() const
+    {
+      return sum_ + correction_;
+    }
+
+  private:
+    DoubleType sum_;
+    DoubleType correction_;
+};
+
+namespace ParallelReduce {
+/// The blocks do not depend on the number of threads
+const size_t blockSize = 256;
+}
+
+/// Sum of f(i) over [0, len)
+/// Each block of terms is added with compensated summation, and the block sums are added pairwise in a fixed order
+/// So the result does not depend on the number of threads
+template <typename DoubleType, typename F>
+DoubleType ParallelSum(size_t len, const F &f)
+{
+  const size_t bsize = ParallelReduce::blockSize;
+  const size_t nblocks = (len + bsize - 1) / bsize;
+  if (nblocks == 0)
+  {
+    return DoubleType(0.0);
+  }
+
+  std::vector<DoubleType> partial(nblocks);
+  ParallelFor(nblocks, [&](size_t beg, size_t end) {
+    for (size_t b = beg; b < end; ++b)
+    {
+      CompensatedSum<DoubleType> sum;
+      const size_t iend = std::min(len, (b + 1) * bsize);
+      for (size_t i = b * bsize; i < iend; ++i)
+      {
+        sum.Add(f(i));
+      }
+      partial[b] = sum.GetValue();
+    }
+  }, bsize);
+
+  for (size_t width = 1; width < nblocks; width *= 2)
+  {
+    for (size_t b = 0; b + width < nblocks; b += 2 * width)
+    {
+      partial[b] += partial[b + width];
+    }
+  }
+  return partial[0];
+}
+
+/// Maximum of f(i) over [0, len), and the lowest index with this value
+/// Returns zero and index 0 when all of the values are less than or equal to zero
+template <typename DoubleType, typename F>
+std::pair<DoubleType, size_t> ParallelMax(size_t len, const F &f)
+{
+  const size_t bsize = ParallelReduce::blockSize;
+  const size_t nblocks = (len + bsize - 1) / bsize;
+
+  std::vector<std::pair<DoubleType, size_t>> partial(nblocks, std::make_pair(DoubleType(0.0), size_t(0)));
+  ParallelFor(nblocks, [&](size_t beg, size_t end) {
+    for (size_t b = beg; b < end; ++b)
+    {
+      auto &p = partial[b];
+      const size_t iend = std::min(len, (b + 1) * bsize);
+      for (size_t i = b * bsize; i < iend; ++i)
+      {
+        const DoubleType v = f(i);
+        if (v > p.first)
+        {
+          p.first = v;
+          p.second = i;
+        }
+      }
+    }
+  }, bsize);
+
+  std::pair<DoubleType, size_t> ret(DoubleType(0.0), size_t(0));
+  for (const auto &p : partial)
+  {
+    if (p.first > ret.first)
+    {
+      ret = p;
+    }
+  }
+  return ret;
+}
+}
+#endif
+
@@ -10,7 +10,15 @@ SPDX-License-Identifier: Apache-2.0
 #include "Matrix.hh"
 #include "FPECheck.hh"
 #include "OutputStream.hh"
+#include <chrono>
 namespace dsMath {
+namespace {
+double ElapsedSeconds(const std::chrono::steady_clock::time_point &tic)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - tic).count();
+}
+}
+
 template <typename DoubleType>
 Preconditioner<DoubleType>::~Preconditioner()
 {
@@ -36,7 +44,9 @@ bool Preconditioner<DoubleType>::LUFactor(Matrix<DoubleType> *mat)
 
   FPECheck::ClearFPE();
 
+  const auto tic = std::chrono::steady_clock::now();
   bool ret = this->DerivedLUFactor(matrix_);
+  factor_time_ += ElapsedSeconds(tic);
 
 #if (defined(__arm64__) && defined(__APPLE__)) || defined(__aarch64__)
   FPECheck::ClearFPE();
@@ -68,8 +78,9 @@ bool Preconditioner<DoubleType>::LUSolve(DoubleVec_t<DoubleType> &x, const Doubl
 
   FPECheck::ClearFPE();
 
-  //// This should be able to return a value too
-  this->DerivedLUSolve(x, b);
+  const auto tic = std::chrono::steady_clock::now();
+  const bool solved = this->DerivedLUSolve(x, b);
+  solve_time_ += ElapsedSeconds(tic);
 
 #if (defined(__arm64__) && defined(__APPLE__)) || defined(__aarch64__)
   FPECheck::ClearFPE();
@@ -84,7 +95,7 @@ bool Preconditioner<DoubleType>::LUSolve(DoubleVec_t<DoubleType> &x, const Doubl
   }
   else
   {
-    ret = true;
+    ret = solved;
   }
 
   return ret;
@@ -100,8 +111,9 @@ bool Preconditioner<DoubleType>::LUSolve(ComplexDoubleVec_t<DoubleType> &x, cons
 
   bool ret = false;
 
-  //// This should be able to return a value too
-  this->DerivedLUSolve(x, b);
+  const auto tic = std::chrono::steady_clock::now();
+  const bool solved = this->DerivedLUSolve(x, b);
+  solve_time_ += ElapsedSeconds(tic);
 
 #if (defined(__arm64__) && defined(__APPLE__)) || defined(__aarch64__)
   FPECheck::ClearFPE();
@@ -116,7 +128,7 @@ bool Preconditioner<DoubleType>::LUSolve(ComplexDoubleVec_t<DoubleType> &x, cons
   }
   else
   {
-    ret = true;
+    ret = solved;
   }
 
   return ret;
@@ -8,6 +8,7 @@ SPDX-License-Identifier: Apache-2.0
 #ifndef PRECONDITIONER_HH
 #define PRECONDITIONER_HH
 #include "dsMathTypes.hh"
+#include <vector>
 namespace dsMath {
 template <typename DoubleType>
 class Matrix;
@@ -25,6 +26,18 @@ class Preconditioner {
     virtual dsMath::CompressionType GetRealMatrixCompressionType() const = 0;
     virtual dsMath::CompressionType GetComplexMatrixCompressionType() const = 0;
 
+    /// true when the matrix should be a BlockCompressedMatrix
+    virtual bool UsesBlockMatrix() const
+    {
+      return false;
+    }
+
+    /// The matrix row of each equation, when the equations are renumbered
+    /// An empty vector is the natural numbering, and size_t(-1) is an equation not in this matrix
+    virtual void SetEquationOrder(const std::vector<size_t> &)
+    {
+    }
+
     Preconditioner(size_t /*numeqns*/, PEnum::TransposeType_t /*tranpose*/);
     bool LUFactor(Matrix<DoubleType> *);     // Factor the matrix
 
@@ -38,9 +51,13 @@ class Preconditioner {
 
     inline size_t size() const {return size_;}
 
+    /// Accumulated wall time in seconds for performance reporting
+    double GetFactorTime() const {return factor_time_;}
+    double GetSolveTime() const {return solve_time_;}
+
   protected:
-    virtual void DerivedLUSolve(DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const =0;
-    virtual void DerivedLUSolve(ComplexDoubleVec_t<DoubleType> &x, const ComplexDoubleVec_t<DoubleType> &b) const =0;
+    virtual bool DerivedLUSolve(DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const =0;
+    virtual bool DerivedLUSolve(ComplexDoubleVec_t<DoubleType> &x, const ComplexDoubleVec_t<DoubleType> &b) const =0;
     virtual bool DerivedLUFactor(Matrix<DoubleType> *)=0;     // Factor the matrix
 
     Matrix<DoubleType> &GetMatrix()
@@ -53,7 +70,9 @@ class Preconditioner {
     bool factored;
     PEnum::TransposeType_t transpose_solve_;
     Matrix<DoubleType> *matrix_;
-
+    double factor_time_ = 0.0;
+    //// LUSolve is const
+    mutable double solve_time_ = 0.0;
 };
 }
 #endif
@@ -7,6 +7,10 @@ SPDX-License-Identifier: Apache-2.0
 
 #include "SolverUtil.hh"
 #include "BlockPreconditioner.hh"
+#include "BlockILUPreconditioner.hh"
+#include "AMGPreconditioner.hh"
+#include "FieldSplitPreconditioner.hh"
+#include "SparseLUPreconditioner.hh"
 #ifdef USE_MKL_PARDISO
 #include "MKLPardisoPreconditioner.hh"
 #endif
@@ -34,6 +38,7 @@ enum class DirectSolver {
   UNKNOWN,
   MKLPARDISO,
   SUPERLU,
+  SPARSELU,
   CUSTOM,
 };
 
@@ -67,6 +72,10 @@ DirectSolver GetDirectSolver()
       OutputStream::WriteOut(OutputStream::OutputType::FATAL, os.str());
 #endif
     }
+    else if (val == "sparse_lu")
+    {
+      ret = DirectSolver::SPARSELU;
+    }
     else if (val == "custom")
     {
       ret = DirectSolver::CUSTOM;
@@ -91,14 +100,14 @@ DirectSolver GetDirectSolver()
     else
     {
       std::ostringstream os;
-      os << "Unrecognized \"direct_solver\" parameter value \"" << val << "\". Valid options are \"mkl_pardiso\", \"superlu\" or \"custom\".\n";
+      os << "Unrecognized \"direct_solver\" parameter value \"" << val << "\". Valid options are \"mkl_pardiso\", \"superlu\", \"sparse_lu\" or \"custom\".\n";
       OutputStream::WriteOut(OutputStream::OutputType::FATAL, os.str());
     }
     return ret;
   }
 
   std::ostringstream os;
-  os << "Parameter \"direct_solver\" parameter not set. Valid options are \"mkl_pardiso\", or \"custom\".\n";
+  os << "Parameter \"direct_solver\" parameter not set. Valid options are \"mkl_pardiso\", \"sparse_lu\", or \"custom\".\n";
 
 #if defined(USE_MKL_PARDISO)
   if (MathLoader::IsMKLLoaded())
@@ -117,6 +126,94 @@ DirectSolver GetDirectSolver()
   return ret;
 }
 
+dsMath::SparseOrdering::OrderingType GetSparseLUOrdering()
+{
+  dsMath::SparseOrdering::OrderingType ret = dsMath::SparseOrdering::OrderingType::ND;
+  GlobalData &gdata = GlobalData::GetInstance();
+  auto dbent = gdata.GetDBEntryOnGlobal("sparse_lu_ordering");
+  if (dbent.first)
+  {
+    const auto &val = dbent.second.GetString();
+    if (!dsMath::SparseOrdering::GetOrderingType(val, ret))
+    {
+      std::ostringstream os;
+      os << "Unrecognized \"sparse_lu_ordering\" parameter value \"" << val << "\". Valid options are \"none\", \"rcm\", \"amd\", or \"nd\".\n";
+      OutputStream::WriteOut(OutputStream::OutputType::FATAL, os.str());
+    }
+  }
+  return ret;
+}
+
+#if defined(LOAD_MATHLIBS)
+enum class IterativePreconditioner {
+  BLOCK_DIRECT,
+  BLOCK_JACOBI,
+  BLOCK_ILU,
+  AMG,
+  FIELD_SPLIT,
+};
+
+IterativePreconditioner GetIterativePreconditioner()
+{
+  IterativePreconditioner ret = IterativePreconditioner::BLOCK_DIRECT;
+  GlobalData &gdata = GlobalData::GetInstance();
+  auto dbent = gdata.GetDBEntryOnGlobal("iterative_preconditioner");
+  if (dbent.first)
+  {
+    const auto &val = dbent.second.GetString();
+    if (val == "block_jacobi")
+    {
+      ret = IterativePreconditioner::BLOCK_JACOBI;
+    }
+    else if (val == "block_ilu")
+    {
+      ret = IterativePreconditioner::BLOCK_ILU;
+    }
+    else if (val == "amg")
+    {
+      ret = IterativePreconditioner::AMG;
+    }
+    else if (val == "field_split")
+    {
+      ret = IterativePreconditioner::FIELD_SPLIT;
+    }
+    else if (val != "block_direct")
+    {
+      std::ostringstream os;
+      os << "Unrecognized \"iterative_preconditioner\" parameter value \"" << val << "\". Valid options are \"block_direct\", \"block_jacobi\", \"block_ilu\", \"amg\", or \"field_split\".\n";
+      OutputStream::WriteOut(OutputStream::OutputType::FATAL, os.str());
+    }
+  }
+  return ret;
+}
+
+dsMath::FieldSplitType GetFieldSplitType()
+{
+  dsMath::FieldSplitType ret = dsMath::FieldSplitType::MULTIPLICATIVE;
+  GlobalData &gdata = GlobalData::GetInstance();
+  auto dbent = gdata.GetDBEntryOnGlobal("field_split_type");
+  if (dbent.first)
+  {
+    const auto &val = dbent.second.GetString();
+    if (val == "additive")
+    {
+      ret = dsMath::FieldSplitType::ADDITIVE;
+    }
+    else if (val == "schur")
+    {
+      ret = dsMath::FieldSplitType::SCHUR;
+    }
+    else if (val != "multiplicative")
+    {
+      std::ostringstream os;
+      os << "Unrecognized \"field_split_type\" parameter value \"" << val << "\". Valid options are \"additive\", \"multiplicative\", or \"schur\".\n";
+      OutputStream::WriteOut(OutputStream::OutputType::FATAL, os.str());
+    }
+  }
+  return ret;
+}
+#endif
+
 template <typename T>
 dsMath::Preconditioner<T> *CreateExternalPreconditioner(size_t numeqns, dsMath::PEnum::TransposeType_t transtype, std::string &errorstring)
 {
@@ -161,6 +258,10 @@ Preconditioner<T> *CreateDirectPreconditioner(size_t numeqns)
     preconditioner = new SuperLUPreconditioner<T>(numeqns, PEnum::TransposeType_t::NOTRANS, PEnum::LUType_t::FULL);
   }
 #endif
+  else if (s == DirectSolver::SPARSELU)
+  {
+    preconditioner = new SparseLUPreconditioner<T>(numeqns, PEnum::TransposeType_t::NOTRANS, GetSparseLUOrdering());
+  }
   else
   {
     dsAssert(false, "Unexpected Solver Type");
@@ -177,7 +278,27 @@ Preconditioner<T> *CreatePreconditioner(LinearSolver<T> &itermethod, size_t nume
 #if defined(LOAD_MATHLIBS)
   if (dynamic_cast<IterativeLinearSolver<T> *>(&itermethod))
   {
-    preconditioner = new BlockPreconditioner<T>(numeqns, PEnum::TransposeType_t::NOTRANS);
+    const auto p = GetIterativePreconditioner();
+    if (p == IterativePreconditioner::BLOCK_JACOBI)
+    {
+      preconditioner = new BlockILUPreconditioner<T>(numeqns, PEnum::TransposeType_t::NOTRANS, BlockILUType::JACOBI);
+    }
+    else if (p == IterativePreconditioner::BLOCK_ILU)
+    {
+      preconditioner = new BlockILUPreconditioner<T>(numeqns, PEnum::TransposeType_t::NOTRANS, BlockILUType::ILU0);
+    }
+    else if (p == IterativePreconditioner::AMG)
+    {
+      preconditioner = new AMGPreconditioner<T>(numeqns, PEnum::TransposeType_t::NOTRANS);
+    }
+    else if (p == IterativePreconditioner::FIELD_SPLIT)
+    {
+      preconditioner = new FieldSplitPreconditioner<T>(numeqns, PEnum::TransposeType_t::NOTRANS, GetFieldSplitType());
+    }
+    else
+    {
+      preconditioner = new BlockPreconditioner<T>(numeqns, PEnum::TransposeType_t::NOTRANS);
+    }
   }
   else
 #endif
@@ -211,6 +332,10 @@ Preconditioner<DoubleType> *CreateACPreconditioner(PEnum::TransposeType_t trans_
       preconditioner = new SuperLUPreconditioner<DoubleType>(numeqns, trans_type, PEnum::LUType_t::FULL);
     }
 #endif
+    else if (s == DirectSolver::SPARSELU)
+    {
+      preconditioner = new SparseLUPreconditioner<DoubleType>(numeqns, trans_type, GetSparseLUOrdering());
+    }
     else
     {
       dsAssert(false, "Unexpected Solver Type");
@@ -0,0 +1,961 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#include "SparseLU.hh"
+#include "ParallelFor.hh"
+#include "OutputStream.hh"
+#include "dsAssert.hh"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <sstream>
+#include <cmath>
+#include <queue>
+#include <functional>
+#include <type_traits>
+
+namespace dsMath {
+namespace {
+const size_t npos = size_t(-1);
+
+template <typename V>
+auto Magnitude(const V &x)
+{
+  using std::abs;
+  return abs(x);
+}
+
+/// Matching of the rows to the columns that maximizes the product of the magnitudes of the matched entries (Duff and Koster, MC64)
+/// Each unmatched column is matched by a shortest augmenting path (Dijkstra), with costs log(column max) - log(magnitude)
+/// The dual variables scale the matrix so the matched entries are near 1, and the other entries are at most about 1
+/// Zero entries are not matched here
+void MatchRowsWeighted(const IntVec_t &colptr, const IntVec_t &rows, const std::vector<double> &mag, std::vector<size_t> &matchRow, std::vector<size_t> &matchCol, std::vector<double> &rowScale, std::vector<double> &colScale)
+{
+  const size_t n = colptr.size() - 1;
+  const double inf = std::numeric_limits<double>::infinity();
+
+  std::vector<double> logmax(n, -inf);
+  for (size_t c = 0; c < n; ++c)
+  {
+    for (int p = colptr[c]; p < colptr[c + 1]; ++p)
+    {
+      if (mag[p] > 0.0)
+      {
+        logmax[c] = std::max(logmax[c], std::log(mag[p]));
+      }
+    }
+  }
+
+  std::vector<double> cost(rows.size(), inf);
+  for (size_t c = 0; c < n; ++c)
+  {
+    for (int p = colptr[c]; p < colptr[c + 1]; ++p)
+    {
+      if (mag[p] > 0.0)
+      {
+        cost[p] = logmax[c] - std::log(mag[p]);
+      }
+    }
+  }
+
+  //// the reduced cost, cost - u - v, is not negative, and is zero for the matched entries
+  std::vector<double> u(n, inf);
+  std::vector<double> v(n, inf);
+  for (size_t c = 0; c < n; ++c)
+  {
+    for (int p = colptr[c]; p < colptr[c + 1]; ++p)
+    {
+      if (cost[p] != inf)
+      {
+        u[rows[p]] = std::min(u[rows[p]], cost[p]);
+      }
+    }
+  }
+  for (auto &x : u)
+  {
+    if (x == inf)
+    {
+      x = 0.0;
+    }
+  }
+
+  auto reduced = [&](int p, size_t c) {
+    return std::max((cost[p] - u[rows[p]]) - v[c], 0.0);
+  };
+
+  for (size_t c = 0; c < n; ++c)
+  {
+    for (int p = colptr[c]; p < colptr[c + 1]; ++p)
+    {
+      if (cost[p] != inf)
+      {
+        v[c] = std::min(v[c], cost[p] - u[rows[p]]);
+      }
+    }
+    if (v[c] == inf)
+    {
+      v[c] = 0.0;
+      continue;
+    }
+    for (int p = colptr[c]; p < colptr[c + 1]; ++p)
+    {
+      const size_t r = rows[p];
+      if ((cost[p] != inf) && (matchCol[r] == npos) && (reduced(p, c) == 0.0))
+      {
+        matchRow[c] = r;
+        matchCol[r] = c;
+        break;
+      }
+    }
+  }
+
+  std::vector<double> dist(n, inf);
+  std::vector<size_t> pred(n, npos);
+  std::vector<char>   done(n, 0);
+  std::vector<size_t> touched;
+  std::vector<size_t> finished;
+  typedef std::pair<double, size_t> entry_t;
+  std::priority_queue<entry_t, std::vector<entry_t>, std::greater<entry_t>> heap;
+
+  auto relax = [&](size_t c, double d) {
+    for (int p = colptr[c]; p < colptr[c + 1]; ++p)
+    {
+      const size_t r = rows[p];
+      if ((cost[p] == inf) || done[r])
+      {
+        continue;
+      }
+      const double nd = d + reduced(p, c);
+      if (nd < dist[r])
+      {
+        if (dist[r] == inf)
+        {
+          touched.push_back(r);
+        }
+        dist[r] = nd;
+        pred[r] = c;
+        heap.push(std::make_pair(nd, r));
+      }
+    }
+  };
+
+  for (size_t c = 0; c < n; ++c)
+  {
+    if (matchRow[c] != npos)
+    {
+      continue;
+    }
+
+    relax(c, 0.0);
+
+    size_t found = npos;
+    double length = 0.0;
+    while (!heap.empty())
+    {
+      const entry_t top = heap.top();
+      heap.pop();
+      const size_t r = top.second;
+      if (done[r] || (top.first > dist[r]))
+      {
+        continue;
+      }
+      done[r] = 1;
+      if (matchCol[r] == npos)
+      {
+        found = r;
+        length = top.first;
+        break;
+      }
+      finished.push_back(r);
+      relax(matchCol[r], top.first);
+    }
+
+    if (found != npos)
+    {
+      //// keeps the reduced costs of the rows and columns on the tree from going negative
+      v[c] += length;
+      for (const auto r : finished)
+      {
+        const double delta = length - dist[r];
+        u[r] -= delta;
+        v[matchCol[r]] += delta;
+      }
+
+      for (size_t r = found; ; )
+      {
+        const size_t col = pred[r];
+        const size_t prev = matchRow[col];
+        matchRow[col] = r;
+        matchCol[r] = col;
+        if (col == c)
+        {
+          break;
+        }
+        r = prev;
+      }
+    }
+
+    for (const auto r : touched)
+    {
+      dist[r] = inf;
+      pred[r] = npos;
+      done[r] = 0;
+    }
+    touched.clear();
+    finished.clear();
+    heap = decltype(heap)();
+  }
+
+  //// powers of 2, so the scaled values are exact
+  rowScale.resize(n);
+  colScale.resize(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    rowScale[i] = std::ldexp(1.0, static_cast<int>(std::lround(u[i] / std::log(2.0))));
+    const double lc = (logmax[i] == -inf) ? 0.0 : (v[i] - logmax[i]);
+    colScale[i] = std::ldexp(1.0, static_cast<int>(std::lround(lc / std::log(2.0))));
+  }
+}
+
+/// Matches the rows with the largest magnitudes, and then completes the matching with zero entries by depth first search for augmenting paths (Duff)
+void MatchRows(const IntVec_t &colptr, const IntVec_t &rows, const std::vector<double> &mag, std::vector<size_t> &matchRow, std::vector<size_t> &matchCol, std::vector<double> &rowScale, std::vector<double> &colScale)
+{
+  const size_t n = colptr.size() - 1;
+  matchRow.assign(n, npos);
+  matchCol.assign(n, npos);
+
+  MatchRowsWeighted(colptr, rows, mag, matchRow, matchCol, rowScale, colScale);
+
+  std::vector<size_t> visited(n, npos);
+  std::vector<std::pair<size_t, int>> stack;
+  for (size_t c = 0; c < n; ++c)
+  {
+    if (matchRow[c] != npos)
+    {
+      continue;
+    }
+
+    stack.clear();
+    stack.push_back(std::make_pair(c, colptr[c]));
+    size_t found = npos;
+    while (!stack.empty())
+    {
+      auto &top = stack.back();
+      if (top.second == colptr[top.first + 1])
+      {
+        stack.pop_back();
+        continue;
+      }
+      const size_t r = rows[top.second++];
+      if (visited[r] == c)
+      {
+        continue;
+      }
+      visited[r] = c;
+      if (matchCol[r] == npos)
+      {
+        found = r;
+        break;
+      }
+      stack.push_back(std::make_pair(matchCol[r], colptr[matchCol[r]]));
+    }
+
+    //// each column on the path takes the row of the next column
+    for (size_t i = stack.size(); (found != npos) && (i > 0); --i)
+    {
+      const size_t col = stack[i - 1].first;
+      const size_t prev = matchRow[col];
+      matchRow[col] = found;
+      matchCol[found] = col;
+      found = prev;
+    }
+  }
+
+  //// a structurally singular matrix has a zero pivot for each unmatched column
+  size_t unmatched = 0;
+  size_t r = 0;
+  for (size_t c = 0; c < n; ++c)
+  {
+    if (matchRow[c] != npos)
+    {
+      continue;
+    }
+    while (matchCol[r] != npos)
+    {
+      ++r;
+    }
+    matchRow[c] = r;
+    matchCol[r] = c;
+    ++unmatched;
+  }
+
+  if (unmatched)
+  {
+    std::ostringstream os;
+    os << "Sparse LU matrix is structurally singular with " << unmatched << " unmatched columns\n";
+    OutputStream::WriteOut(OutputStream::OutputType::VERBOSE1, os.str());
+  }
+}
+}
+
+template <typename DoubleType>
+SparseLU<DoubleType>::SparseLU() : size_(0), numberPerturbed_(0), maximumRefinementSteps_(10), maximumKrylovSize_(30), krylovTolerance_(1.0e-6)
+{
+}
+
+template <typename DoubleType>
+SparseLU<DoubleType>::~SparseLU()
+{
+}
+
+template <typename DoubleType>
+void SparseLU<DoubleType>::Symbolic(const IntVec_t &colptr, const IntVec_t &rows, const DoubleVec_t<DoubleType> &magnitude, SparseOrdering::OrderingType otype)
+{
+  const size_t n = colptr.size() - 1;
+  size_ = n;
+  colPtr_ = colptr;
+  rows_ = rows;
+
+  std::vector<double> mag(magnitude.size());
+  for (size_t i = 0; i < mag.size(); ++i)
+  {
+    mag[i] = static_cast<double>(magnitude[i]);
+  }
+
+  std::vector<size_t> matchRow;
+  std::vector<size_t> matchCol;
+  std::vector<double> rowScale;
+  std::vector<double> colScale;
+  MatchRows(colptr, rows, mag, matchRow, matchCol, rowScale, colScale);
+  rowScale_.assign(rowScale.begin(), rowScale.end());
+  colScale_.assign(colScale.begin(), colScale.end());
+
+  //// pattern of the matched matrix, plus its transpose
+  SparseOrdering::Graph_t graph(n);
+  for (size_t c = 0; c < n; ++c)
+  {
+    for (int p = colptr[c]; p < colptr[c + 1]; ++p)
+    {
+      const size_t r = matchCol[rows[p]];
+      if (r != c)
+      {
+        graph[r].push_back(c);
+        graph[c].push_back(r);
+      }
+    }
+  }
+  for (auto &g : graph)
+  {
+    std::sort(g.begin(), g.end());
+    g.erase(std::unique(g.begin(), g.end()), g.end());
+  }
+
+  const std::vector<size_t> &order = SparseOrdering::ComputeOrdering(graph, otype);
+
+  std::vector<size_t> number(n);
+  rowOf_.resize(n);
+  colOf_.resize(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    const size_t v = (order.empty()) ? i : order[i];
+    number[v] = i;
+    rowOf_[i] = matchRow[v];
+    colOf_[i] = v;
+  }
+
+  //// the rows of the factor are found by walking up the elimination tree (Liu)
+  std::vector<std::vector<size_t>> lowerAdj(n);
+  for (size_t v = 0; v < n; ++v)
+  {
+    const size_t i = number[v];
+    for (const auto u : graph[v])
+    {
+      const size_t k = number[u];
+      if (k < i)
+      {
+        lowerAdj[i].push_back(k);
+      }
+    }
+  }
+  graph.clear();
+
+  std::vector<size_t> parent(n, npos);
+  std::vector<size_t> flag(n);
+  std::vector<size_t> count(n, 0);
+  rowPtr_.assign(n + 1, 0);
+  rowCols_.clear();
+  for (size_t i = 0; i < n; ++i)
+  {
+    flag[i] = i;
+    for (auto k : lowerAdj[i])
+    {
+      while (flag[k] != i)
+      {
+        if (parent[k] == npos)
+        {
+          parent[k] = i;
+        }
+        rowCols_.push_back(k);
+        ++count[k];
+        flag[k] = i;
+        k = parent[k];
+      }
+    }
+    rowPtr_[i + 1] = rowCols_.size();
+  }
+  lowerAdj.clear();
+
+  lowerPtr_.assign(n + 1, 0);
+  for (size_t k = 0; k < n; ++k)
+  {
+    lowerPtr_[k + 1] = lowerPtr_[k] + count[k];
+  }
+
+  //// the rows are added in increasing order
+  std::vector<size_t> next(lowerPtr_.begin(), lowerPtr_.end() - 1);
+  lowerRows_.resize(rowCols_.size());
+  rowPos_.resize(rowCols_.size());
+  for (size_t i = 0; i < n; ++i)
+  {
+    for (size_t q = rowPtr_[i]; q < rowPtr_[i + 1]; ++q)
+    {
+      const size_t k = rowCols_[q];
+      const size_t pos = next[k]++;
+      lowerRows_[pos] = i;
+      rowPos_[q] = pos;
+    }
+  }
+
+  const size_t nnzl = lowerRows_.size();
+  target_.resize(rows.size());
+  for (size_t c = 0; c < n; ++c)
+  {
+    const size_t b = number[c];
+    for (int p = colptr[c]; p < colptr[c + 1]; ++p)
+    {
+      const size_t a = number[matchCol[rows[p]]];
+      if (a == b)
+      {
+        target_[p] = a;
+      }
+      else
+      {
+        const size_t col = std::min(a, b);
+        const size_t row = std::max(a, b);
+        auto it = std::lower_bound(lowerRows_.begin() + lowerPtr_[col], lowerRows_.begin() + lowerPtr_[col + 1], row);
+        dsAssert(*it == row, "UNEXPECTED");
+        const size_t pos = it - lowerRows_.begin();
+        target_[p] = (a > b) ? (n + pos) : (n + nnzl + pos);
+      }
+    }
+  }
+
+  //// a column is on a higher level than all of its descendants
+  std::vector<size_t> level(n, 0);
+  size_t numlevels = (n) ? 1 : 0;
+  for (size_t j = 0; j < n; ++j)
+  {
+    if (parent[j] != npos)
+    {
+      level[parent[j]] = std::max(level[parent[j]], level[j] + 1);
+      numlevels = std::max(numlevels, level[parent[j]] + 1);
+    }
+  }
+
+  levelPtr_.assign(numlevels + 1, 0);
+  for (size_t j = 0; j < n; ++j)
+  {
+    ++levelPtr_[level[j] + 1];
+  }
+  for (size_t l = 0; l < numlevels; ++l)
+  {
+    levelPtr_[l + 1] += levelPtr_[l];
+  }
+  levelCols_.resize(n);
+  next.assign(levelPtr_.begin(), levelPtr_.end() - 1);
+  for (size_t j = 0; j < n; ++j)
+  {
+    levelCols_[next[level[j]]++] = j;
+  }
+
+  real_ = Factors<DoubleType>();
+  complex_ = Factors<ComplexDouble_t<DoubleType>>();
+
+  std::ostringstream os;
+  os << "Sparse LU symbolic factorization equations " << n << " matrix entries " << rows.size() << " factor entries " << GetNumberEntries() << " levels " << GetNumberLevels() << "\n";
+  OutputStream::WriteOut(OutputStream::OutputType::VERBOSE1, os.str());
+}
+
+/// Crout update of column j of L, and row j of U, from the columns in row j of L
+/// The rows in each of these columns below row j are also in column j, so the columns are merged in order
+template <typename DoubleType>
+template <typename V>
+bool SparseLU<DoubleType>::FactorColumn(size_t j, Factors<V> &f, DoubleType tolerance, DoubleType replacement) const
+{
+  const size_t jbeg = lowerPtr_[j];
+  const size_t jend = lowerPtr_[j + 1];
+
+  V d = f.diag[j];
+  for (size_t q = rowPtr_[j]; q < rowPtr_[j + 1]; ++q)
+  {
+    const size_t k   = rowCols_[q];
+    const size_t pos = rowPos_[q];
+    const V ljk = f.lower[pos];
+    const V ukj = f.upper[pos];
+    d -= ljk * ukj;
+
+    size_t t = jbeg;
+    for (size_t p = pos + 1; p < lowerPtr_[k + 1]; ++p)
+    {
+      const size_t i = lowerRows_[p];
+      while (lowerRows_[t] != i)
+      {
+        ++t;
+      }
+      f.lower[t] -= f.lower[p] * ukj;
+      f.upper[t] -= ljk * f.upper[p];
+    }
+  }
+
+  bool perturbed = false;
+  if (Magnitude(d) < tolerance)
+  {
+    //// keep the sign of a real pivot
+    d = (Magnitude(d + tolerance) >= Magnitude(d - tolerance)) ? V(replacement) : V(-replacement);
+    perturbed = true;
+  }
+  f.diag[j] = d;
+
+  for (size_t t = jbeg; t < jend; ++t)
+  {
+    f.lower[t] /= d;
+  }
+  return perturbed;
+}
+
+template <typename DoubleType>
+template <typename V>
+void SparseLU<DoubleType>::FactorImpl(const std::vector<V> &vals, Factors<V> &f)
+{
+  dsAssert(HasSymbolic(), "UNEXPECTED");
+  dsAssert(vals.size() == rows_.size(), "UNEXPECTED");
+
+  const size_t n = size_;
+  const size_t nnzl = lowerRows_.size();
+
+  f.matrix = vals;
+  f.diag.assign(n, V(0.0));
+  f.lower.assign(nnzl, V(0.0));
+  f.upper.assign(nnzl, V(0.0));
+
+  //// the factor is of the scaled matrix
+  DoubleType anorm = 0.0;
+  for (size_t c = 0; c < n; ++c)
+  {
+    for (int p = colPtr_[c]; p < colPtr_[c + 1]; ++p)
+    {
+      const V x = vals[p] * (rowScale_[rows_[p]] * colScale_[c]);
+      const size_t t = target_[p];
+      if (t < n)
+      {
+        f.diag[t] += x;
+      }
+      else if (t < n + nnzl)
+      {
+        f.lower[t - n] += x;
+      }
+      else
+      {
+        f.upper[t - n - nnzl] += x;
+      }
+      const DoubleType m = Magnitude(x);
+      if (m > anorm)
+      {
+        anorm = m;
+      }
+    }
+  }
+
+  using std::sqrt;
+  const DoubleType replacement = (anorm > 0.0) ? anorm : DoubleType(1.0);
+  const DoubleType tolerance = sqrt(std::numeric_limits<DoubleType>::epsilon()) * replacement;
+
+  std::vector<char> perturbed(n, 0);
+  for (size_t l = 0; l + 1 < levelPtr_.size(); ++l)
+  {
+    const size_t lbeg = levelPtr_[l];
+    ParallelFor(levelPtr_[l + 1] - lbeg, [&](size_t b, size_t e) {
+      for (size_t i = b; i < e; ++i)
+      {
+        const size_t j = levelCols_[lbeg + i];
+        perturbed[j] = FactorColumn(j, f, tolerance, replacement);
+      }
+    });
+  }
+
+  numberPerturbed_ = std::count(perturbed.begin(), perturbed.end(), 1);
+  if (numberPerturbed_)
+  {
+    std::ostringstream os;
+    os << "Sparse LU replaced " << numberPerturbed_ << " small pivots\n";
+    OutputStream::WriteOut(OutputStream::OutputType::VERBOSE1, os.str());
+  }
+}
+
+template <typename DoubleType>
+void SparseLU<DoubleType>::Factor(const DoubleVec_t<DoubleType> &vals)
+{
+  FactorImpl(vals, real_);
+}
+
+template <typename DoubleType>
+void SparseLU<DoubleType>::Factor(const ComplexDoubleVec_t<DoubleType> &vals)
+{
+  FactorImpl(vals, complex_);
+}
+
+/// Solves L U x = x, or its transpose, in the numbering of the factor
+template <typename DoubleType>
+template <typename V>
+void SparseLU<DoubleType>::Substitute(std::vector<V> &x, bool transpose, const Factors<V> &f) const
+{
+  const size_t n = size_;
+  if (!transpose)
+  {
+    for (size_t j = 0; j < n; ++j)
+    {
+      const V xj = x[j];
+      for (size_t t = lowerPtr_[j]; t < lowerPtr_[j + 1]; ++t)
+      {
+        x[lowerRows_[t]] -= f.lower[t] * xj;
+      }
+    }
+    for (size_t j = n; j > 0; --j)
+    {
+      V sum = x[j - 1];
+      for (size_t t = lowerPtr_[j - 1]; t < lowerPtr_[j]; ++t)
+      {
+        sum -= f.upper[t] * x[lowerRows_[t]];
+      }
+      x[j - 1] = sum / f.diag[j - 1];
+    }
+  }
+  else
+  {
+    for (size_t j = 0; j < n; ++j)
+    {
+      const V xj = x[j] / f.diag[j];
+      x[j] = xj;
+      for (size_t t = lowerPtr_[j]; t < lowerPtr_[j + 1]; ++t)
+      {
+        x[lowerRows_[t]] -= f.upper[t] * xj;
+      }
+    }
+    for (size_t j = n; j > 0; --j)
+    {
+      V sum = x[j - 1];
+      for (size_t t = lowerPtr_[j - 1]; t < lowerPtr_[j]; ++t)
+      {
+        sum -= f.lower[t] * x[lowerRows_[t]];
+      }
+      x[j - 1] = sum;
+    }
+  }
+}
+
+/// Solves the scaled factor for the original matrix, so y approximates inv(A) x
+template <typename DoubleType>
+template <typename V>
+void SparseLU<DoubleType>::ApplyInverse(std::vector<V> &y, const std::vector<V> &x, bool transpose, const Factors<V> &f) const
+{
+  const size_t n = size_;
+  //// the right hand side is in the order of the rows of the operator
+  const std::vector<size_t>     &inputOf     = (transpose) ? colOf_ : rowOf_;
+  const std::vector<size_t>     &outputOf    = (transpose) ? rowOf_ : colOf_;
+  const std::vector<DoubleType> &inputScale  = (transpose) ? colScale_ : rowScale_;
+  const std::vector<DoubleType> &outputScale = (transpose) ? rowScale_ : colScale_;
+
+  std::vector<V> w(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    const size_t k = inputOf[i];
+    w[i] = x[k] * inputScale[k];
+  }
+  Substitute(w, transpose, f);
+  y.resize(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    const size_t k = outputOf[i];
+    y[k] = w[i] * outputScale[k];
+  }
+}
+
+/// Calculates r = b - A x, and the bound |b| + |A| |x| for the componentwise backward error
+template <typename DoubleType>
+template <typename V>
+DoubleType SparseLU<DoubleType>::Residual(std::vector<V> &r, const std::vector<V> &x, const std::vector<V> &b, bool transpose, const Factors<V> &f) const
+{
+  const size_t n = size_;
+  std::vector<DoubleType> bound(n);
+  r = b;
+  for (size_t i = 0; i < n; ++i)
+  {
+    bound[i] = Magnitude(b[i]);
+  }
+  for (size_t c = 0; c < n; ++c)
+  {
+    for (int p = colPtr_[c]; p < colPtr_[c + 1]; ++p)
+    {
+      const size_t i = (transpose) ? c : static_cast<size_t>(rows_[p]);
+      const size_t j = (transpose) ? static_cast<size_t>(rows_[p]) : c;
+      const V ax = f.matrix[p] * x[j];
+      r[i] -= ax;
+      bound[i] += Magnitude(ax);
+    }
+  }
+
+  //// Oettli and Prager
+  DoubleType error = 0.0;
+  for (size_t i = 0; i < n; ++i)
+  {
+    const DoubleType ri = Magnitude(r[i]);
+    if (bound[i] > 0.0)
+    {
+      error = std::max<DoubleType>(error, ri / bound[i]);
+    }
+    else if (ri > 0.0)
+    {
+      error = std::numeric_limits<DoubleType>::infinity();
+    }
+  }
+  return error;
+}
+
+/// Restarted GMRES for A d = r, preconditioned on the right by the factor (Carson and Higham)
+/// When pivots were replaced, the preconditioned matrix is the identity plus a matrix of low rank, so few iterations are needed
+template <typename DoubleType>
+template <typename V>
+void SparseLU<DoubleType>::Correction(std::vector<V> &d, const std::vector<V> &r, bool transpose, const Factors<V> &f) const
+{
+  using std::sqrt;
+  const size_t n = size_;
+  const size_t m = std::min<size_t>(n, maximumKrylovSize_);
+
+  auto conjugate = [](const V &x) -> V {
+    if constexpr (std::is_same<V, DoubleType>::value)
+    {
+      return x;
+    }
+    else
+    {
+      using std::conj;
+      return conj(x);
+    }
+  };
+
+  auto norm = [](const std::vector<V> &x) -> DoubleType {
+    DoubleType sum = 0.0;
+    for (const auto &v : x)
+    {
+      const DoubleType a = Magnitude(v);
+      sum += a * a;
+    }
+    return sqrt(sum);
+  };
+
+  d.assign(n, V(0.0));
+  const DoubleType beta = norm(r);
+  if (beta == 0.0)
+  {
+    return;
+  }
+
+  std::vector<std::vector<V>> basis(1, r);
+  for (auto &v : basis[0])
+  {
+    v /= beta;
+  }
+
+  std::vector<std::vector<V>> h;
+  std::vector<DoubleType> cs;
+  std::vector<V> sn;
+  std::vector<V> g(1, V(beta));
+
+  std::vector<V> z;
+  std::vector<V> w;
+  size_t k = 0;
+  while (k < m)
+  {
+    ApplyInverse(z, basis[k], transpose, f);
+    //// w = A z
+    w.assign(n, V(0.0));
+    for (size_t c = 0; c < n; ++c)
+    {
+      for (int p = colPtr_[c]; p < colPtr_[c + 1]; ++p)
+      {
+        const size_t i = (transpose) ? c : static_cast<size_t>(rows_[p]);
+        const size_t j = (transpose) ? static_cast<size_t>(rows_[p]) : c;
+        w[i] += f.matrix[p] * z[j];
+      }
+    }
+
+    //// modified Gram-Schmidt
+    std::vector<V> hk(k + 2, V(0.0));
+    for (size_t i = 0; i <= k; ++i)
+    {
+      V dot = V(0.0);
+      for (size_t q = 0; q < n; ++q)
+      {
+        dot += conjugate(basis[i][q]) * w[q];
+      }
+      hk[i] = dot;
+      for (size_t q = 0; q < n; ++q)
+      {
+        w[q] -= dot * basis[i][q];
+      }
+    }
+    const DoubleType wnorm = norm(w);
+    hk[k + 1] = V(wnorm);
+
+    for (size_t i = 0; i < k; ++i)
+    {
+      const V t = cs[i] * hk[i] + sn[i] * hk[i + 1];
+      hk[i + 1] = -conjugate(sn[i]) * hk[i] + cs[i] * hk[i + 1];
+      hk[i] = t;
+    }
+
+    //// the rotation that zeros the subdiagonal
+    const DoubleType a = Magnitude(hk[k]);
+    const DoubleType t = sqrt(a * a + wnorm * wnorm);
+    if (t == 0.0)
+    {
+      break;
+    }
+    const DoubleType c = a / t;
+    const V s = (a == 0.0) ? V(1.0) : (hk[k] / a) * (V(wnorm) / t);
+    hk[k] = c * hk[k] + s * V(wnorm);
+    hk[k + 1] = V(0.0);
+    cs.push_back(c);
+    sn.push_back(s);
+    g.push_back(-conjugate(s) * g[k]);
+    g[k] = c * g[k];
+    h.push_back(hk);
+    ++k;
+
+    if ((Magnitude(g[k]) <= krylovTolerance_ * beta) || (wnorm == 0.0))
+    {
+      break;
+    }
+
+    basis.push_back(w);
+    for (auto &v : basis[k])
+    {
+      v /= wnorm;
+    }
+  }
+
+  //// the least squares solution from the triangular system
+  std::vector<V> y(k);
+  for (size_t i = k; i > 0; --i)
+  {
+    V sum = g[i - 1];
+    for (size_t j = i; j < k; ++j)
+    {
+      sum -= h[j][i - 1] * y[j];
+    }
+    y[i - 1] = sum / h[i - 1][i - 1];
+  }
+
+  std::vector<V> u(n, V(0.0));
+  for (size_t j = 0; j < k; ++j)
+  {
+    for (size_t q = 0; q < n; ++q)
+    {
+      u[q] += y[j] * basis[j][q];
+    }
+  }
+  ApplyInverse(d, u, transpose, f);
+}
+
+/// Solves with the scaled factor, and then improves the solution with the original matrix
+/// Each correction is from GMRES, and the refinement stops when the componentwise backward error is at the roundoff level, or stops decreasing
+template <typename DoubleType>
+template <typename V>
+bool SparseLU<DoubleType>::SolveImpl(std::vector<V> &x, const std::vector<V> &b, bool transpose, const Factors<V> &f) const
+{
+  dsAssert(f.diag.size() == size_, "UNEXPECTED");
+  dsAssert(b.size() == size_, "UNEXPECTED");
+
+  const size_t n = size_;
+  ApplyInverse(x, b, transpose, f);
+
+  const DoubleType eps = std::numeric_limits<DoubleType>::epsilon();
+  using std::sqrt;
+
+  std::vector<V> r;
+  std::vector<V> d;
+  std::vector<V> best;
+  DoubleType bestError = std::numeric_limits<DoubleType>::infinity();
+  DoubleType lastError = bestError;
+  for (size_t step = 0; ; ++step)
+  {
+    const DoubleType error = Residual(r, x, b, transpose, f);
+
+    if (error < bestError)
+    {
+      bestError = error;
+      best = x;
+    }
+
+    if ((error <= eps) || (step == maximumRefinementSteps_) || !(error < 0.5 * lastError))
+    {
+      break;
+    }
+    lastError = error;
+
+    Correction(d, r, transpose, f);
+    for (size_t i = 0; i < n; ++i)
+    {
+      x[i] += d[i];
+    }
+  }
+
+  if (!best.empty())
+  {
+    x.swap(best);
+  }
+
+  const bool ok = (bestError <= sqrt(eps));
+  if (!ok)
+  {
+    std::ostringstream os;
+    os << "Sparse LU refinement did not converge, backward error " << static_cast<double>(bestError) << " with " << numberPerturbed_ << " replaced pivots\n";
+    OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str());
+  }
+  return ok;
+}
+
+template <typename DoubleType>
+bool SparseLU<DoubleType>::Solve(DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b, bool transpose) const
+{
+  return SolveImpl(x, b, transpose, real_);
+}
+
+template <typename DoubleType>
+bool SparseLU<DoubleType>::Solve(ComplexDoubleVec_t<DoubleType> &x, const ComplexDoubleVec_t<DoubleType> &b, bool transpose) const
+{
+  return SolveImpl(x, b, transpose, complex_);
+}
+}
+
+template class dsMath::SparseLU<double>;
+#ifdef DEVSIM_EXTENDED_PRECISION
+#include "Float128.hh"
+template class dsMath::SparseLU<float128>;
+#endif
+
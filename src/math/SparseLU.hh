@@ -0,0 +1,131 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#ifndef DS_SPARSE_LU_HH
+#define DS_SPARSE_LU_HH
+
+#include "dsMathTypes.hh"
+#include "SparseOrdering.hh"
+
+#include <vector>
+#include <cstddef>
+
+namespace dsMath {
+/// Sparse LU factorization with static pivoting
+/// The rows are matched to the columns to give a large diagonal, the matrix is scaled so these entries are near 1, and the symmetric pattern is ordered to reduce fill
+/// The factor has the symmetric pattern of the cholesky factor of this pattern, so the columns of each level of the elimination tree are factored in parallel
+/// Small pivots are replaced by the largest entry of the scaled matrix, so the factor is of a matrix that differs from the original by a matrix of low rank
+/// The solution is then improved by iterative refinement, with GMRES for each correction
+template <typename DoubleType>
+class SparseLU {
+  public:
+    SparseLU();
+    ~SparseLU();
+
+    /// The matrix is in compressed column format, and the magnitudes are used to select the pivots
+    void Symbolic(const IntVec_t &/*colptr*/, const IntVec_t &/*rows*/, const DoubleVec_t<DoubleType> &/*magnitude*/, SparseOrdering::OrderingType);
+
+    bool HasSymbolic() const
+    {
+      return !colOf_.empty();
+    }
+
+    /// The numeric factorization uses the pivots and pattern from Symbolic
+    /// The values are in the same order as the rows given to Symbolic
+    void Factor(const DoubleVec_t<DoubleType> &);
+    void Factor(const ComplexDoubleVec_t<DoubleType> &);
+
+    /// Returns false when the refinement does not reach a small backward error
+    bool Solve(DoubleVec_t<DoubleType> &/*x*/, const DoubleVec_t<DoubleType> &/*b*/, bool /*transpose*/) const;
+    bool Solve(ComplexDoubleVec_t<DoubleType> &/*x*/, const ComplexDoubleVec_t<DoubleType> &/*b*/, bool /*transpose*/) const;
+
+    /// Pivots replaced in the last factorization
+    size_t GetNumberPerturbed() const
+    {
+      return numberPerturbed_;
+    }
+
+    /// Entries of L and U, including the diagonal
+    size_t GetNumberEntries() const
+    {
+      return size_ + 2 * lowerRows_.size();
+    }
+
+    size_t GetNumberLevels() const
+    {
+      return (levelPtr_.empty()) ? 0 : levelPtr_.size() - 1;
+    }
+
+  private:
+    SparseLU(const SparseLU &);
+    SparseLU &operator=(const SparseLU &);
+
+    template <typename V>
+    struct Factors {
+      //// copy of the matrix for the refinement
+      std::vector<V> matrix;
+      std::vector<V> diag;
+      //// L by columns, and U by rows, in the same pattern
+      std::vector<V> lower;
+      std::vector<V> upper;
+    };
+
+    template <typename V>
+    void FactorImpl(const std::vector<V> &, Factors<V> &);
+
+    template <typename V>
+    bool FactorColumn(size_t, Factors<V> &, DoubleType /*tolerance*/, DoubleType /*replacement*/) const;
+
+    template <typename V>
+    void ApplyInverse(std::vector<V> &, const std::vector<V> &, bool, const Factors<V> &) const;
+
+    template <typename V>
+    DoubleType Residual(std::vector<V> &, const std::vector<V> &, const std::vector<V> &, bool, const Factors<V> &) const;
+
+    template <typename V>
+    void Correction(std::vector<V> &, const std::vector<V> &, bool, const Factors<V> &) const;
+
+    template <typename V>
+    bool SolveImpl(std::vector<V> &, const std::vector<V> &, bool, const Factors<V> &) const;
+
+    template <typename V>
+    void Substitute(std::vector<V> &, bool, const Factors<V> &) const;
+
+    size_t size_;
+    //// pattern of the original matrix
+    IntVec_t colPtr_;
+    IntVec_t rows_;
+    //// original row and column of each row and column of the factor
+    std::vector<size_t> rowOf_;
+    std::vector<size_t> colOf_;
+    //// scaling of the original rows and columns
+    std::vector<DoubleType> rowScale_;
+    std::vector<DoubleType> colScale_;
+    //// diagonal, lower, or upper position of each matrix entry
+    std::vector<size_t> target_;
+    //// rows of the strictly lower triangle of each column
+    std::vector<size_t> lowerPtr_;
+    std::vector<size_t> lowerRows_;
+    //// the columns of each row of L, and the position of the entry in that column
+    std::vector<size_t> rowPtr_;
+    std::vector<size_t> rowCols_;
+    std::vector<size_t> rowPos_;
+    //// columns by their level in the elimination tree
+    std::vector<size_t> levelPtr_;
+    std::vector<size_t> levelCols_;
+
+    size_t numberPerturbed_;
+    size_t maximumRefinementSteps_;
+    size_t maximumKrylovSize_;
+    DoubleType krylovTolerance_;
+
+    Factors<DoubleType>                     real_;
+    Factors<ComplexDouble_t<DoubleType>>    complex_;
+};
+}
+#endif
+
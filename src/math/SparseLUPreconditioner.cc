@@ -0,0 +1,130 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#include "SparseLUPreconditioner.hh"
+#include "SparseLU.hh"
+#include "CompressedMatrix.hh"
+#include "OutputStream.hh"
+#include "dsAssert.hh"
+
+#include <sstream>
+
+namespace dsMath {
+namespace {
+template <typename V, typename DoubleType>
+void GetMagnitude(const std::vector<V> &vals, DoubleVec_t<DoubleType> &mag)
+{
+  using std::abs;
+  mag.resize(vals.size());
+  for (size_t i = 0; i < vals.size(); ++i)
+  {
+    mag[i] = abs(vals[i]);
+  }
+}
+}
+
+template <typename DoubleType>
+dsMath::CompressionType SparseLUPreconditioner<DoubleType>::GetRealMatrixCompressionType() const
+{
+  return dsMath::CompressionType::CCM;
+}
+
+template <typename DoubleType>
+dsMath::CompressionType SparseLUPreconditioner<DoubleType>::GetComplexMatrixCompressionType() const
+{
+  return dsMath::CompressionType::CCM;
+}
+
+template <typename DoubleType>
+SparseLUPreconditioner<DoubleType>::~SparseLUPreconditioner()
+{
+}
+
+template <typename DoubleType>
+SparseLUPreconditioner<DoubleType>::SparseLUPreconditioner(size_t numeqns, PEnum::TransposeType_t transpose, SparseOrdering::OrderingType ordering) : Preconditioner<DoubleType>(numeqns, transpose), lu_(new SparseLU<DoubleType>()), ordering_(ordering), transpose_(transpose == PEnum::TransposeType_t::TRANS)
+{
+}
+
+template <typename DoubleType>
+bool SparseLUPreconditioner<DoubleType>::DerivedLUFactor(Matrix<DoubleType> *m)
+{
+  CompressedMatrix<DoubleType> *cm = dynamic_cast<CompressedMatrix<DoubleType> *>(m);
+  if (!cm)
+  {
+    dsAssert(cm != nullptr, "UNEXPECTED");
+    return false;
+  }
+  dsAssert(cm->GetCompressionType() == CompressionType::CCM, "UNEXPECTED");
+
+  const bool is_complex = (cm->GetMatrixType() == MatrixType::COMPLEX);
+  const bool new_symbolic = (!lu_->HasSymbolic()) || (cm->GetSymbolicStatus() == SymbolicStatus_t::NEW_SYMBOLIC);
+
+  DoubleVec_t<DoubleType> mag;
+  if (new_symbolic)
+  {
+    if (is_complex)
+    {
+      GetMagnitude(cm->GetComplex(), mag);
+    }
+    else
+    {
+      GetMagnitude(cm->GetReal(), mag);
+    }
+    lu_->Symbolic(cm->GetCols(), cm->GetRows(), mag, ordering_);
+  }
+
+  for (size_t pass = 0; pass < 2; ++pass)
+  {
+    if (is_complex)
+    {
+      lu_->Factor(cm->GetComplex());
+    }
+    else
+    {
+      lu_->Factor(cm->GetReal());
+    }
+
+    //// the pivots from an earlier matrix may no longer be suitable
+    if (new_symbolic || (lu_->GetNumberPerturbed() == 0) || (pass != 0))
+    {
+      break;
+    }
+
+    OutputStream::WriteOut(OutputStream::OutputType::VERBOSE1, "Sparse LU refactorization replaced pivots, repeating the symbolic factorization\n");
+    if (is_complex)
+    {
+      GetMagnitude(cm->GetComplex(), mag);
+    }
+    else
+    {
+      GetMagnitude(cm->GetReal(), mag);
+    }
+    lu_->Symbolic(cm->GetCols(), cm->GetRows(), mag, ordering_);
+  }
+
+  return true;
+}
+
+template <typename DoubleType>
+bool SparseLUPreconditioner<DoubleType>::DerivedLUSolve(DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const
+{
+  return lu_->Solve(x, b, transpose_);
+}
+
+template <typename DoubleType>
+bool SparseLUPreconditioner<DoubleType>::DerivedLUSolve(ComplexDoubleVec_t<DoubleType> &x, const ComplexDoubleVec_t<DoubleType> &b) const
+{
+  return lu_->Solve(x, b, transpose_);
+}
+}
+
+template class dsMath::SparseLUPreconditioner<double>;
+#ifdef DEVSIM_EXTENDED_PRECISION
+#include "Float128.hh"
+template class dsMath::SparseLUPreconditioner<float128>;
+#endif
+
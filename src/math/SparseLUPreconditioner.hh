@@ -0,0 +1,41 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#ifndef SPARSE_LU_PRECONDITIONER_HH
+#define SPARSE_LU_PRECONDITIONER_HH
+#include "Preconditioner.hh"
+#include "SparseOrdering.hh"
+#include <memory>
+
+namespace dsMath {
+template <typename DoubleType>
+class SparseLU;
+
+/// Multithreaded sparse LU factorization, which does not need an external library
+/// The pivots and pattern are kept while the symbolic status is SAME_SYMBOLIC, so only the numeric factorization is repeated
+template <typename DoubleType>
+class SparseLUPreconditioner : public Preconditioner<DoubleType> {
+  public:
+    virtual ~SparseLUPreconditioner();
+
+    SparseLUPreconditioner(size_t /*numeqns*/, PEnum::TransposeType_t /*tranpose*/, SparseOrdering::OrderingType);
+    dsMath::CompressionType GetRealMatrixCompressionType() const override;
+    dsMath::CompressionType GetComplexMatrixCompressionType() const override;
+
+  protected:
+    bool DerivedLUSolve(DoubleVec_t<DoubleType> &x, const DoubleVec_t<DoubleType> &b) const override;
+    bool DerivedLUSolve(ComplexDoubleVec_t<DoubleType> &x, const ComplexDoubleVec_t<DoubleType> &b) const override;
+    bool DerivedLUFactor(Matrix<DoubleType> *) override;     // Factor the matrix
+
+  private:
+    std::unique_ptr<SparseLU<DoubleType>> lu_;
+    SparseOrdering::OrderingType          ordering_;
+    bool                                  transpose_;
+};
+}
+#endif
+
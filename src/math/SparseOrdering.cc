@@ -0,0 +1,608 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#include "SparseOrdering.hh"
+#include "dsAssert.hh"
+
+#include <algorithm>
+#include <queue>
+#include <functional>
+#include <utility>
+
+namespace dsMath
+{
+namespace SparseOrdering
+{
+bool GetOrderingType(const std::string &name, OrderingType &type)
+{
+  bool ret = true;
+  if (name.empty() || (name == "none"))
+  {
+    type = OrderingType::NONE;
+  }
+  else if (name == "rcm")
+  {
+    type = OrderingType::RCM;
+  }
+  else if (name == "amd")
+  {
+    type = OrderingType::AMD;
+  }
+  else if (name == "nd")
+  {
+    type = OrderingType::ND;
+  }
+  else
+  {
+    ret = false;
+  }
+  return ret;
+}
+
+namespace {
+/// The subgraphs of nested dissection are below this size
+const size_t leafSize = 64;
+
+/// Orders the vertices of a selected subgraph
+/// The stamp vectors avoid clearing per vertex arrays for each subgraph and search
+class Orderer {
+  public:
+    explicit Orderer(const Graph_t &g) : graph(g), label(g.size(), 0), visited(g.size(), 0), level(g.size(), 0), localIndex(g.size(), 0), currentLabel(0), currentVisit(0)
+    {
+    }
+
+    void Select(const std::vector<size_t> &verts)
+    {
+      ++currentLabel;
+      for (const auto v : verts)
+      {
+        label[v] = currentLabel;
+      }
+    }
+
+    bool Contains(size_t v) const
+    {
+      return label[v] == currentLabel;
+    }
+
+    size_t Degree(size_t v) const
+    {
+      size_t ret = 0;
+      for (const auto u : graph[v])
+      {
+        ret += Contains(u) ? 1 : 0;
+      }
+      return ret;
+    }
+
+    /// Breadth first search of the selected vertices, which are not already placed
+    /// Returns the deepest level
+    size_t Search(size_t /*root*/, bool /*sort_by_degree*/, std::vector<size_t> &/*visit*/);
+
+    /// George and Liu
+    size_t PseudoPeripheral(size_t /*start*/, std::vector<size_t> &/*visit*/);
+
+    std::vector<size_t> CuthillMcKee(const std::vector<size_t> &);
+    std::vector<size_t> MinimumDegree(const std::vector<size_t> &);
+    void Dissect(const std::vector<size_t> &, std::vector<size_t> &);
+
+    bool IsVisited(size_t v) const
+    {
+      return visited[v] == currentVisit;
+    }
+
+    size_t GetLevel(size_t v) const
+    {
+      return level[v];
+    }
+
+  private:
+    const Graph_t &graph;
+    std::vector<size_t> label;
+    std::vector<size_t> visited;
+    std::vector<size_t> level;
+    std::vector<size_t> localIndex;
+    std::vector<char>   placed;
+    size_t currentLabel;
+    size_t currentVisit;
+};
+
+size_t Orderer::Search(size_t root, bool sort_by_degree, std::vector<size_t> &visit)
+{
+  ++currentVisit;
+  visit.clear();
+  visit.push_back(root);
+  visited[root] = currentVisit;
+  level[root] = 0;
+
+  size_t depth = 0;
+  std::vector<std::pair<size_t, size_t>> next;
+  for (size_t i = 0; i < visit.size(); ++i)
+  {
+    const size_t v = visit[i];
+    next.clear();
+    for (const auto u : graph[v])
+    {
+      if (Contains(u) && !IsVisited(u) && (placed.empty() || !placed[u]))
+      {
+        visited[u] = currentVisit;
+        level[u] = level[v] + 1;
+        depth = level[u];
+        next.push_back(std::make_pair((sort_by_degree) ? Degree(u) : 0, u));
+      }
+    }
+    if (sort_by_degree)
+    {
+      std::sort(next.begin(), next.end());
+    }
+    for (const auto &p : next)
+    {
+      visit.push_back(p.second);
+    }
+  }
+  return depth;
+}
+
+size_t Orderer::PseudoPeripheral(size_t start, std::vector<size_t> &visit)
+{
+  size_t root = start;
+  size_t depth = Search(root, false, visit);
+
+  std::vector<size_t> trial;
+  for (;;)
+  {
+    size_t candidate = root;
+    size_t min_degree = size_t(-1);
+    for (auto it = visit.rbegin(); (it != visit.rend()) && (GetLevel(*it) == depth); ++it)
+    {
+      const size_t d = Degree(*it);
+      if (d < min_degree)
+      {
+        min_degree = d;
+        candidate = *it;
+      }
+    }
+
+    const size_t trial_depth = Search(candidate, false, trial);
+    if (trial_depth > depth)
+    {
+      root = candidate;
+      depth = trial_depth;
+      visit.swap(trial);
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  //// the levels are for the last search
+  Search(root, false, visit);
+  return root;
+}
+
+std::vector<size_t> Orderer::CuthillMcKee(const std::vector<size_t> &verts)
+{
+  Select(verts);
+  placed.assign(graph.size(), 0);
+
+  //// each component starts near its lowest degree vertex
+  std::vector<std::pair<size_t, size_t>> starts;
+  starts.reserve(verts.size());
+  for (const auto v : verts)
+  {
+    starts.push_back(std::make_pair(Degree(v), v));
+  }
+  std::sort(starts.begin(), starts.end());
+
+  std::vector<size_t> order;
+  order.reserve(verts.size());
+  std::vector<size_t> visit;
+  for (const auto &s : starts)
+  {
+    if (placed[s.second])
+    {
+      continue;
+    }
+    const size_t root = PseudoPeripheral(s.second, visit);
+    Search(root, true, visit);
+    for (const auto v : visit)
+    {
+      placed[v] = 1;
+      order.push_back(v);
+    }
+  }
+  placed.clear();
+
+  std::reverse(order.begin(), order.end());
+  return order;
+}
+
+/// Approximate minimum degree (Amestoy, Davis, and Duff) on the quotient graph
+/// An eliminated vertex becomes an element standing for the clique of its neighbors, so the graph never grows
+/// Vertices with the same neighbors are merged, and eliminated together
+std::vector<size_t> Orderer::MinimumDegree(const std::vector<size_t> &verts)
+{
+  const size_t len = verts.size();
+  Select(verts);
+  for (size_t i = 0; i < len; ++i)
+  {
+    localIndex[verts[i]] = i;
+  }
+
+  //// the variables adjacent to a variable, or the clique of an element
+  std::vector<std::vector<size_t>> vars(len);
+  //// the elements adjacent to a variable
+  std::vector<std::vector<size_t>> elems(len);
+  for (size_t i = 0; i < len; ++i)
+  {
+    for (const auto u : graph[verts[i]])
+    {
+      if (Contains(u))
+      {
+        vars[i].push_back(localIndex[u]);
+      }
+    }
+    std::sort(vars[i].begin(), vars[i].end());
+    vars[i].erase(std::unique(vars[i].begin(), vars[i].end()), vars[i].end());
+  }
+
+  enum class Status : char {VARIABLE, MERGED, ELEMENT, ABSORBED};
+  std::vector<Status> status(len, Status::VARIABLE);
+  //// the number of vertices in each supervariable, and the ones merged into it
+  std::vector<size_t> weight(len, 1);
+  std::vector<std::vector<size_t>> merged(len);
+  std::vector<size_t> degree(len);
+
+  //// ties are broken by the lowest index, so the order is repeatable
+  typedef std::pair<size_t, size_t> entry_t;
+  std::priority_queue<entry_t, std::vector<entry_t>, std::greater<entry_t>> queue;
+  for (size_t i = 0; i < len; ++i)
+  {
+    degree[i] = vars[i].size();
+    queue.push(std::make_pair(degree[i], i));
+  }
+
+  std::vector<size_t> mark(len, 0);
+  std::vector<size_t> external(len, 0);
+  std::vector<size_t> externalMark(len, 0);
+  size_t step = 0;
+  size_t remaining = len;
+
+  std::vector<size_t> order;
+  order.reserve(len);
+  std::vector<size_t> lp;
+  std::vector<std::pair<size_t, size_t>> hashes;
+
+  while (!queue.empty())
+  {
+    const entry_t top = queue.top();
+    queue.pop();
+    const size_t p = top.second;
+    if ((status[p] != Status::VARIABLE) || (top.first != degree[p]))
+    {
+      continue;
+    }
+    ++step;
+
+    //// the new element is the pivot's variables and the cliques of its elements, which it absorbs
+    mark[p] = step;
+    lp.clear();
+    size_t lpWeight = 0;
+    const auto add = [&](size_t u)
+    {
+      if ((status[u] == Status::VARIABLE) && (mark[u] != step))
+      {
+        mark[u] = step;
+        lp.push_back(u);
+        lpWeight += weight[u];
+      }
+    };
+    for (const auto u : vars[p])
+    {
+      add(u);
+    }
+    for (const auto e : elems[p])
+    {
+      for (const auto u : vars[e])
+      {
+        add(u);
+      }
+      status[e] = Status::ABSORBED;
+      std::vector<size_t>().swap(vars[e]);
+    }
+    std::vector<size_t>().swap(elems[p]);
+
+    status[p] = Status::ELEMENT;
+    remaining -= weight[p];
+    order.push_back(verts[p]);
+    order.insert(order.end(), merged[p].begin(), merged[p].end());
+    std::vector<size_t>().swap(merged[p]);
+
+    for (const auto i : lp)
+    {
+      auto &ei = elems[i];
+      ei.erase(std::remove_if(ei.begin(), ei.end(), [&](size_t e) {return status[e] == Status::ABSORBED;}), ei.end());
+      ei.push_back(p);
+      //// these are now reached through the new element
+      auto &vi = vars[i];
+      vi.erase(std::remove_if(vi.begin(), vi.end(), [&](size_t u) {return (status[u] != Status::VARIABLE) || (mark[u] == step);}), vi.end());
+    }
+
+    //// the weight of each other element outside of the new element
+    for (const auto i : lp)
+    {
+      for (const auto e : elems[i])
+      {
+        if (e == p)
+        {
+          continue;
+        }
+        if (externalMark[e] != step)
+        {
+          externalMark[e] = step;
+          auto &ve = vars[e];
+          ve.erase(std::remove_if(ve.begin(), ve.end(), [&](size_t u) {return status[u] != Status::VARIABLE;}), ve.end());
+          external[e] = 0;
+          for (const auto u : ve)
+          {
+            external[e] += weight[u];
+          }
+        }
+        external[e] -= weight[i];
+      }
+    }
+
+    //// an element inside the new element is absorbed by it
+    for (const auto i : lp)
+    {
+      auto &ei = elems[i];
+      for (const auto e : ei)
+      {
+        if ((e != p) && (external[e] == 0) && (status[e] == Status::ELEMENT))
+        {
+          status[e] = Status::ABSORBED;
+          std::vector<size_t>().swap(vars[e]);
+        }
+      }
+      ei.erase(std::remove_if(ei.begin(), ei.end(), [&](size_t e) {return status[e] == Status::ABSORBED;}), ei.end());
+    }
+
+    //// variables with the same elements and variables are indistinguishable
+    hashes.clear();
+    for (const auto i : lp)
+    {
+      std::sort(elems[i].begin(), elems[i].end());
+      std::sort(vars[i].begin(), vars[i].end());
+      size_t h = 0;
+      for (const auto e : elems[i])
+      {
+        h += e;
+      }
+      for (const auto u : vars[i])
+      {
+        h += u;
+      }
+      hashes.push_back(std::make_pair(h, i));
+    }
+    std::sort(hashes.begin(), hashes.end());
+    for (size_t j = 0; j < hashes.size(); ++j)
+    {
+      const size_t a = hashes[j].second;
+      if (status[a] != Status::VARIABLE)
+      {
+        continue;
+      }
+      for (size_t k = j + 1; (k < hashes.size()) && (hashes[k].first == hashes[j].first); ++k)
+      {
+        const size_t b = hashes[k].second;
+        if ((status[b] == Status::VARIABLE) && (elems[a] == elems[b]) && (vars[a] == vars[b]))
+        {
+          weight[a] += weight[b];
+          weight[b] = 0;
+          status[b] = Status::MERGED;
+          merged[a].push_back(verts[b]);
+          merged[a].insert(merged[a].end(), merged[b].begin(), merged[b].end());
+          std::vector<size_t>().swap(merged[b]);
+          std::vector<size_t>().swap(elems[b]);
+          std::vector<size_t>().swap(vars[b]);
+        }
+      }
+    }
+    lp.erase(std::remove_if(lp.begin(), lp.end(), [&](size_t u) {return status[u] != Status::VARIABLE;}), lp.end());
+
+    //// the approximate external degree is bounded by the remaining vertices, the old degree, and the element weights
+    for (const auto i : lp)
+    {
+      const size_t others = lpWeight - weight[i];
+      size_t d = others;
+      for (const auto u : vars[i])
+      {
+        d += weight[u];
+      }
+      for (const auto e : elems[i])
+      {
+        if (e != p)
+        {
+          d += external[e];
+        }
+      }
+      d = std::min(d, degree[i] + others);
+      d = std::min(d, remaining - weight[i]);
+      degree[i] = d;
+      queue.push(std::make_pair(d, i));
+    }
+
+    vars[p] = lp;
+  }
+
+  dsAssert(order.size() == len, "UNEXPECTED");
+  return order;
+}
+
+void Orderer::Dissect(const std::vector<size_t> &verts, std::vector<size_t> &order)
+{
+  if (verts.size() <= leafSize)
+  {
+    const std::vector<size_t> &leaf = MinimumDegree(verts);
+    order.insert(order.end(), leaf.begin(), leaf.end());
+    return;
+  }
+
+  Select(verts);
+
+  size_t start = verts[0];
+  size_t min_degree = size_t(-1);
+  for (const auto v : verts)
+  {
+    const size_t d = Degree(v);
+    if (d < min_degree)
+    {
+      min_degree = d;
+      start = v;
+    }
+  }
+
+  std::vector<size_t> visit;
+  PseudoPeripheral(start, visit);
+
+  if (visit.size() < verts.size())
+  {
+    //// the other components are ordered separately
+    std::vector<size_t> rest;
+    rest.reserve(verts.size() - visit.size());
+    for (const auto v : verts)
+    {
+      if (!IsVisited(v))
+      {
+        rest.push_back(v);
+      }
+    }
+    Dissect(visit, order);
+    Dissect(rest, order);
+    return;
+  }
+
+  const size_t depth = GetLevel(visit.back());
+  if (depth < 2)
+  {
+    const std::vector<size_t> &leaf = MinimumDegree(verts);
+    order.insert(order.end(), leaf.begin(), leaf.end());
+    return;
+  }
+
+  //// the separator is the level containing the middle vertex
+  size_t mid = GetLevel(visit[visit.size() / 2]);
+  mid = std::max<size_t>(1, std::min(mid, depth - 1));
+
+  std::vector<size_t> part0;
+  std::vector<size_t> part1;
+  std::vector<size_t> separator;
+  for (const auto v : visit)
+  {
+    const size_t l = GetLevel(v);
+    if (l < mid)
+    {
+      part0.push_back(v);
+    }
+    else if (l > mid)
+    {
+      part1.push_back(v);
+    }
+    else
+    {
+      separator.push_back(v);
+    }
+  }
+
+  Dissect(part0, order);
+  Dissect(part1, order);
+  order.insert(order.end(), separator.begin(), separator.end());
+}
+}
+
+std::vector<size_t> ComputeOrdering(const Graph_t &graph, OrderingType type)
+{
+  std::vector<size_t> all(graph.size());
+  for (size_t i = 0; i < all.size(); ++i)
+  {
+    all[i] = i;
+  }
+
+  Orderer orderer(graph);
+
+  std::vector<size_t> order;
+  if (type == OrderingType::RCM)
+  {
+    order = orderer.CuthillMcKee(all);
+  }
+  else if (type == OrderingType::AMD)
+  {
+    order = orderer.MinimumDegree(all);
+  }
+  else if (type == OrderingType::ND)
+  {
+    order.reserve(all.size());
+    orderer.Dissect(all, order);
+  }
+  else
+  {
+    order = all;
+  }
+
+  dsAssert(order.size() == graph.size(), "UNEXPECTED");
+  return order;
+}
+
+Statistics GetStatistics(const Graph_t &graph, const std::vector<size_t> &order)
+{
+  const size_t len = graph.size();
+  std::vector<size_t> number(len);
+  std::vector<size_t> vertex(len);
+  for (size_t i = 0; i < len; ++i)
+  {
+    const size_t v = (order.empty()) ? i : order[i];
+    number[v] = i;
+    vertex[i] = v;
+  }
+
+  Statistics ret;
+
+  //// the rows of the factor are found by walking up the elimination tree (Liu)
+  std::vector<size_t> parent(len, size_t(-1));
+  std::vector<size_t> flag(len);
+  for (size_t i = 0; i < len; ++i)
+  {
+    flag[i] = i;
+    ++ret.fill;
+    for (const auto u : graph[vertex[i]])
+    {
+      size_t k = number[u];
+      if (k >= i)
+      {
+        continue;
+      }
+
+      ret.bandwidth = std::max(ret.bandwidth, i - k);
+
+      while (flag[k] != i)
+      {
+        if (parent[k] == size_t(-1))
+        {
+          parent[k] = i;
+        }
+        ++ret.fill;
+        flag[k] = i;
+        k = parent[k];
+      }
+    }
+  }
+  return ret;
+}
+}
+}
+
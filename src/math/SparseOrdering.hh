@@ -0,0 +1,46 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#ifndef SPARSE_ORDERING_HH
+#define SPARSE_ORDERING_HH
+#include <vector>
+#include <string>
+#include <cstddef>
+
+namespace dsMath
+{
+namespace SparseOrdering
+{
+enum class OrderingType {NONE, RCM, AMD, ND};
+
+/// The neighbors of each vertex, without the vertex itself
+/// Every edge must be in the list of both of its vertices
+typedef std::vector<std::vector<size_t>> Graph_t;
+
+/// Returns false if the name is not "none", "rcm", "amd", or "nd"
+bool GetOrderingType(const std::string &, OrderingType &);
+
+/// The vertices in the order they should be numbered
+/// rcm is reverse Cuthill-McKee from a pseudo-peripheral vertex of each component
+/// amd is approximate minimum degree on the quotient graph
+/// nd is nested dissection with level set separators, and approximate minimum degree for the small subgraphs
+std::vector<size_t> ComputeOrdering(const Graph_t &, OrderingType);
+
+struct Statistics {
+  /// largest distance of an entry from the diagonal
+  size_t bandwidth = 0;
+  /// entries in the lower triangle of the cholesky factor of the pattern, including the diagonal
+  size_t fill = 0;
+};
+
+/// The statistics when each vertex is numbered by its position in the order
+/// An empty order is the natural numbering
+Statistics GetStatistics(const Graph_t &, const std::vector<size_t> &);
+}
+}
+#endif
+
@@ -7,16 +7,22 @@ SPDX-License-Identifier: Apache-2.0
 
 #include "TimeData.hh"
 #include "dsAssert.hh"
+#include "SimulationContext.hh"
 
-template <>
-TimeData<double> *TimeData<double>::instance = 0;
+#include <type_traits>
 
 #ifdef DEVSIM_EXTENDED_PRECISION
 #include "Float128.hh"
-template <>
-TimeData<float128> *TimeData<float128>::instance = 0;
 #endif
 
+namespace {
+template <typename DoubleType>
+constexpr SimulationContext::InstanceSlot GetTimeDataSlot()
+{
+  return std::is_same<DoubleType, double>::value ? SimulationContext::InstanceSlot::TIMEDATA_DOUBLE : SimulationContext::InstanceSlot::TIMEDATA_EXTENDED;
+}
+}
+
 template <typename DoubleType>
 TimeData<DoubleType>::TimeData() : IData(3), QData(3)
 {
@@ -25,9 +31,11 @@ TimeData<DoubleType>::TimeData() : IData(3), QData(3)
 template <typename DoubleType>
 TimeData<DoubleType> &TimeData<DoubleType>::GetInstance()
 {
+    TimeData<DoubleType> *instance = static_cast<TimeData<DoubleType> *>(SimulationContext::GetInstance(GetTimeDataSlot<DoubleType>()));
     if (!instance)
     {
         instance = new TimeData<DoubleType>;
+        SimulationContext::SetInstance(GetTimeDataSlot<DoubleType>(), instance);
     }
     return *instance;
 }
@@ -40,8 +48,8 @@ TimeData<DoubleType>::~TimeData()
 template <typename DoubleType>
 void TimeData<DoubleType>::DestroyInstance()
 {
-    delete instance;
-    instance = nullptr;
+    delete static_cast<TimeData<DoubleType> *>(SimulationContext::GetInstance(GetTimeDataSlot<DoubleType>()));
+    SimulationContext::SetInstance(GetTimeDataSlot<DoubleType>(), nullptr);
 }
 
 template <typename DoubleType>
@@ -80,6 +88,21 @@ void TimeData<DoubleType>::ClearQ(TimePoint_t tp)
   QData[static_cast<size_t>(tp)].clear();
 }
 
+template <typename DoubleType>
+void TimeData<DoubleType>::Backup()
+{
+  IBackup = IData;
+  QBackup = QData;
+}
+
+template <typename DoubleType>
+void TimeData<DoubleType>::Restore()
+{
+  dsAssert(IBackup.size() == IData.size(), "UNEXPECTED missing time data backup");
+  IData = IBackup;
+  QData = QBackup;
+}
+
 template <typename DoubleType>
 void TimeData<DoubleType>::AssembleI(TimePoint_t tp, DoubleType scale, std::vector<DoubleType> &v)
 {
@@ -29,6 +29,10 @@ class TimeData
         void ClearI(TimePoint_t);
         void ClearQ(TimePoint_t);
 
+        //// saves all time points, so a step which is rejected after updating them can be undone
+        void Backup();
+        void Restore();
+
         void AssembleI(TimePoint_t, DoubleType, std::vector<DoubleType> &);
         void AssembleQ(TimePoint_t, DoubleType, std::vector<DoubleType> &);
 
@@ -48,10 +52,11 @@ class TimeData
         TimeData(TimeData &);
         TimeData &operator=(TimeData &);
         ~TimeData();
-        static TimeData *instance;
 
         std::vector<std::vector<DoubleType > > IData;
         std::vector<std::vector<DoubleType > > QData;
+        std::vector<std::vector<DoubleType > > IBackup;
+        std::vector<std::vector<DoubleType > > QBackup;
 };
 
 #endif
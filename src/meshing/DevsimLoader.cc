@@ -55,16 +55,23 @@ void processNodes(const MeshRegion &mr, const Device::CoordinateList_t &clist, s
 
 size_t processEdges(const MeshRegion &mr, const std::vector<const Node *> &nlist, std::vector<const Edge *> &elist)
 {
-  MeshEdgeList_t el = mr.GetEdges();
-  size_t edgeduplicate = 0;
-  std::sort(el.begin(), el.end());
-  MeshEdgeList_t::iterator elnewend = std::unique(el.begin(), el.end());
-  if (elnewend != el.end())
+  MeshEdgeList_t sorted;
+  size_t edgeduplicate = mr.GetEdgeDuplicates();
+  if (!mr.IsSorted())
   {
-    edgeduplicate = el.size();
-    el.erase(elnewend, el.end());
-    edgeduplicate -= el.size();
+    sorted = mr.GetEdges();
+    std::sort(sorted.begin(), sorted.end());
+    MeshEdgeList_t::iterator elnewend = std::unique(sorted.begin(), sorted.end());
+    if (elnewend != sorted.end())
+    {
+      edgeduplicate = sorted.size();
+      sorted.erase(elnewend, sorted.end());
+      edgeduplicate -= sorted.size();
+    }
   }
+  const MeshEdgeList_t &el = (mr.IsSorted()) ? mr.GetEdges() : sorted;
+
+  elist.reserve(elist.size() + el.size());
 
   MeshEdgeList_t::const_iterator eit = el.begin();
   for (size_t ei = 0; eit != el.end(); ++eit, ++ei)
@@ -81,17 +88,24 @@ size_t processEdges(const MeshRegion &mr, const std::vector<const Node *> &nlist
 
 size_t processTriangles(const MeshRegion &mr, const std::vector<const Node *> &nlist, std::vector<const Triangle *> &triangle_list)
 {
-  MeshTriangleList_t tl = mr.GetTriangles();
-  size_t triangleduplicate = 0;
-  std::sort(tl.begin(), tl.end());
-  MeshTriangleList_t::iterator tlnewend = std::unique(tl.begin(), tl.end());
-
-  if (tlnewend != tl.end())
+  MeshTriangleList_t sorted;
+  size_t triangleduplicate = mr.GetTriangleDuplicates();
+  if (!mr.IsSorted())
   {
-    triangleduplicate = tl.size();
-    tl.erase(tlnewend, tl.end());
-    triangleduplicate -= tl.size();
+    sorted = mr.GetTriangles();
+    std::sort(sorted.begin(), sorted.end());
+    MeshTriangleList_t::iterator tlnewend = std::unique(sorted.begin(), sorted.end());
+
+    if (tlnewend != sorted.end())
+    {
+      triangleduplicate = sorted.size();
+      sorted.erase(tlnewend, sorted.end());
+      triangleduplicate -= sorted.size();
+    }
   }
+  const MeshTriangleList_t &tl = (mr.IsSorted()) ? mr.GetTriangles() : sorted;
+
+  triangle_list.reserve(triangle_list.size() + tl.size());
 
   MeshTriangleList_t::const_iterator tit = tl.begin();
   for (size_t ti = 0; tit != tl.end(); ++tit, ++ti)
@@ -111,18 +125,25 @@ size_t processTriangles(const MeshRegion &mr, const std::vector<const Node *> &n
 
 size_t processTetrahedra(const MeshRegion &mr, const std::vector<const Node *> &nlist, std::vector<const Tetrahedron *> &tetrahedron_list)
 {
-  size_t tetrahedronduplicate = 0;
-
-  MeshTetrahedronList_t tl = mr.GetTetrahedra();
-  std::sort(tl.begin(), tl.end());
-  MeshTetrahedronList_t::iterator tlnewend = std::unique(tl.begin(), tl.end());
+  size_t tetrahedronduplicate = mr.GetTetrahedronDuplicates();
 
-  if (tlnewend != tl.end())
+  MeshTetrahedronList_t sorted;
+  if (!mr.IsSorted())
   {
-    tetrahedronduplicate = tl.size();
-    tl.erase(tlnewend, tl.end());
-    tetrahedronduplicate -= tl.size();
+    sorted = mr.GetTetrahedra();
+    std::sort(sorted.begin(), sorted.end());
+    MeshTetrahedronList_t::iterator tlnewend = std::unique(sorted.begin(), sorted.end());
+
+    if (tlnewend != sorted.end())
+    {
+      tetrahedronduplicate = sorted.size();
+      sorted.erase(tlnewend, sorted.end());
+      tetrahedronduplicate -= sorted.size();
+    }
   }
+  const MeshTetrahedronList_t &tl = (mr.IsSorted()) ? mr.GetTetrahedra() : sorted;
+
+  tetrahedron_list.reserve(tetrahedron_list.size() + tl.size());
 
   MeshTetrahedronList_t::const_iterator tit = tl.begin();
   for (size_t ti = 0; tit != tl.end(); ++tit, ++ti)
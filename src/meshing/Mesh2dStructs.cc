@@ -48,12 +48,12 @@ void MeshContact2d::AddBoundingBox(const MeshContact2d &mr)
 }
 
 namespace {
-bool InsideBoundingBox(const dsMesh::BoundingBoxList_t &bblist, double x, double y)
+bool InsideBoundingBox(const dsMesh::BoundingBoxList_t &bblist, double x, double y, double z)
 {
     bool ret = false;
     for (dsMesh::BoundingBoxList_t::const_iterator it = bblist.begin(); it != bblist.end(); ++it)
     {
-        if (it->IsPointInside(x, y))
+        if (it->IsPointInside(x, y, z))
         {
             ret = true;
             break;
@@ -63,23 +63,23 @@ bool InsideBoundingBox(const dsMesh::BoundingBoxList_t &bblist, double x, double
 }
 }
 
-bool MeshRegion2d::IsPointInside(double x, double y) const
+bool MeshRegion2d::IsPointInside(double x, double y, double z) const
 {
-    return InsideBoundingBox(bboxes_, x, y);
+    return InsideBoundingBox(bboxes_, x, y, z);
 }
-bool MeshContact2d::IsPointInside(double x, double y) const
+bool MeshContact2d::IsPointInside(double x, double y, double z) const
 {
-    return InsideBoundingBox(bboxes_, x, y);
+    return InsideBoundingBox(bboxes_, x, y, z);
 }
-bool MeshInterface2d::IsPointInside(double x, double y) const
+bool MeshInterface2d::IsPointInside(double x, double y, double z) const
 {
-    return InsideBoundingBox(bboxes_, x, y);
+    return InsideBoundingBox(bboxes_, x, y, z);
 }
 
 #if 0
 bool MeshRegion2d::IsCoordinateInside(const MeshCoordinate &mc) const
 {
-    return IsPointInside(mc.GetX(), mc.GetY());
+    return IsPointInside(mc.GetX(), mc.GetY(), mc.GetZ());
 }
 #endif
 
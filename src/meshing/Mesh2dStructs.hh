@@ -9,6 +9,7 @@ SPDX-License-Identifier: Apache-2.0
 #define MESH_2D_STRUCTS_HH
 #include <string>
 #include <map>
+#include <limits>
 #include "MeshLoaderStructs.hh"
 
 namespace dsMesh {
@@ -16,7 +17,12 @@ namespace dsMesh {
 class BoundingBox {
     public:
 
-    BoundingBox(double x0, double x1, double y0, double y1, double bl) : x0_(x0), x1_(x1), y0_(y0), y1_(y1), bloat_(bl)
+    /// A 2D box includes every z position
+    BoundingBox(double x0, double x1, double y0, double y1, double bl) : BoundingBox(x0, x1, y0, y1, -std::numeric_limits<double>::max(), std::numeric_limits<double>::max(), bl)
+    {
+    }
+
+    BoundingBox(double x0, double x1, double y0, double y1, double z0, double z1, double bl) : x0_(x0), x1_(x1), y0_(y0), y1_(y1), z0_(z0), z1_(z1), bloat_(bl)
     {
         if (x0 > x1)
         {
@@ -28,16 +34,23 @@ class BoundingBox {
             y1_ = y0;
             y0_ = y1;
         }
+        if (z0 > z1)
+        {
+            z1_ = z0;
+            z0_ = z1;
+        }
     }
 
 
-    bool IsPointInside(double x, double y) const
+    bool IsPointInside(double x, double y, double z) const
     {
         return (
             (x > (x0_ - bloat_)) &&
             (x < (x1_ + bloat_)) &&
             (y > (y0_ - bloat_)) &&
-            (y < (y1_ + bloat_))
+            (y < (y1_ + bloat_)) &&
+            (z > (z0_ - bloat_)) &&
+            (z < (z1_ + bloat_))
             );
     }
 
@@ -57,6 +70,14 @@ class BoundingBox {
         {
             return y1_;
         }
+        double GetZ0() const
+        {
+            return z0_;
+        }
+        double GetZ1() const
+        {
+            return z1_;
+        }
         double GetBloat() const
         {
             return bloat_;
@@ -68,6 +89,8 @@ class BoundingBox {
     double x1_;
     double y0_;
     double y1_;
+    double z0_;
+    double z1_;
     double bloat_;
 };
 
@@ -138,7 +161,7 @@ class MeshRegion2d {
 /*
         bool   IsCoordinateInside(const MeshCoordinate &) const;
 */
-        bool IsPointInside(double /*x*/, double /*y*/) const;
+        bool IsPointInside(double /*x*/, double /*y*/, double /*z*/) const;
 
         void AddBoundingBox(const MeshRegion &);
         void AddBoundingBox(const BoundingBox &bb)
@@ -180,7 +203,7 @@ class MeshInterface2d {
             return Region1;
         }
 
-        bool IsPointInside(double /*x*/, double /*y*/) const;
+        bool IsPointInside(double /*x*/, double /*y*/, double /*z*/) const;
 
         void AddBoundingBox(const MeshInterface2d &);
         void AddBoundingBox(const BoundingBox &bb)
@@ -222,7 +245,7 @@ class MeshContact2d {
             bboxes_.push_back(bb);
         }
 
-        bool IsPointInside(double /*x*/, double /*y*/) const;
+        bool IsPointInside(double /*x*/, double /*y*/, double /*z*/) const;
 
         MeshContact2d();
     private:
@@ -0,0 +1,18 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#include "Mesh3d.hh"
+
+namespace dsMesh {
+Mesh3d::~Mesh3d()
+{
+}
+
+Mesh3d::Mesh3d(const std::string &nm) : StructuredMesh(nm, 3)
+{
+}
+}
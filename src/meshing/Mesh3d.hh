@@ -0,0 +1,31 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#ifndef MESH3D_HH
+#define MESH3D_HH
+#include "StructuredMesh.hh"
+
+#include <string>
+
+namespace dsMesh {
+class Mesh3d;
+typedef Mesh3d *Mesh3dPtr;
+
+/// Each cell of the grid is split into 6 tetrahedra
+class Mesh3d : public StructuredMesh {
+    public:
+        ~Mesh3d();
+
+        Mesh3d(const std::string &);
+
+    private:
+        Mesh3d &operator=(const Mesh3d &);
+        Mesh3d(const Mesh3d &);
+};
+}
+
+#endif
@@ -9,10 +9,10 @@ SPDX-License-Identifier: Apache-2.0
 #include "Mesh.hh"
 
 #include "dsAssert.hh"
+#include "SimulationContext.hh"
 
 namespace dsMesh {
 
-MeshKeeper *MeshKeeper::instance = 0;
 
 MeshKeeper::MeshKeeper()
 {
@@ -20,17 +20,19 @@ MeshKeeper::MeshKeeper()
 
 MeshKeeper &MeshKeeper::GetInstance()
 {
+    MeshKeeper *instance = static_cast<MeshKeeper *>(SimulationContext::GetInstance(SimulationContext::InstanceSlot::MESHKEEPER));
     if (!instance)
     {
         instance = new MeshKeeper;
+        SimulationContext::SetInstance(SimulationContext::InstanceSlot::MESHKEEPER, instance);
     }
     return *instance;
 }
 
 void MeshKeeper::DestroyInstance()
 {
-    delete instance;
-    instance = nullptr;
+    delete static_cast<MeshKeeper *>(SimulationContext::GetInstance(SimulationContext::InstanceSlot::MESHKEEPER));
+    SimulationContext::SetInstance(SimulationContext::InstanceSlot::MESHKEEPER, nullptr);
 }
 
 
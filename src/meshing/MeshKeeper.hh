@@ -39,8 +39,6 @@ class MeshKeeper
         MeshKeeper &operator=(MeshKeeper &);
         ~MeshKeeper();
 
-        static MeshKeeper *instance;
-
         MeshList_t meshList;
 };
 }
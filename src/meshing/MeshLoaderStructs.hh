@@ -12,6 +12,7 @@ SPDX-License-Identifier: Apache-2.0
 #include <memory>
 #include <string>
 #include <vector>
+#include <array>
 #include <map>
 #include <algorithm>
 namespace dsMesh {
@@ -261,11 +262,7 @@ class MeshTriangle
     public:
         MeshTriangle(size_t i, size_t j, size_t k) : index0(i), index1(j), index2(k)
         {
-          std::vector<size_t> vec;
-          vec.reserve(3);
-          vec.push_back(i);
-          vec.push_back(j);
-          vec.push_back(k);
+          std::array<size_t, 3> vec = {i, j, k};
           std::sort(vec.begin(), vec.end());
           index0 = vec[0];
           index1 = vec[1];
@@ -325,12 +322,7 @@ class MeshTetrahedron
     public:
         MeshTetrahedron(size_t i, size_t j, size_t k, size_t l) : index0(i), index1(j), index2(k), index3(l)
         {
-          std::vector<size_t> vec;
-          vec.reserve(4);
-          vec.push_back(i);
-          vec.push_back(j);
-          vec.push_back(k);
-          vec.push_back(l);
+          std::array<size_t, 4> vec = {i, j, k, l};
           std::sort(vec.begin(), vec.end());
           index0 = vec[0];
           index1 = vec[1];
@@ -430,7 +422,7 @@ class MeshCoordinate {
 
 class MeshRegion {
     public:
-        MeshRegion(const std::string &n, const std::string &m) : name(n), material(m)
+        MeshRegion(const std::string &n, const std::string &m) : name(n), material(m), sorted(false), edgeDuplicates(0), triangleDuplicates(0), tetrahedronDuplicates(0)
         {
             nodes.reserve(1000);
             edges.reserve(1000);
@@ -470,6 +462,36 @@ class MeshRegion {
             tetrahedra.push_back(mt);
         }
 
+        /// The edges, triangles, and tetrahedra were added in sorted order without duplicates
+        /// The number of duplicates already removed are reported by the loader
+        void SetSorted(size_t edup, size_t tdup, size_t tetdup)
+        {
+            sorted = true;
+            edgeDuplicates = edup;
+            triangleDuplicates = tdup;
+            tetrahedronDuplicates = tetdup;
+        }
+
+        bool IsSorted() const
+        {
+            return sorted;
+        }
+
+        size_t GetEdgeDuplicates() const
+        {
+            return edgeDuplicates;
+        }
+
+        size_t GetTriangleDuplicates() const
+        {
+            return triangleDuplicates;
+        }
+
+        size_t GetTetrahedronDuplicates() const
+        {
+            return tetrahedronDuplicates;
+        }
+
         bool HasNodes() const {
             return !nodes.empty();
         }
@@ -554,6 +576,10 @@ class MeshRegion {
         MeshTetrahedronList_t tetrahedra;
         MeshSolutionList_t       solutionList;
         MeshEquationList_t       equationList;
+        bool                     sorted;
+        size_t                   edgeDuplicates;
+        size_t                   triangleDuplicates;
+        size_t                   tetrahedronDuplicates;
 };
 
 class MeshInterfaceNodePair
@@ -0,0 +1,650 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#include "MeshRefinement.hh"
+#include "DevsimLoader.hh"
+#include "MeshLoaderStructs.hh"
+#include "Device.hh"
+#include "Region.hh"
+#include "Contact.hh"
+#include "Interface.hh"
+#include "Coordinate.hh"
+#include "Node.hh"
+#include "Edge.hh"
+#include "Triangle.hh"
+#include "Tetrahedron.hh"
+#include "EdgeModel.hh"
+#include "NodeSolution.hh"
+#include "dsAssert.hh"
+#ifdef DEVSIM_EXTENDED_PRECISION
+#include "Float128.hh"
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+
+namespace dsMesh {
+namespace {
+const size_t tetrahedronEdges[6][2] = {{0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {2, 3}};
+//// the face opposite of each node
+const size_t tetrahedronFaces[4][3] = {{1, 2, 3}, {0, 2, 3}, {0, 1, 3}, {0, 1, 2}};
+
+template <typename T>
+std::vector<size_t> GetCoordinateIndexes(const T &element)
+{
+  std::vector<size_t> ret;
+  for (const auto &node : element->GetNodeList())
+  {
+    ret.push_back(node->GetCoordinate().GetIndex());
+  }
+  return ret;
+}
+
+bool IsNodeSolution(const NodeModel &nm)
+{
+  bool ret = (dynamic_cast<const NodeSolution<double> *>(&nm) != nullptr);
+#ifdef DEVSIM_EXTENDED_PRECISION
+  ret = ret || (dynamic_cast<const NodeSolution<float128> *>(&nm) != nullptr);
+#endif
+  return ret;
+}
+}
+
+MeshRefinement::MeshRefinement(const Device &device) : device_(device), dimension_(device.GetDimension())
+{
+  dsAssert((dimension_ >= 1) && (dimension_ <= 3), "UNEXPECTED");
+
+  for (const auto &rit : device_.GetRegionList())
+  {
+    const Region &region = *(rit.second);
+    const std::string &name = rit.first;
+    if (dimension_ == 1)
+    {
+      std::vector<EdgeNodes_t> &elements = edges_[name];
+      for (const auto &edge : region.GetEdgeList())
+      {
+        const std::vector<size_t> c = GetCoordinateIndexes(edge);
+        elements.push_back({c[0], c[1]});
+      }
+    }
+    else if (dimension_ == 2)
+    {
+      std::vector<TriangleNodes_t> &elements = triangles_[name];
+      for (const auto &triangle : region.GetTriangleList())
+      {
+        const std::vector<size_t> c = GetCoordinateIndexes(triangle);
+        elements.push_back({c[0], c[1], c[2]});
+      }
+    }
+    else
+    {
+      std::vector<TetrahedronNodes_t> &elements = tetrahedra_[name];
+      for (const auto &tetrahedron : region.GetTetrahedronList())
+      {
+        const std::vector<size_t> c = GetCoordinateIndexes(tetrahedron);
+        elements.push_back({c[0], c[1], c[2], c[3]});
+      }
+    }
+  }
+}
+
+MeshRefinement::EdgeKey_t MeshRefinement::GetKey(size_t c0, size_t c1)
+{
+  return (c0 < c1) ? std::make_pair(c0, c1) : std::make_pair(c1, c0);
+}
+
+bool MeshRefinement::IsMarked(size_t c0, size_t c1) const
+{
+  return midpoints_.count(GetKey(c0, c1)) != 0;
+}
+
+bool MeshRefinement::Mark(size_t c0, size_t c1)
+{
+  return midpoints_.insert(std::make_pair(GetKey(c0, c1), size_t(-1))).second;
+}
+
+size_t MeshRefinement::GetMidpoint(size_t c0, size_t c1) const
+{
+  auto it = midpoints_.find(GetKey(c0, c1));
+  dsAssert(it != midpoints_.end(), "UNEXPECTED");
+  dsAssert(it->second != size_t(-1), "UNEXPECTED");
+  return it->second;
+}
+
+bool MeshRefinement::MarkEdges(const Region &region, const std::string &name, double threshold)
+{
+  ConstEdgeModelPtr em = region.GetEdgeModel(name);
+  if (!em)
+  {
+    return false;
+  }
+
+  const EdgeScalarList<double> &values = em->GetScalarValues<double>();
+  for (const auto &edge : region.GetEdgeList())
+  {
+    if (std::abs(values[edge->GetIndex()]) > threshold)
+    {
+      const std::vector<size_t> c = GetCoordinateIndexes(edge);
+      Mark(c[0], c[1]);
+    }
+  }
+  return true;
+}
+
+bool MeshRefinement::CloseTriangle(const TriangleNodes_t &nodes)
+{
+  const size_t count = static_cast<size_t>(IsMarked(nodes[0], nodes[1])) + static_cast<size_t>(IsMarked(nodes[0], nodes[2])) + static_cast<size_t>(IsMarked(nodes[1], nodes[2]));
+  if (count != 2)
+  {
+    return false;
+  }
+  Mark(nodes[0], nodes[1]);
+  Mark(nodes[0], nodes[2]);
+  Mark(nodes[1], nodes[2]);
+  return true;
+}
+
+bool MeshRefinement::CloseTetrahedron(const TetrahedronNodes_t &nodes)
+{
+  bool ret = false;
+
+  //// the faces must be split the same way from both of their elements
+  bool changed = true;
+  while (changed)
+  {
+    changed = false;
+    for (size_t f = 0; f < 4; ++f)
+    {
+      const TriangleNodes_t face = {nodes[tetrahedronFaces[f][0]], nodes[tetrahedronFaces[f][1]], nodes[tetrahedronFaces[f][2]]};
+      if (CloseTriangle(face))
+      {
+        changed = true;
+        ret = true;
+      }
+    }
+  }
+
+  size_t count = 0;
+  for (size_t e = 0; e < 6; ++e)
+  {
+    count += static_cast<size_t>(IsMarked(nodes[tetrahedronEdges[e][0]], nodes[tetrahedronEdges[e][1]]));
+  }
+
+  bool splitface = false;
+  for (size_t f = 0; f < 4; ++f)
+  {
+    const size_t *fn = tetrahedronFaces[f];
+    splitface = splitface || (IsMarked(nodes[fn[0]], nodes[fn[1]]) && IsMarked(nodes[fn[0]], nodes[fn[2]]) && IsMarked(nodes[fn[1]], nodes[fn[2]]));
+  }
+
+  //// two opposite edges are the only other pattern with closed faces
+  if (!((count <= 1) || (count == 6) || ((count == 3) && splitface)))
+  {
+    for (size_t e = 0; e < 6; ++e)
+    {
+      Mark(nodes[tetrahedronEdges[e][0]], nodes[tetrahedronEdges[e][1]]);
+    }
+    ret = true;
+  }
+
+  return ret;
+}
+
+void MeshRefinement::CloseMarkedEdges()
+{
+  if (dimension_ == 1)
+  {
+    return;
+  }
+
+  bool changed = true;
+  while (changed)
+  {
+    changed = false;
+    for (const auto &rit : triangles_)
+    {
+      for (const auto &nodes : rit.second)
+      {
+        changed = CloseTriangle(nodes) || changed;
+      }
+    }
+    for (const auto &rit : tetrahedra_)
+    {
+      for (const auto &nodes : rit.second)
+      {
+        changed = CloseTetrahedron(nodes) || changed;
+      }
+    }
+  }
+}
+
+void MeshRefinement::SplitEdge(const EdgeNodes_t &nodes, std::vector<EdgeNodes_t> &result) const
+{
+  if (IsMarked(nodes[0], nodes[1]))
+  {
+    const size_t m = GetMidpoint(nodes[0], nodes[1]);
+    result.push_back({nodes[0], m});
+    result.push_back({m, nodes[1]});
+  }
+  else
+  {
+    result.push_back(nodes);
+  }
+}
+
+void MeshRefinement::SplitTriangle(const TriangleNodes_t &nodes, std::vector<TriangleNodes_t> &result) const
+{
+  const size_t triangleEdges[3][3] = {{0, 1, 2}, {0, 2, 1}, {1, 2, 0}};
+
+  size_t count = 0;
+  size_t marked = 0;
+  for (size_t e = 0; e < 3; ++e)
+  {
+    if (IsMarked(nodes[triangleEdges[e][0]], nodes[triangleEdges[e][1]]))
+    {
+      ++count;
+      marked = e;
+    }
+  }
+
+  if (count == 0)
+  {
+    result.push_back(nodes);
+  }
+  else if (count == 1)
+  {
+    //// bisected from the midpoint to the opposite node
+    const size_t n0 = nodes[triangleEdges[marked][0]];
+    const size_t n1 = nodes[triangleEdges[marked][1]];
+    const size_t n2 = nodes[triangleEdges[marked][2]];
+    const size_t m  = GetMidpoint(n0, n1);
+    result.push_back({n0, m, n2});
+    result.push_back({m, n1, n2});
+  }
+  else
+  {
+    dsAssert(count == 3, "UNEXPECTED");
+    const size_t m01 = GetMidpoint(nodes[0], nodes[1]);
+    const size_t m02 = GetMidpoint(nodes[0], nodes[2]);
+    const size_t m12 = GetMidpoint(nodes[1], nodes[2]);
+    result.push_back({nodes[0], m01, m02});
+    result.push_back({nodes[1], m01, m12});
+    result.push_back({nodes[2], m02, m12});
+    result.push_back({m01, m12, m02});
+  }
+}
+
+void MeshRefinement::SplitTetrahedron(const TetrahedronNodes_t &nodes, std::vector<TetrahedronNodes_t> &result) const
+{
+  size_t count = 0;
+  size_t marked = 0;
+  for (size_t e = 0; e < 6; ++e)
+  {
+    if (IsMarked(nodes[tetrahedronEdges[e][0]], nodes[tetrahedronEdges[e][1]]))
+    {
+      ++count;
+      marked = e;
+    }
+  }
+
+  if (count == 0)
+  {
+    result.push_back(nodes);
+  }
+  else if (count == 1)
+  {
+    //// bisected through the midpoint and the two other nodes
+    const size_t n0 = nodes[tetrahedronEdges[marked][0]];
+    const size_t n1 = nodes[tetrahedronEdges[marked][1]];
+    const size_t m  = GetMidpoint(n0, n1);
+    const size_t n2 = nodes[tetrahedronEdges[5 - marked][0]];
+    const size_t n3 = nodes[tetrahedronEdges[5 - marked][1]];
+    result.push_back({n0, m, n2, n3});
+    result.push_back({m, n1, n2, n3});
+  }
+  else if (count == 3)
+  {
+    //// the split face is connected to the opposite node
+    std::vector<TriangleNodes_t> faces;
+    for (size_t f = 0; f < 4; ++f)
+    {
+      const size_t *fn = tetrahedronFaces[f];
+      if (IsMarked(nodes[fn[0]], nodes[fn[1]]) && IsMarked(nodes[fn[0]], nodes[fn[2]]) && IsMarked(nodes[fn[1]], nodes[fn[2]]))
+      {
+        SplitTriangle({nodes[fn[0]], nodes[fn[1]], nodes[fn[2]]}, faces);
+        for (const auto &face : faces)
+        {
+          result.push_back({face[0], face[1], face[2], nodes[f]});
+        }
+        break;
+      }
+    }
+    dsAssert(faces.size() == 4, "UNEXPECTED");
+  }
+  else
+  {
+    dsAssert(count == 6, "UNEXPECTED");
+    const size_t a = nodes[0];
+    const size_t b = nodes[1];
+    const size_t c = nodes[2];
+    const size_t d = nodes[3];
+    const size_t mab = GetMidpoint(a, b);
+    const size_t mac = GetMidpoint(a, c);
+    const size_t mad = GetMidpoint(a, d);
+    const size_t mbc = GetMidpoint(b, c);
+    const size_t mbd = GetMidpoint(b, d);
+    const size_t mcd = GetMidpoint(c, d);
+
+    result.push_back({a, mab, mac, mad});
+    result.push_back({b, mab, mbc, mbd});
+    result.push_back({c, mac, mbc, mcd});
+    result.push_back({d, mad, mbd, mcd});
+
+    //// the inner octahedron is split along its shortest diagonal
+    //// the other four midpoints are in order around the diagonal
+    const Device::CoordinateList_t &clist = device_.GetCoordinateList();
+    const Vector<double> &pa = clist[a]->Position();
+    const Vector<double> &pb = clist[b]->Position();
+    const Vector<double> &pc = clist[c]->Position();
+    const Vector<double> &pd = clist[d]->Position();
+    const double l0 = (pa + pb - pc - pd).magnitude();
+    const double l1 = (pa + pc - pb - pd).magnitude();
+    const double l2 = (pa + pd - pb - pc).magnitude();
+
+    std::array<size_t, 6> octahedron;
+    if ((l0 <= l1) && (l0 <= l2))
+    {
+      octahedron = {mab, mcd, mac, mad, mbd, mbc};
+    }
+    else if (l1 <= l2)
+    {
+      octahedron = {mac, mbd, mab, mad, mcd, mbc};
+    }
+    else
+    {
+      octahedron = {mad, mbc, mab, mac, mcd, mbd};
+    }
+    for (size_t i = 0; i < 4; ++i)
+    {
+      result.push_back({octahedron[0], octahedron[1], octahedron[2 + i], octahedron[2 + (i + 1) % 4]});
+    }
+  }
+}
+
+void MeshRefinement::CreateMesh(DevsimLoader &mesh)
+{
+  const Device::CoordinateList_t &clist = device_.GetCoordinateList();
+
+  std::vector<MeshCoordinate> coordinates(clist.size());
+  for (const auto &coordinate : clist)
+  {
+    const Vector<double> &p = coordinate->Position();
+    coordinates[coordinate->GetIndex()] = MeshCoordinate(p.Getx(), p.Gety(), p.Getz());
+  }
+
+  //// the edge of each new coordinate
+  std::vector<EdgeKey_t> parents;
+  parents.reserve(midpoints_.size());
+  for (auto &mit : midpoints_)
+  {
+    const MeshCoordinate &c0 = coordinates[mit.first.first];
+    const MeshCoordinate &c1 = coordinates[mit.first.second];
+    mit.second = coordinates.size();
+    coordinates.push_back(MeshCoordinate(0.5 * (c0.GetX() + c1.GetX()), 0.5 * (c0.GetY() + c1.GetY()), 0.5 * (c0.GetZ() + c1.GetZ())));
+    parents.push_back(mit.first);
+  }
+  const size_t numoriginal = clist.size();
+
+  //// the new node index of each coordinate in each region
+  std::map<std::string, std::vector<size_t>> coordinateToNode;
+
+  std::vector<EdgeNodes_t>        cedges;
+  std::vector<TriangleNodes_t>    ctriangles;
+  std::vector<TetrahedronNodes_t> ctetrahedra;
+
+  for (const auto &rit : device_.GetRegionList())
+  {
+    const std::string &rname = rit.first;
+    const Region &region = *(rit.second);
+
+    mesh.AddRegion(std::make_unique<MeshRegion>(rname, region.GetMaterialName()));
+    MeshRegion &mregion = mesh.GetMeshRegion(rname);
+
+    std::vector<size_t> &ctonode = coordinateToNode[rname];
+    ctonode.assign(coordinates.size(), size_t(-1));
+
+    //// the original nodes keep their indexes
+    const ConstNodeList &nodes = region.GetNodeList();
+    for (const auto &node : nodes)
+    {
+      const size_t c = node->GetCoordinate().GetIndex();
+      ctonode[c] = node->GetIndex();
+    }
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+      mregion.AddNode(MeshNode(nodes[i]->GetCoordinate().GetIndex()));
+    }
+
+    //// the new nodes are numbered in the order of the elements
+    std::vector<size_t> newnodes;
+    auto GetNode = [&](size_t c) {
+      size_t &ni = ctonode[c];
+      if (ni == size_t(-1))
+      {
+        ni = nodes.size() + newnodes.size();
+        newnodes.push_back(c);
+        mregion.AddNode(MeshNode(c));
+      }
+      return ni;
+    };
+
+    if (dimension_ == 1)
+    {
+      cedges.clear();
+      for (const auto &element : edges_[rname])
+      {
+        SplitEdge(element, cedges);
+      }
+      for (const auto &element : cedges)
+      {
+        const size_t n0 = GetNode(element[0]);
+        const size_t n1 = GetNode(element[1]);
+        mregion.AddEdge(MeshEdge(n0, n1));
+      }
+    }
+    else if (dimension_ == 2)
+    {
+      ctriangles.clear();
+      for (const auto &element : triangles_[rname])
+      {
+        SplitTriangle(element, ctriangles);
+      }
+      for (const auto &element : ctriangles)
+      {
+        const size_t n0 = GetNode(element[0]);
+        const size_t n1 = GetNode(element[1]);
+        const size_t n2 = GetNode(element[2]);
+        mregion.AddTriangle(MeshTriangle(n0, n1, n2));
+      }
+    }
+    else
+    {
+      ctetrahedra.clear();
+      for (const auto &element : tetrahedra_[rname])
+      {
+        SplitTetrahedron(element, ctetrahedra);
+      }
+      for (const auto &element : ctetrahedra)
+      {
+        const size_t n0 = GetNode(element[0]);
+        const size_t n1 = GetNode(element[1]);
+        const size_t n2 = GetNode(element[2]);
+        const size_t n3 = GetNode(element[3]);
+        mregion.AddTetrahedron(MeshTetrahedron(n0, n1, n2, n3));
+      }
+    }
+
+    //// the values on the new nodes are the average of the edge they split
+    for (const auto &nit : region.GetNodeModelList())
+    {
+      const NodeModel &nm = *(nit.second);
+      if (!IsNodeSolution(nm))
+      {
+        continue;
+      }
+
+      const NodeScalarList<double> &values = nm.GetScalarValues<double>();
+
+      SolutionPtr sp = std::make_unique<Solution>(nit.first);
+      sp->SetModelType(Solution::ModelType::NODE);
+      sp->SetDataType(Solution::DataType::DATA);
+      sp->SetReserve(nodes.size() + newnodes.size());
+      for (size_t i = 0; i < nodes.size(); ++i)
+      {
+        sp->AddValue(values[i]);
+      }
+      for (const auto &c : newnodes)
+      {
+        dsAssert(c >= numoriginal, "UNEXPECTED");
+        const EdgeKey_t &parent = parents[c - numoriginal];
+        sp->AddValue(0.5 * (values[ctonode[parent.first]] + values[ctonode[parent.second]]));
+      }
+      mregion.AddSolution(std::move(sp));
+    }
+  }
+
+  //// the node indexes of the refined contact and interface elements in a region
+  auto GetNodes = [&](const std::vector<size_t> &ctonode, const auto &element) {
+    auto ret = element;
+    for (auto &n : ret)
+    {
+      n = ctonode[n];
+      dsAssert(n != size_t(-1), "UNEXPECTED");
+    }
+    return ret;
+  };
+
+  for (const auto &cit : device_.GetContactList())
+  {
+    const std::string &cname = cit.first;
+    const Contact &contact = *(cit.second);
+    const std::string &rname = contact.GetRegion()->GetName();
+    const std::vector<size_t> &ctonode = coordinateToNode[rname];
+
+    mesh.AddContact(std::make_unique<MeshContact>(cname, rname, contact.GetMaterialName()));
+    MeshContact &mcontact = mesh.GetMeshContact(cname);
+
+    std::set<size_t> cnodes;
+    for (const auto &node : contact.GetNodes())
+    {
+      cnodes.insert(node->GetIndex());
+    }
+
+    if (dimension_ == 2)
+    {
+      cedges.clear();
+      for (const auto &edge : contact.GetEdges())
+      {
+        const std::vector<size_t> c = GetCoordinateIndexes(edge);
+        SplitEdge({c[0], c[1]}, cedges);
+      }
+      for (const auto &element : cedges)
+      {
+        const EdgeNodes_t n = GetNodes(ctonode, element);
+        mcontact.AddEdge(MeshEdge(n[0], n[1]));
+        cnodes.insert(n.begin(), n.end());
+      }
+    }
+    else if (dimension_ == 3)
+    {
+      ctriangles.clear();
+      for (const auto &triangle : contact.GetTriangles())
+      {
+        const std::vector<size_t> c = GetCoordinateIndexes(triangle);
+        SplitTriangle({c[0], c[1], c[2]}, ctriangles);
+      }
+      for (const auto &element : ctriangles)
+      {
+        const TriangleNodes_t n = GetNodes(ctonode, element);
+        mcontact.AddTriangle(MeshTriangle(n[0], n[1], n[2]));
+        cnodes.insert(n.begin(), n.end());
+      }
+    }
+
+    for (const auto &n : cnodes)
+    {
+      mcontact.AddNode(MeshNode(n));
+    }
+  }
+
+  for (const auto &iit : device_.GetInterfaceList())
+  {
+    const std::string &iname = iit.first;
+    const Interface &iface = *(iit.second);
+    const std::string &rname0 = iface.GetRegion0()->GetName();
+    const std::string &rname1 = iface.GetRegion1()->GetName();
+    const std::vector<size_t> &ctonode0 = coordinateToNode[rname0];
+    const std::vector<size_t> &ctonode1 = coordinateToNode[rname1];
+
+    mesh.AddInterface(std::make_unique<MeshInterface>(iname, rname0, rname1));
+    MeshInterface &minterface = mesh.GetMeshInterface(iname);
+
+    //// the nodes on both sides of the interface are at the same coordinates
+    std::set<size_t> icoordinates;
+    const Interface::ConstNodeList_t &nodes0 = iface.GetNodes0();
+    for (const auto &node : nodes0)
+    {
+      icoordinates.insert(node->GetCoordinate().GetIndex());
+    }
+
+    if (dimension_ == 2)
+    {
+      cedges.clear();
+      for (const auto &edge : iface.GetEdges0())
+      {
+        const std::vector<size_t> c = GetCoordinateIndexes(edge);
+        SplitEdge({c[0], c[1]}, cedges);
+      }
+      for (const auto &element : cedges)
+      {
+        const EdgeNodes_t n0 = GetNodes(ctonode0, element);
+        const EdgeNodes_t n1 = GetNodes(ctonode1, element);
+        minterface.AddEdgePair(MeshEdge(n0[0], n0[1]), MeshEdge(n1[0], n1[1]));
+        icoordinates.insert(element.begin(), element.end());
+      }
+    }
+    else if (dimension_ == 3)
+    {
+      ctriangles.clear();
+      for (const auto &triangle : iface.GetTriangles0())
+      {
+        const std::vector<size_t> c = GetCoordinateIndexes(triangle);
+        SplitTriangle({c[0], c[1], c[2]}, ctriangles);
+      }
+      for (const auto &element : ctriangles)
+      {
+        const TriangleNodes_t n0 = GetNodes(ctonode0, element);
+        const TriangleNodes_t n1 = GetNodes(ctonode1, element);
+        minterface.AddTrianglePair(MeshTriangle(n0[0], n0[1], n0[2]), MeshTriangle(n1[0], n1[1], n1[2]));
+        icoordinates.insert(element.begin(), element.end());
+      }
+    }
+
+    for (const auto &c : icoordinates)
+    {
+      const size_t n0 = ctonode0[c];
+      const size_t n1 = ctonode1[c];
+      dsAssert((n0 != size_t(-1)) && (n1 != size_t(-1)), "UNEXPECTED");
+      minterface.AddNodePair(MeshInterfaceNodePair(n0, n1));
+    }
+  }
+
+  mesh.AddCoordinates(coordinates);
+}
+}
+
@@ -0,0 +1,86 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#ifndef MESH_REFINEMENT_HH
+#define MESH_REFINEMENT_HH
+#include <vector>
+#include <array>
+#include <map>
+#include <string>
+#include <utility>
+#include <cstddef>
+
+class Device;
+class Region;
+
+namespace dsMesh {
+class DevsimLoader;
+
+/// Splits the marked edges of a device at their midpoints, and creates a new mesh from the result
+/// Edges are identified by their coordinates, so an edge shared by regions is split in all of them
+/// The elements are split so there are no hanging nodes:
+///   triangles have 0, 1, or 3 marked edges, and are bisected or split into 4
+///   tetrahedra have 0 or 1 marked edges, the 3 edges of one face, or all 6 marked edges,
+///   and are bisected, split into 4 from the split face, or split into 8
+class MeshRefinement {
+  public:
+    explicit MeshRefinement(const Device &);
+
+    /// Marks the edges where the magnitude of the edge model is above the threshold
+    /// Returns false if the region does not have the edge model
+    bool MarkEdges(const Region &, const std::string &/*edge model*/, double /*threshold*/);
+
+    /// Marks more edges until every element has one of the patterns which can be split
+    void CloseMarkedEdges();
+
+    size_t GetNumberMarkedEdges() const
+    {
+      return midpoints_.size();
+    }
+
+    /// The regions, contacts, interfaces, and node solutions of the device are added to the mesh
+    /// Node solutions are linearly interpolated onto the new nodes
+    void CreateMesh(DevsimLoader &);
+
+  private:
+    MeshRefinement(const MeshRefinement &);
+    MeshRefinement &operator=(const MeshRefinement &);
+
+    typedef std::pair<size_t, size_t> EdgeKey_t;
+    typedef std::array<size_t, 2> EdgeNodes_t;
+    typedef std::array<size_t, 3> TriangleNodes_t;
+    typedef std::array<size_t, 4> TetrahedronNodes_t;
+
+    static EdgeKey_t GetKey(size_t, size_t);
+
+    bool IsMarked(size_t, size_t) const;
+    /// Returns true if the edge was not already marked
+    bool Mark(size_t, size_t);
+    /// Returns true if more edges were marked
+    bool CloseTriangle(const TriangleNodes_t &);
+    bool CloseTetrahedron(const TetrahedronNodes_t &);
+
+    /// The coordinate index of the midpoint of a marked edge
+    size_t GetMidpoint(size_t, size_t) const;
+
+    /// The elements in coordinate indexes
+    void SplitEdge(const EdgeNodes_t &, std::vector<EdgeNodes_t> &) const;
+    void SplitTriangle(const TriangleNodes_t &, std::vector<TriangleNodes_t> &) const;
+    void SplitTetrahedron(const TetrahedronNodes_t &, std::vector<TetrahedronNodes_t> &) const;
+
+    const Device &device_;
+    size_t dimension_;
+    //// the elements of each region, in coordinate indexes, in the order of the region
+    std::map<std::string, std::vector<EdgeNodes_t>>        edges_;
+    std::map<std::string, std::vector<TriangleNodes_t>>    triangles_;
+    std::map<std::string, std::vector<TetrahedronNodes_t>> tetrahedra_;
+    //// the coordinate index of each midpoint is set when the mesh is created
+    std::map<EdgeKey_t, size_t> midpoints_;
+};
+}
+#endif
+
@@ -0,0 +1,419 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#include "StructuredMesh.hh"
+#include "TensorProductMesh.hh"
+#include "OutputStream.hh"
+#include "dsAssert.hh"
+#include "MeshUtil.hh"
+#include "DevsimLoader.hh"
+#include "ParallelFor.hh"
+#include <sstream>
+#include <algorithm>
+
+namespace dsMesh {
+namespace {
+const char *directionNames[] = {"x", "y", "z"};
+}
+
+StructuredMesh::~StructuredMesh()
+{
+}
+
+StructuredMesh::StructuredMesh(const std::string &nm, size_t dim) : Mesh(nm), dimension(dim)
+{
+    dsAssert((dimension == 2) || (dimension == 3), "UNEXPECTED");
+}
+
+bool StructuredMesh::Instantiate_(const std::string &deviceName, std::string &errorString)
+{
+    bool ret = true;
+    if (meshLoader)
+    {
+        ret = meshLoader->Instantiate(deviceName, errorString);
+    }
+    else
+    {
+        ret = false;
+        errorString += "Unable to instantiate " + deviceName + "\n";
+    }
+
+    return ret;
+}
+
+std::vector<double> StructuredMesh::GetLocations(MeshLineVector_t &mlv)
+{
+    std::vector<double> locations;
+    dsAssert(!mlv.empty(), "UNEXPECTED");
+
+    double xl = mlv[0]->getPosition();
+    double sl = mlv[0]->getPositiveSpacing();
+
+    locations.push_back(xl);
+
+    double xh;
+    double sh;
+    for (size_t i = 1; i < mlv.size(); ++i)
+    {
+        xh  = mlv[i]->getPosition();
+        sh  = mlv[i]->getNegativeSpacing();
+
+        /// Get mlv for this section
+        MeshUtil::pts_t pts = MeshUtil::getPoints(xl, xh, sl, sh);
+        for (size_t j = 1; j < pts.size(); ++j)
+        {
+            locations.push_back(pts[j]);
+        }
+
+        xl = xh;
+        sl = mlv[i]->getPositiveSpacing();
+    }
+    return locations;
+}
+
+size_t StructuredMesh::FindRegion(double x, double y, double z) const
+{
+    //// the last region containing the point is used
+    for (size_t r = regionOrder.size(); r > 0; --r)
+    {
+        const MeshRegion2d &mr = *(regions.find(regionOrder[r - 1])->second);
+        if (mr.IsPointInside(x, y, z))
+        {
+            return r - 1;
+        }
+    }
+    return size_t(-1);
+}
+
+bool StructuredMesh::RemoveCollinearLines(std::string &errorString)
+{
+    bool ret = true;
+
+    std::ostringstream os;
+    for (size_t d = 0; d < dimension; ++d)
+    {
+        MeshLineVector_t &dlines = lines[d];
+        sort(dlines.begin(), dlines.end());
+
+        MeshLineVector_t nlines;
+        const size_t len = dlines.size();
+        if (len > 0)
+        {
+            nlines.push_back(dlines[0]);
+        }
+
+        for (size_t i = 1; i < len; ++i)
+        {
+            if (dlines[i]->getPosition() == dlines[i-1]->getPosition())
+            {
+                os << "Removing collinear point from meshlines in " << directionNames[d] << " direction at " << dlines[i]->getPosition() << "\n";
+            }
+            else
+            {
+                nlines.push_back(dlines[i]);
+            }
+        }
+        dlines.swap(nlines);
+    }
+
+    std::string warn = os.str();
+    if (!warn.empty())
+    {
+        OutputStream::WriteOut(OutputStream::OutputType::INFO, warn);
+    }
+
+    //// Enough meshlines
+    for (size_t d = 0; d < dimension; ++d)
+    {
+        if (lines[d].size() < 2)
+        {
+            ret = false;
+            errorString += std::string("Must have at least 2 mesh lines in the ") + directionNames[d] + " direction\n";
+        }
+    }
+
+    return ret;
+}
+
+bool StructuredMesh::Finalize_(std::string &errorString)
+{
+    bool ret = RemoveCollinearLines(errorString);
+    if (!ret)
+    {
+        return ret;
+    }
+
+    meshLoader = std::make_shared<DevsimLoader>(GetName());
+
+    std::vector<double> locations[3];
+    for (size_t d = 0; d < dimension; ++d)
+    {
+        locations[d] = GetLocations(lines[d]);
+    }
+
+    TensorProductMesh grid(locations[0], locations[1], locations[2]);
+
+    std::vector<MeshCoordinate> coordinates;
+    grid.CreateCoordinates(coordinates);
+
+    grid.SetElementRegions([this](double x, double y, double z) {
+        return FindRegion(x, y, z);
+    });
+
+    //// Messages are in the order of the elements
+    std::vector<MeshRegion *> mregions(regionOrder.size(), nullptr);
+    const size_t numelements = grid.GetNumberElements();
+    for (size_t e = 0; e < numelements; ++e)
+    {
+        const size_t r = grid.GetElementRegion(e);
+        if (r != size_t(-1))
+        {
+            if (!mregions[r])
+            {
+                const MeshRegion2d &mr = *regions[regionOrder[r]];
+                const std::string &nm = mr.GetName();
+                const std::string &m = mr.GetMaterial();
+                meshLoader->AddRegion(std::make_unique<MeshRegion>(nm, m));
+                mregions[r] = &meshLoader->GetMeshRegion(nm);
+
+                std::ostringstream os;
+                os << "Creating Region " << nm << "\n";
+                OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str().c_str());
+            }
+        }
+        else
+        {
+            const TensorProductMesh::ElementNodes_t nodes = grid.GetElementNodes(e);
+            std::ostringstream os;
+            os << ((dimension == 2) ? "Triangle" : "Tetrahedron") << " has no region: ";
+            for (size_t n = 0; n <= dimension; ++n)
+            {
+                os << coordinates[nodes[n]].GetVector() << " ";
+            }
+            os << grid.GetElementCenter(e).GetVector() << "\n";
+            OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str().c_str());
+        }
+    }
+
+    /// Process the elements into regions
+    std::vector<std::vector<size_t>> coordinateToNode;
+    grid.CreateRegions(mregions, coordinateToNode);
+
+    std::map<std::string, size_t> regionIndex;
+    for (size_t r = 0; r < regionOrder.size(); ++r)
+    {
+        regionIndex[regionOrder[r]] = r;
+    }
+
+    std::vector<size_t> nodesAtCoordinate(coordinates.size(), 0);
+    dsMath::ParallelFor(coordinates.size(), [&](size_t b, size_t e) {
+        for (const auto &ctonode : coordinateToNode)
+        {
+            if (ctonode.empty())
+            {
+                continue;
+            }
+            for (size_t i = b; i < e; ++i)
+            {
+                if (ctonode[i] != size_t(-1))
+                {
+                    ++nodesAtCoordinate[i];
+                }
+            }
+        }
+    }, coordinateToNode.size());
+
+    //// The node of the region at this coordinate, or size_t(-1)
+    auto GetRegionNode = [&](const std::string &r, size_t i) {
+        size_t ret = size_t(-1);
+        auto it = regionIndex.find(r);
+        if (it != regionIndex.end())
+        {
+            const std::vector<size_t> &ctonode = coordinateToNode[it->second];
+            if (!ctonode.empty())
+            {
+                ret = ctonode[i];
+            }
+        }
+        return ret;
+    };
+
+    for (size_t i = 0; i < nodesAtCoordinate.size(); ++i)
+    {
+        size_t count = nodesAtCoordinate[i];
+        //// TODO: some type of message for multiple interfaces
+        if (count > 1)
+        {
+            const double x = coordinates[i].GetX();
+            const double y = coordinates[i].GetY();
+            const double z = coordinates[i].GetZ();
+
+            bool found = false;
+            for (std::vector<std::string>::iterator ci = contactOrder.begin(); ci != contactOrder.end(); ++ci)
+            {
+                const std::string &nm = *ci;
+                MeshContact2d &mc = *contacts[nm];
+
+                if (!mc.IsPointInside(x, y, z))
+                {
+                    continue;
+                }
+
+                const std::string &r  = mc.GetRegion();
+                const std::string &m  = mc.GetMaterial();
+
+                if (!meshLoader->IsMeshContact(nm))
+                {
+                    meshLoader->AddContact(std::make_unique<MeshContact>(nm, r, m));
+                }
+
+                size_t ni = GetRegionNode(r, i);
+                if (ni != size_t(-1))
+                {
+                    meshLoader->GetMeshContact(nm).AddNode(MeshNode(ni));
+                    found = true;
+                    std::ostringstream os;
+                    os << "Contact: " << nm << " region " << r << " ni: " << ni << " ci: " << i << " " << coordinates[i].GetVector() << "\n";
+                    OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str().c_str());
+                    break;
+                }
+            }
+
+            /// Now search interfaces
+            if (!found)
+            {
+                for (std::vector<std::string>::iterator ii = interfaceOrder.begin(); ii != interfaceOrder.end(); ++ii)
+                {
+                    const std::string &nm = *ii;
+                    MeshInterface2d &mi = *interfaces[nm];
+
+                    if (!mi.IsPointInside(x, y, z))
+                    {
+                        continue;
+                    }
+
+                    const std::string &r0  = mi.GetRegion0();
+                    const std::string &r1  = mi.GetRegion1();
+
+                    if (!meshLoader->IsMeshInterface(nm))
+                    {
+                        meshLoader->AddInterface(std::make_unique<MeshInterface>(nm, r0, r1));
+                    }
+
+                    size_t ni0 = GetRegionNode(r0, i);
+                    size_t ni1 = GetRegionNode(r1, i);
+                    if ((ni0 != size_t(-1)) && (ni1 != size_t(-1)))
+                    {
+                        meshLoader->GetMeshInterface(nm).AddNodePair(MeshInterfaceNodePair(ni0, ni1));
+                        found = true;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    meshLoader->AddCoordinates(coordinates);
+
+    if (ret)
+    {
+        ret = meshLoader->Finalize(errorString);
+    }
+
+    if (ret)
+    {
+        this->SetFinalized();
+    }
+
+    return ret;
+}
+
+void StructuredMesh::AddLine(LineDirection d, MeshLine2dPtr mline)
+{
+    const size_t index = static_cast<size_t>(d);
+    if (index < dimension)
+    {
+        lines[index].push_back(mline);
+    }
+}
+
+void StructuredMesh::AddRegion(MeshRegion2dPtr mreg)
+{
+    const std::string &nm = mreg->GetName();
+
+    MeshRegion2dList_t::iterator it = regions.find(nm);
+    if (it != regions.end())
+    {
+        MeshRegion2d &morig = *(it->second);
+        if (morig.GetMaterial() != mreg->GetMaterial())
+        {
+            std::ostringstream os;
+            os << "Not changing material from " << morig.GetMaterial() <<
+                " to " << mreg->GetMaterial() << " for region " << nm << "\n";
+            OutputStream::WriteOut(OutputStream::OutputType::INFO, os.str().c_str());
+        }
+        morig.AddBoundingBox(*mreg);
+    }
+    else
+    {
+        regions[nm] = mreg;
+        regionOrder.push_back(nm);
+    }
+}
+
+void StructuredMesh::AddInterface(MeshInterface2dPtr mint)
+{
+    const std::string &nm = mint->GetName();
+
+    MeshInterface2dList_t::iterator it = interfaces.find(nm);
+    if (it != interfaces.end())
+    {
+        MeshInterface2d &morig = *(it->second);
+        if (
+            (morig.GetRegion0() != mint->GetRegion0()) ||
+            (morig.GetRegion1() != mint->GetRegion1())
+        )
+        {
+            std::ostringstream os;
+            os << "Not changing interface regions  for interface " << nm << "\n";
+            OutputStream::WriteOut(OutputStream::OutputType::ERROR, os.str().c_str());
+        }
+        morig.AddBoundingBox(*mint);
+    }
+    else
+    {
+        interfaces[nm] = mint;
+        interfaceOrder.push_back(nm);
+    }
+}
+
+void StructuredMesh::AddContact(MeshContact2dPtr mcon)
+{
+    const std::string &nm = mcon->GetName();
+
+    MeshContact2dList_t::iterator it = contacts.find(nm);
+    if (it != contacts.end())
+    {
+        MeshContact2d &morig = *(it->second);
+        if (
+            (morig.GetRegion() != mcon->GetRegion())
+            )
+        {
+            std::ostringstream os;
+            os << "Not changing contact region  for contact " << nm << "\n";
+            OutputStream::WriteOut(OutputStream::OutputType::ERROR, os.str().c_str());
+        }
+        morig.AddBoundingBox(*mcon);
+    }
+    else
+    {
+        contacts[nm] = mcon;
+        contactOrder.push_back(nm);
+    }
+}
+}
+
@@ -0,0 +1,91 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#ifndef STRUCTURED_MESH_HH
+#define STRUCTURED_MESH_HH
+#include "Mesh.hh"
+#include "Mesh2dStructs.hh"
+#include "MeshLoaderStructs.hh"
+
+#include <memory>
+#include <vector>
+#include <string>
+#include <map>
+
+namespace dsMesh {
+enum class LineDirection {XDIR = 0, YDIR, ZDIR};
+
+class DevsimLoader;
+
+class MeshLine2d;
+typedef std::shared_ptr<MeshLine2d> MeshLine2dPtr;
+class MeshRegion2d;
+typedef std::shared_ptr<MeshRegion2d> MeshRegion2dPtr;
+class MeshInterface2d;
+typedef std::shared_ptr<MeshInterface2d> MeshInterface2dPtr;
+class MeshContact2d;
+typedef std::shared_ptr<MeshContact2d> MeshContact2dPtr;
+
+/// A mesh from lines in each direction, where each cell of the grid is split into triangles or tetrahedra
+/// Each element is in the last region whose bounding boxes contain its center
+/// Contacts and interfaces are on the nodes shared by more than one region
+class StructuredMesh : public Mesh {
+    public:
+        typedef std::vector<MeshLine2dPtr> MeshLineVector_t;
+
+        ~StructuredMesh();
+
+        void   AddLine(LineDirection, MeshLine2dPtr);
+        void   AddRegion(MeshRegion2dPtr);
+        void   AddContact(MeshContact2dPtr);
+        void   AddInterface(MeshInterface2dPtr);
+
+        size_t GetDimension() const
+        {
+            return dimension;
+        }
+
+    protected:
+        StructuredMesh(const std::string &, size_t /*dimension*/);
+
+    private:
+        std::vector<double> GetLocations(MeshLineVector_t &);
+        bool Instantiate_(const std::string &, std::string &);
+        bool Finalize_(std::string &);
+
+        bool RemoveCollinearLines(std::string &);
+
+        /// The index in regionOrder, or size_t(-1)
+        size_t FindRegion(double /*x*/, double /*y*/, double /*z*/) const;
+
+        StructuredMesh &operator=(const StructuredMesh &);
+        StructuredMesh(const StructuredMesh &);
+
+        size_t                          dimension;
+        MeshLineVector_t                lines[3];
+        typedef std::map<std::string, MeshRegion2dPtr>  MeshRegion2dList_t;
+        typedef std::map<std::string, MeshContact2dPtr> MeshContact2dList_t;
+        typedef std::map<std::string, MeshInterface2dPtr> MeshInterface2dList_t;
+        MeshRegion2dList_t    regions;
+        MeshContact2dList_t   contacts;
+        MeshInterface2dList_t interfaces;
+        std::vector<std::string>        regionOrder;
+        std::vector<std::string>        interfaceOrder;
+        std::vector<std::string>        contactOrder;
+
+        std::shared_ptr<DevsimLoader> meshLoader;
+};
+
+inline bool operator<(MeshLine2dPtr p0, MeshLine2dPtr p1)
+{
+    return p0->getPosition() < p1->getPosition();
+}
+
+}
+
+#endif
+
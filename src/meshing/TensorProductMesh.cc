@@ -0,0 +1,306 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#include "TensorProductMesh.hh"
+#include "MeshLoaderStructs.hh"
+#include "ParallelFor.hh"
+#include "dsAssert.hh"
+
+#include <algorithm>
+
+namespace dsMesh {
+namespace {
+/// Orders the entries by their first node with a counting sort, so only the few entries of each node are compared with each other
+/// Returns the number of duplicates removed
+template <size_t N>
+size_t SortAndUniquify(std::vector<std::array<size_t, N>> &entries, size_t numnodes)
+{
+  std::vector<size_t> rowptr(numnodes + 1, 0);
+  for (const auto &entry : entries)
+  {
+    ++rowptr[entry[0] + 1];
+  }
+  for (size_t i = 0; i < numnodes; ++i)
+  {
+    rowptr[i + 1] += rowptr[i];
+  }
+
+  std::vector<std::array<size_t, N>> sorted(entries.size());
+  {
+    std::vector<size_t> position(rowptr.begin(), rowptr.end() - 1);
+    for (const auto &entry : entries)
+    {
+      sorted[position[entry[0]]++] = entry;
+    }
+  }
+
+  size_t count = 0;
+  for (size_t i = 0; i < numnodes; ++i)
+  {
+    auto rbegin = sorted.begin() + rowptr[i];
+    auto rend   = sorted.begin() + rowptr[i + 1];
+    std::sort(rbegin, rend);
+    rend = std::unique(rbegin, rend);
+    const size_t rlen = rend - rbegin;
+    if (count != rowptr[i])
+    {
+      std::move(rbegin, rend, sorted.begin() + count);
+    }
+    count += rlen;
+  }
+  const size_t duplicates = sorted.size() - count;
+  sorted.resize(count);
+  entries.swap(sorted);
+  return duplicates;
+}
+}
+
+TensorProductMesh::TensorProductMesh(const std::vector<double> &x, const std::vector<double> &y, const std::vector<double> &z) : dimension_((z.empty()) ? 2 : 3)
+{
+  locations_[0] = x;
+  locations_[1] = y;
+  locations_[2] = z;
+  //// a 2D mesh is one layer of coordinates
+  if (dimension_ == 2)
+  {
+    locations_[2].push_back(0.0);
+  }
+
+  for (size_t d = 0; d < 3; ++d)
+  {
+    if (d < dimension_)
+    {
+      dsAssert(locations_[d].size() > 1, "UNEXPECTED");
+      cells_[d] = locations_[d].size() - 1;
+    }
+    else
+    {
+      cells_[d] = 1;
+    }
+  }
+
+  const size_t ny = locations_[1].size();
+  const size_t nz = locations_[2].size();
+  auto offset = [ny, nz](size_t i, size_t j, size_t k) {
+    return (i * ny + j) * nz + k;
+  };
+
+  if (dimension_ == 2)
+  {
+    //// split along the diagonal from (i + 1, j) to (i, j + 1)
+    //// the nodes are sorted, as in the original 2D mesh generator, so the regions are numbered the same way
+    ElementNodes_t lower = {offset(0, 0, 0), offset(1, 0, 0), offset(0, 1, 0), 0};
+    ElementNodes_t upper = {offset(1, 0, 0), offset(1, 1, 0), offset(0, 1, 0), 0};
+    std::sort(lower.begin(), lower.begin() + 3);
+    std::sort(upper.begin(), upper.begin() + 3);
+    elementOffsets_.push_back(lower);
+    elementOffsets_.push_back(upper);
+  }
+  else
+  {
+    //// each tetrahedron is a path from (i, j, k) to (i + 1, j + 1, k + 1), with one step in each direction
+    //// every cell is split the same way, so the faces of neighboring cells match
+    std::array<size_t, 3> order = {0, 1, 2};
+    do
+    {
+      std::array<size_t, 3> step = {0, 0, 0};
+      ElementNodes_t nodes;
+      nodes[0] = offset(0, 0, 0);
+      for (size_t n = 0; n < 3; ++n)
+      {
+        step[order[n]] = 1;
+        nodes[n + 1] = offset(step[0], step[1], step[2]);
+      }
+      std::sort(nodes.begin(), nodes.end());
+      elementOffsets_.push_back(nodes);
+    } while (std::next_permutation(order.begin(), order.end()));
+  }
+}
+
+size_t TensorProductMesh::GetNumberCoordinates() const
+{
+  return locations_[0].size() * locations_[1].size() * locations_[2].size();
+}
+
+size_t TensorProductMesh::GetNumberElements() const
+{
+  return cells_[0] * cells_[1] * cells_[2] * elementOffsets_.size();
+}
+
+MeshCoordinate TensorProductMesh::GetCoordinate(size_t c) const
+{
+  const size_t ny = locations_[1].size();
+  const size_t nz = locations_[2].size();
+  const size_t k = c % nz;
+  c /= nz;
+  const size_t j = c % ny;
+  const size_t i = c / ny;
+  return MeshCoordinate(locations_[0][i], locations_[1][j], locations_[2][k]);
+}
+
+void TensorProductMesh::CreateCoordinates(std::vector<MeshCoordinate> &coordinates) const
+{
+  coordinates.resize(GetNumberCoordinates());
+  dsMath::ParallelFor(coordinates.size(), [&](size_t b, size_t e) {
+    for (size_t i = b; i < e; ++i)
+    {
+      coordinates[i] = GetCoordinate(i);
+    }
+  });
+}
+
+TensorProductMesh::ElementNodes_t TensorProductMesh::GetElementNodes(size_t e) const
+{
+  const size_t numper = elementOffsets_.size();
+  size_t cell = e / numper;
+
+  const size_t k = cell % cells_[2];
+  cell /= cells_[2];
+  const size_t j = cell % cells_[1];
+  const size_t i = cell / cells_[1];
+
+  const size_t base = (i * locations_[1].size() + j) * locations_[2].size() + k;
+
+  ElementNodes_t ret = elementOffsets_[e % numper];
+  for (size_t n = 0; n <= dimension_; ++n)
+  {
+    ret[n] += base;
+  }
+  return ret;
+}
+
+MeshCoordinate TensorProductMesh::GetElementCenter(size_t e) const
+{
+  const ElementNodes_t nodes = GetElementNodes(e);
+  double x = 0.0;
+  double y = 0.0;
+  double z = 0.0;
+  for (size_t n = 0; n <= dimension_; ++n)
+  {
+    const MeshCoordinate c = GetCoordinate(nodes[n]);
+    x += c.GetX();
+    y += c.GetY();
+    z += c.GetZ();
+  }
+  const double count = static_cast<double>(dimension_ + 1);
+  return MeshCoordinate(x / count, y / count, z / count);
+}
+
+void TensorProductMesh::SetElementRegions(const RegionFinder_t &finder)
+{
+  elementRegions_.resize(GetNumberElements());
+  dsMath::ParallelFor(elementRegions_.size(), [&](size_t b, size_t e) {
+    for (size_t i = b; i < e; ++i)
+    {
+      const MeshCoordinate c = GetElementCenter(i);
+      elementRegions_[i] = finder(c.GetX(), c.GetY(), c.GetZ());
+    }
+  });
+}
+
+void TensorProductMesh::CreateRegions(const std::vector<MeshRegion *> &regions, std::vector<std::vector<size_t>> &coordinateToNode) const
+{
+  coordinateToNode.resize(regions.size());
+  dsMath::ParallelFor(regions.size(), [&](size_t b, size_t e) {
+    for (size_t r = b; r < e; ++r)
+    {
+      if (regions[r])
+      {
+        CreateRegion(r, *regions[r], coordinateToNode[r]);
+      }
+    }
+  }, GetNumberElements());
+}
+
+void TensorProductMesh::CreateRegion(size_t r, MeshRegion &region, std::vector<size_t> &coordinateToNode) const
+{
+  const size_t numelements = GetNumberElements();
+  const size_t numelementnodes = dimension_ + 1;
+
+  coordinateToNode.assign(GetNumberCoordinates(), size_t(-1));
+
+  //// region node indexes of each element, in increasing order
+  std::vector<ElementNodes_t> elements;
+  size_t numnodes = 0;
+  for (size_t e = 0; e < numelements; ++e)
+  {
+    if (elementRegions_[e] != r)
+    {
+      continue;
+    }
+
+    const ElementNodes_t cnodes = GetElementNodes(e);
+    ElementNodes_t nodes = {0, 0, 0, 0};
+    for (size_t n = 0; n < numelementnodes; ++n)
+    {
+      size_t &ni = coordinateToNode[cnodes[n]];
+      if (ni == size_t(-1))
+      {
+        ni = numnodes++;
+        region.AddNode(MeshNode(cnodes[n]));
+      }
+      nodes[n] = ni;
+    }
+    std::sort(nodes.begin(), nodes.begin() + numelementnodes);
+    elements.push_back(nodes);
+  }
+
+  std::vector<std::array<size_t, 2>> edges;
+  edges.reserve(elements.size() * (numelementnodes * (numelementnodes - 1)) / 2);
+  for (const auto &nodes : elements)
+  {
+    for (size_t a = 0; a < numelementnodes; ++a)
+    {
+      for (size_t b = a + 1; b < numelementnodes; ++b)
+      {
+        edges.push_back({nodes[a], nodes[b]});
+      }
+    }
+  }
+  const size_t edgeduplicate = SortAndUniquify(edges, numnodes);
+  for (const auto &edge : edges)
+  {
+    region.AddEdge(MeshEdge(edge[0], edge[1]));
+  }
+
+  //// the elements in 2D, and their faces in 3D
+  std::vector<std::array<size_t, 3>> triangles;
+  triangles.reserve(elements.size() * ((dimension_ == 2) ? 1 : 4));
+  for (const auto &nodes : elements)
+  {
+    if (dimension_ == 2)
+    {
+      triangles.push_back({nodes[0], nodes[1], nodes[2]});
+    }
+    else
+    {
+      triangles.push_back({nodes[0], nodes[1], nodes[2]});
+      triangles.push_back({nodes[0], nodes[1], nodes[3]});
+      triangles.push_back({nodes[0], nodes[2], nodes[3]});
+      triangles.push_back({nodes[1], nodes[2], nodes[3]});
+    }
+  }
+  const size_t triangleduplicate = SortAndUniquify(triangles, numnodes);
+  for (const auto &triangle : triangles)
+  {
+    region.AddTriangle(MeshTriangle(triangle[0], triangle[1], triangle[2]));
+  }
+
+  size_t tetrahedronduplicate = 0;
+  if (dimension_ == 3)
+  {
+    tetrahedronduplicate = SortAndUniquify(elements, numnodes);
+    for (const auto &nodes : elements)
+    {
+      region.AddTetrahedron(MeshTetrahedron(nodes[0], nodes[1], nodes[2], nodes[3]));
+    }
+  }
+
+  region.SetSorted(edgeduplicate, triangleduplicate, tetrahedronduplicate);
+}
+}
+
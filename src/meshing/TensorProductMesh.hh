@@ -0,0 +1,78 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#ifndef TENSOR_PRODUCT_MESH_HH
+#define TENSOR_PRODUCT_MESH_HH
+#include <vector>
+#include <array>
+#include <functional>
+#include <cstddef>
+
+namespace dsMesh {
+class MeshCoordinate;
+class MeshRegion;
+
+/// The grid of the mesh line locations in each direction
+/// Each cell is split into 2 triangles in 2D, or 6 tetrahedra around its diagonal in 3D
+/// The coordinate index increases fastest in the last direction
+/// The nodes, edges, triangles, and tetrahedra of each region are created from the elements of the grid,
+/// in sorted order without duplicates, so the loader does not sort them again
+class TensorProductMesh {
+  public:
+    /// The region of the element with this center, or size_t(-1) when it is not in a region
+    typedef std::function<size_t (double, double, double)> RegionFinder_t;
+
+    typedef std::array<size_t, 4> ElementNodes_t;
+
+    /// The z locations are empty for a 2D mesh
+    TensorProductMesh(const std::vector<double> &/*x*/, const std::vector<double> &/*y*/, const std::vector<double> &/*z*/);
+
+    size_t GetDimension() const
+    {
+      return dimension_;
+    }
+
+    size_t GetNumberCoordinates() const;
+
+    size_t GetNumberElements() const;
+
+    void CreateCoordinates(std::vector<MeshCoordinate> &) const;
+
+    /// The finder is called from several threads at the same time
+    void SetElementRegions(const RegionFinder_t &);
+
+    size_t GetElementRegion(size_t e) const
+    {
+      return elementRegions_[e];
+    }
+
+    /// The coordinate indexes of the nodes, where only the first 3 are used for a triangle
+    ElementNodes_t GetElementNodes(size_t) const;
+
+    MeshCoordinate GetElementCenter(size_t) const;
+
+    /// The regions are created at the same time, and a null region is skipped
+    /// The nodes of each region are numbered in the order they are first used by its elements
+    /// The coordinate to node index is size_t(-1) for each coordinate not in the region
+    void CreateRegions(const std::vector<MeshRegion *> &, std::vector<std::vector<size_t>> &/*coordinateToNode*/) const;
+
+  private:
+    void CreateRegion(size_t, MeshRegion &, std::vector<size_t> &) const;
+
+    MeshCoordinate GetCoordinate(size_t) const;
+
+    size_t                      dimension_;
+    std::array<std::vector<double>, 3> locations_;
+    //// number of cells in each direction
+    std::array<size_t, 3>       cells_;
+    //// coordinate index offsets for the nodes of each element in a cell
+    std::vector<ElementNodes_t> elementOffsets_;
+    std::vector<size_t>         elementRegions_;
+};
+}
+#endif
+
@@ -367,6 +367,27 @@ const DoubleType &EdgeModel::GetUniformValue() const
   return model_data.GetUniformValue<DoubleType>();
 }
 
+bool EdgeModel::IsSparse() const
+{
+  if (!uptodate)
+  {
+    CalculateValues();
+  }
+
+  return model_data.IsSparse();
+}
+
+const std::vector<size_t> &EdgeModel::GetSparseIndexes() const
+{
+  return model_data.GetSparseIndexes();
+}
+
+template <typename DoubleType>
+const std::vector<DoubleType> &EdgeModel::GetSparseValues() const
+{
+  return model_data.GetSparseValues<DoubleType>();
+}
+
 void EdgeModel::SerializeBuiltIn(std::ostream &of) const
 {
   of << "BUILTIN";
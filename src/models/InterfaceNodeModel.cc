@@ -174,6 +174,27 @@ const DoubleType &InterfaceNodeModel::GetUniformValue() const
   return model_data.GetUniformValue<DoubleType>();
 }
 
+bool InterfaceNodeModel::IsSparse() const
+{
+  if (!uptodate)
+  {
+    CalculateValues();
+  }
+
+  return model_data.IsSparse();
+}
+
+const std::vector<size_t> &InterfaceNodeModel::GetSparseIndexes() const
+{
+  return model_data.GetSparseIndexes();
+}
+
+template <typename DoubleType>
+const std::vector<DoubleType> &InterfaceNodeModel::GetSparseValues() const
+{
+  return model_data.GetSparseValues<DoubleType>();
+}
+
 void InterfaceNodeModel::DevsimSerialize(std::ostream &of) const
 {
   of << "begin_interface_node_model \"" << this->GetName() << "\"\n";
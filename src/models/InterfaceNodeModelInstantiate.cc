@@ -1,6 +1,7 @@
 
 template std::vector<DBLTYPE> const& InterfaceNodeModel::GetScalarValues<DBLTYPE>() const;
 template const DBLTYPE &InterfaceNodeModel::GetUniformValue<DBLTYPE>() const;
+template const std::vector<DBLTYPE> &InterfaceNodeModel::GetSparseValues<DBLTYPE>() const;
 template void InterfaceNodeModel::SetValues<DBLTYPE>(std::vector<DBLTYPE> const&) const;
 template void InterfaceNodeModel::SetValues<DBLTYPE>(DBLTYPE const&) const;
 
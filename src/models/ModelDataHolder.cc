@@ -7,6 +7,56 @@ SPDX-License-Identifier: Apache-2.0
 
 #include "ModelDataHolder.hh"
 
+#include <algorithm>
+
+namespace {
+/// The background is zero or the first value, whichever has fewer values differing from it
+template <typename DoubleType>
+bool FindSparseValues(const std::vector<DoubleType> &values, DoubleType &background, std::vector<size_t> &indexes, std::vector<DoubleType> &exceptions)
+{
+  const size_t length = values.size();
+  if (length == 0)
+  {
+    return false;
+  }
+
+  const size_t max_exceptions = length / ModelDataHolder::sparse_fraction;
+
+  const DoubleType candidates[] = {DoubleType(0.0), values[0]};
+  for (const auto &candidate : candidates)
+  {
+    indexes.clear();
+    bool found = true;
+    for (size_t i = 0; i < length; ++i)
+    {
+      if (values[i] != candidate)
+      {
+        if (indexes.size() == max_exceptions)
+        {
+          found = false;
+          break;
+        }
+        indexes.push_back(i);
+      }
+    }
+
+    if (found)
+    {
+      background = candidate;
+      exceptions.resize(indexes.size());
+      for (size_t i = 0; i < indexes.size(); ++i)
+      {
+        exceptions[i] = values[indexes[i]];
+      }
+      return true;
+    }
+  }
+
+  indexes.clear();
+  return false;
+}
+}
+
 void ModelDataHolder::clear_type(MDtype t) const
 {
   if (t == MDtype::DOUBLE)
@@ -60,8 +110,42 @@ bool ModelDataHolder::IsUniform() const
   return is_uniform;
 }
 
+void ModelDataHolder::expand_sparse() const
+{
+  if (type == MDtype::DOUBLE)
+  {
+    std::vector<double> values(length, double_uniform_value);
+    for (size_t i = 0; i < sparse_indexes.size(); ++i)
+    {
+      values[sparse_indexes[i]] = double_values[i];
+    }
+    double_values.swap(values);
+    clear_type(MDtype::EXTENDED);
+  }
+#ifdef DEVSIM_EXTENDED_PRECISION
+  else if (type == MDtype::EXTENDED)
+  {
+    std::vector<float128> values(length, float128_uniform_value);
+    for (size_t i = 0; i < sparse_indexes.size(); ++i)
+    {
+      values[sparse_indexes[i]] = float128_values[i];
+    }
+    float128_values.swap(values);
+    clear_type(MDtype::DOUBLE);
+  }
+#endif
+  std::vector<size_t>().swap(sparse_indexes);
+  is_sparse = false;
+}
+
 void ModelDataHolder::expand_uniform() const
 {
+  if (is_sparse)
+  {
+    expand_sparse();
+    return;
+  }
+
   if (!is_uniform)
   {
     return;
@@ -97,6 +181,8 @@ void ModelDataHolder::clear() const
   std::vector<float128>().swap(float128_values);
 #endif
   is_uniform = true;
+  is_sparse = false;
+  std::vector<size_t>().swap(sparse_indexes);
 }
 
 bool ModelDataHolder::IsZero() const
@@ -190,16 +276,57 @@ const std::vector<float128> &ModelDataHolder::GetValues() const
 }
 #endif
 
+template <>
+const std::vector<double> &ModelDataHolder::GetSparseValues() const
+{
+#ifdef DEVSIM_EXTENDED_PRECISION
+  if (type == MDtype::EXTENDED && double_values.size() != float128_values.size())
+  {
+    double_values.resize(float128_values.size());
+    for (size_t i = 0; i < float128_values.size(); ++i)
+    {
+      double_values[i] = static_cast<double>(float128_values[i]);
+    }
+  }
+#endif
+  return double_values;
+}
+
+#ifdef DEVSIM_EXTENDED_PRECISION
+template <>
+const std::vector<float128> &ModelDataHolder::GetSparseValues() const
+{
+  if (type == MDtype::DOUBLE && float128_values.size() != double_values.size())
+  {
+    float128_values.resize(double_values.size());
+    for (size_t i = 0; i < double_values.size(); ++i)
+    {
+      float128_values[i] = double_values[i];
+    }
+  }
+  return float128_values;
+}
+#endif
+
 template <>
 void ModelDataHolder::set_indexes(const std::vector<size_t> &indexes, const double &v)
 {
   clear();
 
-  double_values.resize(length);
-
-  for (auto i : indexes)
+  if ((indexes.size() * sparse_fraction <= length) && std::is_sorted(indexes.begin(), indexes.end()))
   {
-    double_values[i] = v;
+    sparse_indexes = indexes;
+    double_values.resize(indexes.size(), v);
+    is_sparse = true;
+  }
+  else
+  {
+    double_values.resize(length);
+
+    for (auto i : indexes)
+    {
+      double_values[i] = v;
+    }
   }
 
   type = MDtype::DOUBLE;
@@ -213,11 +340,20 @@ void ModelDataHolder::set_indexes(const std::vector<size_t> &indexes, const floa
 {
   clear();
 
-  float128_values.resize(length);
-
-  for (auto i : indexes)
+  if ((indexes.size() * sparse_fraction <= length) && std::is_sorted(indexes.begin(), indexes.end()))
   {
-    float128_values[i] = v;
+    sparse_indexes = indexes;
+    float128_values.resize(indexes.size(), v);
+    is_sparse = true;
+  }
+  else
+  {
+    float128_values.resize(length);
+
+    for (auto i : indexes)
+    {
+      float128_values[i] = v;
+    }
   }
 
   type = MDtype::EXTENDED;
@@ -230,11 +366,24 @@ void ModelDataHolder::set_indexes(const std::vector<size_t> &indexes, const std:
 {
   clear();
 
-  double_values.resize(length);
-
-  for (auto i : indexes)
+  if ((indexes.size() * sparse_fraction <= length) && std::is_sorted(indexes.begin(), indexes.end()))
+  {
+    sparse_indexes = indexes;
+    double_values.resize(indexes.size());
+    for (size_t i = 0; i < indexes.size(); ++i)
+    {
+      double_values[i] = v[indexes[i]];
+    }
+    is_sparse = true;
+  }
+  else
   {
-    double_values[i] = v[i];
+    double_values.resize(length);
+
+    for (auto i : indexes)
+    {
+      double_values[i] = v[i];
+    }
   }
 
   type = MDtype::DOUBLE;
@@ -247,11 +396,24 @@ void ModelDataHolder::set_indexes(const std::vector<size_t> &indexes, const std:
 {
   clear();
 
-  float128_values.resize(length);
-
-  for (auto i : indexes)
+  if ((indexes.size() * sparse_fraction <= length) && std::is_sorted(indexes.begin(), indexes.end()))
+  {
+    sparse_indexes = indexes;
+    float128_values.resize(indexes.size());
+    for (size_t i = 0; i < indexes.size(); ++i)
+    {
+      float128_values[i] = v[indexes[i]];
+    }
+    is_sparse = true;
+  }
+  else
   {
-    float128_values[i] = v[i];
+    float128_values.resize(length);
+
+    for (auto i : indexes)
+    {
+      float128_values[i] = v[i];
+    }
   }
 
   type = MDtype::EXTENDED;
@@ -262,20 +424,44 @@ void ModelDataHolder::set_indexes(const std::vector<size_t> &indexes, const std:
 template <>
 void ModelDataHolder::set_values(const std::vector<double> &nv)
 {
-  clear_type(MDtype::EXTENDED);
+  clear();
   type = MDtype::DOUBLE;
-  double_values = nv;
   is_uniform = false;
+
+  double background = 0.0;
+  if (FindSparseValues(nv, background, sparse_indexes, double_values))
+  {
+    double_uniform_value = background;
+#ifdef DEVSIM_EXTENDED_PRECISION
+    float128_uniform_value = background;
+#endif
+    is_sparse = true;
+  }
+  else
+  {
+    double_values = nv;
+  }
 }
 
 #ifdef DEVSIM_EXTENDED_PRECISION
 template <>
 void ModelDataHolder::set_values(const std::vector<float128> &nv)
 {
-  clear_type(MDtype::DOUBLE);
+  clear();
   type = MDtype::EXTENDED;
-  float128_values = nv;
   is_uniform = false;
+
+  float128 background = 0.0;
+  if (FindSparseValues(nv, background, sparse_indexes, float128_values))
+  {
+    float128_uniform_value = background;
+    double_uniform_value = static_cast<double>(background);
+    is_sparse = true;
+  }
+  else
+  {
+    float128_values = nv;
+  }
 }
 #endif
 
@@ -21,7 +21,7 @@ class ModelDataHolder
   enum class MDtype {DOUBLE, EXTENDED};
 
   public:
-    explicit ModelDataHolder(size_t l) : double_uniform_value(0.0), length(l), type(MDtype::DOUBLE), is_uniform(true)
+    explicit ModelDataHolder(size_t l) : double_uniform_value(0.0), length(l), type(MDtype::DOUBLE), is_uniform(true), is_sparse(false)
     {
       // default float128 are 0.0
     }
@@ -39,6 +39,21 @@ class ModelDataHolder
 
     bool IsUniform() const;
 
+    /// The uniform value is the background, and only the values which differ from it are stored
+    bool IsSparse() const
+    {
+      return is_sparse;
+    }
+
+    /// increasing indexes of the values which differ from the background
+    const std::vector<size_t> &GetSparseIndexes() const
+    {
+      return sparse_indexes;
+    }
+
+    template <typename DoubleType>
+    const std::vector<DoubleType> &GetSparseValues() const;
+
     template <typename DoubleType>
     MDtype GetMDtype() const;
 
@@ -68,9 +83,14 @@ class ModelDataHolder
 
     void clear() const;
 
+    /// expands both uniform and sparse data
     void expand_uniform() const;
 
+    /// Values are stored as sparse when at most 1 in sparse_fraction differ from the background
+    static const size_t sparse_fraction = 8;
+
   private:
+    void expand_sparse() const;
 
     void clear_type(MDtype t) const;
     void set_type(MDtype t) const;
@@ -84,6 +104,8 @@ class ModelDataHolder
     const size_t                length;
     mutable MDtype              type;
     mutable bool                is_uniform;
+    mutable bool                is_sparse;
+    mutable std::vector<size_t> sparse_indexes;
 };
 
 #endif
@@ -252,6 +252,27 @@ const DoubleType &NodeModel::GetUniformValue() const
   return model_data.GetUniformValue<DoubleType>();
 }
 
+bool NodeModel::IsSparse() const
+{
+  if (!uptodate)
+  {
+    CalculateValues();
+  }
+
+  return model_data.IsSparse();
+}
+
+const std::vector<size_t> &NodeModel::GetSparseIndexes() const
+{
+  return model_data.GetSparseIndexes();
+}
+
+template <typename DoubleType>
+const std::vector<DoubleType> &NodeModel::GetSparseValues() const
+{
+  return model_data.GetSparseValues<DoubleType>();
+}
+
 void NodeModel::SerializeBuiltIn(std::ostream &of) const
 {
   of << "BUILTIN";
@@ -8,6 +8,7 @@ SPDX-License-Identifier: Apache-2.0
 #include "ParallelOpEqual.hh"
 #include "ScalarData.hh"
 #include "GetNumberOfThreads.hh"
+#include "SimulationContext.hh"
 #include <future>
 #include <memory>
 
@@ -115,13 +116,14 @@ void OpEqualRun(U &task, size_t vlen)
 
 template <typename U>
 OpEqualRange<U>::OpEqualRange(U &mp, size_t b, size_t e) :
-  opEqualPacket_(mp), beg_(b), end_(e)
+  opEqualPacket_(mp), beg_(b), end_(e), context_(SimulationContext::GetCurrent())
 {
 }
 
 template <typename U>
 void OpEqualRange<U>::operator()()
 {
+  SimulationContext::ScopedContext scope(context_);
   opEqualPacket_(beg_, end_);
 }
 
@@ -11,6 +11,8 @@ SPDX-License-Identifier: Apache-2.0
 //// Only for the typedef
 #include "FPECheck.hh"
 
+class SimulationContext;
+
 #include <vector>
 
 template <typename U, typename DoubleType>
@@ -94,6 +96,8 @@ class OpEqualRange
     U            &opEqualPacket_;
     size_t           beg_;
     size_t           end_;
+    //// the worker thread uses the context of the calling thread
+    SimulationContext &context_;
 };
 
 #endif
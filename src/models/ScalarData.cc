@@ -7,17 +7,28 @@ SPDX-License-Identifier: Apache-2.0
 
 #include "ScalarData.hh"
 #include "ParallelOpEqual.hh"
+#include "ModelDataHolder.hh"
 
 #include "dsAssert.hh"
 
+#include <algorithm>
+#include <iterator>
+
 template <typename T, typename DoubleType>
-ScalarData<T, DoubleType>::ScalarData(const T &em) : refdata(0), isuniform(false), uniform_value(0.0)
+ScalarData<T, DoubleType>::ScalarData(const T &em) : refdata(0), isuniform(false), uniform_value(0.0), issparse(false)
 {
   if (em.IsUniform())
   {
     isuniform     = true;
     uniform_value = em.template GetUniformValue<DoubleType>();
   }
+  else if (em.IsSparse())
+  {
+    issparse       = true;
+    uniform_value  = em.template GetUniformValue<DoubleType>();
+    sparse_indexes = em.GetSparseIndexes();
+    values         = em.template GetSparseValues<DoubleType>();
+  }
   else
   {
     refdata = &em;
@@ -29,19 +40,19 @@ ScalarData<T, DoubleType>::ScalarData(const T &em) : refdata(0), isuniform(false
 }
 
 template <typename T, typename DoubleType>
-ScalarData<T, DoubleType>::ScalarData(const std::vector<DoubleType> &esl) : refdata(0), isuniform(false), uniform_value(0.0)
+ScalarData<T, DoubleType>::ScalarData(const std::vector<DoubleType> &esl) : refdata(0), isuniform(false), uniform_value(0.0), issparse(false)
 {
   values = esl;
   length = values.size();
 }
 
 template <typename T, typename DoubleType>
-ScalarData<T, DoubleType>::ScalarData(DoubleType v, size_t l) : refdata(0), isuniform(true), uniform_value(v), length(l)
+ScalarData<T, DoubleType>::ScalarData(DoubleType v, size_t l) : refdata(0), isuniform(true), uniform_value(v), issparse(false), length(l)
 {
 }
 
 template <typename T, typename DoubleType>
-ScalarData<T, DoubleType>::ScalarData(const ScalarData<T, DoubleType> &em) : refdata(em.refdata), values(em.values), isuniform(em.isuniform), uniform_value(em.uniform_value), length(em.length)
+ScalarData<T, DoubleType>::ScalarData(const ScalarData<T, DoubleType> &em) : refdata(em.refdata), values(em.values), isuniform(em.isuniform), uniform_value(em.uniform_value), issparse(em.issparse), sparse_indexes(em.sparse_indexes), length(em.length)
 {
 }
 
@@ -54,15 +65,35 @@ ScalarData<T, DoubleType> &ScalarData<T, DoubleType>::operator=(const ScalarData
     values        = em.values;
     isuniform     = em.isuniform;
     uniform_value = em.uniform_value;
+    issparse      = em.issparse;
+    sparse_indexes = em.sparse_indexes;
     length        = em.length;
   }
   return *this;
 }
 
+template <typename T, typename DoubleType>
+void ScalarData<T, DoubleType>::ExpandSparse() const
+{
+  std::vector<DoubleType> full(length, uniform_value);
+  for (size_t i = 0; i < sparse_indexes.size(); ++i)
+  {
+    full[sparse_indexes[i]] = values[i];
+  }
+  values.swap(full);
+  std::vector<size_t>().swap(sparse_indexes);
+  uniform_value = 0.0;
+  issparse = false;
+}
+
 template <typename T, typename DoubleType>
 void ScalarData<T, DoubleType>::MakeAssignable() const
 {
-  if (isuniform)
+  if (issparse)
+  {
+    ExpandSparse();
+  }
+  else if (isuniform)
   {
     values.clear();
     values.resize(length, uniform_value);
@@ -84,6 +115,18 @@ DoubleType ScalarData<T, DoubleType>::operator[](size_t x) const
   {
     ret = uniform_value;
   }
+  else if (issparse)
+  {
+    const auto it = std::lower_bound(sparse_indexes.begin(), sparse_indexes.end(), x);
+    if ((it != sparse_indexes.end()) && (*it == x))
+    {
+      ret = values[it - sparse_indexes.begin()];
+    }
+    else
+    {
+      ret = uniform_value;
+    }
+  }
   else if (refdata)
   {
     const std::vector<DoubleType> &y = refdata->template GetScalarValues<DoubleType>();
@@ -111,7 +154,11 @@ const std::vector<DoubleType> &ScalarData<T, DoubleType>::GetScalarList() const
 {
   const std::vector<DoubleType> *data = &values;
 
-  if (isuniform)
+  if (issparse)
+  {
+    ExpandSparse();
+  }
+  else if (isuniform)
   {
     //// We are still uniform
     values.clear();
@@ -145,6 +192,10 @@ ScalarData<T, DoubleType> &ScalarData<T, DoubleType>::op_equal_data(const Scalar
     const DoubleType &oval = esd.uniform_value;
     this->op_equal_scalar(oval, myop);
   }
+  else if ((isuniform || issparse) && esd.issparse)
+  {
+    this->op_equal_sparse(esd, myop);
+  }
   else
   {
     MakeAssignable();
@@ -157,6 +208,55 @@ ScalarData<T, DoubleType> &ScalarData<T, DoubleType>::op_equal_data(const Scalar
   return *this;
 }
 
+//// The result is sparse over the union of the indexes, unless there are too many of them
+template <typename T, typename DoubleType> template <typename V>
+void ScalarData<T, DoubleType>::op_equal_sparse(const ScalarData<T, DoubleType> &esd, const V &myop)
+{
+  const std::vector<size_t> &oindexes = esd.sparse_indexes;
+  const std::vector<DoubleType> &ovals = esd.values;
+
+  std::vector<size_t> nindexes;
+  nindexes.reserve(sparse_indexes.size() + oindexes.size());
+  std::set_union(sparse_indexes.begin(), sparse_indexes.end(), oindexes.begin(), oindexes.end(), std::back_inserter(nindexes));
+
+  if (nindexes.size() * ModelDataHolder::sparse_fraction > length)
+  {
+    MakeAssignable();
+    const std::vector<DoubleType> &fvals = esd.GetScalarList();
+    SerialVectorVectorOpEqual<V, DoubleType> foo(values, fvals, myop);
+    OpEqualRun(foo, values.size());
+    return;
+  }
+
+  std::vector<DoubleType> nvals(nindexes.size());
+  size_t j = 0;
+  size_t k = 0;
+  for (size_t i = 0; i < nindexes.size(); ++i)
+  {
+    const size_t index = nindexes[i];
+    DoubleType x = uniform_value;
+    if ((j < sparse_indexes.size()) && (sparse_indexes[j] == index))
+    {
+      x = values[j];
+      ++j;
+    }
+    DoubleType y = esd.uniform_value;
+    if ((k < oindexes.size()) && (oindexes[k] == index))
+    {
+      y = ovals[k];
+      ++k;
+    }
+    myop(x, y);
+    nvals[i] = x;
+  }
+  myop(uniform_value, esd.uniform_value);
+
+  values.swap(nvals);
+  sparse_indexes.swap(nindexes);
+  isuniform = false;
+  issparse = true;
+}
+
 template <typename T, typename DoubleType> template <typename V>
 ScalarData<T, DoubleType> &ScalarData<T, DoubleType>::op_equal_scalar(const DoubleType &v, const V &myop)
 {
@@ -164,6 +264,14 @@ ScalarData<T, DoubleType> &ScalarData<T, DoubleType>::op_equal_scalar(const Doub
   {
     myop(uniform_value, v);
   }
+  else if (issparse)
+  {
+    myop(uniform_value, v);
+    for (auto &x : values)
+    {
+      myop(x, v);
+    }
+  }
   else
   {
     MakeAssignable();
@@ -102,6 +102,19 @@ class ScalarData {
           return isuniform;
         }
 
+        //// The uniform value is the background, and values holds the values at the sparse indexes
+        bool   IsSparse() const {
+          return issparse;
+        }
+
+        const std::vector<size_t> &GetSparseIndexes() const {
+          return sparse_indexes;
+        }
+
+        const std::vector<DoubleType> &GetSparseValues() const {
+          return values;
+        }
+
         DoubleType GetUniformValue() const {
           return uniform_value;
         }
@@ -128,12 +141,16 @@ class ScalarData {
     private:
 
         void MakeAssignable() const;
+        void ExpandSparse() const;
+        template <typename V> void op_equal_sparse(const ScalarData &, const V &);
 
         ScalarData() = delete;
         mutable const reftype *refdata;
         mutable std::vector<DoubleType> values;
         mutable bool           isuniform;
         mutable DoubleType     uniform_value;
+        mutable bool           issparse;
+        mutable std::vector<size_t> sparse_indexes;
         size_t                 length;
 };
 #endif
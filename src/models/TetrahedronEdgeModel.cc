@@ -16,6 +16,7 @@ SPDX-License-Identifier: Apache-2.0
 #include "GeometryStream.hh"
 #include "TetrahedronEdgeScalarData.hh"
 #include "Tetrahedron.hh"
+#include "ParallelFor.hh"
 
 
 
@@ -286,6 +287,27 @@ const DoubleType &TetrahedronEdgeModel::GetUniformValue() const
   return model_data.GetUniformValue<DoubleType>();
 }
 
+bool TetrahedronEdgeModel::IsSparse() const
+{
+  if (!uptodate)
+  {
+    CalculateValues();
+  }
+
+  return model_data.IsSparse();
+}
+
+const std::vector<size_t> &TetrahedronEdgeModel::GetSparseIndexes() const
+{
+  return model_data.GetSparseIndexes();
+}
+
+template <typename DoubleType>
+const std::vector<DoubleType> &TetrahedronEdgeModel::GetSparseValues() const
+{
+  return model_data.GetSparseValues<DoubleType>();
+}
+
 void TetrahedronEdgeModel::SerializeBuiltIn(std::ostream &of) const
 {
   of << "BUILTIN";
@@ -312,26 +334,30 @@ template <typename DoubleType>
 EdgeScalarList<DoubleType> TetrahedronEdgeModel::GetValuesOnEdges() const
 {
   const TetrahedronEdgeScalarData<DoubleType> &tec = TetrahedronEdgeScalarData<DoubleType>(*this);
+  //// the values are expanded before the threads read them
+  const std::vector<DoubleType> &tvals = tec.GetScalarList();
 
   const ConstEdgeList &edge_list = GetRegion().GetEdgeList();
+  const Region::EdgeToConstTetrahedronList_t &ettlist = GetRegion().GetEdgeToTetrahedronList();
   std::vector<DoubleType> ev(edge_list.size());
 
-  for (size_t i = 0; i < edge_list.size(); ++i)
-  {
-    const ConstTetrahedronList &tl = GetRegion().GetEdgeToTetrahedronList()[i];
-    ConstTetrahedronList::const_iterator it = tl.begin();
-    const ConstTetrahedronList::const_iterator itend = tl.end();
-    DoubleType vol = 0.0;
-    for ( ; it != itend; ++it)
+  //// each edge gathers from its tetrahedrons in index order, so the sum does not depend on the number of threads
+  dsMath::ParallelFor(edge_list.size(), [&](size_t b, size_t e) {
+    for (size_t i = b; i < e; ++i)
     {
-      const size_t tindex = (**it).GetIndex();
+      const ConstTetrahedronList &tl = ettlist[i];
+      DoubleType vol = 0.0;
+      for (const auto &tp : tl)
+      {
+        const size_t tindex = tp->GetIndex();
 
-      const size_t eindex = GetRegion().GetEdgeIndexOnTetrahedron(**it, edge_list[i]);
+        const size_t eindex = GetRegion().GetEdgeIndexOnTetrahedron(*tp, edge_list[i]);
 
-      vol += tec[6*tindex + eindex];
+        vol += tvals[6*tindex + eindex];
+      }
+      ev[i] = vol;
     }
-    ev[i] = vol;
-  }
+  });
 
   return ev;
 }
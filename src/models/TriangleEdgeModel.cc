@@ -278,6 +278,27 @@ const DoubleType &TriangleEdgeModel::GetUniformValue() const
   return model_data.GetUniformValue<DoubleType>();
 }
 
+bool TriangleEdgeModel::IsSparse() const
+{
+  if (!uptodate)
+  {
+    CalculateValues();
+  }
+
+  return model_data.IsSparse();
+}
+
+const std::vector<size_t> &TriangleEdgeModel::GetSparseIndexes() const
+{
+  return model_data.GetSparseIndexes();
+}
+
+template <typename DoubleType>
+const std::vector<DoubleType> &TriangleEdgeModel::GetSparseValues() const
+{
+  return model_data.GetSparseValues<DoubleType>();
+}
+
 void TriangleEdgeModel::SerializeBuiltIn(std::ostream &of) const
 {
   of << "BUILTIN";
@@ -124,6 +124,14 @@ class TriangleEdgeModel : public std::enable_shared_from_this<TriangleEdgeModel>
         template <typename DoubleType>
         const DoubleType &GetUniformValue() const;
 
+        /// The uniform value is the background for the sparse values
+        bool IsSparse() const;
+
+        const std::vector<size_t> &GetSparseIndexes() const;
+
+        template <typename DoubleType>
+        const std::vector<DoubleType> &GetSparseValues() const;
+
         size_t GetLength() const
         {
           return model_data.GetLength();
@@ -1,5 +1,10 @@
 // Geometry Commands
 DS_FUNCTION_TABLE(reset_devsim,       dsCommand::resetDevsimCmd)
+DS_FUNCTION_TABLE(create_simulation_context, dsCommand::simulationContextCmd)
+DS_FUNCTION_TABLE(delete_simulation_context, dsCommand::simulationContextCmd)
+DS_FUNCTION_TABLE(set_simulation_context, dsCommand::simulationContextCmd)
+DS_FUNCTION_TABLE(get_simulation_context, dsCommand::simulationContextCmd)
+DS_FUNCTION_TABLE(get_simulation_context_list, dsCommand::simulationContextCmd)
 DS_FUNCTION_TABLE(get_device_list,    dsCommand::getDeviceListCmd)
 DS_FUNCTION_TABLE(get_region_list,    dsCommand::getRegionListCmd)
 DS_FUNCTION_TABLE(get_interface_list, dsCommand::getRegionListCmd)
@@ -38,6 +43,7 @@ DS_FUNCTION_TABLE(get_node_model_list,        dsCommand::getNodeModelListCmd)
 DS_FUNCTION_TABLE(get_node_model_values,      dsCommand::printNodeValuesCmd)
 DS_FUNCTION_TABLE(interface_model,            dsCommand::createInterfaceNodeModelCmd)
 DS_FUNCTION_TABLE(interface_normal_model,     dsCommand::createInterfaceNormalModelCmd)
+DS_FUNCTION_TABLE(interpolate_node_solution,  dsCommand::interpolateNodeSolutionCmd)
 DS_FUNCTION_TABLE(node_model,                 dsCommand::createNodeModelCmd)
 DS_FUNCTION_TABLE(node_solution,              dsCommand::createNodeSolutionCmd)
 DS_FUNCTION_TABLE(edge_solution,              dsCommand::createNodeSolutionCmd)
@@ -59,6 +65,8 @@ DS_FUNCTION_TABLE(cylindrical_surface_area,   dsCommand::createCylindricalCmd)
 DS_FUNCTION_TABLE(get_contact_current,        dsCommand::getContactCurrentCmd)
 DS_FUNCTION_TABLE(get_contact_charge,         dsCommand::getContactCurrentCmd)
 DS_FUNCTION_TABLE(solve,                      dsCommand::solveCmd)
+DS_FUNCTION_TABLE(solve_continuation,         dsCommand::solveContinuationCmd)
+DS_FUNCTION_TABLE(solve_transient,            dsCommand::solveTransientCmd)
 DS_FUNCTION_TABLE(get_matrix_and_rhs,         dsCommand::getMatrixAndRHSCmd)
 DS_FUNCTION_TABLE(set_initial_condition,      dsCommand::setInitialConditionCmd)
 // Equation Commands
@@ -85,11 +93,16 @@ DS_FUNCTION_TABLE(add_2d_contact,                dsCommand::add2dContactCmd)
 DS_FUNCTION_TABLE(add_2d_interface,              dsCommand::add2dInterfaceCmd)
 DS_FUNCTION_TABLE(add_2d_mesh_line,              dsCommand::add2dMeshLineCmd)
 DS_FUNCTION_TABLE(add_2d_region,                 dsCommand::add2dRegionCmd)
+DS_FUNCTION_TABLE(add_3d_contact,                dsCommand::add2dContactCmd)
+DS_FUNCTION_TABLE(add_3d_interface,              dsCommand::add2dInterfaceCmd)
+DS_FUNCTION_TABLE(add_3d_mesh_line,              dsCommand::add2dMeshLineCmd)
+DS_FUNCTION_TABLE(add_3d_region,                 dsCommand::add2dRegionCmd)
 DS_FUNCTION_TABLE(add_gmsh_contact,              dsCommand::addGmshContactCmd)
 DS_FUNCTION_TABLE(add_gmsh_interface,            dsCommand::addGmshInterfaceCmd)
 DS_FUNCTION_TABLE(add_gmsh_region,               dsCommand::addGmshRegionCmd)
 DS_FUNCTION_TABLE(create_1d_mesh,                dsCommand::create1dMeshCmd)
 DS_FUNCTION_TABLE(create_2d_mesh,                dsCommand::create1dMeshCmd)
+DS_FUNCTION_TABLE(create_3d_mesh,                dsCommand::create1dMeshCmd)
 DS_FUNCTION_TABLE(create_contact_from_interface, dsCommand::createContactFromInterfaceCmd)
 DS_FUNCTION_TABLE(create_device,                 dsCommand::createDeviceCmd)
 DS_FUNCTION_TABLE(create_gmsh_mesh,              dsCommand::createGmshMeshCmd)
@@ -99,12 +112,14 @@ DS_FUNCTION_TABLE(delete_mesh,                   dsCommand::deleteMeshCmd)
 DS_FUNCTION_TABLE(finalize_mesh,                 dsCommand::finalizeMeshCmd)
 DS_FUNCTION_TABLE(get_mesh_list,                 dsCommand::getMeshListCmd)
 DS_FUNCTION_TABLE(load_devices,                  dsCommand::loadDevicesCmd)
+DS_FUNCTION_TABLE(refine_mesh,                   dsCommand::refineMeshCmd)
 DS_FUNCTION_TABLE(write_devices,                 dsCommand::writeDevicesCmd)
 // Circuit Commands
 DS_FUNCTION_TABLE(add_circuit_node,            dsCommand::addCircuitNodeCmd)
 DS_FUNCTION_TABLE(circuit_element,             dsCommand::circuitElementCmd)
 DS_FUNCTION_TABLE(circuit_alter,               dsCommand::circuitAlterCmd)
 DS_FUNCTION_TABLE(circuit_node_alias,          dsCommand::circuitNodeAliasCmd)
+DS_FUNCTION_TABLE(circuit_pulse,               dsCommand::circuitPulseCmd)
 DS_FUNCTION_TABLE(delete_circuit,              dsCommand::circuitDeleteCircuitCmd)
 DS_FUNCTION_TABLE(get_circuit_node_list,       dsCommand::circuitGetCircuitNodeListCmd)
 DS_FUNCTION_TABLE(get_circuit_solution_list,   dsCommand::circuitGetCircuitSolutionListCmd)
@@ -8,7 +8,7 @@ SPDX-License-Identifier: Apache-2.0
 #include "ControlGIL.hh"
 #include "Python.h"
 
-void * MasterGILControl::thread_state_ = nullptr;
+thread_local void * MasterGILControl::thread_state_ = nullptr;
 
 MasterGILControl::MasterGILControl()
 {
@@ -1,4 +1,99 @@
 
+static const char solve_continuation_doc[] =
+R"(    devsim.solve_continuation (device, parameter, end_value, step_size, minimum_step, maximum_step, target_iterations, maximum_failures, callback, solver_type, absolute_error, relative_error, maximum_error, maximum_iterations, maximum_divergence, info, symbolic_iteration_limit)
+
+    Ramps a device parameter, such as a contact bias, from its current value to ``end_value`` using dc solves.  The initial guess for each point is extrapolated along the solution tangent, which is calculated from the factored jacobian of the previous point.  The step is adjusted so that each point converges in about ``target_iterations`` iterations, and is halved when a point fails to converge.
+
+    Parameters
+    ----------
+    device : str
+       The selected device
+    parameter : str
+       Name of the device parameter being ramped
+    end_value : Float
+       Final value of the parameter
+    step_size : Float
+       Initial step size
+    minimum_step : Float, optional
+       The sweep fails when the step is reduced below this value, which must be positive (default 1e-6 times the distance from the starting value to ``end_value``)
+    maximum_step : Float, optional
+       Maximum step size, no limit when 0.0 (default 0.0)
+    target_iterations : int, optional
+       Desired number of iterations per point (default 4)
+    maximum_failures : int, optional
+       The sweep fails when this many points in a row fail to converge (default 10)
+    callback : str, optional
+       Function called with the device name after each converged point
+    solver_type : {'direct', 'iterative'} required
+       Linear solver type
+    absolute_error : Float, optional
+       Required update norm in the solve (default 0.0)
+    relative_error : Float, optional
+       Required relative update in the solve (default 0.0)
+    maximum_error : Float, optional
+       Maximum absolute error before solve stops (default MAXDOUBLE)
+    maximum_iterations : int, optional
+       Maximum number of iterations in the DC solve (default 20)
+    maximum_divergence : int, optional
+       Maximum number of diverging iterations during solve (default 20)
+    info : bool, optional
+       Return the parameter value and number of iterations for each point (default False)
+    symbolic_iteration_limit : int, optional
+       Reuse symbolic matrix factorization after this number of iterations (default 1)
+)";
+
+static const char solve_transient_doc[] =
+R"(    devsim.solve_transient (stop_time, tdelta, start_time, method, gamma, minimum_step, maximum_step, target_iterations, maximum_failures, callback, solver_type, absolute_error, relative_error, charge_error, maximum_error, maximum_iterations, maximum_divergence, info, symbolic_iteration_limit)
+
+    Integrates from ``start_time`` to ``stop_time``.  The circuit sources are evaluated at each time point, and each step is shortened so that it lands exactly on the next break point of a source waveform.  The step after a break point uses BDF1 and restarts from ``tdelta``.  Otherwise the step is adjusted so that each point converges in about ``target_iterations`` iterations, and it is halved when a point fails to converge.
+
+    Parameters
+    ----------
+    stop_time : Float
+       Final time of the simulation
+    tdelta : Float
+       Initial time step
+    start_time : Float, optional
+       Time of the current solution (default 0.0)
+    method : {'trbdf2', 'bdf1'}, optional
+       Integration method (default 'trbdf2')
+    gamma : Float, optional
+       Fraction of each TR-BDF2 step taken with the trapezoidal rule (default 2 - sqrt(2))
+    minimum_step : Float, optional
+       The simulation fails when the step is reduced below this value, which must be positive (default 1e-9 times the difference of ``stop_time`` and ``start_time``)
+    maximum_step : Float, optional
+       Maximum step size, no limit when 0.0 (default 0.0)
+    target_iterations : int, optional
+       Desired number of iterations per point (default 4)
+    maximum_failures : int, optional
+       The simulation fails when this many points in a row fail to converge (default 10)
+    callback : str, optional
+       Function called with the time after each converged point
+    solver_type : {'direct', 'iterative'} required
+       Linear solver type
+    absolute_error : Float, optional
+       Required update norm in the solve (default 0.0)
+    relative_error : Float, optional
+       Required relative update in the solve (default 0.0)
+    charge_error : Float, optional
+       Relative error between projected and solved charge (default 0.0)
+    maximum_error : Float, optional
+       Maximum absolute error before solve stops (default MAXDOUBLE)
+    maximum_iterations : int, optional
+       Maximum number of iterations in each solve (default 20)
+    maximum_divergence : int, optional
+       Maximum number of diverging iterations during solve (default 20)
+    info : bool, optional
+       Return the time, method, and number of iterations for each point (default False)
+    symbolic_iteration_limit : int, optional
+       Reuse symbolic matrix factorization after this number of iterations (default 1)
+
+    Notes
+    -----
+
+    A ``transient_dc`` solve is required before the first call.  Later calls continue from the last time point, and their first step uses BDF1.
+)";
+
 static const char add_circuit_node_doc[] =
 R"(    devsim.add_circuit_node (name, value, variable_update)
 
@@ -63,6 +158,31 @@ R"(    devsim.circuit_node_alias (node, alias)
        alias for the circuit node
 )";
 
+static const char circuit_pulse_doc[] =
+R"(    devsim.circuit_pulse (name, v1, v2, td, tr, tf, pw, per)
+
+    Sets a pulse waveform on a voltage or current source for transient simulation.  The source is ``v1`` until ``td``, rises to ``v2`` over ``tr``, stays at ``v2`` for ``pw``, and falls back to ``v1`` over ``tf``.  The corners of the waveform are the break points used by :meth:`devsim.solve_transient`.
+
+    Parameters
+    ----------
+    name : str
+       Name of the voltage or current source
+    v1 : Float
+       initial value
+    v2 : Float
+       pulsed value
+    td : Float, optional
+       delay time (default 0.0)
+    tr : Float, optional
+       rise time (default 0.0)
+    tf : Float, optional
+       fall time (default 0.0)
+    pw : Float, optional
+       pulse width (default 0.0)
+    per : Float, optional
+       period, a single pulse when 0.0 (default 0.0)
+)";
+
 static const char delete_circuit_doc[] =
 R"(    devsim.delete_circuit ()
 
@@ -455,7 +575,57 @@ R"(    devsim.get_region_list (device, contact, interface)
 static const char reset_devsim_doc[] =
 R"(    devsim.reset_devsim ()
 
-    Resets all data for clean restart.
+    Resets all data for clean restart.  When called from a thread using a simulation context other than ``global``, only the data in that context is reset.
+)";
+
+static const char create_simulation_context_doc[] =
+R"(    devsim.create_simulation_context (name)
+
+    Creates a new simulation context.  A simulation context holds its own devices, parameters, circuit, and transient data.  The global parameters of the ``global`` context are copied into the new context.
+
+    Parameters
+    ----------
+    name : str
+       Name of the new context
+
+    Notes
+    -----
+
+    Each Python thread selects its own context using :meth:`devsim.set_simulation_context`.  Solves in different contexts may then run concurrently, since the Python GIL is released during the solve.  Model expressions are parsed by a symbolic engine which is shared by all of the contexts.
+)";
+
+static const char delete_simulation_context_doc[] =
+R"(    devsim.delete_simulation_context (name)
+
+    Deletes a simulation context and all of its data.  The ``global`` context, and contexts selected by any thread, may not be deleted.
+
+    Parameters
+    ----------
+    name : str
+       Name of the context
+)";
+
+static const char set_simulation_context_doc[] =
+R"(    devsim.set_simulation_context (name)
+
+    Selects the simulation context used by the calling thread.
+
+    Parameters
+    ----------
+    name : str, optional
+       Name of the context. If not specified, the ``global`` context is used.
+)";
+
+static const char get_simulation_context_doc[] =
+R"(    devsim.get_simulation_context ()
+
+    Gets the name of the simulation context used by the calling thread.
+)";
+
+static const char get_simulation_context_list_doc[] =
+R"(    devsim.get_simulation_context_list ()
+
+    Gets the list of simulation contexts.
 )";
 
 static const char get_dimension_doc[] =
@@ -727,6 +897,116 @@ R"(    devsim.add_2d_region (mesh, region, material, xl, xh, yl, yh, bloat)
        Extend bounding box by this amount when search for mesh to include in region (default 1e-10)
 )";
 
+static const char add_3d_contact_doc[] =
+R"(    devsim.add_3d_contact (name, material, mesh, region, xl, xh, yl, yh, zl, zh, bloat)
+
+    Add a contact to a 3D mesh
+
+    Parameters
+    ----------
+    name : str
+       Name for the contact being created
+    material : str
+       material for the contact being created
+    mesh : str
+       Mesh to add the contact to
+    region : str
+       Name of the region included in the contact
+    xl : Float, optional
+       x position for corner of bounding box (default -MAXDOUBLE)
+    xh : Float, optional
+       x position for corner of bounding box (default +MAXDOUBLE)
+    yl : Float, optional
+       y position for corner of bounding box (default -MAXDOUBLE)
+    yh : Float, optional
+       y position for corner of bounding box (default +MAXDOUBLE)
+    zl : Float, optional
+       z position for corner of bounding box (default -MAXDOUBLE)
+    zh : Float, optional
+       z position for corner of bounding box (default +MAXDOUBLE)
+    bloat : Float, optional
+       Extend bounding box by this amount when search for mesh to include in region (default 1e-10)
+)";
+
+static const char add_3d_interface_doc[] =
+R"(    devsim.add_3d_interface (mesh, name, region0, region1, xl, xh, yl, yh, zl, zh, bloat)
+
+    Add an interface to a 3D mesh
+
+    Parameters
+    ----------
+    mesh : str
+       Mesh to add the interface to
+    name : str
+       Name for the interface being created
+    region0 : str
+       Name of the region included in the interface
+    region1 : str
+       Name of the region included in the interface
+    xl : Float, optional
+       x position for corner of bounding box (default -MAXDOUBLE)
+    xh : Float, optional
+       x position for corner of bounding box (default +MAXDOUBLE)
+    yl : Float, optional
+       y position for corner of bounding box (default -MAXDOUBLE)
+    yh : Float, optional
+       y position for corner of bounding box (default +MAXDOUBLE)
+    zl : Float, optional
+       z position for corner of bounding box (default -MAXDOUBLE)
+    zh : Float, optional
+       z position for corner of bounding box (default +MAXDOUBLE)
+    bloat : Float, optional
+       Extend bounding box by this amount when search for mesh to include in region (default 1e-10)
+)";
+
+static const char add_3d_mesh_line_doc[] =
+R"(    devsim.add_3d_mesh_line (mesh, dir, pos, ns, ps)
+
+    Add a mesh line to a 3D mesh
+
+    Parameters
+    ----------
+    mesh : str
+       Mesh to add the line to
+    dir : str
+       Direction of the line, which is x, y, or z
+    pos : str
+       Position for the mesh point
+    ns : Float
+       Spacing from this point in the negative direction
+    ps : Float
+       Spacing from this point in the positive direction
+)";
+
+static const char add_3d_region_doc[] =
+R"(    devsim.add_3d_region (mesh, region, material, xl, xh, yl, yh, zl, zh, bloat)
+
+    Add a region to a 3D mesh
+
+    Parameters
+    ----------
+    mesh : str
+       Mesh to add the region to
+    region : str
+       Name for the region being created
+    material : str
+       Material for the region being created
+    xl : Float, optional
+       x position for corner of bounding box (default -MAXDOUBLE)
+    xh : Float, optional
+       x position for corner of bounding box (default +MAXDOUBLE)
+    yl : Float, optional
+       y position for corner of bounding box (default -MAXDOUBLE)
+    yh : Float, optional
+       y position for corner of bounding box (default +MAXDOUBLE)
+    zl : Float, optional
+       z position for corner of bounding box (default -MAXDOUBLE)
+    zh : Float, optional
+       z position for corner of bounding box (default +MAXDOUBLE)
+    bloat : Float, optional
+       Extend bounding box by this amount when search for mesh to include in region (default 1e-10)
+)";
+
 static const char add_gmsh_contact_doc[] =
 R"(    devsim.add_gmsh_contact (gmsh_name, material, mesh, name, region)
 
@@ -804,6 +1084,18 @@ R"(    devsim.create_2d_mesh (mesh)
        name of the 2D mesh being created
 )";
 
+static const char create_3d_mesh_doc[] =
+R"(    devsim.create_3d_mesh (mesh)
+
+    Create a mesh to create a 3D device
+    Each cell between the mesh lines is split into 6 tetrahedra
+
+    Parameters
+    ----------
+    mesh : str
+       name of the 3D mesh being created
+)";
+
 static const char create_contact_from_interface_doc[] =
 R"(    devsim.create_contact_from_interface (device, region, interface, material, name)
 
@@ -953,6 +1245,29 @@ R"(    devsim.load_devices (file)
        name of the file to load the meshes from
 )";
 
+static const char refine_mesh_doc[] =
+R"(    devsim.refine_mesh (device, mesh, edge_model, threshold)
+
+    Create a mesh from a device, where the edges with an edge model above a threshold are split at their midpoints
+
+    Parameters
+    ----------
+    device : str
+       The device being refined
+    mesh : str
+       Name of the new mesh
+    edge_model : str
+       The edge model used to select the edges, such as an error indicator
+    threshold : float, optional
+       Edges are split when the magnitude of the edge model is above this value (default 0.0)
+
+    Notes
+    -----
+    Edges are selected in each region with the edge model.  More edges are split so that there are no hanging nodes, and an edge shared by regions is split in all of them.  Triangles are split into 2 or 4 triangles, and tetrahedra are split into 2, 4, or 8 tetrahedra.
+
+    The new mesh is finalized, and has the regions, contacts, and interfaces of the device.  The node solutions of each region are copied into the mesh, and the value at each new node is the average of the edge it splits.  These node solutions are restored by :meth:`devsim.create_device`, while the other models and the equations have to be created again on the new device.
+)";
+
 static const char write_devices_doc[] =
 R"(    devsim.write_devices (file, device, type, include_test)
 
@@ -1616,6 +1931,31 @@ R"(    devsim.interface_normal_model (device, region, interface)
     where ``iname`` is the name of the interface.  The normals are of the closest node on the interface.  The sign is toward the interface.
 )";
 
+static const char interpolate_node_solution_doc[] =
+R"(    devsim.interpolate_node_solution (device, region, name, from_device, from_region, from_name)
+
+    Set a node solution from the values of a node model on another device.  The value at each node is interpolated from the element of the other region containing it.  This is used to start a simulation on a refined mesh from the solution on a coarser mesh of the same geometry.
+
+    Parameters
+    ----------
+    device : str
+       The selected device
+    region : str
+       The selected region
+    name : str
+       Name of the node solution being set
+    from_device : str
+       The device with the values being interpolated
+    from_region : str, optional
+       The region of from_device with the values being interpolated (default is region)
+    from_name : str, optional
+       The node model with the values being interpolated (default is name)
+
+    Notes
+    -----
+    A node outside of the other region uses the values of the nearest element found, and the number of these nodes is displayed.
+)";
+
 static const char node_model_doc[] =
 R"(    devsim.node_model (device, region, name, equation, display_type)
 
@@ -1696,7 +2036,7 @@ R"(    devsim.print_node_values (device, region, name)
 )";
 
 static const char register_function_doc[] =
-R"(    devsim.register_function (name, nargs, procedure)
+R"(    devsim.register_function (name, nargs, procedure, vectorized)
 
     This command is used to register a new Python procedure for evaluation by SYMDIFF.
 
@@ -1708,6 +2048,17 @@ R"(    devsim.register_function (name, nargs, procedure)
        Number of arguments to the function
     procedure : str
        The procedure to be called
+    vectorized : bool, optional
+       The procedure is called once with arrays of values (default False)
+
+    Notes
+    -----
+
+    By default, the procedure is called once for each node, edge, or element, with a ``float`` for each argument.
+
+    When ``vectorized`` is ``True``, the procedure is called once for each model evaluation.  Each argument which varies over the region is passed as an ``array.array`` of type ``'d'``, and the constant arguments are passed as a ``float``.  The procedure must return a sequence of ``float`` of the same length, such as a ``list``, ``array.array``, or ``numpy`` array of type ``float64``.  A ``numpy`` array may be created from an argument without a copy by using ``numpy.frombuffer``.
+
+    When all of the arguments are constant, the procedure is called once with a ``float`` for each argument, and must return a ``float``.
 )";
 
 static const char set_edge_values_doc[] =
@@ -1906,7 +2257,7 @@ R"(    devsim.set_initial_condition (static_rhs, dynamic_rhs)
 )";
 
 static const char solve_doc[] =
-R"(    devsim.solve (type, solver_type, absolute_error, relative_error, maximum_error, charge_error, gamma, tdelta, maximum_iterations, maximum_divergence, frequency, output_node, info, symbolic_iteration_limit)
+R"(    devsim.solve (type, solver_type, absolute_error, relative_error, maximum_error, charge_error, gamma, tdelta, maximum_iterations, maximum_divergence, frequency, output_node, info, timing, symbolic_iteration_limit)
 
     Call the solver.  A small-signal AC source is set with the circuit voltage source.
 
@@ -1938,6 +2289,19 @@ R"(    devsim.solve (type, solver_type, absolute_error, relative_error, maximum_
        Output circuit node for noise simulation
     info : bool, optional
        Solve command return convergence information (default False)
+    timing : bool, optional
+       Add the time of each phase to the convergence information, requires ``info`` (default False)
     symbolic_iteration_limit : int, optional
        Reuse symbolic matrix factorization after this number of iterations (default 1)
+
+    Notes
+    -----
+
+    When ``info`` and ``timing`` are ``True``, the returned dictionary for a ``dc`` or transient solve contains a ``timing`` entry.  It is not part of the default ``info`` result, since the times differ between runs.  This has the wall time in seconds spent in ``assemble``, ``finalize``, ``linear_solve``, ``factor``, ``solve``, and ``update``, and the ``total`` time of the solve.  When uncoupled devices are solved as separate blocks, the time of each phase is summed over the blocks.
+
+    The ``equation_ordering`` parameter may be set to ``rcm``, ``amd``, or ``nd`` to renumber the matrix of a coupled solve.  The node bandwidth and fill before and after ordering are in the ``ordering`` entry of the returned dictionary.
+
+    Setting the ``direct_solver`` parameter to ``sparse_lu`` selects the built in sparse LU factorization, which does not need the Intel MKL or an external solver.  The columns of each level of the elimination tree are factored in parallel using the ``threads_available`` and ``threads_task_size`` parameters.  The ``sparse_lu_ordering`` parameter sets the fill reducing ordering to ``none``, ``rcm``, ``amd``, or ``nd`` (the default).  When the symbolic factorization is reused, only the numeric factorization is repeated.
+
+    The ``iterative_preconditioner`` parameter selects the preconditioner when ``solver_type`` is ``iterative``.  The default, ``block_direct``, factors the matrix with the direct solver, after dropping small entries between the equations of each region.  The ``block_jacobi`` and ``block_ilu`` options store the matrix with a dense block for each pair of coupled nodes, and use block Jacobi or block incomplete LU factorization on these blocks.  The ``amg`` option applies one V-cycle of smoothed aggregation algebraic multigrid, which is intended for potential and other Poisson like equations.  The multigrid setup and cycle use the ``threads_available`` and ``threads_task_size`` parameters.  The ``field_split`` option groups the equations by their solution variable over all of the regions, with the circuit equations as one more group, and solves each group with the solver in the ``field_split_solver_<variable>`` or ``field_split_solver`` parameter, which may be ``direct`` (the default), ``ilu``, or ``amg``.  The ``field_split_type`` parameter combines the groups as ``multiplicative`` (the default), ``additive``, or ``schur``.  The ``schur`` type eliminates the variable in the ``field_split_schur_field`` parameter, which defaults to ``Potential``, from the remaining equations using its diagonal.
 )";
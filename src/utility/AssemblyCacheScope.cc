@@ -0,0 +1,84 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#include "AssemblyCacheScope.hh"
+#include "OutputStream.hh"
+
+#include <sstream>
+
+thread_local size_t AssemblyCacheScope::depth_      = 0;
+thread_local size_t AssemblyCacheScope::generation_ = 0;
+thread_local size_t AssemblyCacheScope::hits_       = 0;
+thread_local size_t AssemblyCacheScope::misses_     = 0;
+thread_local std::vector<std::shared_ptr<void>> AssemblyCacheScope::caches_;
+std::atomic<size_t> AssemblyCacheScope::lastGeneration_(0);
+
+AssemblyCacheScope::AssemblyCacheScope(const std::string &msg) : msg_(msg)
+{
+  if (depth_ == 0)
+  {
+    generation_ = ++lastGeneration_;
+    hits_   = 0;
+    misses_ = 0;
+  }
+  ++depth_;
+}
+
+AssemblyCacheScope::~AssemblyCacheScope()
+{
+  --depth_;
+  if (depth_ != 0)
+  {
+    return;
+  }
+
+  const size_t numcaches = caches_.size();
+  caches_.clear();
+  generation_ = 0;
+
+  const size_t lookups = hits_ + misses_;
+  if (lookups == 0)
+  {
+    return;
+  }
+
+  try
+  {
+    std::ostringstream os;
+    os << "\nCACHE " << msg_ << " (" << hits_ << " hits of " << lookups << " lookups, " << (100.0 * hits_) / lookups << "%, " << numcaches << " caches)\n";
+    OutputStream::WriteOut(OutputStream::OutputType::VERBOSE2, os.str());
+  }
+  catch(...)
+  {
+  }
+}
+
+void AssemblyCacheScope::Keep(std::shared_ptr<void> p)
+{
+  if (generation_ != 0)
+  {
+    caches_.push_back(p);
+  }
+}
+
+void AssemblyCacheScope::RecordLookup(bool hit)
+{
+  if (generation_ == 0)
+  {
+    return;
+  }
+
+  if (hit)
+  {
+    ++hits_;
+  }
+  else
+  {
+    ++misses_;
+  }
+}
+
@@ -0,0 +1,51 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#ifndef ASSEMBLY_CACHE_SCOPE_HH
+#define ASSEMBLY_CACHE_SCOPE_HH
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <cstddef>
+
+/// The model expression caches created during an assembly pass are kept until the end of the pass
+/// so that the bulk, contact, and interface equations share their evaluations
+/// Each pass has a new generation, so that a cache from an earlier pass is never used
+/// The scopes may be nested, and only the outermost one starts a new generation
+/// The passes of the equation blocks run on their own threads, so the state of the pass is kept for each thread
+class AssemblyCacheScope {
+  public:
+    explicit AssemblyCacheScope(const std::string &/*token*/);
+    ~AssemblyCacheScope();
+
+    /// The generation of the current pass, or 0 when there is no pass
+    static size_t GetGeneration()
+    {
+      return generation_;
+    }
+
+    /// The cache is released at the end of the current pass
+    static void Keep(std::shared_ptr<void>);
+
+    static void RecordLookup(bool /*hit*/);
+
+  private:
+    AssemblyCacheScope(const AssemblyCacheScope &);
+    AssemblyCacheScope &operator=(const AssemblyCacheScope &);
+
+    const std::string msg_;
+
+    static thread_local size_t depth_;
+    static thread_local size_t generation_;
+    static thread_local size_t hits_;
+    static thread_local size_t misses_;
+    static thread_local std::vector<std::shared_ptr<void>> caches_;
+    static std::atomic<size_t> lastGeneration_;
+};
+#endif
+
@@ -14,7 +14,7 @@ SPDX-License-Identifier: Apache-2.0
 #include <cmath>
 #include <cassert>
 
-FPECheck::FPEFlag_t FPECheck::fpe_raised_ = 0;
+thread_local FPECheck::FPEFlag_t FPECheck::fpe_raised_ = 0;
 
 #ifndef _WIN32
 void fpehandle(int)
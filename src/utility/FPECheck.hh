@@ -41,6 +41,7 @@ class FPECheck
     FPECheck(const FPECheck &);
     FPECheck &operator=(const FPECheck &);
 
-    static FPECheck::FPEFlag_t fpe_raised_;
+    /// floating point status is per thread
+    static thread_local FPECheck::FPEFlag_t fpe_raised_;
 };
 #endif
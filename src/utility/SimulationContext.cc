@@ -0,0 +1,234 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#include "SimulationContext.hh"
+#include "dsAssert.hh"
+
+#include <map>
+#include <mutex>
+#include <sstream>
+
+namespace {
+typedef std::map<std::string, SimulationContext *> ContextMap_t;
+
+std::mutex &GetContextMutex()
+{
+  static std::mutex context_mutex;
+  return context_mutex;
+}
+
+//// only accessed with the mutex held
+ContextMap_t &GetContextMap()
+{
+  static ContextMap_t context_map;
+  return context_map;
+}
+}
+
+const char *SimulationContext::GlobalContextName = "global";
+
+thread_local SimulationContext::CurrentHolder SimulationContext::current_;
+
+SimulationContext::CurrentHolder::~CurrentHolder()
+{
+  if (context)
+  {
+    --(context->use_count_);
+  }
+}
+
+SimulationContext::SimulationContext(const std::string &name) : name_(name), use_count_(0)
+{
+  instances_.fill(nullptr);
+}
+
+SimulationContext::~SimulationContext()
+{
+}
+
+bool SimulationContext::IsEmpty() const
+{
+  for (auto p : instances_)
+  {
+    if (p)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//// The global context is never deleted, so that it outlives any static destructors
+SimulationContext &SimulationContext::GetGlobal()
+{
+  static SimulationContext *global_context = new SimulationContext(GlobalContextName);
+  return *global_context;
+}
+
+SimulationContext &SimulationContext::GetCurrent()
+{
+  SimulationContext *ret = current_.context;
+  return (ret) ? *ret : GetGlobal();
+}
+
+void SimulationContext::SetCurrent(SimulationContext *context)
+{
+  if (context == &GetGlobal())
+  {
+    context = nullptr;
+  }
+
+  SimulationContext *&current = current_.context;
+
+  if (current == context)
+  {
+    return;
+  }
+
+  if (current)
+  {
+    --(current->use_count_);
+  }
+
+  if (context)
+  {
+    ++(context->use_count_);
+  }
+
+  current = context;
+}
+
+void *SimulationContext::GetInstance(InstanceSlot slot)
+{
+  return GetCurrent().instances_[static_cast<size_t>(slot)];
+}
+
+void SimulationContext::SetInstance(InstanceSlot slot, void *instance)
+{
+  GetCurrent().instances_[static_cast<size_t>(slot)] = instance;
+}
+
+SimulationContext *SimulationContext::FindContext(const std::string &name)
+{
+  if (name.empty() || (name == GlobalContextName))
+  {
+    return &GetGlobal();
+  }
+
+  std::lock_guard<std::mutex> lock(GetContextMutex());
+  ContextMap_t &context_map = GetContextMap();
+  auto it = context_map.find(name);
+  return (it != context_map.end()) ? it->second : nullptr;
+}
+
+std::vector<std::string> SimulationContext::GetContextNames()
+{
+  std::vector<std::string> ret;
+  ret.push_back(GlobalContextName);
+
+  std::lock_guard<std::mutex> lock(GetContextMutex());
+  for (auto &it : GetContextMap())
+  {
+    ret.push_back(it.first);
+  }
+  return ret;
+}
+
+SimulationContext *SimulationContext::CreateContext(const std::string &name, std::string &errorString)
+{
+  if (name.empty() || (name == GlobalContextName))
+  {
+    std::ostringstream os;
+    os << "Simulation context name \"" << name << "\" is reserved\n";
+    errorString += os.str();
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(GetContextMutex());
+  ContextMap_t &context_map = GetContextMap();
+  if (context_map.count(name))
+  {
+    std::ostringstream os;
+    os << "Simulation context \"" << name << "\" already exists\n";
+    errorString += os.str();
+    return nullptr;
+  }
+
+  SimulationContext *ret = new SimulationContext(name);
+  context_map[name] = ret;
+  return ret;
+}
+
+bool SimulationContext::SelectContext(const std::string &name, std::string &errorString)
+{
+  if (name.empty() || (name == GlobalContextName))
+  {
+    SetCurrent(nullptr);
+    return true;
+  }
+
+  //// hold the lock so that the context cannot be removed before it is marked in use
+  std::lock_guard<std::mutex> lock(GetContextMutex());
+  ContextMap_t &context_map = GetContextMap();
+  auto it = context_map.find(name);
+  if (it == context_map.end())
+  {
+    std::ostringstream os;
+    os << "Simulation context \"" << name << "\" does not exist\n";
+    errorString += os.str();
+    return false;
+  }
+
+  SetCurrent(it->second);
+  return true;
+}
+
+bool SimulationContext::RemoveContext(const std::string &name, std::string &errorString)
+{
+  std::ostringstream os;
+  if (name.empty() || (name == GlobalContextName))
+  {
+    os << "Simulation context \"" << name << "\" cannot be deleted\n";
+    errorString += os.str();
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(GetContextMutex());
+  ContextMap_t &context_map = GetContextMap();
+  auto it = context_map.find(name);
+  if (it == context_map.end())
+  {
+    os << "Simulation context \"" << name << "\" does not exist\n";
+    errorString += os.str();
+    return false;
+  }
+
+  SimulationContext *context = it->second;
+  if (context->IsInUse())
+  {
+    os << "Simulation context \"" << name << "\" is in use by a thread\n";
+    errorString += os.str();
+    return false;
+  }
+
+  dsAssert(context->IsEmpty(), "UNEXPECTED");
+
+  context_map.erase(it);
+  delete context;
+  return true;
+}
+
+SimulationContext::ScopedContext::ScopedContext(SimulationContext &context) : previous_(&SimulationContext::GetCurrent())
+{
+  SimulationContext::SetCurrent(&context);
+}
+
+SimulationContext::ScopedContext::~ScopedContext()
+{
+  SimulationContext::SetCurrent(previous_);
+}
+
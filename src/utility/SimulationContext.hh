@@ -0,0 +1,107 @@
+/***
+DEVSIM
+Copyright 2026 DEVSIM LLC
+
+SPDX-License-Identifier: Apache-2.0
+***/
+
+#ifndef SIMULATION_CONTEXT_HH
+#define SIMULATION_CONTEXT_HH
+
+#include <string>
+#include <vector>
+#include <array>
+#include <atomic>
+
+/// A simulation context owns one copy of each of the data singletons
+/// (GlobalData, MeshKeeper, circuit data, MathEval and TimeData).
+/// Each thread has a current context, which defaults to the global
+/// context.  This allows independent devices to be loaded and solved
+/// concurrently from separate Python threads.
+///
+/// The symbolic expression engine is not part of the context, and
+/// remains shared by the whole process.
+class SimulationContext
+{
+  public:
+    enum class InstanceSlot {
+      GLOBALDATA = 0,
+      MESHKEEPER,
+      NODEKEEPER,
+      INSTANCEKEEPER,
+      MATHEVAL_DOUBLE,
+      MATHEVAL_EXTENDED,
+      TIMEDATA_DOUBLE,
+      TIMEDATA_EXTENDED,
+      NUMBER_OF_SLOTS
+    };
+
+    /// RAII selection of a context in the current thread
+    /// Used for propagating the context to worker threads
+    class ScopedContext
+    {
+      public:
+        explicit ScopedContext(SimulationContext &);
+        ~ScopedContext();
+      private:
+        ScopedContext(const ScopedContext &);
+        ScopedContext &operator=(const ScopedContext &);
+
+        SimulationContext *previous_;
+    };
+
+    static SimulationContext &GetCurrent();
+    static SimulationContext &GetGlobal();
+
+    /// These operate on the current context of the calling thread
+    static void *GetInstance(InstanceSlot);
+    static void  SetInstance(InstanceSlot, void *);
+
+    static SimulationContext *FindContext(const std::string &/*name*/);
+    static std::vector<std::string> GetContextNames();
+
+    /// returns nullptr and sets the error string if the context already exists
+    static SimulationContext *CreateContext(const std::string &/*name*/, std::string &/*errorString*/);
+    /// returns false and sets the error string if the context does not exist
+    static bool SelectContext(const std::string &/*name*/, std::string &/*errorString*/);
+    /// the instances owned by the context must be destroyed by the caller first
+    static bool RemoveContext(const std::string &/*name*/, std::string &/*errorString*/);
+
+    const std::string &GetName() const
+    {
+      return name_;
+    }
+
+    bool IsInUse() const
+    {
+      return use_count_ != 0;
+    }
+
+    bool IsEmpty() const;
+
+    static const char *GlobalContextName;
+
+  private:
+    explicit SimulationContext(const std::string &);
+    ~SimulationContext();
+    SimulationContext(const SimulationContext &);
+    SimulationContext &operator=(const SimulationContext &);
+
+    static void SetCurrent(SimulationContext *);
+
+    std::string name_;
+    std::array<void *, static_cast<size_t>(InstanceSlot::NUMBER_OF_SLOTS)> instances_;
+    std::atomic<size_t> use_count_;
+
+    /// releases the selection when the thread exits
+    struct CurrentHolder
+    {
+      ~CurrentHolder();
+      SimulationContext *context = nullptr;
+    };
+
+    static thread_local CurrentHolder current_;
+};
+
+#endif
+
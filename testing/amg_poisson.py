@@ -0,0 +1,60 @@
+# Copyright 2026 DEVSIM LLC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+####
+#### amg_poisson.py
+#### 2d equilibrium potential solved with the iterative solver and the amg preconditioner
+#### the potential must match the direct solver
+####
+import devsim
+import test_common
+
+device = "MyDevice"
+region = "MyRegion"
+
+devsim.create_2d_mesh(mesh="dog")
+devsim.add_2d_mesh_line(mesh="dog", dir="x", pos=0.0, ps=1e-6)
+devsim.add_2d_mesh_line(mesh="dog", dir="x", pos=1e-4, ps=1e-6)
+devsim.add_2d_mesh_line(mesh="dog", dir="y", pos=0.0, ps=1e-6)
+devsim.add_2d_mesh_line(mesh="dog", dir="y", pos=2e-5, ps=1e-6)
+devsim.add_2d_region(mesh="dog", material="Si", region=region)
+devsim.add_2d_contact(
+    mesh="dog", name="top", region=region, material="metal", xl=0.0, xh=0.0
+)
+devsim.add_2d_contact(
+    mesh="dog", name="bot", region=region, material="metal", xl=1e-4, xh=1e-4
+)
+devsim.finalize_mesh(mesh="dog")
+devsim.create_device(mesh="dog", device=device)
+
+devsim.set_parameter(name="topbias", value=0.1)
+devsim.set_parameter(name="botbias", value=0.0)
+
+test_common.SetupResistorConstants(device, region)
+test_common.SetupInitialResistorSystem(device, region, 1e16)
+test_common.SetupInitialResistorContact(device=device, contact="top")
+test_common.SetupInitialResistorContact(device=device, contact="bot")
+
+potentials = {}
+for solver_type in ("direct", "iterative"):
+    devsim.set_node_value(device=device, region=region, name="Potential", value=0.0)
+    if solver_type == "iterative":
+        devsim.set_parameter(name="iterative_preconditioner", value="amg")
+    devsim.solve(
+        type="dc",
+        absolute_error=1.0,
+        relative_error=1e-10,
+        maximum_iterations=30,
+        solver_type=solver_type,
+    )
+    potentials[solver_type] = devsim.get_node_model_values(
+        device=device, region=region, name="Potential"
+    )
+
+diff = max(
+    abs(x - y) for x, y in zip(potentials["direct"], potentials["iterative"])
+)
+print("maximum potential difference %g" % diff)
+if diff > 1e-8:
+    raise RuntimeError("amg changed the potential")
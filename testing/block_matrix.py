@@ -0,0 +1,59 @@
+# Copyright 2026 DEVSIM LLC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+####
+#### block_matrix.py
+#### 1d resistor solved with the iterative solver and the block preconditioners
+#### the currents must match the direct solver
+####
+import devsim
+import test_common
+
+device = "MyDevice"
+region = "MyRegion"
+
+test_common.CreateSimpleMesh(device, region)
+devsim.set_parameter(name="topbias", value=0.0)
+devsim.set_parameter(name="botbias", value=0.0)
+
+test_common.SetupResistorConstants(device, region)
+test_common.SetupInitialResistorSystem(device, region, 1e16)
+test_common.SetupInitialResistorContact(device=device, contact="top")
+test_common.SetupInitialResistorContact(device=device, contact="bot")
+devsim.solve(type="dc", absolute_error=1.0, relative_error=1e-10, maximum_iterations=30)
+
+test_common.SetupCarrierResistorSystem(device, region)
+test_common.SetupCarrierResistorContact(device=device, contact="top")
+test_common.SetupCarrierResistorContact(device=device, contact="bot")
+
+devsim.set_parameter(name="topbias", value=0.1)
+
+currents = {}
+for preconditioner in ("direct", "block_jacobi", "block_ilu"):
+    devsim.set_node_values(
+        device=device, region=region, name="Electrons", init_from="IntrinsicElectrons"
+    )
+    devsim.set_node_values(
+        device=device, region=region, name="Holes", init_from="IntrinsicHoles"
+    )
+    if preconditioner == "direct":
+        solver_type = "direct"
+    else:
+        solver_type = "iterative"
+        devsim.set_parameter(name="iterative_preconditioner", value=preconditioner)
+    devsim.solve(
+        type="dc",
+        absolute_error=1.0,
+        relative_error=1e-10,
+        maximum_iterations=30,
+        solver_type=solver_type,
+    )
+    currents[preconditioner] = devsim.get_contact_current(
+        device=device, contact="top", equation="ElectronContinuityEquation"
+    )
+    test_common.printResistorCurrent(device=device, contact="top")
+
+for preconditioner, current in currents.items():
+    if abs(current - currents["direct"]) > 1e-8 * abs(currents["direct"]):
+        raise RuntimeError("%s changed the current" % preconditioner)
@@ -0,0 +1,95 @@
+# Copyright 2026 DEVSIM LLC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+####
+#### circuit_batch.py
+#### resistors and capacitors are stamped from stored matrix entries
+#### the entries must be rebuilt when an element is altered, and when nodes are added
+####
+import math
+
+import devsim
+
+
+def dc():
+    devsim.solve(
+        type="dc", absolute_error=1.0, relative_error=1e-14, maximum_iterations=3
+    )
+
+
+def transient_dc():
+    devsim.solve(
+        type="transient_dc",
+        absolute_error=1.0,
+        relative_error=1e-14,
+        maximum_iterations=3,
+    )
+
+
+def bdf1(tstep):
+    devsim.solve(
+        type="transient_bdf1",
+        absolute_error=1.0,
+        relative_error=1e-14,
+        maximum_iterations=3,
+        tdelta=tstep,
+    )
+
+
+def check(node, expected):
+    v = devsim.get_circuit_node_value(node=node, solution="dcop")
+    print("node %s %1.15e %1.15e" % (node, v, expected))
+    if not math.isclose(v, expected, rel_tol=1e-12, abs_tol=1e-15):
+        raise RuntimeError("node %s is %g, expected %g" % (node, v, expected))
+
+
+# resistor divider
+devsim.circuit_element(name="V1", n1=1, n2=0, value=1.0)
+devsim.circuit_element(name="R1", n1=1, n2=2, value=1.0)
+devsim.circuit_element(name="R2", n1=2, n2=0, value=3.0)
+dc()
+check(2, 3.0 / (1.0 + 3.0))
+
+# the conductance of R1 is recalculated
+devsim.circuit_alter(name="R1", value=3.0)
+dc()
+check(2, 3.0 / (3.0 + 3.0))
+
+# node 3 is added, so the circuit nodes are numbered again
+devsim.circuit_element(name="R3", n1=2, n2=3, value=1.0)
+devsim.circuit_element(name="R4", n1=3, n2=0, value=2.0)
+dc()
+rp = 1.0 / (1.0 / 3.0 + 1.0 / (1.0 + 2.0))
+v2 = rp / (3.0 + rp)
+check(2, v2)
+check(3, v2 * 2.0 / (1.0 + 2.0))
+
+# rc step, each backward euler step is exact for a linear circuit
+devsim.circuit_element(name="V2", n1=4, n2=0, value=0.0)
+devsim.circuit_element(name="R5", n1=4, n2=5, value=2.0)
+devsim.circuit_element(name="C1", n1=5, n2=0, value=0.5)
+
+
+def step_response(r, c):
+    devsim.circuit_alter(name="V2", value=0.0)
+    transient_dc()
+    check(5, 0.0)
+    devsim.circuit_alter(name="V2", value=1.0)
+    tstep = 0.1
+    a = tstep / (r * c)
+    v = 0.0
+    for i in range(5):
+        bdf1(tstep)
+        v = (v + a) / (1.0 + a)
+        check(5, v)
+
+
+step_response(2.0, 0.5)
+
+# the capacitance of C1 is recalculated
+devsim.circuit_alter(name="C1", value=2.0)
+step_response(2.0, 2.0)
+
+# the divider is unchanged by the rc circuit
+check(2, v2)
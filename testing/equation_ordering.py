@@ -0,0 +1,80 @@
+# Copyright 2026 DEVSIM LLC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+####
+#### equation_ordering.py
+#### 2d resistor solved with each equation ordering, the currents must not change
+####
+import devsim
+import test_common
+
+device = "MyDevice"
+region = "MyRegion"
+
+devsim.create_2d_mesh(mesh="dog")
+devsim.add_2d_mesh_line(mesh="dog", dir="x", pos=0.0, ps=1e-6)
+devsim.add_2d_mesh_line(mesh="dog", dir="x", pos=1e-4, ps=1e-6)
+devsim.add_2d_mesh_line(mesh="dog", dir="y", pos=0.0, ps=1e-6)
+devsim.add_2d_mesh_line(mesh="dog", dir="y", pos=2e-5, ps=1e-6)
+devsim.add_2d_region(mesh="dog", material="Si", region=region)
+devsim.add_2d_contact(
+    mesh="dog", name="top", region=region, material="metal", xl=0.0, xh=0.0
+)
+devsim.add_2d_contact(
+    mesh="dog", name="bot", region=region, material="metal", xl=1e-4, xh=1e-4
+)
+devsim.finalize_mesh(mesh="dog")
+devsim.create_device(mesh="dog", device=device)
+
+devsim.set_parameter(name="topbias", value=0.0)
+devsim.set_parameter(name="botbias", value=0.0)
+
+test_common.SetupResistorConstants(device, region)
+test_common.SetupInitialResistorSystem(device, region, 1e16)
+test_common.SetupInitialResistorContact(device=device, contact="top")
+test_common.SetupInitialResistorContact(device=device, contact="bot")
+devsim.solve(type="dc", absolute_error=1.0, relative_error=1e-10, maximum_iterations=30)
+
+test_common.SetupCarrierResistorSystem(device, region)
+test_common.SetupCarrierResistorContact(device=device, contact="top")
+test_common.SetupCarrierResistorContact(device=device, contact="bot")
+
+devsim.set_parameter(name="topbias", value=0.1)
+
+currents = {}
+for ordering in ("none", "rcm", "amd", "nd"):
+    devsim.set_parameter(name="equation_ordering", value=ordering)
+    devsim.set_node_values(
+        device=device, region=region, name="Electrons", init_from="IntrinsicElectrons"
+    )
+    devsim.set_node_values(
+        device=device, region=region, name="Holes", init_from="IntrinsicHoles"
+    )
+    res = devsim.solve(
+        type="dc",
+        absolute_error=1.0,
+        relative_error=1e-10,
+        maximum_iterations=30,
+        info=True,
+    )
+    if "ordering" in res:
+        o = res["ordering"]
+        print(
+            "%s bandwidth %d -> %d fill %g -> %g"
+            % (
+                o["type"],
+                o["bandwidth_before"],
+                o["bandwidth_after"],
+                o["fill_before"],
+                o["fill_after"],
+            )
+        )
+    currents[ordering] = devsim.get_contact_current(
+        device=device, contact="top", equation="ElectronContinuityEquation"
+    )
+    test_common.printResistorCurrent(device=device, contact="top")
+
+for ordering, current in currents.items():
+    if abs(current - currents["none"]) > 1e-8 * abs(currents["none"]):
+        raise RuntimeError("ordering %s changed the current" % ordering)
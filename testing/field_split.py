@@ -0,0 +1,71 @@
+# Copyright 2026 DEVSIM LLC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+####
+#### field_split.py
+#### 1d resistor solved with the iterative solver and the field split preconditioner
+#### the currents must match the direct solver
+####
+import devsim
+import test_common
+
+device = "MyDevice"
+region = "MyRegion"
+
+test_common.CreateSimpleMesh(device, region)
+devsim.set_parameter(name="topbias", value=0.0)
+devsim.set_parameter(name="botbias", value=0.0)
+
+test_common.SetupResistorConstants(device, region)
+test_common.SetupInitialResistorSystem(device, region, 1e16)
+test_common.SetupInitialResistorContact(device=device, contact="top")
+test_common.SetupInitialResistorContact(device=device, contact="bot")
+devsim.solve(type="dc", absolute_error=1.0, relative_error=1e-10, maximum_iterations=30)
+
+test_common.SetupCarrierResistorSystem(device, region)
+test_common.SetupCarrierResistorContact(device=device, contact="top")
+test_common.SetupCarrierResistorContact(device=device, contact="bot")
+
+devsim.set_parameter(name="topbias", value=0.1)
+
+#### the type of split, and the solver for the potential
+cases = (
+    ("direct", None, None),
+    ("multiplicative", "multiplicative", "direct"),
+    ("schur", "schur", "direct"),
+    ("additive_amg", "additive", "amg"),
+)
+
+currents = {}
+for name, split_type, potential_solver in cases:
+    devsim.set_node_values(
+        device=device, region=region, name="Electrons", init_from="IntrinsicElectrons"
+    )
+    devsim.set_node_values(
+        device=device, region=region, name="Holes", init_from="IntrinsicHoles"
+    )
+    if split_type is None:
+        solver_type = "direct"
+    else:
+        solver_type = "iterative"
+        devsim.set_parameter(name="iterative_preconditioner", value="field_split")
+        devsim.set_parameter(name="field_split_type", value=split_type)
+        devsim.set_parameter(
+            name="field_split_solver_Potential", value=potential_solver
+        )
+    devsim.solve(
+        type="dc",
+        absolute_error=1.0,
+        relative_error=1e-10,
+        maximum_iterations=30,
+        solver_type=solver_type,
+    )
+    currents[name] = devsim.get_contact_current(
+        device=device, contact="top", equation="ElectronContinuityEquation"
+    )
+    test_common.printResistorCurrent(device=device, contact="top")
+
+for name, current in currents.items():
+    if abs(current - currents["direct"]) > 1e-8 * abs(currents["direct"]):
+        raise RuntimeError("%s changed the current" % name)
@@ -0,0 +1,85 @@
+# Copyright 2026 DEVSIM LLC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+####
+#### geometry_cache.py
+#### the element edge couples of a mesh are stored in a cache file, and read when the same mesh is loaded again
+####
+import glob
+import os
+import struct
+import tempfile
+
+import devsim
+
+cache = tempfile.TemporaryDirectory()
+devsim.set_parameter(name="geometry_cache_directory", value=cache.name)
+
+
+def create_3d(mesh, spacing):
+    devsim.create_3d_mesh(mesh=mesh)
+    for d in ("x", "y", "z"):
+        devsim.add_3d_mesh_line(mesh=mesh, dir=d, pos=0.0, ps=spacing)
+        devsim.add_3d_mesh_line(mesh=mesh, dir=d, pos=1.0, ps=spacing)
+    devsim.add_3d_region(mesh=mesh, material="Si", region="r0")
+    devsim.finalize_mesh(mesh=mesh)
+
+
+def get_values(device):
+    return {
+        "EdgeCouple": devsim.get_edge_model_values(device=device, region="r0", name="EdgeCouple"),
+        "NodeVolume": devsim.get_node_model_values(device=device, region="r0", name="NodeVolume"),
+        "ElementEdgeCouple": devsim.get_element_model_values(device=device, region="r0", name="ElementEdgeCouple"),
+    }
+
+
+create_3d("cube", 0.25)
+devsim.create_device(mesh="cube", device="first")
+first = get_values("first")
+
+files = glob.glob(os.path.join(cache.name, "*.dsgeom"))
+if len(files) != 1:
+    raise RuntimeError("expected 1 cache file, found %d" % len(files))
+
+# the second device has the same geometry, so its values are read from the file
+devsim.create_device(mesh="cube", device="second")
+second = get_values("second")
+for name, values in first.items():
+    if values != second[name]:
+        raise RuntimeError("%s is different when read from the cache" % name)
+print("%d element edge couples read from the cache" % len(second["ElementEdgeCouple"]))
+
+# the values in the file are used, instead of being calculated again
+header = "<8sQQQQQQQQ"
+with open(files[0], "r+b") as f:
+    magic, key, check, nodes, edges, triangles, tetrahedra, size, count = struct.unpack(header, f.read(struct.calcsize(header)))
+    if size == 8:
+        f.write(struct.pack("<%dd" % count, *([1.0] * count)))
+if size == 8:
+    devsim.create_device(mesh="cube", device="third")
+    values = devsim.get_element_model_values(device="third", region="r0", name="ElementEdgeCouple")
+    if any(v != 1.0 for v in values):
+        raise RuntimeError("the cache file was not used")
+    print("cache file used")
+
+    # a file whose node count does not match the region is calculated again
+    with open(files[0], "r+b") as f:
+        f.seek(24)
+        f.write(struct.pack("<Q", nodes + 1))
+    devsim.create_device(mesh="cube", device="fourth")
+    values = devsim.get_element_model_values(device="fourth", region="r0", name="ElementEdgeCouple")
+    if values != first["ElementEdgeCouple"]:
+        raise RuntimeError("a cache file for a different region was used")
+    print("mismatched cache file not used")
+
+# a different geometry has a different file
+create_3d("other", 0.5)
+devsim.create_device(mesh="other", device="other")
+total = sum(devsim.get_node_model_values(device="other", region="r0", name="NodeVolume"))
+if abs(total - 1.0) > 1e-12:
+    raise RuntimeError("other has volume %g" % total)
+files = glob.glob(os.path.join(cache.name, "*.dsgeom"))
+if len(files) != 2:
+    raise RuntimeError("expected 2 cache files, found %d" % len(files))
+print("%d cache files" % len(files))
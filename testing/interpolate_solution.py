@@ -0,0 +1,56 @@
+# Copyright 2026 DEVSIM LLC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+####
+#### interpolate_solution.py
+#### node solutions are interpolated from a coarse mesh onto a finer mesh of the same geometry
+####
+import devsim
+
+
+def create_2d(mesh, spacing):
+    devsim.create_2d_mesh(mesh=mesh)
+    for d in ("x", "y"):
+        devsim.add_2d_mesh_line(mesh=mesh, dir=d, pos=0.0, ps=spacing)
+        devsim.add_2d_mesh_line(mesh=mesh, dir=d, pos=1.0, ps=spacing)
+    devsim.add_2d_region(mesh=mesh, material="Si", region="r0")
+    devsim.finalize_mesh(mesh=mesh)
+    devsim.create_device(mesh=mesh, device=mesh)
+
+
+def create_3d(mesh, spacing):
+    devsim.create_3d_mesh(mesh=mesh)
+    for d in ("x", "y", "z"):
+        devsim.add_3d_mesh_line(mesh=mesh, dir=d, pos=0.0, ps=spacing)
+        devsim.add_3d_mesh_line(mesh=mesh, dir=d, pos=1.0, ps=spacing)
+    devsim.add_3d_region(mesh=mesh, material="Si", region="r0")
+    devsim.finalize_mesh(mesh=mesh)
+    devsim.create_device(mesh=mesh, device=mesh)
+
+
+def check(coarse, fine, equation):
+    for device in (coarse, fine):
+        devsim.node_solution(device=device, region="r0", name="Potential")
+    devsim.node_model(device=coarse, region="r0", name="init", equation=equation)
+    devsim.set_node_values(device=coarse, region="r0", name="Potential", init_from="init")
+
+    devsim.interpolate_node_solution(device=fine, region="r0", name="Potential", from_device=coarse)
+
+    devsim.node_model(device=fine, region="r0", name="expected", equation=equation)
+    values = devsim.get_node_model_values(device=fine, region="r0", name="Potential")
+    expected = devsim.get_node_model_values(device=fine, region="r0", name="expected")
+    for i, (v, e) in enumerate(zip(values, expected)):
+        if abs(v - e) > 1e-12:
+            raise RuntimeError("%s node %d is %g, expected %g" % (fine, i, v, e))
+    print("%s %d nodes interpolated from %s" % (fine, len(values), coarse))
+
+
+# a linear function is the same on both meshes
+create_2d("coarse2d", 0.25)
+create_2d("fine2d", 0.1)
+check("coarse2d", "fine2d", "1 + 2*x - 3*y")
+
+create_3d("coarse3d", 0.5)
+create_3d("fine3d", 0.2)
+check("coarse3d", "fine3d", "1 + 2*x - 3*y + 4*z")
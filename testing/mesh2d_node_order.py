@@ -0,0 +1,52 @@
+# Copyright 2026 DEVSIM LLC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+####
+#### mesh2d_node_order.py
+#### the nodes of each region of a 2D mesh are numbered in the order of the original 2D mesh generator
+#### each cell is split into the triangles (ul, ur, ll) and (ur, lr, ll), with their nodes sorted,
+#### and a region node is numbered when it is first found in a triangle
+####
+import devsim
+
+device = "MyDevice"
+
+xlocs = [0.0, 0.25, 0.5, 0.75, 1.0]
+ylocs = [0.0, 0.2, 0.4, 0.6, 0.8, 1.0]
+
+devsim.create_2d_mesh(mesh="dog")
+for x in xlocs:
+    devsim.add_2d_mesh_line(mesh="dog", dir="x", pos=x, ps=1.0)
+for y in ylocs:
+    devsim.add_2d_mesh_line(mesh="dog", dir="y", pos=y, ps=1.0)
+devsim.add_2d_region(mesh="dog", material="Si", region="r0", yl=0.0, yh=0.4)
+devsim.add_2d_region(mesh="dog", material="Ox", region="r1", yl=0.4, yh=1.0)
+devsim.add_2d_interface(mesh="dog", name="i0", region0="r0", region1="r1")
+devsim.finalize_mesh(mesh="dog")
+devsim.create_device(mesh="dog", device=device)
+
+numy = len(ylocs)
+coordinates = [(x, y) for x in xlocs for y in ylocs]
+
+expected = {"r0": [], "r1": []}
+for i in range(len(xlocs) - 1):
+    for j in range(numy - 1):
+        ul = i * numy + j
+        ur = (i + 1) * numy + j
+        ll = i * numy + (j + 1)
+        lr = (i + 1) * numy + (j + 1)
+        for triangle in ((ul, ur, ll), (ur, lr, ll)):
+            ycenter = sum(coordinates[c][1] for c in triangle) / 3.0
+            nodes = expected["r0" if ycenter < 0.4 else "r1"]
+            for c in sorted(triangle):
+                if c not in nodes:
+                    nodes.append(c)
+
+for region, nodes in expected.items():
+    x = devsim.get_node_model_values(device=device, region=region, name="x")
+    y = devsim.get_node_model_values(device=device, region=region, name="y")
+    actual = list(zip(x, y))
+    if actual != [coordinates[c] for c in nodes]:
+        raise RuntimeError("%s nodes are not in the original order" % region)
+    print("%s %d nodes in the original order" % (region, len(actual)))
@@ -0,0 +1,63 @@
+# Copyright 2026 DEVSIM LLC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+####
+#### mesh3d_structured.py
+#### a 3D mesh created from mesh lines, where each cell is split into 6 tetrahedra
+####
+import devsim
+
+device = "MyDevice"
+
+devsim.create_3d_mesh(mesh="cube")
+for d in ("x", "y", "z"):
+    devsim.add_3d_mesh_line(mesh="cube", dir=d, pos=0.0, ps=0.25)
+    devsim.add_3d_mesh_line(mesh="cube", dir=d, pos=1.0, ps=0.25)
+devsim.add_3d_mesh_line(mesh="cube", dir="z", pos=0.5, ps=0.25)
+devsim.add_3d_region(mesh="cube", material="Si", region="r0", zl=0.0, zh=0.5)
+devsim.add_3d_region(mesh="cube", material="Si", region="r1", zl=0.5, zh=1.0)
+devsim.add_3d_interface(mesh="cube", name="i0", region0="r0", region1="r1")
+devsim.finalize_mesh(mesh="cube")
+devsim.create_device(mesh="cube", device=device)
+
+
+def count(values):
+    return len(set(round(v, 12) for v in values))
+
+
+for region, volume in (("r0", 0.5), ("r1", 0.5)):
+    x = devsim.get_node_model_values(device=device, region=region, name="x")
+    y = devsim.get_node_model_values(device=device, region=region, name="y")
+    z = devsim.get_node_model_values(device=device, region=region, name="z")
+    nx, ny, nz = count(x), count(y), count(z)
+    if len(x) != nx * ny * nz:
+        raise RuntimeError("%s has %d nodes" % (region, len(x)))
+
+    cx, cy, cz = nx - 1, ny - 1, nz - 1
+    elements = devsim.get_element_node_list(device=device, region=region)
+    if len(elements) != 6 * cx * cy * cz:
+        raise RuntimeError("%s has %d tetrahedra" % (region, len(elements)))
+
+    # the faces of neighboring cells are split the same way
+    edges = (
+        cx * ny * nz + nx * cy * nz + nx * ny * cz
+        + cx * cy * nz + cx * ny * cz + nx * cy * cz
+        + cx * cy * cz
+    )
+    couple = devsim.get_edge_model_values(device=device, region=region, name="EdgeCouple")
+    if len(couple) != edges:
+        raise RuntimeError("%s has %d edges, expected %d" % (region, len(couple), edges))
+
+    total = sum(devsim.get_node_model_values(device=device, region=region, name="NodeVolume"))
+    if abs(total - volume) > 1e-12:
+        raise RuntimeError("%s has volume %g" % (region, total))
+
+    print("%s %d nodes %d edges %d tetrahedra" % (region, len(x), len(couple), len(elements)))
+
+# the interface is the plane between the regions
+devsim.interface_model(device=device, interface="i0", name="iz", equation="z@r0")
+iz = devsim.get_interface_model_values(device=device, interface="i0", name="iz")
+if len(iz) != nx * ny or any(abs(v - 0.5) > 1e-12 for v in iz):
+    raise RuntimeError("i0 has %d nodes" % len(iz))
+print("i0 %d nodes" % len(iz))
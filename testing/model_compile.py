@@ -0,0 +1,63 @@
+# Copyright 2026 DEVSIM LLC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+####
+#### model_compile.py
+#### the resistor from res1.py with node and edge models compiled to native code
+#### the interpreter is used when no compiler is available, so the results are the same
+####
+import os
+import tempfile
+
+import devsim
+import test_common
+import res1
+
+device = res1.device
+region = res1.region
+
+cache = tempfile.TemporaryDirectory()
+devsim.set_parameter(name="model_compile", value=True)
+devsim.set_parameter(name="model_compile_directory", value=cache.name)
+
+test_common.CreateSimpleMesh(device, region)
+devsim.set_parameter(name="topbias", value=0.0)
+devsim.set_parameter(name="botbias", value=0.0)
+res1.run_initial_bias(False)
+for v in (0.0, 0.05, 0.10):
+    devsim.set_parameter(name="topbias", value=v)
+    devsim.solve(
+        type="dc", absolute_error=1.0, relative_error=1e-10, maximum_iterations=30
+    )
+    test_common.printResistorCurrent(device=device, contact="top")
+    test_common.printResistorCurrent(device=device, contact="bot")
+
+# the same expressions evaluated by the interpreter
+for name in ("ElectronCurrent", "ElectricField"):
+    compiled = devsim.get_edge_model_values(device=device, region=region, name=name)
+    devsim.set_parameter(name="model_compile", value=False)
+    devsim.set_node_values(
+        device=device,
+        region=region,
+        name="Potential",
+        values=devsim.get_node_model_values(
+            device=device, region=region, name="Potential"
+        ),
+    )
+    interpreted = devsim.get_edge_model_values(
+        device=device, region=region, name=name
+    )
+    devsim.set_parameter(name="model_compile", value=True)
+    diff = max(
+        abs(a - b) / max(abs(a), abs(b), 1e-300) for a, b in zip(compiled, interpreted)
+    )
+    print("%s %s" % (name, diff < 1e-12))
+
+# the generated sources and partial libraries are removed after each compile
+leftover = [f for f in os.listdir(cache.name) if not f.endswith(".so")]
+if leftover:
+    raise RuntimeError("files left in the model cache: %s" % leftover)
+
+devsim.set_parameter(name="model_compile", value=False)
+cache.cleanup()
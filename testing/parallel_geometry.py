@@ -0,0 +1,40 @@
+# Copyright 2026 DEVSIM LLC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+####
+#### parallel_geometry.py
+#### 3d geometric models calculated with different numbers of threads
+#### the results must be identical
+####
+import devsim
+
+devsim.create_3d_mesh(mesh="cube")
+for d in ("x", "y", "z"):
+    devsim.add_3d_mesh_line(mesh="cube", dir=d, pos=0.0, ps=0.1)
+    devsim.add_3d_mesh_line(mesh="cube", dir=d, pos=1.0, ps=0.1)
+devsim.add_3d_region(mesh="cube", material="Si", region="r0")
+devsim.finalize_mesh(mesh="cube")
+
+devsim.set_parameter(name="threads_task_size", value=1)
+
+results = {}
+for threads in (1, 4):
+    devsim.set_parameter(name="threads_available", value=threads)
+    device = "cube%d" % threads
+    devsim.create_device(mesh="cube", device=device)
+    results[threads] = {
+        "EdgeCouple": devsim.get_edge_model_values(device=device, region="r0", name="EdgeCouple"),
+        "NodeVolume": devsim.get_node_model_values(device=device, region="r0", name="NodeVolume"),
+        "ElementEdgeCouple": devsim.get_element_model_values(device=device, region="r0", name="ElementEdgeCouple"),
+        "ElementNodeVolume": devsim.get_element_model_values(device=device, region="r0", name="ElementNodeVolume"),
+    }
+
+for name, values in results[1].items():
+    if values != results[4][name]:
+        raise RuntimeError("%s depends on the number of threads" % name)
+
+total = sum(results[4]["NodeVolume"])
+if abs(total - 1.0) > 1e-12:
+    raise RuntimeError("volume is %g" % total)
+print("%d edges, volume %g" % (len(results[4]["EdgeCouple"]), total))
@@ -0,0 +1,79 @@
+# Copyright 2026 DEVSIM LLC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+####
+#### parallel_reduce.py
+#### 2d resistor currents and errors with different numbers of threads
+#### the results must be identical
+####
+import devsim
+import test_common
+
+device = "MyDevice"
+region = "MyRegion"
+
+devsim.create_2d_mesh(mesh="dog")
+devsim.add_2d_mesh_line(mesh="dog", dir="x", pos=0.0, ps=1e-6)
+devsim.add_2d_mesh_line(mesh="dog", dir="x", pos=1e-4, ps=1e-6)
+devsim.add_2d_mesh_line(mesh="dog", dir="y", pos=0.0, ps=1e-7)
+devsim.add_2d_mesh_line(mesh="dog", dir="y", pos=1e-4, ps=1e-7)
+devsim.add_2d_region(mesh="dog", material="Si", region=region)
+devsim.add_2d_contact(
+    mesh="dog", name="top", region=region, material="metal", xl=0.0, xh=0.0
+)
+devsim.add_2d_contact(
+    mesh="dog", name="bot", region=region, material="metal", xl=1e-4, xh=1e-4
+)
+devsim.finalize_mesh(mesh="dog")
+devsim.create_device(mesh="dog", device=device)
+
+devsim.set_parameter(name="topbias", value=0.0)
+devsim.set_parameter(name="botbias", value=0.0)
+
+test_common.SetupResistorConstants(device, region)
+test_common.SetupInitialResistorSystem(device, region, 1e16)
+test_common.SetupInitialResistorContact(device=device, contact="top")
+test_common.SetupInitialResistorContact(device=device, contact="bot")
+devsim.solve(type="dc", absolute_error=1.0, relative_error=1e-10, maximum_iterations=30)
+
+test_common.SetupCarrierResistorSystem(device, region)
+test_common.SetupCarrierResistorContact(device=device, contact="top")
+test_common.SetupCarrierResistorContact(device=device, contact="bot")
+
+devsim.set_parameter(name="topbias", value=0.1)
+devsim.set_parameter(name="threads_task_size", value=1)
+
+results = {}
+for threads in (1, 4):
+    devsim.set_parameter(name="threads_available", value=threads)
+    devsim.set_node_values(
+        device=device, region=region, name="Electrons", init_from="IntrinsicElectrons"
+    )
+    devsim.set_node_values(
+        device=device, region=region, name="Holes", init_from="IntrinsicHoles"
+    )
+    info = devsim.solve(
+        type="dc",
+        absolute_error=1.0,
+        relative_error=1e-10,
+        maximum_iterations=30,
+        info=True,
+    )
+    errors = [
+        (e["relative_error"], e["absolute_error"])
+        for i in info["iterations"]
+        for d in i["devices"]
+        for r in d["regions"]
+        for e in r["equations"]
+    ]
+    currents = [
+        devsim.get_contact_current(device=device, contact=c, equation=e)
+        for c in ("top", "bot")
+        for e in ("ElectronContinuityEquation", "HoleContinuityEquation")
+    ]
+    results[threads] = (errors, currents)
+
+if results[1] != results[4]:
+    raise RuntimeError("the results depend on the number of threads")
+print("identical results with 1 and 4 threads")
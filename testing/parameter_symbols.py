@@ -0,0 +1,81 @@
+# Copyright 2026 DEVSIM LLC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+####
+#### parameter_symbols.py
+#### models are updated when a parameter they use is set on the global, device, or region level
+#### and a region parameter shadows the device and global parameters
+####
+import devsim
+
+device = "MyDevice"
+regions = ("r0", "r1")
+
+devsim.create_1d_mesh(mesh="dog")
+devsim.add_1d_mesh_line(mesh="dog", pos=0.0, ps=0.1, tag="top")
+devsim.add_1d_mesh_line(mesh="dog", pos=0.5, ps=0.1, tag="mid")
+devsim.add_1d_mesh_line(mesh="dog", pos=1.0, ps=0.1, tag="bot")
+devsim.add_1d_contact(mesh="dog", name="top", tag="top", material="metal")
+devsim.add_1d_contact(mesh="dog", name="bot", tag="bot", material="metal")
+devsim.add_1d_interface(mesh="dog", name="i0", tag="mid")
+devsim.add_1d_region(mesh="dog", material="Si", region="r0", tag1="top", tag2="mid")
+devsim.add_1d_region(mesh="dog", material="Si", region="r1", tag1="mid", tag2="bot")
+devsim.finalize_mesh(mesh="dog")
+devsim.create_device(mesh="dog", device=device)
+
+devsim.set_parameter(name="alpha", value=1.0)
+devsim.set_parameter(name="beta", value=5.0)
+
+for region in regions:
+    devsim.node_model(device=device, region=region, name="a2", equation="2*alpha")
+    devsim.node_model(device=device, region=region, name="b3", equation="3*beta")
+
+
+def check(region, name, expected):
+    values = devsim.get_node_model_values(device=device, region=region, name=name)
+    for v in values:
+        if v != expected:
+            raise RuntimeError(
+                "%s on %s is %g, expected %g" % (name, region, v, expected)
+            )
+
+
+def check_all(a, b):
+    for region, expected in zip(regions, a):
+        check(region, "a2", 2 * expected)
+    for region, expected in zip(regions, b):
+        check(region, "b3", 3 * expected)
+
+
+check_all((1.0, 1.0), (5.0, 5.0))
+
+devsim.set_parameter(name="alpha", value=2.0)
+check_all((2.0, 2.0), (5.0, 5.0))
+
+devsim.set_parameter(device=device, name="alpha", value=3.0)
+check_all((3.0, 3.0), (5.0, 5.0))
+
+devsim.set_parameter(device=device, region="r1", name="alpha", value=4.0)
+check_all((3.0, 4.0), (5.0, 5.0))
+
+# shadowed on the device for both regions
+devsim.set_parameter(name="alpha", value=10.0)
+check_all((3.0, 4.0), (5.0, 5.0))
+
+devsim.set_parameter(device=device, name="alpha", value=6.0)
+check_all((6.0, 4.0), (5.0, 5.0))
+
+devsim.set_parameter(name="beta", value=7.0)
+check_all((6.0, 4.0), (7.0, 7.0))
+
+devsim.set_parameter(device=device, region="r0", name="beta", value=8.0)
+check_all((6.0, 4.0), (8.0, 7.0))
+
+# a model created after the parameter is set
+devsim.node_model(device=device, region="r1", name="ab", equation="alpha*beta")
+check("r1", "ab", 28.0)
+devsim.set_parameter(device=device, region="r1", name="beta", value=0.5)
+check("r1", "ab", 2.0)
+check_all((6.0, 4.0), (8.0, 0.5))
+print("parameter_symbols passed")
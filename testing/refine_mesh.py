@@ -0,0 +1,122 @@
+# Copyright 2026 DEVSIM LLC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+####
+#### refine_mesh.py
+#### the edges selected by an edge model are split, and the node solutions are interpolated onto the new nodes
+####
+import devsim
+
+equations = {2: "1 + 2*x - 3*y", 3: "1 + 2*x - 3*y + 4*z"}
+
+
+def create_2d(mesh):
+    devsim.create_2d_mesh(mesh=mesh)
+    for d in ("x", "y"):
+        devsim.add_2d_mesh_line(mesh=mesh, dir=d, pos=0.0, ps=0.25)
+        devsim.add_2d_mesh_line(mesh=mesh, dir=d, pos=1.0, ps=0.25)
+    devsim.add_2d_region(mesh=mesh, material="Si", region="r0", yl=0.0, yh=0.5)
+    devsim.add_2d_region(mesh=mesh, material="Ox", region="r1", yl=0.5, yh=1.0)
+    devsim.add_2d_interface(mesh=mesh, name="i0", region0="r0", region1="r1")
+    devsim.add_2d_contact(mesh=mesh, name="bot", region="r0", material="metal", yl=0.0, yh=0.0)
+    devsim.add_2d_contact(mesh=mesh, name="top", region="r1", material="metal", yl=1.0, yh=1.0)
+    devsim.finalize_mesh(mesh=mesh)
+    devsim.create_device(mesh=mesh, device=mesh)
+
+
+def create_3d(mesh):
+    devsim.create_3d_mesh(mesh=mesh)
+    for d in ("x", "y", "z"):
+        devsim.add_3d_mesh_line(mesh=mesh, dir=d, pos=0.0, ps=0.5)
+        devsim.add_3d_mesh_line(mesh=mesh, dir=d, pos=1.0, ps=0.5)
+    devsim.add_3d_region(mesh=mesh, material="Si", region="r0", zl=0.0, zh=0.5)
+    devsim.add_3d_region(mesh=mesh, material="Ox", region="r1", zl=0.5, zh=1.0)
+    devsim.add_3d_interface(mesh=mesh, name="i0", region0="r0", region1="r1")
+    devsim.add_3d_contact(mesh=mesh, name="bot", region="r0", material="metal", zl=0.0, zh=0.0)
+    devsim.add_3d_contact(mesh=mesh, name="top", region="r1", material="metal", zl=1.0, zh=1.0)
+    devsim.finalize_mesh(mesh=mesh)
+    devsim.create_device(mesh=mesh, device=mesh)
+
+
+def refine(device, refined, dimension):
+    # only the edges near the origin in the first region are selected
+    for region in ("r0", "r1"):
+        devsim.node_solution(device=device, region=region, name="Potential")
+        devsim.node_model(device=device, region=region, name="init", equation=equations[dimension])
+        devsim.set_node_values(device=device, region=region, name="Potential", init_from="init")
+    devsim.edge_from_node_model(device=device, region="r0", node_model="x")
+    devsim.edge_model(device=device, region="r0", name="indicator", equation="step(0.5 - x@n0)*step(0.5 - x@n1)")
+
+    devsim.refine_mesh(device=device, mesh=refined, edge_model="indicator", threshold=0.5)
+    devsim.create_device(mesh=refined, device=refined)
+
+
+def check(device, refined, dimension):
+    for region, volume in (("r0", 0.5), ("r1", 0.5)):
+        before = len(devsim.get_node_model_values(device=device, region=region, name="x"))
+        values = devsim.get_node_model_values(device=refined, region=region, name="Potential")
+        if len(values) <= before:
+            raise RuntimeError("%s %s has %d nodes" % (refined, region, len(values)))
+
+        # the solution is linear, so the interpolation is exact
+        devsim.node_model(device=refined, region=region, name="expected", equation=equations[dimension])
+        expected = devsim.get_node_model_values(device=refined, region=region, name="expected")
+        for i, (v, e) in enumerate(zip(values, expected)):
+            if abs(v - e) > 1e-12:
+                raise RuntimeError("%s %s node %d is %g, expected %g" % (refined, region, i, v, e))
+
+        total = sum(devsim.get_node_model_values(device=refined, region=region, name="NodeVolume"))
+        if abs(total - volume) > 1e-12:
+            raise RuntimeError("%s %s has volume %g" % (refined, region, total))
+
+        # every element side is shared by two elements, unless it is on the boundary of the region
+        sides = {}
+        elements = devsim.get_element_node_list(device=refined, region=region)
+        for element in elements:
+            for i in range(len(element)):
+                side = tuple(sorted(element[:i] + element[i + 1:]))
+                sides[side] = sides.get(side, 0) + 1
+        positions = [
+            devsim.get_node_model_values(device=refined, region=region, name=n)
+            for n in ("x", "y", "z")[:dimension]
+        ]
+        for side, count in sides.items():
+            coordinates = [[p[n] for n in side] for p in positions]
+            boundary = any(
+                (len(set(c)) == 1) and (c[0] in (0.0, 0.5, 1.0)) for c in coordinates
+            )
+            if (count > 2) or ((count == 1) and not boundary):
+                raise RuntimeError("%s %s has a hanging side %s" % (refined, region, side))
+
+        print("%s %s %d nodes from %d, %d elements" % (refined, region, len(values), before, len(elements)))
+
+    # the interface nodes are at the same positions in both regions
+    devsim.interface_model(device=refined, interface="i0", name="dx", equation="x@r0 - x@r1")
+    dx = devsim.get_interface_model_values(device=refined, interface="i0", name="dx")
+    if max(abs(v) for v in dx) != 0.0:
+        raise RuntimeError("%s interface nodes do not match" % refined)
+
+    for contact in ("bot", "top"):
+        elements = devsim.get_element_node_list(device=refined, region=("r0" if contact == "bot" else "r1"), contact=contact)
+        print("%s contact %s %d elements" % (refined, contact, len(elements)))
+    print("%s interface %d nodes" % (refined, len(dx)))
+
+
+create_2d("coarse2d")
+refine("coarse2d", "fine2d", 2)
+check("coarse2d", "fine2d", 2)
+
+# the default threshold of 0 splits every edge with a nonzero indicator, which is the same selection
+devsim.refine_mesh(device="coarse2d", mesh="default2d", edge_model="indicator")
+devsim.create_device(mesh="default2d", device="default2d")
+for region in ("r0", "r1"):
+    expected = len(devsim.get_node_model_values(device="fine2d", region=region, name="x"))
+    count = len(devsim.get_node_model_values(device="default2d", region=region, name="x"))
+    if count != expected:
+        raise RuntimeError("default2d %s has %d nodes, expected %d" % (region, count, expected))
+print("default threshold %d nodes" % count)
+
+create_3d("coarse3d")
+refine("coarse3d", "fine3d", 3)
+check("coarse3d", "fine3d", 3)
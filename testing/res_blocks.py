@@ -0,0 +1,56 @@
+# Copyright 2026 DEVSIM LLC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+####
+#### res_blocks.py
+#### uncoupled resistors are solved as separate blocks of the jacobian
+####
+import devsim
+import test_common
+
+region = "MyRegion"
+devices = {"r1": 1e16, "r2": 1e17, "r3": 1e18}
+
+test_common.CreateSimpleMesh("r1", region)
+for device in devices:
+    if device != "r1":
+        devsim.create_device(mesh="dog", device=device)
+
+devsim.set_parameter(name="threads_available", value=2)
+devsim.set_parameter(name="threads_task_size", value=2048)
+devsim.set_parameter(name="topbias", value=0.0)
+devsim.set_parameter(name="botbias", value=0.0)
+
+for device, net_doping in devices.items():
+    test_common.SetupResistorConstants(device, region)
+    test_common.SetupInitialResistorSystem(device, region, net_doping)
+    test_common.SetupInitialResistorContact(device=device, contact="top")
+    test_common.SetupInitialResistorContact(device=device, contact="bot")
+
+res = devsim.solve(
+    type="dc",
+    absolute_error=1.0,
+    relative_error=1e-10,
+    maximum_iterations=30,
+    info=True,
+)
+print("blocks %d" % res["number_of_blocks"])
+
+for device in devices:
+    test_common.SetupCarrierResistorSystem(device, region)
+    test_common.SetupCarrierResistorContact(device=device, contact="top")
+    test_common.SetupCarrierResistorContact(device=device, contact="bot")
+
+for v in (0.0, 0.05, 0.10):
+    devsim.set_parameter(name="topbias", value=v)
+    res = devsim.solve(
+        type="dc",
+        absolute_error=1.0,
+        relative_error=1e-10,
+        maximum_iterations=30,
+        info=True,
+    )
+    print("iterations %d" % len(res["iterations"]))
+    for device in devices:
+        test_common.printResistorCurrent(device=device, contact="top")
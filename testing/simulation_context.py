@@ -0,0 +1,78 @@
+# Copyright 2026 DEVSIM LLC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+####
+#### simulation_context.py
+#### solve two independent resistors concurrently in separate simulation contexts
+####
+import contextlib
+import io
+import threading
+
+import devsim
+import test_common
+import res1
+
+device = res1.device
+region = res1.region
+
+
+def run_resistor(context, net_doping, results):
+    devsim.set_simulation_context(name=context)
+    test_common.CreateSimpleMesh(device, region)
+    devsim.set_parameter(name="topbias", value=0.0)
+    devsim.set_parameter(name="botbias", value=0.0)
+    res1.run_initial_bias(False, net_doping)
+    for v in (0.0, 0.05, 0.10):
+        devsim.set_parameter(name="topbias", value=v)
+        devsim.solve(
+            type="dc", absolute_error=1.0, relative_error=1e-10, maximum_iterations=30
+        )
+        results.append(
+            (
+                v,
+                devsim.get_contact_current(
+                    device=device, contact="top", equation="ElectronContinuityEquation"
+                ),
+            )
+        )
+    devsim.set_simulation_context()
+
+
+contexts = {"lightly_doped": 1e16, "heavily_doped": 1e18}
+results = {}
+for c in contexts:
+    devsim.create_simulation_context(name=c)
+    results[c] = []
+
+print(devsim.get_simulation_context_list())
+
+# solver output from the threads would be interleaved
+with contextlib.redirect_stdout(io.StringIO()):
+    threads = [
+        threading.Thread(target=run_resistor, args=(c, contexts[c], results[c]))
+        for c in contexts
+    ]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+# the global context is unaffected
+print(devsim.get_simulation_context())
+print(devsim.get_device_list())
+
+for c in contexts:
+    print(c)
+    for v, i in results[c]:
+        print("%g\t%1.5e" % (v, i))
+
+for c in contexts:
+    devsim.set_simulation_context(name=c)
+    print(c, devsim.get_device_list())
+devsim.set_simulation_context()
+
+for c in contexts:
+    devsim.delete_simulation_context(name=c)
+print(devsim.get_simulation_context_list())
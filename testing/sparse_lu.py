@@ -0,0 +1,52 @@
+# Copyright 2026 DEVSIM LLC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+####
+#### sparse_lu.py
+#### 1d resistor with a circuit source solved with the sparse_lu direct solver
+#### the dc current and the small-signal circuit solution must match the default direct solver
+####
+import devsim
+import res1
+import test_common
+
+devsim.circuit_element(name="V1", n1="topbias", n2=0, acreal=1.0)
+test_common.CreateSimpleMesh(res1.device, res1.region)
+devsim.set_parameter(name="botbias", value=0.0)
+res1.run_initial_bias(use_circuit_bias=True)
+devsim.circuit_alter(name="V1", value=0.1)
+
+default_solver = devsim.get_parameter(name="direct_solver")
+
+results = {}
+for solver in (default_solver, "sparse_lu"):
+    devsim.set_parameter(name="direct_solver", value=solver)
+    devsim.set_node_values(
+        device=res1.device,
+        region=res1.region,
+        name="Electrons",
+        init_from="IntrinsicElectrons",
+    )
+    devsim.set_node_values(
+        device=res1.device, region=res1.region, name="Holes", init_from="IntrinsicHoles"
+    )
+    devsim.solve(
+        type="dc", absolute_error=1.0, relative_error=1e-10, maximum_iterations=30
+    )
+    current = devsim.get_contact_current(
+        device=res1.device, contact="top", equation="ElectronContinuityEquation"
+    )
+    devsim.solve(type="ac", frequency=1e6)
+    test_common.print_ac_circuit_solution()
+    results[solver] = [current] + [
+        devsim.get_circuit_node_value(solution=s, node=n)
+        for n in devsim.get_circuit_node_list()
+        for s in ("ssac_real", "ssac_imag")
+    ]
+
+devsim.set_parameter(name="direct_solver", value=default_solver)
+
+for x, y in zip(results[default_solver], results["sparse_lu"]):
+    if abs(x - y) > 1e-8 * max(abs(x), abs(y)) + 1e-30:
+        raise RuntimeError("sparse_lu changed the solution %g %g" % (x, y))
@@ -0,0 +1,91 @@
+# Copyright 2026 DEVSIM LLC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+####
+#### sparse_model.py
+#### models which are zero, or constant, on most of the nodes have the same values as dense models
+#### and are assembled with the same result
+####
+import devsim
+
+device = "MyDevice"
+region = "MyRegion"
+
+devsim.create_1d_mesh(mesh="dog")
+devsim.add_1d_mesh_line(mesh="dog", pos=0.0, ps=0.01, tag="top")
+devsim.add_1d_mesh_line(mesh="dog", pos=1.0, ps=0.01, tag="bot")
+devsim.add_1d_contact(mesh="dog", name="top", tag="top", material="metal")
+devsim.add_1d_contact(mesh="dog", name="bot", tag="bot", material="metal")
+devsim.add_1d_region(mesh="dog", material="Si", region=region, tag1="top", tag2="bot")
+devsim.finalize_mesh(mesh="dog")
+devsim.create_device(mesh="dog", device=device)
+
+x = devsim.get_node_model_values(device=device, region=region, name="x")
+
+
+def check(name, expected):
+    values = devsim.get_node_model_values(device=device, region=region, name=name)
+    if len(values) != len(expected):
+        raise RuntimeError("%s has %d values" % (name, len(values)))
+    for i, (v, e) in enumerate(zip(values, expected)):
+        if abs(v - e) > 1e-12 * max(1.0, abs(e)):
+            raise RuntimeError("%s[%d] is %g, expected %g" % (name, i, v, e))
+
+
+# zero background
+devsim.node_model(device=device, region=region, name="charge", equation="step(x-0.955)")
+charge = [1.0 if v > 0.955 else 0.0 for v in x]
+check("charge", charge)
+
+# constant background, and arithmetic with a sparse model
+devsim.node_model(device=device, region=region, name="shifted", equation="2*charge + 3")
+check("shifted", [2 * v + 3 for v in charge])
+
+devsim.node_model(device=device, region=region, name="product", equation="charge*shifted")
+check("product", [v * (2 * v + 3) for v in charge])
+
+devsim.node_model(device=device, region=region, name="dense", equation="charge + x")
+check("dense", [v + w for v, w in zip(charge, x)])
+
+# changing a value of a sparse model
+devsim.node_solution(device=device, region=region, name="sol")
+devsim.set_node_values(device=device, region=region, name="sol", values=charge)
+devsim.set_node_value(device=device, region=region, name="sol", index=0, value=5.0)
+check("sol", [5.0] + charge[1:])
+
+# a poisson equation where the source is only on a few of the nodes
+devsim.node_solution(device=device, region=region, name="Potential")
+devsim.edge_from_node_model(device=device, region=region, node_model="Potential")
+devsim.edge_model(device=device, region=region, name="Field", equation="(Potential@n0 - Potential@n1)*EdgeInverseLength")
+devsim.edge_model(device=device, region=region, name="Field:Potential@n0", equation="EdgeInverseLength")
+devsim.edge_model(device=device, region=region, name="Field:Potential@n1", equation="-EdgeInverseLength")
+devsim.equation(
+    device=device,
+    region=region,
+    name="PotentialEquation",
+    variable_name="Potential",
+    node_model="charge",
+    edge_model="Field",
+    variable_update="default",
+)
+for contact in ("top", "bot"):
+    devsim.contact_node_model(device=device, contact=contact, name="%s_bc" % contact, equation="Potential")
+    devsim.contact_node_model(device=device, contact=contact, name="%s_bc:Potential" % contact, equation="1")
+    devsim.contact_equation(device=device, contact=contact, name="PotentialEquation", node_model="%s_bc" % contact)
+
+devsim.solve(type="dc", absolute_error=1e-10, relative_error=1e-12, maximum_iterations=5)
+
+# the field is constant where there is no charge
+potential = devsim.get_node_model_values(device=device, region=region, name="Potential")
+slopes = [
+    (potential[i + 1] - potential[i]) / (x[i + 1] - x[i])
+    for i in range(len(x) - 1)
+    if x[i + 1] < 0.95
+]
+for s in slopes:
+    if abs(s - slopes[0]) > 1e-8 * abs(slopes[0]):
+        raise RuntimeError("slope %g differs from %g" % (s, slopes[0]))
+if abs(potential[0]) > 1e-12 or abs(potential[-1]) > 1e-12:
+    raise RuntimeError("contact potential is not zero")
+print("sparse_model passed")
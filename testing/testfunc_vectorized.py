@@ -0,0 +1,88 @@
+# Copyright 2026 DEVSIM LLC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+####
+#### testfunc_vectorized.py
+#### functions registered with vectorized=True are called once per model evaluation
+####
+from devsim import (
+    add_1d_contact,
+    add_1d_mesh_line,
+    add_1d_region,
+    create_1d_mesh,
+    create_device,
+    edge_model,
+    finalize_mesh,
+    get_edge_model_values,
+    get_node_model_values,
+    node_model,
+    print_node_values,
+    register_function,
+    symdiff,
+)
+
+import array
+import math
+
+device = "MyDevice"
+region = "MyRegion"
+
+create_1d_mesh(mesh="dog")
+add_1d_mesh_line(mesh="dog", pos=0.0, ps=0.1, tag="top")
+add_1d_mesh_line(mesh="dog", pos=1.0, ps=0.1, tag="bot")
+add_1d_contact(mesh="dog", name="top", material="metal", tag="top")
+add_1d_contact(mesh="dog", name="bot", material="metal", tag="bot")
+add_1d_region(mesh="dog", material="Si", region=region, tag1="top", tag2="bot")
+finalize_mesh(mesh="dog")
+create_device(mesh="dog", device=device)
+
+symdiff(expr="declare(ssin(x))")
+symdiff(expr="declare(vsin(x))")
+symdiff(expr="declare(vscale(x, y))")
+
+calls = {"ssin": 0, "vsin": 0, "vscale": 0}
+
+
+def ssin(x):
+    calls["ssin"] += 1
+    return math.sin(x)
+
+
+def vsin(x):
+    calls["vsin"] += 1
+    if isinstance(x, float):
+        return math.sin(x)
+    return array.array("d", [math.sin(v) for v in x])
+
+
+# a constant argument is passed as a float
+def vscale(x, y):
+    calls["vscale"] += 1
+    if isinstance(x, float):
+        return x * y
+    return [v * y for v in x]
+
+
+register_function(name="ssin", procedure=ssin, nargs=1)
+register_function(name="vsin", procedure=vsin, nargs=1, vectorized=True)
+register_function(name="vscale", procedure=vscale, nargs=2, vectorized=True)
+
+node_model(device=device, region=region, name="ssin", equation="ssin(x)")
+node_model(device=device, region=region, name="vsin", equation="vsin(x)")
+node_model(device=device, region=region, name="vscale", equation="vscale(x, 2)")
+node_model(device=device, region=region, name="vconst", equation="vsin(0.5)")
+edge_model(device=device, region=region, name="evsin", equation="vsin(EdgeLength)")
+
+print_node_values(device=device, region=region, name="vsin")
+print_node_values(device=device, region=region, name="vscale")
+print_node_values(device=device, region=region, name="vconst")
+
+s = get_node_model_values(device=device, region=region, name="ssin")
+v = get_node_model_values(device=device, region=region, name="vsin")
+print("max difference %g" % max([abs(a - b) for a, b in zip(s, v)]))
+e = get_edge_model_values(device=device, region=region, name="evsin")
+print("edge values %d %g" % (len(e), e[0]))
+print("nodes %d" % len(s))
+for k in sorted(calls.keys()):
+    print("%s calls %d" % (k, calls[k]))
@@ -0,0 +1,74 @@
+# Copyright 2026 DEVSIM LLC
+#
+# SPDX-License-Identifier: Apache-2.0
+
+####
+#### transient_pulse.py
+#### rc circuit driven by a pulse, the time steps must land on each corner of the pulse
+####
+import math
+
+import devsim
+import test_common
+
+devsim.circuit_element(name="V1", n1=1, n2=0, value=0.0)
+devsim.circuit_element(name="R1", n1=1, n2=2, value=1)
+devsim.circuit_element(name="C1", n1=2, n2=0, value=1e-3)
+
+td = 1e-3
+tr = 1e-4
+pw = 2e-3
+tf = 1e-4
+devsim.circuit_pulse(name="V1", v1=0.0, v2=1.0, td=td, tr=tr, tf=tf, pw=pw)
+
+devsim.solve(
+    type="transient_dc", absolute_error=1.0, relative_error=1e-14, maximum_iterations=3
+)
+
+times = []
+source = []
+
+
+def record(time):
+    times.append(time)
+    source.append(devsim.get_circuit_node_value(solution="dcop", node="1"))
+    print("time %1.6e" % time)
+    test_common.print_circuit_solution()
+
+
+info = devsim.solve_transient(
+    stop_time=5e-3,
+    tdelta=3e-4,
+    absolute_error=1.0,
+    relative_error=1e-14,
+    maximum_iterations=3,
+    callback=record,
+    info=True,
+)
+
+if not info["converged"]:
+    raise RuntimeError("transient did not converge")
+
+for b in (td, td + tr, td + tr + pw, td + tr + pw + tf, 5e-3):
+    if not any(math.isclose(t, b, rel_tol=1e-12) for t in times):
+        raise RuntimeError("break point %g was not a time point" % b)
+
+# the step after each corner restarts with BDF1
+points = info["points"]
+for i, p in enumerate(points[1:]):
+    prev = points[i]
+    if any(math.isclose(prev["time"], b, rel_tol=1e-12) for b in (td, td + tr)):
+        if p["method"] != "bdf1":
+            raise RuntimeError("expected bdf1 after break point %g" % prev["time"])
+
+# the source is at the top of the pulse at the end of the rise
+for t, v in zip(times, source):
+    if math.isclose(t, td + tr, rel_tol=1e-12) and not math.isclose(v, 1.0):
+        raise RuntimeError("source is %g at the end of the rise" % v)
+
+# a minimum step that is not positive would let a failing simulation halve its step forever
+try:
+    devsim.solve_transient(stop_time=6e-3, tdelta=3e-4, minimum_step=0.0)
+    raise RuntimeError("minimum_step of 0 was accepted")
+except devsim.error as x:
+    print(x)